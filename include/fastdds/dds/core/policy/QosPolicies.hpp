@@ -3005,6 +3005,7 @@ public:
         , domain_ids_(b.max_domains() != 0 ?
                 b.max_domains() :
                 b.domain_ids().size())
+        , listener_spin_budget_(b.listener_spin_budget())
     {
         domain_ids_ = b.domain_ids();
     }
@@ -3022,6 +3023,7 @@ public:
                 b.domain_ids().size());
         domain_ids_ = b.domain_ids();
         data_sharing_listener_thread_ = b.data_sharing_listener_thread();
+        listener_spin_budget_ = b.listener_spin_budget();
 
         return *this;
     }
@@ -3033,6 +3035,7 @@ public:
                shm_directory_ == b.shm_directory_ &&
                domain_ids_ == b.domain_ids_ &&
                data_sharing_listener_thread_ == b.data_sharing_listener_thread_ &&
+               listener_spin_budget_ == b.listener_spin_budget_ &&
                Parameter_t::operator ==(b) &&
                QosPolicy::operator ==(b);
     }
@@ -3240,6 +3243,33 @@ public:
         data_sharing_listener_thread_ = value;
     }
 
+    /**
+     * Getter for the spin budget of the DataSharing listener thread
+     *
+     * @return Maximum time, in microseconds, the listener busy-polls for new data before blocking.
+     *         0 means the listener always blocks.
+     */
+    uint32_t listener_spin_budget() const
+    {
+        return listener_spin_budget_;
+    }
+
+    /**
+     * Setter for the spin budget of the DataSharing listener thread
+     *
+     * When not 0, the listener thread busy-polls for new data up to this time before blocking on the notification.
+     * The actual spin time adapts to how often data arrives while spinning, never exceeding this value.
+     * Spinning avoids the wake-up of the listener thread at the cost of CPU usage, so it is usually combined with
+     * pinning the listener thread to a dedicated core through the affinity of @ref data_sharing_listener_thread.
+     *
+     * @param value Maximum spin time in microseconds. 0 disables spinning.
+     */
+    void listener_spin_budget(
+            uint32_t value)
+    {
+        listener_spin_budget_ = value;
+    }
+
 private:
 
     void setup(
@@ -3271,6 +3301,9 @@ private:
 
     //! Thread settings for the DataSharing listener thread
     rtps::ThreadSettings data_sharing_listener_thread_;
+
+    //! Maximum time, in microseconds, the DataSharing listener spins before blocking
+    uint32_t listener_spin_budget_ = 0;
 };
 
 
@@ -42,6 +42,7 @@
 #include <fastdds/rtps/common/Guid.hpp>
 #include <fastdds/rtps/common/SampleIdentity.hpp>
 #include <fastdds/rtps/common/Time_t.hpp>
+#include <fastdds/rtps/transport/SendQueueStatistics.hpp>
 
 namespace dds {
 namespace domain {
@@ -1084,6 +1085,16 @@ public:
 
     // DomainParticipant methods specific from Fast DDS
 
+    /**
+     * Retrieves the statistics of the send queues of the transport connections of this participant.
+     * Only the TCP transports configured with a non-zero TCPTransportDescriptor::send_queue_size report them.
+     *
+     * @param [out] statistics Reference to the vector where the statistics of each connection will be returned
+     * @return RETCODE_NOT_ENABLED if the participant has not been enabled, RETCODE_OK otherwise
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t get_send_queue_statistics(
+            std::vector<rtps::SendQueueStatistics>& statistics) const;
+
     /**
      * Register a type in this participant.
      *
@@ -0,0 +1,114 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryFileConsumer.hpp
+ *
+ */
+
+#ifndef FASTDDS_DDS_LOG__BINARYFILECONSUMER_HPP
+#define FASTDDS_DDS_LOG__BINARYFILECONSUMER_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <fastdds/dds/log/Log.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Log consumer that writes the log events to a file as compact binary records.
+ *
+ * Entries logged on structured mode are written with their arguments in binary form, so their text is never
+ * formatted for this consumer.
+ * Category, file and function names are written once, and referenced by an identifier afterwards.
+ * The resulting file can be turned back into text with method @c decode, or with the fastdds-log-decoder tool
+ * (built when CMake option COMPILE_LOG_DECODER is enabled).
+ *
+ * @file BinaryFileConsumer.hpp
+ */
+class BinaryFileConsumer : public LogConsumer
+{
+public:
+
+    //! Default constructor: filename = "output.blog", append = false.
+    FASTDDS_EXPORTED_API BinaryFileConsumer();
+
+    /** Constructor with parameters.
+     * @param filename path of the output file where the log will be written.
+     * @param append indicates if the consumer must append the content in the filename.
+     */
+    FASTDDS_EXPORTED_API BinaryFileConsumer(
+            const std::string& filename,
+            bool append = false);
+
+    virtual ~BinaryFileConsumer();
+
+    /** \internal
+     * Called by Log to ask us to consume the Entry.
+     * @param entry Log::Entry to consume.
+     */
+    FASTDDS_EXPORTED_API void Consume(
+            const Log::Entry& entry) override;
+
+    //! Entries are written with their arguments and timestamp in binary form.
+    FASTDDS_EXPORTED_API bool RequiresText() const override;
+
+    /** \internal
+     * Called by Log once the queued entries have been consumed, to write them to the file.
+     */
+    FASTDDS_EXPORTED_API void Flush() override;
+
+    /**
+     * Turns the records written by a BinaryFileConsumer back into text.
+     * Each entry is written in a line, with the same layout used by FileConsumer.
+     *
+     * @param input stream with the contents of the binary file.
+     * @param output stream where the text will be written.
+     * @param print_thread_ids whether to add the identifier of the logging thread to each line.
+     *
+     * @return false if the input is not a binary log file, or it is malformed.
+     */
+    FASTDDS_EXPORTED_API static bool decode(
+            std::istream& input,
+            std::ostream& output,
+            bool print_thread_ids = false);
+
+private:
+
+    //! Returns the identifier of a name, writing its definition the first time it is found.
+    uint32_t name_id(
+            const char* name);
+
+    std::string output_file_;
+    std::ofstream file_;
+    bool append_;
+
+    //! Identifiers of the names already written to the file
+    std::map<std::string, uint32_t> name_ids_;
+
+    //! Buffer where records are built before writing them
+    std::string record_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_DDS_LOG__BINARYFILECONSUMER_HPP
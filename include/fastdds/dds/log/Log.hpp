@@ -15,9 +15,11 @@
 #ifndef FASTDDS_DDS_LOG__LOG_HPP
 #define FASTDDS_DDS_LOG__LOG_HPP
 
+#include <cstdint>
 #include <regex>
 #include <sstream>
 
+#include <fastdds/dds/log/StructuredLogRecord.hpp>
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/fastdds_dll.hpp>
 
@@ -93,6 +95,18 @@ public:
         Info,
     };
 
+    /**
+     * Behavior when an entry is logged while the log queue is full.
+     * * DropNewest: The new entry is discarded and accounted on the dropped entries counter.
+     * * Block: The calling thread waits until there is room on the queue, so no entry is lost. Default.
+     *   Entries logged by a consumer, i.e. from the logging thread, are still dropped when the queue is full.
+     */
+    enum OverflowPolicy
+    {
+        DropNewest,
+        Block,
+    };
+
     /**
      * Registers an user defined consumer to route log output.
      * There is a default stdout consumer active as default.
@@ -119,6 +133,27 @@ public:
     //! Returns the current verbosity level.
     FASTDDS_EXPORTED_API static Log::Kind GetVerbosity();
 
+    //! Sets the policy to apply when logging an entry while the log queue is full.
+    FASTDDS_EXPORTED_API static void SetOverflowPolicy(
+            Log::OverflowPolicy);
+
+    //! Returns the current overflow policy.
+    FASTDDS_EXPORTED_API static Log::OverflowPolicy GetOverflowPolicy();
+
+    //! Returns the number of entries dropped because the log queue was full.
+    FASTDDS_EXPORTED_API static uint64_t GetDroppedEntries();
+
+    /**
+     * Enables or disables the structured mode.
+     * On structured mode, the arguments of the log macros are captured in binary form, and the text of the message
+     * is only formatted on the logging thread.
+     */
+    FASTDDS_EXPORTED_API static void SetStructuredMode(
+            bool enabled);
+
+    //! Returns whether the structured mode is enabled.
+    FASTDDS_EXPORTED_API static bool GetStructuredMode();
+
     //! Sets a filter that will pattern-match against log categories, dropping any unmatched categories.
     FASTDDS_EXPORTED_API static void SetCategoryFilter(
             const std::regex&);
@@ -176,6 +211,12 @@ public:
         Log::Context context;
         Log::Kind kind;
         std::string timestamp;
+        //! Arguments captured on structured mode, encoded as described on StructuredLogRecord. Empty otherwise.
+        std::string arguments;
+        //! Nanoseconds since epoch at the time the entry was logged.
+        int64_t timestamp_ns = 0;
+        //! Identifier of the thread that logged the entry.
+        uint64_t thread_id = 0;
     };
 
     /**
@@ -190,6 +231,14 @@ public:
             const std::string& message,
             const Log::Context&,
             Log::Kind);
+
+    /**
+     * Not recommended to call this method directly! Use the log macros with the structured mode enabled.
+     */
+    FASTDDS_EXPORTED_API static void QueueLog(
+            StructuredLogRecord& record,
+            const Log::Context&,
+            Log::Kind);
 };
 
 //! Streams Log::Kind serialization
@@ -230,6 +279,23 @@ public:
     virtual void Consume(
             const Log::Entry&) = 0;
 
+    /**
+     * Whether this consumer reads the text fields of the entries, i.e. the message and timestamp strings.
+     * Those fields are only formatted on the logging thread when a consumer requires them.
+     */
+    virtual bool RequiresText() const
+    {
+        return true;
+    }
+
+    /**
+     * Called by the logging thread each time it has consumed the queued entries, and so before Log::Flush returns.
+     * Consumers buffering their output should write it here.
+     */
+    virtual void Flush()
+    {
+    }
+
 protected:
 
     FASTDDS_EXPORTED_API void print_timestamp(
@@ -281,6 +347,24 @@ protected:
 * It is a risk that a user takes in exchange of a perfect way of non generating code in such cases.
 ********************/
 
+// Builds the entry on the calling thread, capturing the arguments in binary form when on structured mode
+#define EPROSIMA_LOG_QUEUE_IMPL_(cat, msg, kind)                                                                      \
+    if (eprosima::fastdds::dds::Log::GetStructuredMode())                                                             \
+    {                                                                                                                 \
+        eprosima::fastdds::dds::StructuredLogRecord fastdds_log_rec_tmp__;                                            \
+        fastdds_log_rec_tmp__ << msg;                                                                                 \
+        eprosima::fastdds::dds::Log::QueueLog(                                                                        \
+            fastdds_log_rec_tmp__, eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat}, kind);   \
+    }                                                                                                                 \
+    else                                                                                                              \
+    {                                                                                                                 \
+        std::stringstream fastdds_log_ss_tmp__;                                                                       \
+        fastdds_log_ss_tmp__ << msg;                                                                                  \
+        eprosima::fastdds::dds::Log::QueueLog(                                                                        \
+            fastdds_log_ss_tmp__.str(), eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat},     \
+            kind);                                                                                                    \
+    }
+
 /*********
 * ERROR *
 *********/
@@ -289,11 +373,7 @@ protected:
 
 #define EPROSIMA_LOG_ERROR_IMPL_(cat, msg)                                                                             \
     do {                                                                                                               \
-        std::stringstream fastdds_log_ss_tmp__;                                                                        \
-        fastdds_log_ss_tmp__ << msg;                                                                                   \
-        eprosima::fastdds::dds::Log::QueueLog(                                                                         \
-            fastdds_log_ss_tmp__.str(), eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat},      \
-            eprosima::fastdds::dds::Log::Kind::Error);                                                                 \
+        EPROSIMA_LOG_QUEUE_IMPL_(cat, msg, eprosima::fastdds::dds::Log::Kind::Error)                                   \
     } while (0)
 
 #elif (__INTERNALDEBUG || _INTERNALDEBUG)
@@ -322,11 +402,7 @@ protected:
     do {                                                                                                              \
         if (eprosima::fastdds::dds::Log::GetVerbosity() >= eprosima::fastdds::dds::Log::Kind::Warning)                \
         {                                                                                                             \
-            std::stringstream fastdds_log_ss_tmp__;                                                                   \
-            fastdds_log_ss_tmp__ << msg;                                                                              \
-            eprosima::fastdds::dds::Log::QueueLog(                                                                    \
-                fastdds_log_ss_tmp__.str(), eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat}, \
-                eprosima::fastdds::dds::Log::Kind::Warning);                                                          \
+            EPROSIMA_LOG_QUEUE_IMPL_(cat, msg, eprosima::fastdds::dds::Log::Kind::Warning)                            \
         }                                                                                                             \
     } while (0)
 
@@ -361,11 +437,7 @@ protected:
     do {                                                                                                              \
         if (eprosima::fastdds::dds::Log::GetVerbosity() >= eprosima::fastdds::dds::Log::Kind::Info)                   \
         {                                                                                                             \
-            std::stringstream fastdds_log_ss_tmp__;                                                                   \
-            fastdds_log_ss_tmp__ << msg;                                                                              \
-            eprosima::fastdds::dds::Log::QueueLog(                                                                    \
-                fastdds_log_ss_tmp__.str(), eprosima::fastdds::dds::Log::Context{__FILE__, __LINE__, __func__, #cat}, \
-                eprosima::fastdds::dds::Log::Kind::Info);                                                             \
+            EPROSIMA_LOG_QUEUE_IMPL_(cat, msg, eprosima::fastdds::dds::Log::Kind::Info)                               \
         }                                                                                                             \
     } while (0)
 
@@ -0,0 +1,251 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StructuredLogRecord.hpp
+ *
+ */
+
+#ifndef FASTDDS_DDS_LOG__STRUCTUREDLOGRECORD_HPP
+#define FASTDDS_DDS_LOG__STRUCTUREDLOGRECORD_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <fastdds/fastdds_dll.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Captures the arguments streamed into a log macro as a compact binary sequence, so they can be formatted later
+ * from the logging thread, or offline.
+ *
+ * Integral, floating point, character and string arguments are captured as they are.
+ * Any other argument, including stream manipulators, makes the record fall back to text for the rest of the message,
+ * so the final text is the same that would have been obtained streaming the arguments into a std::stringstream.
+ *
+ * Each argument is encoded as a one byte tag followed by its value in little endian:
+ * * SIGNED_INTEGER: 8 bytes two's complement.
+ * * UNSIGNED_INTEGER: 8 bytes.
+ * * FLOATING_POINT: 8 bytes IEEE 754 binary64.
+ * * CHARACTER: 1 byte.
+ * * STRING: 4 bytes length followed by the characters.
+ */
+class StructuredLogRecord
+{
+public:
+
+    //! Tags identifying the type of each encoded argument
+    enum ArgumentTag : uint8_t
+    {
+        SIGNED_INTEGER = 'i',
+        UNSIGNED_INTEGER = 'u',
+        FLOATING_POINT = 'f',
+        CHARACTER = 'c',
+        STRING = 's'
+    };
+
+    StructuredLogRecord()
+    {
+        arguments_.reserve(64);
+    }
+
+    StructuredLogRecord(
+            const StructuredLogRecord&) = delete;
+    StructuredLogRecord& operator =(
+            const StructuredLogRecord&) = delete;
+
+    StructuredLogRecord& operator <<(
+            const char* value)
+    {
+        if (text_)
+        {
+            *text_ << value;
+        }
+        else
+        {
+            append_string(value, value ? std::strlen(value) : 0);
+        }
+        return *this;
+    }
+
+    StructuredLogRecord& operator <<(
+            char* value)
+    {
+        return *this << static_cast<const char*>(value);
+    }
+
+    StructuredLogRecord& operator <<(
+            const std::string& value)
+    {
+        if (text_)
+        {
+            *text_ << value;
+        }
+        else
+        {
+            append_string(value.data(), value.size());
+        }
+        return *this;
+    }
+
+    StructuredLogRecord& operator <<(
+            std::ostream& (*manipulator)(std::ostream&))
+    {
+        text() << manipulator;
+        return *this;
+    }
+
+    StructuredLogRecord& operator <<(
+            std::ios_base& (*manipulator)(std::ios_base&))
+    {
+        text() << manipulator;
+        return *this;
+    }
+
+    template<typename T>
+    StructuredLogRecord& operator <<(
+            const T& value)
+    {
+        append(value, std::integral_constant<bool,
+                std::is_arithmetic<T>::value && !std::is_same<T, long double>::value>());
+        return *this;
+    }
+
+    /**
+     * Returns the encoded arguments.
+     * Pending text, if any, is appended as a final string argument.
+     */
+    const std::string& arguments()
+    {
+        if (text_)
+        {
+            std::unique_ptr<std::ostringstream> text;
+            text.swap(text_);
+            *this << text->str();
+        }
+        return arguments_;
+    }
+
+    /**
+     * Formats a sequence of encoded arguments into a stream.
+     *
+     * @param arguments  Encoded arguments, as returned by @c arguments.
+     * @param output     Stream where the text will be written.
+     *
+     * @return false if the encoded arguments are malformed.
+     */
+    FASTDDS_EXPORTED_API static bool render(
+            const std::string& arguments,
+            std::ostream& output);
+
+private:
+
+    template<typename T>
+    void append(
+            const T& value,
+            std::true_type /*is_arithmetic*/)
+    {
+        if (text_)
+        {
+            *text_ << value;
+        }
+        else if (std::is_same<T, char>::value || std::is_same<T, signed char>::value ||
+                std::is_same<T, unsigned char>::value)
+        {
+            arguments_.push_back(static_cast<char>(CHARACTER));
+            arguments_.push_back(static_cast<char>(value));
+        }
+        else if (std::is_floating_point<T>::value)
+        {
+            double d = static_cast<double>(value);
+            uint64_t bits = 0;
+            std::memcpy(&bits, &d, sizeof(bits));
+            append_u64(FLOATING_POINT, bits);
+        }
+        else if (std::is_signed<T>::value)
+        {
+            append_u64(SIGNED_INTEGER, static_cast<uint64_t>(static_cast<int64_t>(value)));
+        }
+        else
+        {
+            append_u64(UNSIGNED_INTEGER, static_cast<uint64_t>(value));
+        }
+    }
+
+    template<typename T>
+    void append(
+            const T& value,
+            std::false_type /*is_arithmetic*/)
+    {
+        text() << value;
+    }
+
+    void append_u64(
+            ArgumentTag tag,
+            uint64_t value)
+    {
+        char buffer[9];
+        buffer[0] = static_cast<char>(tag);
+        for (size_t i = 0; i < 8; ++i)
+        {
+            buffer[i + 1] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+        arguments_.append(buffer, sizeof(buffer));
+    }
+
+    void append_string(
+            const char* value,
+            size_t length)
+    {
+        char buffer[5];
+        uint32_t length32 = static_cast<uint32_t>(length);
+        buffer[0] = static_cast<char>(STRING);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            buffer[i + 1] = static_cast<char>((length32 >> (8 * i)) & 0xFF);
+        }
+        arguments_.append(buffer, sizeof(buffer));
+        arguments_.append(value, length32);
+    }
+
+    //! Switches to text mode, rendering the arguments captured so far.
+    std::ostream& text()
+    {
+        if (!text_)
+        {
+            text_.reset(new std::ostringstream());
+            render(arguments_, *text_);
+            arguments_.clear();
+        }
+        return *text_;
+    }
+
+    std::string arguments_;
+
+    std::unique_ptr<std::ostringstream> text_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_DDS_LOG__STRUCTUREDLOGRECORD_HPP
@@ -315,6 +315,10 @@ public:
      *
      * @param max_wait Maximum blocking time for this operation
      * @return RETCODE_OK if the DataWriter receive the acknowledgments before the time expires and RETCODE_ERROR otherwise
+     *
+     * @note When the SQLite3 persistence service is used with the `dds.persistence.sqlite3.write_behind` property,
+     * acknowledged samples may not be stored in the database yet. Samples written up to one flush interval before an
+     * abrupt termination of the process may be lost.
      */
     FASTDDS_EXPORTED_API ReturnCode_t wait_for_acknowledgments(
             const fastdds::dds::Duration_t& max_wait);
@@ -582,6 +586,10 @@ public:
      *         or the key is not consistent with `handle`.
      * @return RETCODE_OK if the DataWriter received the acknowledgments before the time expired.
      * @return RETCODE_TIMEOUT otherwise.
+     *
+     * @note When the SQLite3 persistence service is used with the `dds.persistence.sqlite3.write_behind` property,
+     * acknowledged samples may not be stored in the database yet. Samples written up to one flush interval before an
+     * abrupt termination of the process may be lost.
      */
     FASTDDS_EXPORTED_API ReturnCode_t wait_for_acknowledgments(
             const void* const instance,
@@ -461,7 +461,9 @@ public:
 #endif // if HAVE_SECURITY
                (this->discovery_server_thread == b.discovery_server_thread) &&
                (this->typelookup_service_thread == b.typelookup_service_thread) &&
-               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads);
+               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads) &&
+               (this->writer_send_threads == b.writer_send_threads) &&
+               (this->writer_send_threads_number == b.writer_send_threads_number);
 
     }
 
@@ -579,6 +581,19 @@ public:
     //! Thread settings for the builtin transports reception threads
     fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
 
+    //! Thread settings for the threads used by writers to send to their matched readers in parallel
+    fastdds::rtps::ThreadSettings writer_send_threads;
+
+    /*! Number of threads used by writers to send to their matched readers in parallel.
+     * They are only used by writers sending a separate message to each reader
+     * (WriterAttributes::separate_sending), to send periodic heartbeats and, when their flow controller does not
+     * limit the sent bytes, changes to remote readers.
+     * Local and data-sharing readers, liveliness heartbeats and writers with protected submessages or payloads are
+     * always served on the calling thread.
+     * Zero (default) disables parallel sending.
+     */
+    uint32_t writer_send_threads_number = 0;
+
 #if HAVE_SECURITY
     //! Thread settings for the security log thread
     fastdds::rtps::ThreadSettings security_log_thread;
@@ -93,6 +93,9 @@ public:
 
     //! Thread settings for the data-sharing listener thread
     fastdds::rtps::ThreadSettings data_sharing_listener_thread {};
+
+    //! Maximum time, in microseconds, the data-sharing listener spins for new data before blocking (0 to always block)
+    uint32_t data_sharing_listener_spin_budget = 0;
 };
 
 } // namespace rtps
@@ -55,6 +55,22 @@ struct FlowControllerDescriptor
     //! Default value: 100ms.
     uint64_t period_ms = 100;
 
+    //! Depth in bytes of the token bucket used to pace the sent data.
+    //!
+    //! Maximum number of bytes that can be sent to network in a single burst.
+    //! The token bucket is used when both token_bucket_depth and token_bucket_refill_rate are not 0, and then
+    //! max_bytes_per_period and period_ms are ignored.
+    //! 0 value means no token bucket.
+    //! Default value: 0
+    uint32_t token_bucket_depth = 0;
+
+    //! Refill rate of the token bucket in bytes per second.
+    //!
+    //! The bucket is refilled continuously, with microsecond resolution.
+    //! 0 value means no token bucket.
+    //! Default value: 0
+    uint64_t token_bucket_refill_rate = 0;
+
     //! Thread settings for the sender thread
     ThreadSettings sender_thread;
 
@@ -65,6 +81,8 @@ struct FlowControllerDescriptor
                (this->scheduler == b.scheduler) &&
                (this->max_bytes_per_period == b.max_bytes_per_period) &&
                (this->period_ms == b.period_ms) &&
+               (this->token_bucket_depth == b.token_bucket_depth) &&
+               (this->token_bucket_refill_rate == b.token_bucket_refill_rate) &&
                (this->sender_thread == b.sender_thread);
     }
 
@@ -37,7 +37,10 @@ enum class FlowControllerSchedulerPolicy : int32_t
     HIGH_PRIORITY,
     //! Priority with reservation scheduler policy: guarantee each DataWriter's minimum reservation of throughput.
     //! Samples not fitting the reservation are scheduled by priority.
-    PRIORITY_WITH_RESERVATION
+    PRIORITY_WITH_RESERVATION,
+    //! Deficit round robin scheduler policy: schedules DataWriters in circular order, sharing the sent bytes between
+    //! them according to their weights.
+    DEFICIT_ROUND_ROBIN
 };
 
 } // namespace rtps
@@ -85,6 +85,30 @@ public:
             const uint32_t& total_bytes,
             std::chrono::steady_clock::time_point max_blocking_time_point) const = 0;
 
+    /**
+     * Send a train of messages of the same size through this interface.
+     * Transports supporting it send the whole train in a single operation. By default, each message is sent on its
+     * own.
+     *
+     * @param buffers Vector of NetworkBuffers of all the messages. Each message ends at the end of a buffer.
+     * @param total_bytes Total number of bytes to send. Should be equal to the sum of the @c size field of all buffers.
+     * @param segment_size Size of each message, except the last one, which may be smaller.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    virtual bool send_segments(
+            const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+            const uint32_t& total_bytes,
+            uint32_t segment_size,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const
+    {
+        static_cast<void>(total_bytes);
+        return for_each_segment(buffers, segment_size,
+                       [&](const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& segment, uint32_t segment_bytes)
+                       {
+                           return send(segment, segment_bytes, max_blocking_time_point);
+                       });
+    }
+
     /*!
      * Lock the object.
      */
@@ -30,6 +30,7 @@
 #include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/builtin/data/ParticipantBuiltinTopicData.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/transport/SendQueueStatistics.hpp>
 #include <fastdds/statistics/IListeners.hpp>
 #include <fastdds/fastdds_dll.hpp>
 
@@ -322,6 +323,15 @@ public:
      */
     std::vector<TransportNetmaskFilterInfo> get_netmask_filter_info() const;
 
+    /**
+     * @brief Returns the statistics of the send queues of the connections of the registered transports.
+     *
+     * Only the TCP transports configured with a non-zero TCPTransportDescriptor::send_queue_size report them.
+     *
+     * @return A vector with the send queue statistics of each connection.
+     */
+    std::vector<SendQueueStatistics> get_send_queue_statistics() const;
+
     /**
      * @brief Fills the provided publication discovery data with the information of the
      * writer identified by writer_guid.
@@ -185,6 +185,25 @@ public:
         return low_level_transport_->netmask_filter_info();
     }
 
+    /*!
+     * Call the low-level transport `send_queue_statistics()`.
+     * Returns the statistics of the send queues of the connections of the transport, if it uses them
+     */
+    FASTDDS_EXPORTED_API std::vector<SendQueueStatistics> send_queue_statistics() const override
+    {
+        return low_level_transport_->send_queue_statistics();
+    }
+
+    /*!
+     * Call the low-level transport `max_concurrent_receptions()`.
+     * Reports how many threads may deliver data concurrently on the input channel opened for a locator.
+     */
+    FASTDDS_EXPORTED_API uint32_t max_concurrent_receptions(
+            const fastdds::rtps::Locator_t& locator) const override
+    {
+        return low_level_transport_->max_concurrent_receptions(locator);
+    }
+
     /*!
      * Call the low-level transport `DoInputLocatorsMatch()`.
      * Must report whether two locators map to the same internal channel.
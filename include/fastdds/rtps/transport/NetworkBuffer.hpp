@@ -20,6 +20,7 @@
 #define FASTDDS_RTPS_TRANSPORT__NETWORKBUFFER_HPP
 
 #include <cstdint>
+#include <vector>
 
 namespace asio {
 // Forward declaration of asio::const_buffer
@@ -55,6 +56,45 @@ struct NetworkBuffer final
     operator asio::const_buffer() const;
 };
 
+/**
+ * Splits a train of messages of the same size into the buffers of each message.
+ *
+ * @param buffers Buffers of all the messages. Each message ends at the end of a buffer.
+ * @param segment_size Size of each message, except the last one, which may be smaller.
+ * @param functor Called with the buffers and the size of each message, returning whether it succeeded.
+ * @return true when the functor succeeded for all the messages.
+ */
+template<typename Functor>
+bool for_each_segment(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t segment_size,
+        Functor functor)
+{
+    bool ret = true;
+    std::vector<NetworkBuffer> segment;
+    uint32_t segment_bytes = 0;
+
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        segment.push_back(buffer);
+        segment_bytes += buffer.size;
+
+        if (segment_bytes >= segment_size)
+        {
+            ret &= functor(segment, segment_bytes);
+            segment.clear();
+            segment_bytes = 0;
+        }
+    }
+
+    if (!segment.empty())
+    {
+        ret &= functor(segment, segment_bytes);
+    }
+
+    return ret;
+}
+
 }  // namespace rtps
 }  // namespace fastdds
 }  // namespace eprosima
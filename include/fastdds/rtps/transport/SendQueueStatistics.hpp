@@ -0,0 +1,54 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SendQueueStatistics.hpp
+ */
+
+#ifndef FASTDDS_RTPS_TRANSPORT__SENDQUEUESTATISTICS_HPP
+#define FASTDDS_RTPS_TRANSPORT__SENDQUEUESTATISTICS_HPP
+
+#include <cstdint>
+
+#include <fastdds/rtps/common/Locator.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Statistics of the send queue of a transport connection.
+ * Currently filled by the TCP transports when TCPTransportDescriptor::send_queue_size is not zero.
+ */
+struct SendQueueStatistics
+{
+    //! Physical locator of the remote end of the connection
+    Locator remote_locator;
+    //! Number of messages currently waiting on the queue
+    uint32_t current_depth = 0;
+    //! Maximum number of messages that have been waiting on the queue at the same time
+    uint32_t max_depth = 0;
+    //! Number of messages added to the queue
+    uint64_t enqueued_messages = 0;
+    //! Number of messages discarded because the queue was full
+    uint64_t dropped_messages = 0;
+    //! Number of gathered writes performed on the socket
+    uint64_t coalesced_writes = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_TRANSPORT__SENDQUEUESTATISTICS_HPP
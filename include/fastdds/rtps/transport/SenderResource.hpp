@@ -72,6 +72,35 @@ public:
                        max_blocking_time_point);
     }
 
+    /**
+     * Sends a train of messages of the same size in a single operation, through the channel managed by this
+     * resource. Only available when @c supports_segments returns true.
+     * @param buffers Vector of buffers of all the messages. Each message ends at the end of a buffer.
+     * @param total_bytes Length of all buffers to be sent.
+     * @param segment_size Length of each message, except the last one, which may be smaller.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point If transport supports it then it will use it as maximum blocking time.
+     * @return Success of the send operation.
+     */
+    bool send_segments(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        return send_segments_lambda_(buffers, total_bytes, segment_size, destination_locators_begin,
+                       destination_locators_end, max_blocking_time_point);
+    }
+
+    //! Whether the transport can send a train of messages in a single operation.
+    bool supports_segments() const
+    {
+        return static_cast<bool>(send_segments_lambda_);
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -81,6 +110,7 @@ public:
     {
         clean_up.swap(rValueResource.clean_up);
         send_buffers_lambda_.swap(rValueResource.send_buffers_lambda_);
+        send_segments_lambda_.swap(rValueResource.send_segments_lambda_);
     }
 
     virtual ~SenderResource() = default;
@@ -120,6 +150,14 @@ protected:
                 LocatorsIterator* destination_locators_end,
                 const std::chrono::steady_clock::time_point&)> send_buffers_lambda_;
 
+    std::function<bool(
+                const std::vector<NetworkBuffer>&,
+                uint32_t,
+                uint32_t,
+                LocatorsIterator* destination_locators_begin,
+                LocatorsIterator* destination_locators_end,
+                const std::chrono::steady_clock::time_point&)> send_segments_lambda_;
+
 private:
 
     SenderResource()                                 = delete;
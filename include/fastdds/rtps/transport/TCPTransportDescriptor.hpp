@@ -301,6 +301,19 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
      */
     bool non_blocking_send;
 
+    /**
+     * Maximum number of messages waiting on the send queue of each connection.
+     *
+     * When greater than zero, calls to send() copy the message into a per-connection queue and return
+     * immediately. A dedicated thread per connection writes all the queued messages to the socket with a single
+     * gathered write. When the queue is full, the message is dropped if @c non_blocking_send is true, or the
+     * caller waits until there is room in the queue otherwise. Plain and TLS connections are supported. The
+     * statistics of the queue of each connection can be retrieved with DomainParticipant::get_send_queue_statistics().
+     *
+     * Zero value disables the queue, and messages are written to the socket by the calling thread (default).
+     */
+    uint32_t send_queue_size;
+
     //! Add listener port to the listening_ports list
     void add_listener_port(
             uint16_t port)
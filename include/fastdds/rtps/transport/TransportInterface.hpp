@@ -33,6 +33,7 @@
 #include <fastdds/rtps/transport/network/AllowedNetworkInterface.hpp>
 #include <fastdds/rtps/transport/network/NetmaskFilterKind.hpp>
 #include <fastdds/rtps/transport/SenderResource.hpp>
+#include <fastdds/rtps/transport/SendQueueStatistics.hpp>
 #include <fastdds/rtps/transport/TransportDescriptorInterface.hpp>
 #include <fastdds/rtps/transport/TransportReceiverInterface.hpp>
 
@@ -328,6 +329,29 @@ public:
         return {NetmaskFilterKind::AUTO, {}};
     }
 
+    //! Returns the statistics of the send queues of the connections of the transport, if it uses them
+    virtual std::vector<SendQueueStatistics> send_queue_statistics() const
+    {
+        return {};
+    }
+
+    /**
+     * Reports how many threads may deliver data concurrently on the input channel opened for a locator.
+     *
+     * When greater than 1, the receiver registered on the channel may be called from several threads at the same
+     * time, and the upper layer can register that many independent message receivers to process them in parallel.
+     *
+     * @param locator Locator used to open the input channel.
+     *
+     * @return The maximum number of concurrent reception threads of the channel.
+     */
+    virtual uint32_t max_concurrent_receptions(
+            const Locator& locator) const
+    {
+        static_cast<void>(locator);
+        return 1u;
+    }
+
 protected:
 
     TransportInterface(
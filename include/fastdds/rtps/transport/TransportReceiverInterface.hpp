@@ -26,6 +26,20 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+/**
+ * Description of a datagram received as part of a batch.
+ * @ingroup TRANSPORT_MODULE
+ */
+struct ReceivedDatagram
+{
+    //! Pointer to the received data.
+    const fastdds::rtps::octet* data = nullptr;
+    //! Number of bytes received.
+    uint32_t size = 0;
+    //! Locator identifying the remote endpoint.
+    Locator remote_locator;
+};
+
 /**
  * Interface against which to implement a data receiver, decoupled from transport internals.
  * @ingroup TRANSPORT_MODULE
@@ -49,6 +63,24 @@ public:
             const uint32_t size,
             const Locator& local_locator,
             const Locator& remote_locator) = 0;
+
+    /**
+     * Method to be called by the transport when receiving several datagrams at once.
+     * The default implementation calls @ref OnDataReceived for each datagram, in order.
+     * @param datagrams Pointer to the first received datagram.
+     * @param count Number of datagrams received.
+     * @param local_locator Locator identifying the local endpoint.
+     */
+    virtual void OnDataBatchReceived(
+            const ReceivedDatagram* datagrams,
+            const uint32_t count,
+            const Locator& local_locator)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            OnDataReceived(datagrams[i].data, datagrams[i].size, local_locator, datagrams[i].remote_locator);
+        }
+    }
 };
 
 } // namespace rtps
@@ -36,6 +36,14 @@ namespace rtps {
  * immediately if the buffer is full, but no error will be returned to the upper layer. This means that the
  * application will behave as if the datagram is sent and lost.
  *
+ * - \c datagrams_per_batch: maximum number of datagrams handled on each socket operation.
+ *
+ * - \c generic_receive_offload: let the kernel coalesce incoming datagrams of the same flow.
+ *
+ * - \c generic_segmentation_offload: let the kernel split a train of equal-size outgoing datagrams.
+ *
+ * - \c unicast_receive_threads: number of sockets, each with its own reception thread, sharing each unicast port.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct UDPTransportDescriptor : public SocketTransportDescriptor
@@ -73,6 +81,57 @@ struct UDPTransportDescriptor : public SocketTransportDescriptor
      * datagram. This may hinder performance on high-frequency writers.
      */
     bool non_blocking_send = false;
+
+    /**
+     * Maximum number of datagrams to handle on each socket operation.
+     *
+     * When set to a value greater than 1, reception uses recvmmsg() on a ring of this many receive buffers,
+     * delivering all the datagrams available in a single call to the receiver, and sending a message to
+     * several destinations uses a single sendmmsg() call for up to this many destinations.
+     * This reduces the per-datagram system call overhead on high-throughput scenarios, at the cost of
+     * reserving @c datagrams_per_batch times @c maxMessageSize bytes of memory for each input channel.
+     *
+     * Values of 0 and 1 disable batching. Batching is only available on Linux, and is ignored elsewhere.
+     */
+    uint32_t datagrams_per_batch = 1;
+
+    /**
+     * Whether to enable UDP generic receive offload (UDP_GRO) on input sockets.
+     *
+     * When set to true, the kernel may deliver a burst of equal-size datagrams from the same sender (e.g. the
+     * DATA_FRAG messages of a large sample) as a single buffer, which is split back into the original datagrams
+     * before being processed. This reduces the per-datagram cost of receiving large fragmented samples, at the
+     * cost of reserving 64 KB receive buffers.
+     *
+     * Only available on Linux, and ignored elsewhere.
+     */
+    bool generic_receive_offload = false;
+
+    /**
+     * Whether to enable UDP generic segmentation offload (UDP_SEGMENT) on output sockets.
+     *
+     * When set to true, the consecutive equal-size messages built by a writer (e.g. the DATA_FRAG messages of a
+     * large sample) are handed to the kernel as a single train on each socket operation, and split back into the
+     * original datagrams by the kernel or the network card. This reduces the per-datagram cost of sending large
+     * fragmented samples. Each datagram of a train must fit in the MTU of the route, so it is meant to be used with
+     * a @c maxMessageSize that does so. When the kernel cannot segment a train, its datagrams are sent one by one.
+     *
+     * Only available on Linux, and ignored elsewhere.
+     */
+    bool generic_segmentation_offload = false;
+
+    /**
+     * Number of sockets opened on each unicast input port, each one served by its own reception thread.
+     *
+     * When set to a value greater than 1, the sockets are bound with SO_REUSEPORT and the kernel spreads the
+     * incoming datagrams among them by source address and port, so the messages from different remote participants
+     * are processed in parallel, each reception thread using its own message receiver.
+     * The port is still bound exclusively first, so a port already in use by another participant is detected
+     * as usual.
+     *
+     * Values of 0 and 1 keep a single socket per port. Only available on Linux, and ignored elsewhere.
+     */
+    uint32_t unicast_receive_threads = 1;
 };
 
 } // namespace rtps
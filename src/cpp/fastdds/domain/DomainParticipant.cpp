@@ -643,6 +643,12 @@ ReturnCode_t DomainParticipant::get_current_time(
     return impl_->get_current_time(current_time);
 }
 
+ReturnCode_t DomainParticipant::get_send_queue_statistics(
+        std::vector<rtps::SendQueueStatistics>& statistics) const
+{
+    return impl_->get_send_queue_statistics(statistics);
+}
+
 ReturnCode_t DomainParticipant::register_type(
         TypeSupport type,
         const std::string& type_name)
@@ -993,6 +993,19 @@ ReturnCode_t DomainParticipantImpl::delete_contained_entities()
     return RETCODE_OK;
 }
 
+ReturnCode_t DomainParticipantImpl::get_send_queue_statistics(
+        std::vector<fastdds::rtps::SendQueueStatistics>& statistics) const
+{
+    const fastdds::rtps::RTPSParticipant* rtps_participant = get_rtps_participant();
+    if (rtps_participant == nullptr)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    statistics = rtps_participant->get_send_queue_statistics();
+    return RETCODE_OK;
+}
+
 ReturnCode_t DomainParticipantImpl::assert_liveliness()
 {
     fastdds::rtps::RTPSParticipant* rtps_participant = get_rtps_participant();
@@ -623,6 +623,9 @@ public:
     ReturnCode_t get_current_time(
             fastdds::dds::Time_t& current_time) const;
 
+    ReturnCode_t get_send_queue_statistics(
+            std::vector<fastdds::rtps::SendQueueStatistics>& statistics) const;
+
     const DomainParticipant* get_participant() const
     {
         std::lock_guard<std::mutex> _(mtx_gs_);
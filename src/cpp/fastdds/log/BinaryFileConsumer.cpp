@@ -0,0 +1,352 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryFileConsumer.cpp
+ *
+ */
+
+#include <fastdds/dds/log/BinaryFileConsumer.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include <fastdds/dds/log/StructuredLogRecord.hpp>
+
+#include <utils/SystemInfo.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/*
+ * File layout. All integers are little endian.
+ *
+ * The file (or each appended session) starts with a header: the magic "FDDSBLOG" followed by a version byte.
+ * Records follow, each one starting with a type byte:
+ * * NAME_RECORD: u32 id, u32 length, characters. Defines a name referenced by entries. Identifier 0 means no name.
+ * * ENTRY_RECORD: u8 kind, i64 nanoseconds since epoch, u64 thread id, u32 category id, u32 filename id, i32 line,
+ *   u32 function id, u8 message format, u32 length, message bytes.
+ *   The message is plain text when the format is TEXT_MESSAGE, or arguments encoded as described on
+ *   StructuredLogRecord when the format is STRUCTURED_MESSAGE.
+ */
+static const char binary_log_magic[8] = {'F', 'D', 'D', 'S', 'B', 'L', 'O', 'G'};
+static constexpr uint8_t binary_log_version = 1;
+static constexpr uint8_t NAME_RECORD = 'N';
+static constexpr uint8_t ENTRY_RECORD = 'E';
+static constexpr uint8_t TEXT_MESSAGE = 0;
+static constexpr uint8_t STRUCTURED_MESSAGE = 1;
+
+static void append_u8(
+        std::string& buffer,
+        uint8_t value)
+{
+    buffer.push_back(static_cast<char>(value));
+}
+
+static void append_u32(
+        std::string& buffer,
+        uint32_t value)
+{
+    for (size_t i = 0; i < 4; ++i)
+    {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+static void append_u64(
+        std::string& buffer,
+        uint64_t value)
+{
+    for (size_t i = 0; i < 8; ++i)
+    {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+static bool read_bytes(
+        std::istream& input,
+        unsigned char* data,
+        size_t size)
+{
+    input.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(size));
+    return input.gcount() == static_cast<std::streamsize>(size);
+}
+
+static bool read_u8(
+        std::istream& input,
+        uint8_t& value)
+{
+    return read_bytes(input, &value, 1);
+}
+
+static bool read_u32(
+        std::istream& input,
+        uint32_t& value)
+{
+    unsigned char data[4];
+    if (!read_bytes(input, data, sizeof(data)))
+    {
+        return false;
+    }
+
+    value = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        value |= static_cast<uint32_t>(data[i]) << (8 * i);
+    }
+    return true;
+}
+
+static bool read_u64(
+        std::istream& input,
+        uint64_t& value)
+{
+    unsigned char data[8];
+    if (!read_bytes(input, data, sizeof(data)))
+    {
+        return false;
+    }
+
+    value = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return true;
+}
+
+static bool read_string(
+        std::istream& input,
+        std::string& value)
+{
+    uint32_t length = 0;
+    if (!read_u32(input, length))
+    {
+        return false;
+    }
+
+    value.resize(length);
+    return 0 == length || read_bytes(input, reinterpret_cast<unsigned char*>(&value[0]), length);
+}
+
+BinaryFileConsumer::BinaryFileConsumer()
+    : BinaryFileConsumer("output.blog")
+{
+}
+
+BinaryFileConsumer::BinaryFileConsumer(
+        const std::string& filename,
+        bool append)
+    : output_file_(filename)
+    , append_(append)
+{
+    if (append_)
+    {
+        file_.open(output_file_, std::ios::out | std::ios::binary | std::ios::app);
+    }
+    else
+    {
+        file_.open(output_file_, std::ios::out | std::ios::binary);
+    }
+
+    // Names are defined again after the header, so appended sessions are decoded independently
+    file_.write(binary_log_magic, sizeof(binary_log_magic));
+    file_.put(static_cast<char>(binary_log_version));
+}
+
+BinaryFileConsumer::~BinaryFileConsumer()
+{
+    file_.close();
+}
+
+void BinaryFileConsumer::Consume(
+        const Log::Entry& entry)
+{
+    // Name definitions should be written before the entry referencing them
+    uint32_t category_id = name_id(entry.context.category);
+    uint32_t filename_id = name_id(entry.context.filename);
+    uint32_t function_id = name_id(entry.context.function);
+
+    bool is_structured = !entry.arguments.empty();
+    const std::string& message = is_structured ? entry.arguments : entry.message;
+
+    record_.clear();
+    append_u8(record_, ENTRY_RECORD);
+    append_u8(record_, static_cast<uint8_t>(entry.kind));
+    append_u64(record_, static_cast<uint64_t>(entry.timestamp_ns));
+    append_u64(record_, entry.thread_id);
+    append_u32(record_, category_id);
+    append_u32(record_, filename_id);
+    append_u32(record_, static_cast<uint32_t>(entry.context.line));
+    append_u32(record_, function_id);
+    append_u8(record_, is_structured ? STRUCTURED_MESSAGE : TEXT_MESSAGE);
+    append_u32(record_, static_cast<uint32_t>(message.size()));
+    record_.append(message);
+
+    file_.write(record_.data(), static_cast<std::streamsize>(record_.size()));
+}
+
+bool BinaryFileConsumer::RequiresText() const
+{
+    return false;
+}
+
+void BinaryFileConsumer::Flush()
+{
+    file_.flush();
+}
+
+uint32_t BinaryFileConsumer::name_id(
+        const char* name)
+{
+    if (nullptr == name)
+    {
+        return 0;
+    }
+
+    auto it = name_ids_.find(name);
+    if (it != name_ids_.end())
+    {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(name_ids_.size() + 1);
+    name_ids_.emplace(name, id);
+
+    size_t length = std::strlen(name);
+    record_.clear();
+    append_u8(record_, NAME_RECORD);
+    append_u32(record_, id);
+    append_u32(record_, static_cast<uint32_t>(length));
+    record_.append(name, length);
+    file_.write(record_.data(), static_cast<std::streamsize>(record_.size()));
+
+    return id;
+}
+
+bool BinaryFileConsumer::decode(
+        std::istream& input,
+        std::ostream& output,
+        bool print_thread_ids)
+{
+    std::vector<std::string> names;
+    bool header_found = false;
+    uint8_t record_type = 0;
+
+    while (read_u8(input, record_type))
+    {
+        if (binary_log_magic[0] == static_cast<char>(record_type))
+        {
+            unsigned char header[sizeof(binary_log_magic)];
+            uint8_t version = 0;
+            if (!read_bytes(input, header + 1, sizeof(header) - 1) ||
+                    0 != std::memcmp(header + 1, binary_log_magic + 1, sizeof(header) - 1) ||
+                    !read_u8(input, version) || binary_log_version != version)
+            {
+                return false;
+            }
+
+            // A new session starts
+            header_found = true;
+            names.clear();
+        }
+        else if (!header_found)
+        {
+            return false;
+        }
+        else if (NAME_RECORD == record_type)
+        {
+            uint32_t id = 0;
+            std::string name;
+            if (!read_u32(input, id) || 0 == id || !read_string(input, name))
+            {
+                return false;
+            }
+
+            if (names.size() < id)
+            {
+                names.resize(id);
+            }
+            names[id - 1] = name;
+        }
+        else if (ENTRY_RECORD == record_type)
+        {
+            uint8_t kind = 0;
+            uint64_t timestamp_ns = 0;
+            uint64_t thread_id = 0;
+            uint32_t category_id = 0;
+            uint32_t filename_id = 0;
+            uint32_t line = 0;
+            uint32_t function_id = 0;
+            uint8_t message_format = 0;
+            std::string message;
+
+            if (!read_u8(input, kind) || !read_u64(input, timestamp_ns) || !read_u64(input, thread_id) ||
+                    !read_u32(input, category_id) || !read_u32(input, filename_id) || !read_u32(input, line) ||
+                    !read_u32(input, function_id) || !read_u8(input, message_format) ||
+                    !read_string(input, message) ||
+                    category_id > names.size() || filename_id > names.size() || function_id > names.size())
+            {
+                return false;
+            }
+
+            std::chrono::system_clock::time_point time(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(static_cast<int64_t>(timestamp_ns))));
+            output << SystemInfo::get_timestamp(time) << " ";
+
+            output << "[" << (0 != category_id ? names[category_id - 1] : "") << " " <<
+                static_cast<Log::Kind>(kind) << "] ";
+
+            if (print_thread_ids)
+            {
+                output << "[thread " << thread_id << "] ";
+            }
+
+            if (STRUCTURED_MESSAGE == message_format)
+            {
+                if (!StructuredLogRecord::render(message, output))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                output << message;
+            }
+
+            if (0 != filename_id)
+            {
+                output << " (" << names[filename_id - 1] << ":" << static_cast<int32_t>(line) << ")";
+            }
+            if (0 != function_id)
+            {
+                output << " -> Function " << names[function_id - 1];
+            }
+            output << std::endl;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return header_found;
+}
+
+} // Namespace dds
+} // Namespace fastdds
+} // Namespace eprosima
@@ -12,11 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <sstream>
+#include <thread>
 
 #include <fastdds/dds/log/Colors.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -24,7 +28,7 @@
 #include <fastdds/dds/log/StdoutConsumer.hpp>
 #include <fastdds/dds/log/StdoutErrConsumer.hpp>
 
-#include <utils/DBQueue.hpp>
+#include <utils/collections/BoundedMPSCQueue.hpp>
 #include <utils/SystemInfo.hpp>
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
@@ -34,15 +38,25 @@ namespace fastdds {
 namespace dds {
 namespace detail {
 
+//! Number of preallocated entries on the log queue
+static constexpr size_t log_queue_capacity = 4096;
+
 struct LogResources
 {
     LogResources()
-        : logging_(false)
-        , work_(false)
+        : logs_(log_queue_capacity)
+        , logging_(false)
+        , consumer_sleeping_(false)
         , current_loop_(0)
+        , flushed_position_(0)
         , filenames_(false)
         , functions_(true)
         , verbosity_(Log::Error)
+        , overflow_policy_(Log::Block)
+        , blocked_producers_(0)
+        , dropped_entries_(0)
+        , reported_dropped_entries_(0)
+        , structured_mode_(false)
     {
 #if STDOUTERR_LOG_CONSUMER
         consumers_.emplace_back(new StdoutErrConsumer);
@@ -107,6 +121,38 @@ struct LogResources
         return verbosity_;
     }
 
+    //! Sets the policy to apply when logging an entry while the queue is full.
+    void SetOverflowPolicy(
+            Log::OverflowPolicy policy)
+    {
+        overflow_policy_ = policy;
+    }
+
+    //! Returns the current overflow policy.
+    Log::OverflowPolicy GetOverflowPolicy()
+    {
+        return overflow_policy_;
+    }
+
+    //! Returns the number of entries dropped because the queue was full.
+    uint64_t GetDroppedEntries()
+    {
+        return dropped_entries_.load(std::memory_order_relaxed);
+    }
+
+    //! Enables or disables the structured mode.
+    void SetStructuredMode(
+            bool enabled)
+    {
+        structured_mode_.store(enabled, std::memory_order_relaxed);
+    }
+
+    //! Returns whether the structured mode is enabled.
+    bool GetStructuredMode()
+    {
+        return structured_mode_.load(std::memory_order_relaxed);
+    }
+
     //! Sets a filter that will pattern-match against log categories, dropping any unmatched categories.
     void SetCategoryFilter(
             const std::regex& filter)
@@ -185,6 +231,10 @@ struct LogResources
         filenames_ = false;
         functions_ = true;
         verbosity_ = Log::Error;
+        overflow_policy_ = Log::Block;
+        dropped_entries_ = 0;
+        reported_dropped_entries_ = 0;
+        structured_mode_ = false;
         consumers_.clear();
 
 #if STDOUTERR_LOG_CONSUMER
@@ -205,35 +255,14 @@ struct LogResources
             return;
         }
 
-        /*   Flush() two steps strategy:
-
-             We must assure Log::Run swaps the queues twice
-             because its the only way the content in the background queue
-             will be consumed (first Run() loop).
+        // Every entry queued before this point takes a position lower than the current one
+        size_t last_position = logs_.pushed();
 
-             Then, we must assure the new front queue content is consumed (second Run() loop).
-         */
-
-        int last_loop = current_loop_;
-
-        for (int i = 0; i < 2; ++i)
-        {
-            cv_.wait(guard,
-                    [&]()
-                    {
-                        /* We must avoid:
-                         + the two calls be processed without an intermediate Run() loop
-                           (by using last_loop sequence number and checking if the foreground queue is empty)
-                         + deadlock by absence of Run() loop activity (by using BothEmpty() call)
-                         */
-                        return !logging_ ||
-                        logs_.BothEmpty() ||
-                        (last_loop != current_loop_ && logs_.Empty());
-                    });
-
-            last_loop = current_loop_;
-
-        }
+        cv_.wait(guard,
+                [&]()
+                {
+                    return !logging_ || flushed_position_ >= last_position;
+                });
     }
 
     /**
@@ -241,30 +270,22 @@ struct LogResources
      *  * EPROSIMA_LOG_INFO(cat, msg);
      *  * EPROSIMA_LOG_WARNING(cat, msg);
      *  * EPROSIMA_LOG_ERROR(cat, msg);
-     *
-     * @todo this method takes 2 mutexes (same mutex) internally.
-     * This is a very high sensible point of the code and it should be refactored to be as efficient as possible.
      */
     void QueueLog(
             const std::string& message,
             const Log::Context& context,
             Log::Kind kind)
     {
-        StartThread();
+        queue_entry(message, std::string(), context, kind);
+    }
 
-        std::string timestamp = SystemInfo::get_timestamp();
-        logs_.Push(Log::Entry{ message, context, kind, timestamp });
-        {
-            std::unique_lock<std::mutex> guard(cv_mutex_);
-            work_ = true;
-            // pessimization
-            cv_.notify_all();
-            // wait till the thread is initialized
-            cv_.wait(guard, [&]
-                    {
-                        return current_loop_;
-                    });
-        }
+    //! Queues an entry whose text will be formatted from its arguments on the logging thread.
+    void QueueLog(
+            StructuredLogRecord& record,
+            const Log::Context& context,
+            Log::Kind kind)
+    {
+        queue_entry(std::string(), record.arguments(), context, kind);
     }
 
     //! Stops the logging_ thread. It will re-launch on the next call to QueueLog.
@@ -273,7 +294,12 @@ struct LogResources
         {
             std::unique_lock<std::mutex> guard(cv_mutex_);
             logging_ = false;
-            work_ = false;
+        }
+
+        {
+            // Producers blocked on a full queue drop their entries
+            std::lock_guard<std::mutex> guard(room_mutex_);
+            room_cv_.notify_all();
         }
 
         if (logging_thread_.joinable())
@@ -288,8 +314,103 @@ struct LogResources
 
 private:
 
+    /**
+     * Entries are written into a preallocated slot of a lock-free queue, so the calling thread only takes a lock
+     * when the logging thread needs to be woken up, or when the queue is full and the overflow policy is Block.
+     * The timestamp is captured in binary form, and formatted on the logging thread.
+     */
+    void queue_entry(
+            const std::string& message,
+            const std::string& arguments,
+            const Log::Context& context,
+            Log::Kind kind)
+    {
+        StartThread();
+
+        int64_t timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        uint64_t thread_id = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+        auto fill = [&](Log::Entry& entry)
+                {
+                    // Assigning keeps the capacity of the slot strings, avoiding allocations once warmed up
+                    entry.message.assign(message);
+                    entry.context = context;
+                    entry.kind = kind;
+                    entry.arguments.assign(arguments);
+                    entry.timestamp.clear();
+                    entry.timestamp_ns = timestamp_ns;
+                    entry.thread_id = thread_id;
+                };
+
+        if (!logs_.try_push(fill))
+        {
+            // Blocking from the logging thread would never end, as it is the one releasing room
+            if (Log::Block != overflow_policy_ || !logging_ || logging_thread_.is_calling_thread())
+            {
+                dropped_entries_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            wait_for_room(fill);
+        }
+
+        wake_up_consumer();
+    }
+
+    /**
+     * Waits until the logging thread releases a slot on the queue, and fills it.
+     * The entry is dropped if the logging thread is stopped meanwhile.
+     */
+    template<typename Functor>
+    void wait_for_room(
+            Functor& fill)
+    {
+        std::unique_lock<std::mutex> guard(room_mutex_);
+        // Pairs with the fence in notify_blocked_producers(), so either the consumer sees this producer waiting
+        // or we see the slot it releases
+        blocked_producers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        bool pushed = false;
+        room_cv_.wait(guard, [&]()
+                {
+                    if (logs_.try_push(fill))
+                    {
+                        pushed = true;
+                        return true;
+                    }
+
+                    // The logging thread may be sleeping if the queue was filled after it last checked
+                    wake_up_consumer();
+                    return !logging_;
+                });
+
+        blocked_producers_.fetch_sub(1, std::memory_order_relaxed);
+
+        if (!pushed)
+        {
+            dropped_entries_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    //! Wakes up the producers waiting for room on the queue, if any.
+    void notify_blocked_producers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 < blocked_producers_.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> guard(room_mutex_);
+            room_cv_.notify_all();
+        }
+    }
+
     void StartThread()
     {
+        if (logging_.load(std::memory_order_acquire) && 0 != current_loop_.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
         std::unique_lock<std::mutex> guard(cv_mutex_);
         if (!logging_ && !logging_thread_.joinable())
         {
@@ -300,55 +421,151 @@ private:
                     };
             logging_thread_ = eprosima::create_thread(thread_fn, thread_settings_, "dds.log");
         }
+
+        // wait till the thread is initialized
+        cv_.wait(guard, [&]
+                {
+                    return !logging_ || 0 != current_loop_ || logging_thread_.is_calling_thread();
+                });
+    }
+
+    //! Notifies the logging thread if it is waiting for entries.
+    void wake_up_consumer()
+    {
+        // Pairs with the fence in run(), so either the consumer sees the new entry or we see it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumer_sleeping_.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> guard(cv_mutex_);
+            cv_.notify_all();
+        }
     }
 
     void run()
     {
         std::unique_lock<std::mutex> guard(cv_mutex_);
 
-        while (logging_)
+        while (true)
         {
-            cv_.wait(guard,
-                    [&]()
-                    {
-                        return !logging_ || work_;
-                    });
-
-            work_ = false;
-
             guard.unlock();
             {
-                logs_.Swap();
-                while (!logs_.Empty())
-                {
-                    Log::Entry& entry = logs_.Front();
-                    {
-                        std::unique_lock<std::mutex> configGuard(config_mutex_);
-
-                        if (preprocess(entry))
+                auto consume = [this](Log::Entry& entry)
                         {
-                            for (auto& consumer : consumers_)
+                            std::unique_lock<std::mutex> configGuard(config_mutex_);
+
+                            if (preprocess(entry))
                             {
-                                consumer->Consume(entry);
+                                dispatch(entry);
                             }
-                        }
-                    }
-                    // This Pop() is also a barrier for Log::Flush wait condition
-                    logs_.Pop();
+                        };
+
+                while (logs_.try_pop(consume))
+                {
+                    notify_blocked_producers();
+                }
+
+                report_dropped_entries();
+            }
+            size_t consumed_position = logs_.popped();
+            {
+                // Consumers write the output buffered for the whole batch before Log::Flush is released
+                std::unique_lock<std::mutex> configGuard(config_mutex_);
+                for (auto& consumer : consumers_)
+                {
+                    consumer->Flush();
                 }
             }
             guard.lock();
+            flushed_position_ = consumed_position;
 
             // avoid overflow
             if (++current_loop_ > 10000)
             {
-                current_loop_ = 0;
+                current_loop_ = 1;
             }
 
             cv_.notify_all();
+
+            if (!logging_)
+            {
+                // Entries queued before the thread was stopped have been consumed
+                break;
+            }
+
+            consumer_sleeping_.store(true, std::memory_order_relaxed);
+            // Pairs with the fence in wake_up_consumer()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            cv_.wait(guard,
+                    [&]()
+                    {
+                        return !logging_ || !logs_.empty();
+                    });
+            consumer_sleeping_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    //! Hands an entry to every consumer. Its text fields are only formatted if some consumer requires them.
+    void dispatch(
+            Log::Entry& entry)
+    {
+        for (auto& consumer : consumers_)
+        {
+            if (consumer->RequiresText())
+            {
+                format(entry);
+            }
+            consumer->Consume(entry);
+        }
+    }
+
+    //! Formats the text fields that were captured in binary form by the calling thread, if not done yet.
+    void format(
+            Log::Entry& entry)
+    {
+        if (!entry.timestamp.empty())
+        {
+            return;
+        }
+
+        std::chrono::system_clock::time_point time(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::nanoseconds(entry.timestamp_ns)));
+        entry.timestamp = SystemInfo::get_timestamp(time);
+
+        if (!entry.arguments.empty())
+        {
+            format_stream_.str(std::string());
+            format_stream_.clear();
+            StructuredLogRecord::render(entry.arguments, format_stream_);
+            entry.message = format_stream_.str();
         }
     }
 
+    //! Emits an entry telling how many entries have been dropped since the last report.
+    void report_dropped_entries()
+    {
+        // Taken before reading the counters, as Reset clears them
+        std::unique_lock<std::mutex> configGuard(config_mutex_);
+
+        uint64_t dropped = dropped_entries_.load(std::memory_order_relaxed);
+        if (dropped == reported_dropped_entries_)
+        {
+            return;
+        }
+
+        Log::Entry entry{};
+        entry.message = "Dropped " + std::to_string(dropped - reported_dropped_entries_) +
+                " log entries because the log queue was full";
+        entry.context = Log::Context{nullptr, 0, nullptr, "LOG"};
+        entry.kind = Log::Warning;
+        entry.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        entry.thread_id = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+        reported_dropped_entries_ = dropped;
+
+        dispatch(entry);
+    }
+
     bool preprocess(
             Log::Entry& entry)
     {
@@ -360,9 +577,13 @@ private:
         {
             return false;
         }
-        if (error_string_filter_ && !regex_search(entry.message, *error_string_filter_))
+        if (error_string_filter_)
         {
-            return false;
+            format(entry);
+            if (!regex_search(entry.message, *error_string_filter_))
+            {
+                return false;
+            }
         }
         if (!filenames_)
         {
@@ -376,16 +597,18 @@ private:
         return true;
     }
 
-    DBQueue<Log::Entry> logs_;
+    BoundedMPSCQueue<Log::Entry> logs_;
     std::vector<std::unique_ptr<LogConsumer>> consumers_;
     eprosima::thread logging_thread_;
 
     // Condition variable segment.
     std::condition_variable cv_;
     std::mutex cv_mutex_;
-    bool logging_;
-    bool work_;
-    int current_loop_;
+    std::atomic<bool> logging_;
+    std::atomic<bool> consumer_sleeping_;
+    std::atomic<int> current_loop_;
+    //! Position on the queue up to which entries have been consumed and flushed
+    size_t flushed_position_;
 
     // Context configuration.
     std::mutex config_mutex_;
@@ -397,6 +620,19 @@ private:
 
     std::atomic<Log::Kind> verbosity_;
     rtps::ThreadSettings thread_settings_;
+
+    // Queue overflow handling.
+    std::atomic<Log::OverflowPolicy> overflow_policy_;
+    std::mutex room_mutex_;
+    std::condition_variable room_cv_;
+    //! Number of producers waiting on room_cv_ for a slot to be released
+    std::atomic<uint32_t> blocked_producers_;
+    std::atomic<uint64_t> dropped_entries_;
+    uint64_t reported_dropped_entries_;
+
+    // Structured logging.
+    std::atomic<bool> structured_mode_;
+    std::ostringstream format_stream_;
 };
 
 const std::shared_ptr<LogResources>& get_log_resources()
@@ -428,6 +664,33 @@ void Log::Flush()
     detail::get_log_resources()->Flush();
 }
 
+void Log::SetOverflowPolicy(
+        Log::OverflowPolicy policy)
+{
+    detail::get_log_resources()->SetOverflowPolicy(policy);
+}
+
+Log::OverflowPolicy Log::GetOverflowPolicy()
+{
+    return detail::get_log_resources()->GetOverflowPolicy();
+}
+
+uint64_t Log::GetDroppedEntries()
+{
+    return detail::get_log_resources()->GetDroppedEntries();
+}
+
+void Log::SetStructuredMode(
+        bool enabled)
+{
+    detail::get_log_resources()->SetStructuredMode(enabled);
+}
+
+bool Log::GetStructuredMode()
+{
+    return detail::get_log_resources()->GetStructuredMode();
+}
+
 void Log::ReportFilenames(
         bool report)
 {
@@ -453,6 +716,14 @@ void Log::QueueLog(
     detail::get_log_resources()->QueueLog(message, context, kind);
 }
 
+void Log::QueueLog(
+        StructuredLogRecord& record,
+        const Log::Context& context,
+        Log::Kind kind)
+{
+    detail::get_log_resources()->QueueLog(record, context, kind);
+}
+
 Log::Kind Log::GetVerbosity()
 {
     return detail::get_log_resources()->GetVerbosity();
@@ -0,0 +1,131 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StructuredLogRecord.cpp
+ *
+ */
+
+#include <fastdds/dds/log/StructuredLogRecord.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+static uint64_t read_u64(
+        const unsigned char* data)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+static uint32_t read_u32(
+        const unsigned char* data)
+{
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        value |= static_cast<uint32_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+bool StructuredLogRecord::render(
+        const std::string& arguments,
+        std::ostream& output)
+{
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(arguments.data());
+    size_t pos = 0;
+    size_t size = arguments.size();
+
+    while (pos < size)
+    {
+        uint8_t tag = data[pos++];
+        size_t remaining = size - pos;
+
+        switch (tag)
+        {
+            case SIGNED_INTEGER:
+            case UNSIGNED_INTEGER:
+            case FLOATING_POINT:
+            {
+                if (remaining < 8)
+                {
+                    return false;
+                }
+
+                uint64_t bits = read_u64(&data[pos]);
+                pos += 8;
+
+                if (SIGNED_INTEGER == tag)
+                {
+                    output << static_cast<int64_t>(bits);
+                }
+                else if (UNSIGNED_INTEGER == tag)
+                {
+                    output << bits;
+                }
+                else
+                {
+                    double value = 0;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    output << value;
+                }
+                break;
+            }
+
+            case CHARACTER:
+            {
+                if (remaining < 1)
+                {
+                    return false;
+                }
+                output << static_cast<char>(data[pos++]);
+                break;
+            }
+
+            case STRING:
+            {
+                if (remaining < 4)
+                {
+                    return false;
+                }
+
+                uint32_t length = read_u32(&data[pos]);
+                pos += 4;
+                if (remaining - 4 < length)
+                {
+                    return false;
+                }
+
+                output.write(reinterpret_cast<const char*>(&data[pos]), length);
+                pos += length;
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+} // Namespace dds
+} // Namespace fastdds
+} // Namespace eprosima
@@ -2375,6 +2375,24 @@ void DataWriterImpl::filter_is_being_removed(
     }
 }
 
+ReturnCode_t DataWriterImpl::get_filter_evaluation_statistics(
+        ReaderFilterCollection::EvaluationStatistics& statistics) const
+{
+    if (nullptr == writer_)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    if (!reader_filters_)
+    {
+        return RETCODE_UNSUPPORTED;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> guard(writer_->getMutex());
+    statistics = reader_filters_->evaluation_statistics();
+    return RETCODE_OK;
+}
+
 ReturnCode_t DataWriterImpl::get_matched_subscription_data(
         SubscriptionBuiltinTopicData& subscription_data,
         const InstanceHandle_t& subscription_handle) const
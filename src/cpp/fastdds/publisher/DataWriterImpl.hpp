@@ -381,6 +381,17 @@ public:
     void filter_is_being_removed(
             const char* filter_class_name);
 
+    /**
+     * Retrieve the counters of the filter evaluations performed for writer side filtering.
+     *
+     * @param [out] statistics  Counters of the evaluations performed on behalf of the matched readers.
+     *
+     * @return RETCODE_OK on success, RETCODE_NOT_ENABLED if the writer is not enabled, or RETCODE_UNSUPPORTED if
+     *         writer side filtering is not active on this writer.
+     */
+    ReturnCode_t get_filter_evaluation_statistics(
+            ReaderFilterCollection::EvaluationStatistics& statistics) const;
+
     /**
      * @brief Retrieves in a subscription associated with the @ref DataWriter
      *
@@ -874,6 +874,25 @@ bool PublisherImpl::get_monitoring_status(
     return ret;
 }
 
+ReturnCode_t PublisherImpl::get_filter_evaluation_statistics(
+        const fastdds::rtps::GUID_t& writer_guid,
+        ReaderFilterCollection::EvaluationStatistics& statistics) const
+{
+    std::lock_guard<std::mutex> lock(mtx_writers_);
+    for (auto& topic_writers : writers_)
+    {
+        for (DataWriterImpl* writer : topic_writers.second)
+        {
+            if (writer->guid() == writer_guid)
+            {
+                return writer->get_filter_evaluation_statistics(statistics);
+            }
+        }
+    }
+
+    return RETCODE_BAD_PARAMETER;
+}
+
 #endif //FASTDDS_STATISTICS
 
 } // dds
@@ -36,6 +36,7 @@
 #include <fastdds/dds/topic/qos/TopicQos.hpp>
 
 #ifdef FASTDDS_STATISTICS
+#include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
 #include <statistics/rtps/monitor-service/interfaces/IStatusQueryable.hpp>
 #endif // ifdef FASTDDS_STATISTICS
 
@@ -242,6 +243,19 @@ public:
     bool get_monitoring_status(
             statistics::MonitorServiceData& status,
             const fastdds::rtps::GUID_t& entity_guid);
+
+    /**
+     * Retrieve the counters of the filter evaluations performed by a DataWriter of this publisher.
+     *
+     * @param [in] writer_guid   GUID of the DataWriter.
+     * @param [out] statistics   Counters of the evaluations performed on behalf of its matched readers.
+     *
+     * @return RETCODE_BAD_PARAMETER if the DataWriter does not belong to this publisher, or the result of
+     *         DataWriterImpl::get_filter_evaluation_statistics otherwise.
+     */
+    ReturnCode_t get_filter_evaluation_statistics(
+            const fastdds::rtps::GUID_t& writer_guid,
+            ReaderFilterCollection::EvaluationStatistics& statistics) const;
 #endif //FASTDDS_STATISTICS
 
 protected:
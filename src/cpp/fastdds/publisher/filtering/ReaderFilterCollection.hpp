@@ -19,7 +19,12 @@
 #ifndef _FASTDDS_PUBLISHER_FILTERING_READERFILTERCOLLECTION_HPP_
 #define _FASTDDS_PUBLISHER_FILTERING_READERFILTERCOLLECTION_HPP_
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/dds/topic/IContentFilter.hpp>
 #include <fastdds/dds/topic/IContentFilterFactory.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
@@ -39,6 +44,7 @@
 #include <fastdds/topic/TopicProxy.hpp>
 #include <fastdds/topic/ContentFilterInfo.hpp>
 #include <fastdds/topic/ContentFilterUtils.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
 
 #include <utils/collections/node_size_helpers.hpp>
 
@@ -50,6 +56,11 @@ namespace dds {
  * Class responsible for writer side filtering.
  * Contains a resource-limited map associating a reader GUID with its filtering information.
  * Performs the evaluation of filters when a change is added to the DataWriter's history.
+ *
+ * Readers using DDS-SQL filters with the same expression and parameters are grouped, and the filter of each group
+ * is evaluated only once per change.
+ * The DDS-SQL filters on equal types that need to deserialize the payload of a change share a single deserialized
+ * view of it.
  */
 class ReaderFilterCollection
 {
@@ -58,6 +69,21 @@ class ReaderFilterCollection
 
 public:
 
+    /**
+     * Counters of the filter evaluations performed by a ReaderFilterCollection.
+     */
+    struct EvaluationStatistics
+    {
+        /// Number of times a change has been checked against the filter of a reader
+        uint64_t reader_evaluations = 0;
+        /// Number of times a filter has actually been evaluated
+        uint64_t filter_evaluations = 0;
+        /// Number of reader checks that reused the result of an equivalent filter
+        uint64_t shared_evaluations = 0;
+        /// Number of payloads deserialized into the view shared by the DDS-SQL filters
+        uint64_t payload_decodings = 0;
+    };
+
     /**
      * Construct a ReaderFilterCollection.
      *
@@ -89,6 +115,14 @@ public:
         return reader_filters_.empty();
     }
 
+    /**
+     * @return the counters of the filter evaluations performed so far.
+     */
+    const EvaluationStatistics& evaluation_statistics() const
+    {
+        return statistics_;
+    }
+
     /**
      * Performs filter evaluation on a DataWriterFilteredChange.
      *
@@ -120,14 +154,25 @@ public:
             info.sample_identity.writer_guid(change.writerGUID);
             info.sample_identity.sequence_number(change.sequenceNumber);
 
+            // Forget the results and the deserialized payloads of the previous change
+            group_results_.assign(num_evaluation_groups_, GroupResult::NOT_EVALUATED);
+            for (auto& decoded_payload : decoded_payloads_)
+            {
+                decoded_payload.reset();
+            }
+
+            // Entries are visited in order, so the iterator only needs to move forward.
+            auto it = reader_filters_.cbegin();
+            std::size_t it_index = 0;
+
             // Functor used from the serialization process to evaluate each filter and write its signature.
-            auto filter_process = [this, &change, &info](
+            auto filter_process = [this, &change, &info, &it, &it_index](
                 std::size_t i,
                 uint8_t* signature) -> bool
                     {
                         // Point to the corresponding entry
-                        auto it = reader_filters_.cbegin();
-                        std::advance(it, i);
+                        std::advance(it, i - it_index);
+                        it_index = i;
                         const ReaderFilterInformation& entry = it->second;
 
                         // Copy the signature
@@ -137,8 +182,9 @@ public:
                         bool filter_result = true;
                         if (fastdds::rtps::ALIVE == change.kind)
                         {
-                            // Evaluate filter and update filtered_out_readers
-                            filter_result = entry.filter->evaluate(change.serializedPayload, info, it->first);
+                            // Evaluate filter, or reuse the result of an equivalent one, and update
+                            // filtered_out_readers
+                            filter_result = evaluate(entry, change, info, it->first);
                             if (!filter_result)
                             {
                                 change.filtered_out_readers.emplace_back(it->first);
@@ -171,6 +217,7 @@ public:
             }
             ++it;
         }
+        update_evaluation_groups();
     }
 
     /**
@@ -188,6 +235,7 @@ public:
         {
             destroy_filter(it->second);
             reader_filters_.erase(it);
+            update_evaluation_groups();
         }
     }
 
@@ -243,11 +291,124 @@ public:
                     reader_filters_.erase(it);
                 }
             }
+            update_evaluation_groups();
         }
     }
 
 private:
 
+    /// Result of the filter of an evaluation group on the current change
+    enum class GroupResult : uint8_t
+    {
+        NOT_EVALUATED,
+        PASSED,
+        FILTERED_OUT
+    };
+
+    /**
+     * Evaluate the filter of a reader on a change, reusing the result of an equivalent filter when possible.
+     *
+     * @param [in] entry        Filtering information of the reader.
+     * @param [in] change       Change being filtered.
+     * @param [in] info         Information about the change being filtered.
+     * @param [in] reader_guid  GUID of the reader.
+     *
+     * @return whether the change passes the filter.
+     */
+    bool evaluate(
+            const ReaderFilterInformation& entry,
+            const DataWriterFilteredChange& change,
+            const IContentFilter::FilterSampleInfo& info,
+            const fastdds::rtps::GUID_t& reader_guid) const
+    {
+        ++statistics_.reader_evaluations;
+
+        GroupResult& group_result = group_results_[entry.evaluation_group];
+        if (GroupResult::NOT_EVALUATED != group_result)
+        {
+            ++statistics_.shared_evaluations;
+            return GroupResult::PASSED == group_result;
+        }
+
+        ++statistics_.filter_evaluations;
+        bool result = false;
+        if (nullptr != entry.sql_filter)
+        {
+            auto& decoded_payload = decoded_payloads_[entry.decoding_group];
+            bool was_decoded = decoded_payload.is_decoded;
+            result = entry.sql_filter->evaluate(change.serializedPayload, decoded_payload);
+            if (!was_decoded && decoded_payload.is_decoded)
+            {
+                ++statistics_.payload_decodings;
+            }
+        }
+        else
+        {
+            result = entry.filter->evaluate(change.serializedPayload, info, reader_guid);
+        }
+
+        group_result = result ? GroupResult::PASSED : GroupResult::FILTERED_OUT;
+        return result;
+    }
+
+    /**
+     * Assign the evaluation and decoding groups of the entries.
+     * Entries using DDS-SQL filters with the same expression signature share an evaluation group.
+     * Other filters may depend on the reader GUID, so each of them has its own evaluation group.
+     * Entries using DDS-SQL filters on equal types share a decoding group, so the types are only compared here.
+     * Called whenever an entry is added, updated or removed.
+     */
+    void update_evaluation_groups()
+    {
+        std::vector<const ReaderFilterInformation*> sql_groups;
+        std::vector<const ReaderFilterInformation*> decoding_groups;
+        std::size_t num_groups = 0;
+        for (auto& item : reader_filters_)
+        {
+            ReaderFilterInformation& entry = item.second;
+            if (nullptr != entry.sql_filter)
+            {
+                // Each filter has its own DynamicType, so equal types are usually different objects
+                const DynamicType::_ref_type& type = entry.sql_filter->get_type();
+                auto decoding_it = std::find_if(decoding_groups.begin(), decoding_groups.end(),
+                                [&type](const ReaderFilterInformation* group)
+                                {
+                                    const DynamicType::_ref_type& group_type = group->sql_filter->get_type();
+                                    return group_type == type || (group_type && group_type->equals(type));
+                                });
+                if (decoding_it != decoding_groups.end())
+                {
+                    entry.decoding_group = (*decoding_it)->decoding_group;
+                }
+                else
+                {
+                    entry.decoding_group = decoding_groups.size();
+                    decoding_groups.push_back(&entry);
+                }
+
+                auto group_it = std::find_if(sql_groups.begin(), sql_groups.end(),
+                                [&entry](const ReaderFilterInformation* group)
+                                {
+                                    return group->expression_signature == entry.expression_signature;
+                                });
+                if (group_it != sql_groups.end())
+                {
+                    entry.evaluation_group = (*group_it)->evaluation_group;
+                    continue;
+                }
+                sql_groups.push_back(&entry);
+            }
+            entry.evaluation_group = num_groups++;
+        }
+
+        num_evaluation_groups_ = num_groups;
+        group_results_.reserve(num_groups);
+
+        // The views are created again by the first filter of each group using them
+        decoded_payloads_.clear();
+        decoded_payloads_.resize(decoding_groups.size());
+    }
+
     /**
      * Ensure a filter instance is removed before an information entry is removed.
      *
@@ -294,6 +455,9 @@ private:
             return true;
         }
 
+        std::array<uint8_t, 16> new_expression_signature;
+        ContentFilterUtils::compute_expression_signature(filter_info, new_expression_signature);
+
         LoanableSequence<const char*>::size_type n_params;
         n_params = static_cast<LoanableSequence<const char*>::size_type>(filter_info.expression_parameters.size());
         LoanableSequence<const char*> filter_parameters(n_params);
@@ -326,6 +490,10 @@ private:
         entry.filter_signature = new_signature;
         entry.filter_factory = new_factory;
         entry.filter = new_filter;
+        entry.expression_signature = new_expression_signature;
+        // The built-in DDS-SQL filters do not depend on the reader, so their results can be shared
+        entry.sql_filter = (0 == strcmp(class_name, FASTDDS_SQLFILTER_NAME)) ?
+                dynamic_cast<DDSSQLFilter::DDSFilterExpression*>(new_filter) : nullptr;
 
         return true;
     }
@@ -338,6 +506,15 @@ private:
     foonathan::memory::map<fastdds::rtps::GUID_t, ReaderFilterInformation, pool_allocator_t> reader_filters_;
 
     std::size_t max_filters_;
+
+    /// Number of different evaluation groups among the entries
+    std::size_t num_evaluation_groups_ = 0;
+    /// Result of each evaluation group on the change being filtered
+    mutable std::vector<GroupResult> group_results_;
+    /// Deserialized payload of the change being filtered, for each decoding group
+    mutable std::vector<DDSSQLFilter::DDSFilterExpression::DecodedPayload> decoded_payloads_;
+    /// Counters of the evaluations performed
+    mutable EvaluationStatistics statistics_;
 };
 
 }  // namespace dds
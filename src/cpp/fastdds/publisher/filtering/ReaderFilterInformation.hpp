@@ -20,6 +20,7 @@
 #define _FASTDDS_PUBLISHER_FILTERING_READERFILTERINFORMATION_HPP_
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 #include <fastcdr/cdr/fixed_size_string.hpp>
@@ -31,12 +32,24 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+namespace DDSSQLFilter {
+class DDSFilterExpression;
+}  // namespace DDSSQLFilter
+
 struct ReaderFilterInformation
 {
     fastcdr::string_255 filter_class_name;
     IContentFilterFactory* filter_factory = nullptr;
     IContentFilter* filter = nullptr;
     std::array<uint8_t, 16> filter_signature{ { 0 } };
+    /// Signature of the class name, expression and parameters of the filter
+    std::array<uint8_t, 16> expression_signature{ { 0 } };
+    /// The filter as a DDS-SQL expression, or nullptr when it was not created by the built-in DDS-SQL factory
+    DDSSQLFilter::DDSFilterExpression* sql_filter = nullptr;
+    /// Index of the group of equivalent filters sharing their evaluation result
+    std::size_t evaluation_group = 0;
+    /// Index of the group of DDS-SQL filters on equal types sharing the deserialized payload
+    std::size_t decoding_group = 0;
 };
 
 }  // namespace dds
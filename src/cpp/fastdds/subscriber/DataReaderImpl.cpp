@@ -189,6 +189,7 @@ ReturnCode_t DataReaderImpl::enable()
     att.expects_inline_qos = qos_.expects_inline_qos();
     att.disable_positive_acks = qos_.reliable_reader_qos().disable_positive_acks.enabled;
     att.data_sharing_listener_thread = qos_.data_sharing().data_sharing_listener_thread();
+    att.data_sharing_listener_spin_budget = qos_.data_sharing().listener_spin_budget();
 
     // TODO(Ricardo) Remove in future
     // Insert topic_name and partitions
@@ -1673,6 +1674,12 @@ bool DataReaderImpl::can_qos_be_updated(
         EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
                 "data_sharing_listener_thread cannot be changed after the DataReader is enabled.");
     }
+    if (to.data_sharing().listener_spin_budget() != from.data_sharing().listener_spin_budget())
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "data_sharing listener_spin_budget cannot be changed after the DataReader is enabled.");
+    }
     if (to.properties() != from.properties())
     {
         updatable = false;
@@ -98,10 +98,16 @@ DataReaderHistory::DataReaderHistory(
         resource_limited_qos_.max_samples_per_instance = resource_limited_qos_.max_samples;
         key_changes_allocation_.initial = resource_limited_qos_.allocated_samples;
         key_changes_allocation_.maximum = resource_limited_qos_.max_samples;
+    }
+
+    instances_.init(key_changes_allocation_, key_writers_allocation_,
+            static_cast<size_t>(resource_limited_qos_.max_instances));
 
-        instances_.emplace(c_InstanceHandle_Unknown,
-                std::make_shared<DataReaderInstance>(key_changes_allocation_, key_writers_allocation_));
-        data_available_instances_[c_InstanceHandle_Unknown] = instances_[c_InstanceHandle_Unknown];
+    if (!type_->is_compute_key_provided)
+    {
+        DataReaderInstance* instance = instances_.emplace(c_InstanceHandle_Unknown);
+        instance->has_available_data = true;
+        data_available_instances_[c_InstanceHandle_Unknown] = instance;
     }
 
     using std::placeholders::_1;
@@ -226,14 +232,14 @@ bool DataReaderHistory::received_change_keep_all(
     }
 
     bool ret_value = false;
-    InstanceCollection::iterator vit;
-    if (find_key(a_change->instanceHandle, vit))
+    DataReaderInstance* instance = nullptr;
+    if (find_key(a_change->instanceHandle, instance))
     {
-        DataReaderInstance::ChangeCollection& instance_changes = vit->second->cache_changes;
+        DataReaderInstance::ChangeCollection& instance_changes = instance->cache_changes;
         size_t total_size = instance_changes.size() + unknown_missing_changes_up_to;
         if (total_size < static_cast<size_t>(resource_limited_qos_.max_samples_per_instance))
         {
-            ret_value =  add_received_change_with_key(a_change, *vit->second, rejection_reason);
+            ret_value =  add_received_change_with_key(a_change, *instance, rejection_reason);
         }
         else
         {
@@ -268,10 +274,10 @@ bool DataReaderHistory::received_change_keep_last(
     }
 
     bool ret_value = false;
-    InstanceCollection::iterator vit;
-    if (find_key(a_change->instanceHandle, vit))
+    DataReaderInstance* instance = nullptr;
+    if (find_key(a_change->instanceHandle, instance))
     {
-        DataReaderInstance::ChangeCollection& instance_changes = vit->second->cache_changes;
+        DataReaderInstance::ChangeCollection& instance_changes = instance->cache_changes;
         if (instance_changes.size() < static_cast<size_t>(history_qos_.depth))
         {
             ret_value = true;
@@ -294,7 +300,7 @@ bool DataReaderHistory::received_change_keep_last(
 
         if (ret_value)
         {
-            ret_value = add_received_change_with_key(a_change, *vit->second, rejection_reason);
+            ret_value = add_received_change_with_key(a_change, *instance, rejection_reason);
         }
     }
     else
@@ -347,7 +353,11 @@ void DataReaderHistory::add_to_instance(
     // ADD TO KEY VECTOR
     DataReaderCacheChange item = a_change;
     eprosima::utilities::collections::sorted_vector_insert(instance.cache_changes, item, rtps::history_order_cmp);
-    data_available_instances_[a_change->instanceHandle] = instances_[a_change->instanceHandle];
+    if (!instance.has_available_data)
+    {
+        instance.has_available_data = true;
+        data_available_instances_[a_change->instanceHandle] = &instance;
+    }
 
     EPROSIMA_LOG_INFO(SUBSCRIBER, mp_reader->getGuid().entityId
             << ": Change " << a_change->sequenceNumber << " added from: "
@@ -387,32 +397,32 @@ bool DataReaderHistory::get_first_untaken_info(
 
 bool DataReaderHistory::find_key(
         const InstanceHandle_t& handle,
-        InstanceCollection::iterator& vit_out)
+        DataReaderInstance*& instance)
 {
-    InstanceCollection::iterator vit;
-    vit = instances_.find(handle);
-    if (vit != instances_.end())
+    instance = instances_.find(handle);
+    if (nullptr != instance)
     {
-        vit_out = vit;
         return true;
     }
 
     if (instances_.size() < static_cast<size_t>(resource_limited_qos_.max_instances))
     {
-        vit_out = instances_.emplace(handle,
-                        std::make_shared<DataReaderInstance>(key_changes_allocation_, key_writers_allocation_)).first;
+        instance = instances_.emplace(handle);
         return true;
     }
 
-    for (vit = instances_.begin(); vit != instances_.end(); ++vit)
+    for (const InstanceCollection::value_type& item : instances_)
     {
-        if (InstanceStateKind::ALIVE_INSTANCE_STATE != vit->second->instance_state)
+        if (InstanceStateKind::ALIVE_INSTANCE_STATE != item.second->instance_state)
         {
-            data_available_instances_.erase(vit->first);
-            instances_.erase(vit);
-            vit_out = instances_.emplace(handle,
-                            std::make_shared<DataReaderInstance>(key_changes_allocation_,
-                            key_writers_allocation_)).first;
+            if (item.second->has_available_data)
+            {
+                data_available_instances_.erase(item.first);
+            }
+            // Copy the handle, as the slot is modified when erasing
+            InstanceHandle_t replaced_handle = item.first;
+            instances_.erase(replaced_handle);
+            instance = instances_.emplace(handle);
             return true;
         }
     }
@@ -444,15 +454,15 @@ bool DataReaderHistory::remove_change_sub(
 
     std::lock_guard<RecursiveTimedMutex> guard(*getMutex());
     bool found = false;
-    InstanceCollection::iterator vit;
-    if (find_key(change->instanceHandle, vit))
+    DataReaderInstance* instance = nullptr;
+    if (find_key(change->instanceHandle, instance))
     {
-        for (auto chit = vit->second->cache_changes.begin(); chit != vit->second->cache_changes.end(); ++chit)
+        for (auto chit = instance->cache_changes.begin(); chit != instance->cache_changes.end(); ++chit)
         {
             if ((*chit)->sequenceNumber == change->sequenceNumber &&
                     (*chit)->writerGUID == change->writerGUID)
             {
-                vit->second->cache_changes.erase(chit);
+                instance->cache_changes.erase(chit);
                 found = true;
 
                 if (change->isRead)
@@ -507,15 +517,15 @@ bool DataReaderHistory::remove_change_sub(
 
     if (new_it == changesEnd() || !matches_change(&dummy_change, *new_it)) // Change was successfully removed.
     {
-        InstanceCollection::iterator vit;
-        if (find_key(dummy_change.instanceHandle, vit))
+        DataReaderInstance* instance = nullptr;
+        if (find_key(dummy_change.instanceHandle, instance))
         {
-            auto in_it = std::find(vit->second->cache_changes.begin(), vit->second->cache_changes.end(), change);
+            auto in_it = std::find(instance->cache_changes.begin(), instance->cache_changes.end(), change);
 
-            if (vit->second->cache_changes.end() != in_it)
+            if (instance->cache_changes.end() != in_it)
             {
                 assert(it == in_it);
-                it = vit->second->cache_changes.erase(in_it);
+                it = instance->cache_changes.erase(in_it);
                 if (dummy_change.isRead)
                 {
                     --counters_.samples_read;
@@ -546,17 +556,17 @@ bool DataReaderHistory::set_next_deadline(
         return false;
     }
     std::lock_guard<RecursiveTimedMutex> guard(*getMutex());
-    auto it = instances_.find(handle);
-    if (it == instances_.end())
+    DataReaderInstance* instance = instances_.find(handle);
+    if (nullptr == instance)
     {
         return false;
     }
 
     if (deadline_missed)
     {
-        it->second->deadline_missed();
+        instance->deadline_missed();
     }
-    it->second->next_deadline_us = next_deadline_us;
+    instance->next_deadline_us = next_deadline_us;
     return true;
 }
 
@@ -570,6 +580,10 @@ bool DataReaderHistory::get_next_deadline(
         return false;
     }
     std::lock_guard<RecursiveTimedMutex> guard(*getMutex());
+    if (instances_.empty())
+    {
+        return false;
+    }
     auto min = std::min_element(instances_.begin(),
                     instances_.end(),
                     [](
@@ -600,14 +614,14 @@ uint64_t DataReaderHistory::get_unread_count(
 bool DataReaderHistory::is_instance_present(
         const InstanceHandle_t& handle) const
 {
-    return has_keys_ && instances_.find(handle) != instances_.end();
+    return has_keys_ && nullptr != instances_.find(handle);
 }
 
 std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::lookup_available_instance(
         const InstanceHandle_t& handle,
         bool exact)
 {
-    InstanceCollection::iterator it = data_available_instances_.end();
+    instance_info it = data_available_instances_.end();
 
     if (!has_keys_)
     {
@@ -639,11 +653,7 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::lookup_avai
             else
             {
                 // Looking for an instance with a handle greater than the one on the input
-                auto comp = [](const InstanceHandle_t& h, const InstanceCollection::value_type& it)
-                        {
-                            return h < it.first;
-                        };
-                it = std::upper_bound(data_available_instances_.begin(), data_available_instances_.end(), handle, comp);
+                it = data_available_instances_.upper_bound(handle);
             }
         }
     }
@@ -671,18 +681,20 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::next_availa
 void DataReaderHistory::check_and_remove_instance(
         DataReaderHistory::instance_info& instance_info)
 {
-    DataReaderInstance* instance = instance_info->second.get();
+    DataReaderInstance* instance = instance_info->second;
 
     if (instance->cache_changes.empty())
     {
+        InstanceHandle_t handle = instance_info->first;
+        instance->has_available_data = false;
+        instance_info = data_available_instances_.erase(instance_info);
+
         if (InstanceStateKind::ALIVE_INSTANCE_STATE != instance->instance_state &&
                 instance->alive_writers.empty() &&
-                instance_info->first.isDefined())
+                handle.isDefined())
         {
-            instances_.erase(instance_info->first);
+            instances_.erase(handle);
         }
-
-        instance_info = data_available_instances_.erase(instance_info);
     }
 }
 
@@ -708,16 +720,16 @@ ReaderHistory::iterator DataReaderHistory::remove_change_nts(
             if (!has_keys_ || is_fully_assembled)
             {
                 // clean any references to this CacheChange in the key state collection
-                auto it = instances_.find(dummy_change.instanceHandle);
+                DataReaderInstance* instance = instances_.find(dummy_change.instanceHandle);
 
                 // if keyed and in history must be in the map
                 // There is a case when the sample could not be in the keyed map. The first received fragment of a
                 // fragmented sample is stored in the history, and when it is completed it is stored in the keyed map.
                 // But it can occur it is rejected when the sample is completed and removed without being stored in the
                 // keyed map.
-                if (it != instances_.end())
+                if (nullptr != instance)
                 {
-                    it->second->cache_changes.remove(change_ptr);
+                    instance->cache_changes.remove(change_ptr);
                     if (dummy_change.isRead)
                     {
                         --counters_.samples_read;
@@ -760,11 +772,11 @@ bool DataReaderHistory::completed_change(
 
     if (compute_key_for_change_fn_(change))
     {
-        InstanceCollection::iterator vit;
-        if (find_key(change->instanceHandle, vit))
+        DataReaderInstance* instance = nullptr;
+        if (find_key(change->instanceHandle, instance))
         {
             ret_value = !change->instanceHandle.isDefined() ||
-                    complete_fn_(change, *vit->second, unknown_missing_changes_up_to, rejection_reason);
+                    complete_fn_(change, *instance, unknown_missing_changes_up_to, rejection_reason);
         }
     }
 
@@ -847,7 +859,7 @@ void DataReaderHistory::change_was_processed_nts(
 }
 
 void DataReaderHistory::instance_viewed_nts(
-        const InstanceCollection::mapped_type& instance)
+        DataReaderInstance* instance)
 {
     if (ViewStateKind::NEW_VIEW_STATE == instance->view_state)
     {
@@ -860,24 +872,23 @@ void DataReaderHistory::instance_viewed_nts(
 bool DataReaderHistory::update_instance_nts(
         CacheChange_t* const change)
 {
-    InstanceCollection::iterator vit;
-    vit = instances_.find(change->instanceHandle);
+    DataReaderInstance* instance = instances_.find(change->instanceHandle);
 
-    assert(vit != instances_.end());
+    assert(nullptr != instance);
     assert(false == change->isRead);
-    auto previous_owner = vit->second->current_owner.first;
+    auto previous_owner = instance->current_owner.first;
     ++counters_.samples_unread;
     bool ret =
-            vit->second->update_state(counters_, change->kind, change->writerGUID,
+            instance->update_state(counters_, change->kind, change->writerGUID,
                     change->reader_info.writer_ownership_strength);
-    change->reader_info.disposed_generation_count = vit->second->disposed_generation_count;
-    change->reader_info.no_writers_generation_count = vit->second->no_writers_generation_count;
+    change->reader_info.disposed_generation_count = instance->disposed_generation_count;
+    change->reader_info.no_writers_generation_count = instance->no_writers_generation_count;
 
-    auto current_owner = vit->second->current_owner.first;
+    auto current_owner = instance->current_owner.first;
     if ((current_owner != previous_owner) && (current_owner == change->writerGUID))
     {
         // Remove all changes from different owners after the change.
-        DataReaderInstance::ChangeCollection& changes = vit->second->cache_changes;
+        DataReaderInstance::ChangeCollection& changes = instance->cache_changes;
         auto it = std::lower_bound(changes.begin(), changes.end(), change, rtps::history_order_cmp);
         assert(it != changes.end());
         assert(*it == change);
@@ -58,6 +58,8 @@ struct DataReaderInstance
     int32_t disposed_generation_count = 0;
     //! Current no_writers generation of the instance
     int32_t no_writers_generation_count = 0;
+    //! Whether the instance is present on the collection of instances with available data
+    bool has_available_data = false;
 
     DataReaderInstance(
             const eprosima::fastdds::ResourceLimitedContainerConfig& changes_allocation,
@@ -67,6 +69,21 @@ struct DataReaderInstance
     {
     }
 
+    //! Return to the initial state, keeping the memory allocated by the collections.
+    void clear()
+    {
+        cache_changes.clear();
+        alive_writers.clear();
+        current_owner = { {}, (std::numeric_limits<uint32_t>::max)() };
+        next_deadline_us = std::chrono::steady_clock::time_point();
+        view_state = ViewStateKind::NEW_VIEW_STATE;
+        instance_state = InstanceStateKind::ALIVE_INSTANCE_STATE;
+        disposed_generation_count = 0;
+        no_writers_generation_count = 0;
+        has_available_data = false;
+        has_been_accounted_ = false;
+    }
+
     void writer_update_its_ownership_strength(
             const fastdds::rtps::GUID_t& writer_guid,
             const uint32_t ownership_strength)
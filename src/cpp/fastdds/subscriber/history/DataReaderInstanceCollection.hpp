@@ -0,0 +1,381 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataReaderInstanceCollection.hpp
+ */
+
+#ifndef _FASTDDS_SUBSCRIBER_HISTORY_DATAREADERINSTANCECOLLECTION_HPP_
+#define _FASTDDS_SUBSCRIBER_HISTORY_DATAREADERINSTANCECOLLECTION_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+#include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
+
+#include "DataReaderInstance.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Collection of DataReaderInstance objects accessible by their handle.
+ *
+ * Instances are indexed on an open addressing hash table with linear probing, so looking up the instance of a
+ * received sample does not walk a tree nor allocate.
+ * Instance objects are taken from a pool, and returned to it when erased, keeping the memory of their collections.
+ * When the maximum number of instances is finite, both the table and the pool are preallocated on @c init.
+ *
+ * Iteration order is unspecified.
+ */
+class DataReaderInstanceCollection
+{
+public:
+
+    using InstanceHandle_t = eprosima::fastdds::rtps::InstanceHandle_t;
+    using value_type = std::pair<InstanceHandle_t, DataReaderInstance*>;
+
+    //! Forward iterator over the instances on the collection.
+    class const_iterator
+    {
+    public:
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = DataReaderInstanceCollection::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator(
+                const value_type* slot,
+                const value_type* end)
+            : slot_(slot)
+            , end_(end)
+        {
+            skip_empty();
+        }
+
+        reference operator *() const
+        {
+            return *slot_;
+        }
+
+        pointer operator ->() const
+        {
+            return slot_;
+        }
+
+        const_iterator& operator ++()
+        {
+            ++slot_;
+            skip_empty();
+            return *this;
+        }
+
+        const_iterator operator ++(
+                int)
+        {
+            const_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator ==(
+                const const_iterator& other) const
+        {
+            return slot_ == other.slot_;
+        }
+
+        bool operator !=(
+                const const_iterator& other) const
+        {
+            return slot_ != other.slot_;
+        }
+
+    private:
+
+        void skip_empty()
+        {
+            while (slot_ != end_ && nullptr == slot_->second)
+            {
+                ++slot_;
+            }
+        }
+
+        const value_type* slot_;
+        const value_type* end_;
+    };
+
+    DataReaderInstanceCollection() = default;
+
+    DataReaderInstanceCollection(
+            const DataReaderInstanceCollection&) = delete;
+    DataReaderInstanceCollection& operator =(
+            const DataReaderInstanceCollection&) = delete;
+
+    /**
+     * Configure the collection. Should be called once, before any other method.
+     *
+     * @param changes_allocation  Allocation configuration for the changes of each instance.
+     * @param writers_allocation  Allocation configuration for the writers of each instance.
+     * @param max_instances       Maximum number of instances. Table and pool are preallocated when this is lower
+     *                            than std::numeric_limits<int32_t>::max().
+     */
+    void init(
+            const eprosima::fastdds::ResourceLimitedContainerConfig& changes_allocation,
+            const eprosima::fastdds::ResourceLimitedContainerConfig& writers_allocation,
+            size_t max_instances)
+    {
+        changes_allocation_ = changes_allocation;
+        writers_allocation_ = writers_allocation;
+
+        size_t initial_instances = 0;
+        if (max_instances < static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        {
+            initial_instances = max_instances;
+        }
+
+        // Keep the load factor at or below one half
+        size_t capacity = min_capacity;
+        while (capacity < 2 * initial_instances)
+        {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, value_type{});
+        mask_ = capacity - 1;
+
+        free_instances_.reserve(initial_instances);
+        for (size_t i = 0; i < initial_instances; ++i)
+        {
+            storage_.emplace_back(changes_allocation_, writers_allocation_);
+            free_instances_.push_back(&storage_.back());
+        }
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(slots_.data(), slots_.data() + slots_.size());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size());
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+    /**
+     * Look for the instance with a given handle.
+     *
+     * @param handle  Handle of the instance.
+     *
+     * @return Pointer to the instance, or nullptr if it is not on the collection.
+     */
+    DataReaderInstance* find(
+            const InstanceHandle_t& handle) const
+    {
+        if (slots_.empty())
+        {
+            return nullptr;
+        }
+
+        for (size_t pos = hash(handle) & mask_;; pos = (pos + 1) & mask_)
+        {
+            const value_type& slot = slots_[pos];
+            if (nullptr == slot.second)
+            {
+                return nullptr;
+            }
+            if (slot.first == handle)
+            {
+                return slot.second;
+            }
+        }
+    }
+
+    /**
+     * Add a new instance to the collection.
+     *
+     * @param handle  Handle of the instance. Should not be on the collection.
+     *
+     * @return Pointer to the new instance, on its initial state.
+     */
+    DataReaderInstance* emplace(
+            const InstanceHandle_t& handle)
+    {
+        assert(nullptr == find(handle));
+
+        if (2 * (size_ + 1) > slots_.size())
+        {
+            rehash(slots_.empty() ? static_cast<size_t>(min_capacity) : 2 * slots_.size());
+        }
+
+        DataReaderInstance* instance = nullptr;
+        if (free_instances_.empty())
+        {
+            storage_.emplace_back(changes_allocation_, writers_allocation_);
+            instance = &storage_.back();
+        }
+        else
+        {
+            instance = free_instances_.back();
+            free_instances_.pop_back();
+        }
+
+        insert_slot(handle, instance);
+        ++size_;
+        return instance;
+    }
+
+    /**
+     * Remove an instance from the collection, returning it to the pool.
+     * Any pointer to the instance should not be used afterwards.
+     *
+     * @param handle  Handle of the instance.
+     *
+     * @return Whether the instance was on the collection.
+     */
+    bool erase(
+            const InstanceHandle_t& handle)
+    {
+        if (slots_.empty())
+        {
+            return false;
+        }
+
+        size_t pos = hash(handle) & mask_;
+        for (;; pos = (pos + 1) & mask_)
+        {
+            if (nullptr == slots_[pos].second)
+            {
+                return false;
+            }
+            if (slots_[pos].first == handle)
+            {
+                break;
+            }
+        }
+
+        DataReaderInstance* instance = slots_[pos].second;
+        instance->clear();
+        free_instances_.push_back(instance);
+
+        // Backward shift deletion: move back the entries on the same cluster, so no tombstones are needed.
+        size_t hole = pos;
+        for (size_t next = (hole + 1) & mask_; nullptr != slots_[next].second; next = (next + 1) & mask_)
+        {
+            size_t ideal = hash(slots_[next].first) & mask_;
+            // The entry can fill the hole when its ideal position is not on the cyclic range (hole, next]
+            if (((next - ideal) & mask_) >= ((next - hole) & mask_))
+            {
+                slots_[hole] = slots_[next];
+                hole = next;
+            }
+        }
+        slots_[hole] = value_type{};
+
+        --size_;
+        return true;
+    }
+
+private:
+
+    static constexpr size_t min_capacity = 16;
+
+    //! Hash of the key hash on a handle. Keys shorter than a key hash are zero padded, so bytes are mixed.
+    static size_t hash(
+            const InstanceHandle_t& handle)
+    {
+        const eprosima::fastdds::rtps::octet* data = handle.value;
+        uint64_t low = 0;
+        uint64_t high = 0;
+        std::memcpy(&low, data, sizeof(low));
+        std::memcpy(&high, data + sizeof(low), sizeof(high));
+
+        uint64_t h = low ^ (high * 0x9E3779B97F4A7C15ull);
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EBull;
+        h ^= h >> 31;
+        return static_cast<size_t>(h);
+    }
+
+    void insert_slot(
+            const InstanceHandle_t& handle,
+            DataReaderInstance* instance)
+    {
+        size_t pos = hash(handle) & mask_;
+        while (nullptr != slots_[pos].second)
+        {
+            pos = (pos + 1) & mask_;
+        }
+        slots_[pos].first = handle;
+        slots_[pos].second = instance;
+    }
+
+    void rehash(
+            size_t capacity)
+    {
+        std::vector<value_type> old_slots(capacity, value_type{});
+        old_slots.swap(slots_);
+        mask_ = capacity - 1;
+
+        for (const value_type& slot : old_slots)
+        {
+            if (nullptr != slot.second)
+            {
+                insert_slot(slot.first, slot.second);
+            }
+        }
+    }
+
+    //! Hash table. Empty slots have a null instance.
+    std::vector<value_type> slots_;
+    size_t mask_ = 0;
+    size_t size_ = 0;
+
+    //! Owner of all the instances, with stable addresses
+    std::deque<DataReaderInstance> storage_;
+    //! Instances on the pool, ready to be reused
+    std::vector<DataReaderInstance*> free_instances_;
+
+    eprosima::fastdds::ResourceLimitedContainerConfig changes_allocation_;
+    eprosima::fastdds::ResourceLimitedContainerConfig writers_allocation_;
+};
+
+} /* namespace detail */
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif  // _FASTDDS_SUBSCRIBER_HISTORY_DATAREADERINSTANCECOLLECTION_HPP_
@@ -40,6 +40,17 @@ void compute_signature(
         const rtps::ContentFilterProperty& filter_property,
         std::array<uint8_t, 16>& filter_signature);
 
+/**
+ * Compute a signature of the filter class name, expression and parameters, ignoring the topic names.
+ * Filters created by the same factory with the same expression signature are equivalent.
+ *
+ * @param [in]  filter_property       Filtering discovery information from which to compute the signature.
+ * @param [out] expression_signature  Expression signature.
+ */
+void compute_expression_signature(
+        const rtps::ContentFilterProperty& filter_property,
+        std::array<uint8_t, 16>& expression_signature);
+
 /**
  * Compute two filter signatures, one according to RTPS 2.5 section 9.6.4.1, and one interoperable with
  * RTI Connext 6.1 and below.
@@ -264,6 +264,38 @@ void ContentFilterUtils::compute_signature(
     std::copy_n(md5_rtps.digest, filter_signature.size(), filter_signature.begin());
 }
 
+void ContentFilterUtils::compute_expression_signature(
+        const rtps::ContentFilterProperty& filter_property,
+        std::array<uint8_t, 16>& expression_signature)
+{
+    MD5 md5;
+
+    md5.init();
+
+    // Add filter_class_name
+    {
+        const char* str = filter_property.filter_class_name.c_str();
+        MD5::size_type slen = static_cast<MD5::size_type>(strlen(str) + 1);
+        md5.update(str, slen);
+    }
+    // Add filter_expression
+    {
+        const char* str = filter_property.filter_expression.c_str();
+        MD5::size_type slen = static_cast<MD5::size_type>(strlen(str) + 1);
+        md5.update(str, slen);
+    }
+    // Add expression_parameters
+    for (const auto& param : filter_property.expression_parameters)
+    {
+        const char* str = param.c_str();
+        MD5::size_type slen = static_cast<MD5::size_type>(strlen(str) + 1);
+        md5.update(str, slen);
+    }
+    md5.finalize();
+
+    std::copy_n(md5.digest, expression_signature.size(), expression_signature.begin());
+}
+
 void ContentFilterUtils::compute_signature(
         const rtps::ContentFilterProperty& filter_property,
         std::array<uint8_t, 16>& filter_signature_rtps,
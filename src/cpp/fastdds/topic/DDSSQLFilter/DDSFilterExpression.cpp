@@ -33,6 +33,7 @@
 #include "DDSFilterConditionState.hpp"
 #include "DDSFilterField.hpp"
 #include "DDSFilterParameter.hpp"
+#include "DDSFilterPayloadPlan.hpp"
 
 namespace eprosima {
 namespace fastdds {
@@ -47,35 +48,84 @@ bool DDSFilterExpression::evaluate(
     static_cast<void>(sample_info);
     static_cast<void>(reader_guid);
 
-    using namespace eprosima::fastdds::dds::xtypes;
-    using namespace eprosima::fastcdr;
+    // Always pass filter for key-only payloads
+    if (payload.is_serialized_key)
+    {
+        return true;
+    }
+
+    if (plan_.can_evaluate(payload))
+    {
+        root->reset();
+        return plan_.evaluate(payload, *root);
+    }
 
+    return decode(payload, dyn_data_) && evaluate_decoded(dyn_data_);
+}
+
+bool DDSFilterExpression::evaluate(
+        const IContentFilter::SerializedPayload& payload,
+        DecodedPayload& decoded) const
+{
     // Always pass filter for key-only payloads
     if (payload.is_serialized_key)
     {
         return true;
     }
 
-    dyn_data_->clear_all_values();
+    if (plan_.can_evaluate(payload))
+    {
+        root->reset();
+        return plan_.evaluate(payload, *root);
+    }
+
+    if (!decoded.data)
+    {
+        decoded.data = DynamicDataFactory::get_instance()->create_data(dyn_type_);
+        decoded.is_decoded = false;
+    }
+
+    if (!decoded.is_decoded)
+    {
+        decoded.is_valid = decode(payload, decoded.data);
+        decoded.is_decoded = true;
+    }
+
+    return decoded.is_valid && evaluate_decoded(decoded.data);
+}
+
+bool DDSFilterExpression::decode(
+        const IContentFilter::SerializedPayload& payload,
+        const traits<DynamicData>::ref_type& data) const
+{
+    using namespace eprosima::fastcdr;
+
+    data->clear_all_values();
     try
     {
         FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.length);
         Cdr deser(fastbuffer
                 );
         deser.read_encapsulation();
-        traits<DynamicData>::narrow<DynamicDataImpl>(dyn_data_)->deserialize(deser);
+        traits<DynamicData>::narrow<DynamicDataImpl>(data)->deserialize(deser);
     }
     catch (eprosima::fastcdr::exception::Exception& /*exception*/)
     {
         return false;
     }
 
+    return true;
+}
+
+bool DDSFilterExpression::evaluate_decoded(
+        const traits<DynamicData>::ref_type& data) const
+{
     root->reset();
     for (auto it = fields.begin();
             it != fields.end() && DDSFilterConditionState::UNDECIDED == root->get_state();
             ++it)
     {
-        if (!it->second->set_value(dyn_data_))
+        if (!it->second->set_value(data))
         {
             return false;
         }
@@ -86,6 +136,7 @@ bool DDSFilterExpression::evaluate(
 
 void DDSFilterExpression::clear()
 {
+    plan_.clear();
     DynamicDataFactory::get_instance()->delete_data(dyn_data_);
     DynamicTypeBuilderFactory::get_instance()->delete_type(dyn_type_);
     parameters.clear();
@@ -100,6 +151,11 @@ void DDSFilterExpression::set_type(
     dyn_data_ = traits<DynamicData>::narrow<DynamicDataImpl>(DynamicDataFactory::get_instance()->create_data(type));
 }
 
+void DDSFilterExpression::compile_plan()
+{
+    plan_.compile(dyn_type_, fields);
+}
+
 } // namespace DDSSQLFilter
 } // namespace dds
 } // namespace fastdds
@@ -31,6 +31,7 @@
 #include "DDSFilterCondition.hpp"
 #include "DDSFilterField.hpp"
 #include "DDSFilterParameter.hpp"
+#include "DDSFilterPayloadPlan.hpp"
 
 #include "../../xtypes/dynamic_types/DynamicDataImpl.hpp"
 
@@ -47,11 +48,52 @@ class DDSFilterExpression final : public IContentFilter
 
 public:
 
+    /**
+     * A payload deserialized into a DynamicData.
+     * Several expressions on equal types can share it when evaluating the same sample, so the payload is
+     * deserialized only once.
+     * Whether two expressions can share it should be decided beforehand, comparing the result of @c get_type.
+     */
+    struct DecodedPayload final
+    {
+        /**
+         * Indicate that a new sample is going to be evaluated.
+         * The payload will be deserialized again by the first expression that needs it.
+         */
+        void reset()
+        {
+            is_decoded = false;
+        }
+
+        /// The Dynamic data holding the deserialized payload
+        traits<DynamicData>::ref_type data;
+        /// Whether @c data holds the current payload
+        bool is_decoded = false;
+        /// Whether the current payload could be deserialized
+        bool is_valid = false;
+    };
+
     bool evaluate(
             const SerializedPayload& payload,
             const FilterSampleInfo& sample_info,
             const GUID_t& reader_guid) const final;
 
+    /**
+     * Evaluate this expression on a payload, using a shared DecodedPayload when the payload needs to be
+     * deserialized.
+     * The result does not depend on the sample information nor the reader GUID.
+     *
+     * @param [in]     payload  The payload to evaluate.
+     * @param [in,out] decoded  The deserialized view of @c payload shared with other expressions.
+     *
+     * @pre @c decoded is only shared with expressions whose type is equal to the type of this one.
+     *
+     * @return whether the payload passes the filter.
+     */
+    bool evaluate(
+            const SerializedPayload& payload,
+            DecodedPayload& decoded) const;
+
     /**
      * Clear the information held by this object.
      */
@@ -65,6 +107,22 @@ public:
     void set_type(
             DynamicType::_ref_type type);
 
+    /**
+     * @return the DynamicType used when evaluating this expression.
+     */
+    const DynamicType::_ref_type& get_type() const
+    {
+        return dyn_type_;
+    }
+
+    /**
+     * Compile the plan used to extract the referenced fields directly from the serialized payloads.
+     * When the plan cannot be used for a payload, it will be fully deserialized instead.
+     *
+     * @pre Method @c set_type has been called, and all the fields have been added.
+     */
+    void compile_plan();
+
     /// The root condition of the expression tree.
     std::unique_ptr<DDSFilterCondition> root;
     /// The fields referenced by this expression.
@@ -74,10 +132,29 @@ public:
 
 private:
 
+    /**
+     * Deserialize a payload into a DynamicData.
+     *
+     * @return whether the payload could be deserialized.
+     */
+    bool decode(
+            const SerializedPayload& payload,
+            const traits<DynamicData>::ref_type& data) const;
+
+    /**
+     * Evaluate this expression on a deserialized payload.
+     *
+     * @return whether the payload passes the filter.
+     */
+    bool evaluate_decoded(
+            const traits<DynamicData>::ref_type& data) const;
+
     /// The Dynamic type used to deserialize the payloads
     DynamicType::_ref_type dyn_type_;
     /// The Dynamic data used to deserialize the payloads
     traits<DynamicData>::ref_type dyn_data_;
+    /// The plan used to extract the fields without deserializing the payloads
+    DDSFilterPayloadPlan plan_;
 };
 
 }  // namespace DDSSQLFilter
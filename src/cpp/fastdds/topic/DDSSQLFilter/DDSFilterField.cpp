@@ -88,19 +88,24 @@ bool DDSFilterField::set_value(
 
     if (ret && last_step)
     {
-        has_value_ = true;
-        value_has_changed();
-
-        // Inform parent predicates
-        for (DDSFilterPredicate* parent : parents_)
-        {
-            parent->value_has_changed();
-        }
+        value_was_set();
     }
 
     return ret;
 }
 
+void DDSFilterField::value_was_set()
+{
+    has_value_ = true;
+    value_has_changed();
+
+    // Inform parent predicates
+    for (DDSFilterPredicate* parent : parents_)
+    {
+        parent->value_has_changed();
+    }
+}
+
 bool DDSFilterField::set_value_using_member_id(
         DynamicData::_ref_type data,
         MemberId member_id)
@@ -123,6 +123,23 @@ public:
             DynamicData::_ref_type data,
             size_t n);
 
+    /**
+     * Mark the value of this DDSFilterField as present, once it has been directly written by a
+     * DDSFilterPayloadPlan.
+     * Will notify the predicates where this DDSFilterField is being used.
+     *
+     * @post Method @c has_value returns true.
+     */
+    void value_was_set();
+
+    /**
+     * @return the access path to the field represented by this DDSFilterField.
+     */
+    inline const std::vector<FieldAccessor>& access_path() const noexcept
+    {
+        return access_path_;
+    }
+
 protected:
 
     inline void add_parent(
@@ -0,0 +1,900 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterPayloadPlan.cpp
+ */
+
+#include "DDSFilterPayloadPlan.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastdds/config.hpp>
+#include <fastdds/dds/topic/IContentFilter.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
+
+#include "DDSFilterConditionState.hpp"
+#include "DDSFilterField.hpp"
+#include "DDSFilterValue.hpp"
+
+#include "../../xtypes/dynamic_types/DynamicTypeImpl.hpp"
+#include "../../xtypes/dynamic_types/DynamicTypeMemberImpl.hpp"
+#include "../../xtypes/dynamic_types/MemberDescriptorImpl.hpp"
+#include "../../xtypes/dynamic_types/TypeDescriptorImpl.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+using TypeLayout = DDSFilterPayloadPlan::TypeLayout;
+
+/// Size of the encapsulation header. Alignment is relative to the end of it.
+static constexpr uint32_t encapsulation_size = 4u;
+/// Maximum alignment on XCDRv1 (PLAIN_CDR)
+static constexpr uint32_t xcdr1_max_alignment = 8u;
+/// Maximum alignment on XCDRv2 (PLAIN_CDR2)
+static constexpr uint32_t xcdr2_max_alignment = 4u;
+
+static traits<DynamicTypeImpl>::ref_type resolve_type(
+        const DynamicType::_ref_type& type)
+{
+    return traits<DynamicType>::narrow<DynamicTypeImpl>(type)->resolve_alias_enclosed_type();
+}
+
+static uint32_t primitive_size(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_INT8:
+        case TK_UINT8:
+        case TK_CHAR8:
+            return 1u;
+
+        case TK_INT16:
+        case TK_UINT16:
+            return 2u;
+
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+            return 4u;
+
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            return 8u;
+
+        case TK_FLOAT128:
+            return 16u;
+
+        default:
+            break;
+    }
+
+    return 0u;
+}
+
+static uint64_t align_offset(
+        uint64_t offset,
+        uint32_t size,
+        uint32_t max_alignment)
+{
+    uint64_t alignment = (std::min)(size, max_alignment);
+    uint64_t position = offset - encapsulation_size;
+    return encapsulation_size + ((position + alignment - 1u) & ~(alignment - 1u));
+}
+
+static bool is_supported_structure(
+        const traits<DynamicTypeImpl>::ref_type& type,
+        bool is_xcdr2)
+{
+    const TypeDescriptorImpl& descriptor = type->get_descriptor();
+    ExtensibilityKind extensibility = descriptor.extensibility_kind();
+
+    // Inherited members, member headers and delimiter headers are not supported
+    return !descriptor.base_type() &&
+           ExtensibilityKind::MUTABLE != extensibility &&
+           (!is_xcdr2 || ExtensibilityKind::FINAL == extensibility);
+}
+
+static std::shared_ptr<TypeLayout> build_layout(
+        const DynamicType::_ref_type& type,
+        bool is_xcdr2)
+{
+    auto resolved = resolve_type(type);
+    auto layout = std::make_shared<TypeLayout>();
+    TypeKind kind = resolved->get_kind();
+
+    switch (kind)
+    {
+        case TK_ENUM:
+        {
+            // Enumerations are serialized using their holder type
+            auto& literals = resolved->get_all_members_by_index();
+            if (literals.empty())
+            {
+                return nullptr;
+            }
+            kind = resolve_type(literals.at(0)->get_descriptor().type())->get_kind();
+            layout->kind = TypeLayout::Kind::PRIMITIVE;
+            layout->primitive_kind = kind;
+            layout->size = primitive_size(kind);
+        }
+        break;
+
+        case TK_BITMASK:
+        {
+            const BoundSeq& bound = resolved->get_descriptor().bound();
+            if (1 != bound.size())
+            {
+                return nullptr;
+            }
+            layout->kind = TypeLayout::Kind::PRIMITIVE;
+            layout->primitive_kind = 9 > bound[0] ? TK_UINT8 : 17 > bound[0] ? TK_UINT16 :
+                    33 > bound[0] ? TK_UINT32 : TK_UINT64;
+            layout->size = primitive_size(layout->primitive_kind);
+        }
+        break;
+
+        case TK_STRING8:
+            layout->kind = TypeLayout::Kind::STRING;
+            break;
+
+        case TK_STRUCTURE:
+        {
+            if (!is_supported_structure(resolved, is_xcdr2))
+            {
+                return nullptr;
+            }
+
+            layout->kind = TypeLayout::Kind::STRUCTURE;
+            for (auto& member : resolved->get_all_members_by_index())
+            {
+                if (member->get_descriptor().is_optional())
+                {
+                    return nullptr;
+                }
+
+                auto member_layout = build_layout(member->get_descriptor().type(), is_xcdr2);
+                if (!member_layout)
+                {
+                    return nullptr;
+                }
+                layout->members.push_back(member_layout);
+            }
+        }
+        break;
+
+        case TK_ARRAY:
+        case TK_SEQUENCE:
+        {
+            const TypeDescriptorImpl& descriptor = resolved->get_descriptor();
+            layout->element = build_layout(descriptor.element_type(), is_xcdr2);
+            if (!layout->element)
+            {
+                return nullptr;
+            }
+
+            layout->has_dheader = is_xcdr2 && TypeLayout::Kind::PRIMITIVE != layout->element->kind;
+            if (TK_SEQUENCE == kind)
+            {
+                layout->kind = TypeLayout::Kind::SEQUENCE;
+            }
+            else
+            {
+                uint64_t n_elements = 1u;
+                for (uint32_t dimension : descriptor.bound())
+                {
+                    n_elements *= dimension;
+                    if (n_elements > std::numeric_limits<uint32_t>::max())
+                    {
+                        return nullptr;
+                    }
+                }
+                layout->kind = TypeLayout::Kind::ARRAY;
+                layout->size = static_cast<uint32_t>(n_elements);
+            }
+        }
+        break;
+
+        default:
+            layout->kind = TypeLayout::Kind::PRIMITIVE;
+            layout->primitive_kind = kind;
+            layout->size = primitive_size(kind);
+            break;
+    }
+
+    if (TypeLayout::Kind::PRIMITIVE == layout->kind && 0u == layout->size)
+    {
+        // Wide characters, unions, maps, bitsets, etc. are not supported
+        return nullptr;
+    }
+
+    return layout;
+}
+
+/**
+ * Try to compute, at compile time, the position after skipping a number of values of a type.
+ * Only possible when the type has no variable length parts.
+ */
+static bool fold_skip(
+        const TypeLayout& layout,
+        uint64_t count,
+        uint32_t max_alignment,
+        uint64_t& offset)
+{
+    if (0u == count)
+    {
+        return true;
+    }
+
+    switch (layout.kind)
+    {
+        case TypeLayout::Kind::PRIMITIVE:
+            offset = align_offset(offset, layout.size, max_alignment) + count * layout.size;
+            break;
+
+        case TypeLayout::Kind::ARRAY:
+            if (layout.has_dheader)
+            {
+                return false;
+            }
+            if (TypeLayout::Kind::PRIMITIVE == layout.element->kind)
+            {
+                return fold_skip(*layout.element, count * layout.size, max_alignment, offset);
+            }
+            for (uint64_t n = 0; n < count; ++n)
+            {
+                if (!fold_skip(*layout.element, layout.size, max_alignment, offset))
+                {
+                    return false;
+                }
+            }
+            break;
+
+        case TypeLayout::Kind::STRUCTURE:
+            for (uint64_t n = 0; n < count; ++n)
+            {
+                for (const auto& member : layout.members)
+                {
+                    if (!fold_skip(*member, 1u, max_alignment, offset))
+                    {
+                        return false;
+                    }
+                }
+            }
+            break;
+
+        default:
+            return false;
+    }
+
+    return offset <= std::numeric_limits<uint32_t>::max();
+}
+
+/**
+ * Check whether a kind of value can be stored on a DDSFilterField of a certain kind.
+ */
+static bool is_compatible(
+        DDSFilterValue::ValueKind field_kind,
+        TypeKind value_kind,
+        bool is_enum)
+{
+    switch (field_kind)
+    {
+        case DDSFilterValue::ValueKind::BOOLEAN:
+            return TK_BOOLEAN == value_kind;
+
+        case DDSFilterValue::ValueKind::CHAR:
+            return TK_CHAR8 == value_kind;
+
+        case DDSFilterValue::ValueKind::STRING:
+            return TK_STRING8 == value_kind;
+
+        case DDSFilterValue::ValueKind::ENUM:
+            return is_enum;
+
+        case DDSFilterValue::ValueKind::SIGNED_INTEGER:
+            return TK_INT8 == value_kind || TK_INT16 == value_kind ||
+                   TK_INT32 == value_kind || TK_INT64 == value_kind;
+
+        case DDSFilterValue::ValueKind::UNSIGNED_INTEGER:
+            return TK_BYTE == value_kind || TK_UINT8 == value_kind || TK_UINT16 == value_kind ||
+                   TK_UINT32 == value_kind || TK_UINT64 == value_kind;
+
+        case DDSFilterValue::ValueKind::FLOAT_FIELD:
+            return TK_FLOAT32 == value_kind;
+
+        case DDSFilterValue::ValueKind::DOUBLE_FIELD:
+            return TK_FLOAT64 == value_kind;
+
+        case DDSFilterValue::ValueKind::LONG_DOUBLE_FIELD:
+            // Only platforms where long double matches the wire representation are supported
+            return TK_FLOAT128 == value_kind && 16u == sizeof(long double);
+
+        default:
+            break;
+    }
+
+    return false;
+}
+
+/**
+ * Helper to navigate a plain CDR payload.
+ */
+class PayloadCursor final
+{
+
+public:
+
+    PayloadCursor(
+            const IContentFilter::SerializedPayload& payload,
+            uint32_t offset,
+            uint32_t max_alignment) noexcept
+        : buffer_(payload.data)
+        , length_(payload.length)
+        , offset_(offset)
+        , max_alignment_(max_alignment)
+    {
+#if FASTDDS_IS_BIG_ENDIAN_TARGET
+        swap_ = 0 != (payload.data[1] & 0x01);
+#else
+        swap_ = 0 == (payload.data[1] & 0x01);
+#endif  // FASTDDS_IS_BIG_ENDIAN_TARGET
+    }
+
+    bool is_valid() const noexcept
+    {
+        return offset_ <= length_;
+    }
+
+    bool advance(
+            uint64_t n_bytes) noexcept
+    {
+        offset_ += n_bytes;
+        return is_valid();
+    }
+
+    bool align(
+            uint32_t size) noexcept
+    {
+        offset_ = align_offset(offset_, size, max_alignment_);
+        return is_valid();
+    }
+
+    template<typename T>
+    bool read(
+            T& value) noexcept
+    {
+        return read(&value, sizeof(T));
+    }
+
+    bool read(
+            void* value,
+            uint32_t size) noexcept
+    {
+        if (!align(size) || length_ - offset_ < size)
+        {
+            return false;
+        }
+
+        unsigned char* dst = static_cast<unsigned char*>(value);
+        std::memcpy(dst, &buffer_[offset_], size);
+        if (swap_)
+        {
+            std::reverse(dst, dst + size);
+        }
+        offset_ += size;
+        return true;
+    }
+
+    bool read_string(
+            const char*& str,
+            uint32_t& str_length) noexcept
+    {
+        if (!read(str_length) || !advance(str_length))
+        {
+            return false;
+        }
+
+        str = reinterpret_cast<const char*>(&buffer_[offset_ - str_length]);
+        if (0u < str_length)
+        {
+            // Remove null terminator
+            --str_length;
+        }
+        return true;
+    }
+
+    bool skip(
+            const TypeLayout& layout,
+            uint32_t count) noexcept
+    {
+        if (0u == count)
+        {
+            return true;
+        }
+
+        if (TypeLayout::Kind::PRIMITIVE == layout.kind)
+        {
+            return align(layout.size) && advance(static_cast<uint64_t>(count) * layout.size);
+        }
+
+        for (uint32_t n = 0; n < count; ++n)
+        {
+            if (!skip(layout))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool skip_dheader() noexcept
+    {
+        uint32_t dheader = 0;
+        return read(dheader);
+    }
+
+private:
+
+    bool skip(
+            const TypeLayout& layout) noexcept
+    {
+        uint32_t length = 0;
+
+        if (layout.has_dheader)
+        {
+            return read(length) && advance(length);
+        }
+
+        switch (layout.kind)
+        {
+            case TypeLayout::Kind::STRING:
+                return read(length) && advance(length);
+
+            case TypeLayout::Kind::STRUCTURE:
+                for (const auto& member : layout.members)
+                {
+                    if (!skip(*member, 1u))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+
+            case TypeLayout::Kind::ARRAY:
+                return skip(*layout.element, layout.size);
+
+            case TypeLayout::Kind::SEQUENCE:
+                return read(length) && skip(*layout.element, length);
+
+            default:
+                break;
+        }
+
+        return skip(layout, 1u);
+    }
+
+    const rtps::octet* buffer_;
+    uint32_t length_;
+    uint64_t offset_;
+    uint32_t max_alignment_;
+    bool swap_;
+};
+
+bool DDSFilterPayloadPlan::compile(
+        DynamicType::_ref_type type,
+        const std::map<std::string, std::shared_ptr<DDSFilterField>>& fields)
+{
+    clear();
+
+    xcdr1_plan_.is_valid = true;
+    xcdr2_plan_.is_valid = true;
+    for (const auto& field : fields)
+    {
+        fields_.push_back(field.second);
+
+        xcdr1_plan_.fields.emplace_back();
+        xcdr1_plan_.is_valid = xcdr1_plan_.is_valid &&
+                compile(type, *field.second, xcdr1_max_alignment, xcdr1_plan_.fields.back());
+
+        xcdr2_plan_.fields.emplace_back();
+        xcdr2_plan_.is_valid = xcdr2_plan_.is_valid &&
+                compile(type, *field.second, xcdr2_max_alignment, xcdr2_plan_.fields.back());
+    }
+
+    return xcdr1_plan_.is_valid || xcdr2_plan_.is_valid;
+}
+
+void DDSFilterPayloadPlan::clear()
+{
+    fields_.clear();
+    xcdr1_plan_ = EncodingPlan();
+    xcdr2_plan_ = EncodingPlan();
+    layouts_.clear();
+}
+
+bool DDSFilterPayloadPlan::can_evaluate(
+        const IContentFilter::SerializedPayload& payload) const noexcept
+{
+    if (nullptr == payload.data || encapsulation_size > payload.length || 0 != payload.data[0])
+    {
+        return false;
+    }
+
+    switch (payload.data[1])
+    {
+        // CDR_BE, CDR_LE
+        case 0x00:
+        case 0x01:
+            return xcdr1_plan_.is_valid;
+
+        // CDR2_BE, CDR2_LE
+        case 0x06:
+        case 0x07:
+            return xcdr2_plan_.is_valid;
+
+        default:
+            break;
+    }
+
+    return false;
+}
+
+bool DDSFilterPayloadPlan::evaluate(
+        const IContentFilter::SerializedPayload& payload,
+        const DDSFilterCondition& root) const
+{
+    assert(can_evaluate(payload));
+
+    bool is_xcdr1 = 0x02 > payload.data[1];
+    const EncodingPlan& plan = is_xcdr1 ? xcdr1_plan_ : xcdr2_plan_;
+    uint32_t max_alignment = is_xcdr1 ? xcdr1_max_alignment : xcdr2_max_alignment;
+
+    for (size_t n = 0; n < fields_.size() && DDSFilterConditionState::UNDECIDED == root.get_state(); ++n)
+    {
+        if (!extract(payload, plan.fields[n], max_alignment, *fields_[n]))
+        {
+            return false;
+        }
+    }
+
+    return DDSFilterConditionState::RESULT_TRUE == root.get_state();
+}
+
+bool DDSFilterPayloadPlan::compile(
+        const DynamicType::_ref_type& type,
+        const DDSFilterField& field,
+        uint32_t max_alignment,
+        FieldPlan& plan)
+{
+    bool is_xcdr2 = xcdr2_max_alignment == max_alignment;
+    const std::vector<DDSFilterField::FieldAccessor>& access_path = field.access_path();
+    uint64_t offset = encapsulation_size;
+
+    auto add_skip = [&](const std::shared_ptr<TypeLayout>& layout, uint32_t count)
+            {
+                // Position is known at compile time until the first variable-length skip
+                uint64_t new_offset = offset;
+                if (plan.steps.empty() && fold_skip(*layout, count, max_alignment, new_offset))
+                {
+                    offset = new_offset;
+                }
+                else if (0u < count)
+                {
+                    layouts_.push_back(layout);
+                    plan.steps.push_back({Step::Kind::SKIP_TYPE, count, layout.get()});
+                }
+            };
+
+    auto add_dheader = [&]()
+            {
+                if (plan.steps.empty())
+                {
+                    offset = align_offset(offset, 4u, max_alignment) + 4u;
+                }
+                else
+                {
+                    plan.steps.push_back({Step::Kind::SKIP_DHEADER, 0u, nullptr});
+                }
+            };
+
+    if (access_path.empty())
+    {
+        return false;
+    }
+
+    traits<DynamicTypeImpl>::ref_type current_type = resolve_type(type);
+    bool is_enum = false;
+    for (size_t n = 0; n < access_path.size(); ++n)
+    {
+        if (TK_STRUCTURE != current_type->get_kind())
+        {
+            return false;
+        }
+
+        if (!is_supported_structure(current_type, is_xcdr2))
+        {
+            return false;
+        }
+
+        auto& members = current_type->get_all_members_by_index();
+        size_t member_index = access_path[n].member_index;
+        if (member_index >= members.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < member_index; ++i)
+        {
+            auto member_layout = build_layout(members[i]->get_descriptor().type(), is_xcdr2);
+            if (!member_layout || members[i]->get_descriptor().is_optional())
+            {
+                return false;
+            }
+            add_skip(member_layout, 1u);
+        }
+
+        if (members[member_index]->get_descriptor().is_optional())
+        {
+            return false;
+        }
+        current_type = resolve_type(members[member_index]->get_descriptor().type());
+
+        if (access_path[n].array_index < MEMBER_ID_INVALID)
+        {
+            TypeKind collection_kind = current_type->get_kind();
+            if (TK_ARRAY != collection_kind && TK_SEQUENCE != collection_kind)
+            {
+                return false;
+            }
+
+            auto collection_layout = build_layout(current_type, is_xcdr2);
+            if (!collection_layout)
+            {
+                return false;
+            }
+
+            uint32_t index = static_cast<uint32_t>(access_path[n].array_index);
+            if (collection_layout->has_dheader)
+            {
+                add_dheader();
+            }
+
+            if (TK_ARRAY == collection_kind)
+            {
+                if (index >= collection_layout->size)
+                {
+                    return false;
+                }
+                add_skip(collection_layout->element, index);
+            }
+            else
+            {
+                layouts_.push_back(collection_layout->element);
+                plan.steps.push_back({Step::Kind::SELECT_SEQUENCE_ITEM, index, collection_layout->element.get()});
+            }
+
+            current_type = resolve_type(current_type->get_descriptor().element_type());
+        }
+    }
+
+    TypeKind value_kind = current_type->get_kind();
+    if (TK_ENUM == value_kind)
+    {
+        auto enum_layout = build_layout(current_type, is_xcdr2);
+        if (!enum_layout)
+        {
+            return false;
+        }
+        is_enum = true;
+        value_kind = enum_layout->primitive_kind;
+    }
+
+    if (!is_compatible(field.kind, value_kind, is_enum))
+    {
+        return false;
+    }
+
+    plan.value_kind = value_kind;
+    plan.value_size = primitive_size(value_kind);
+    plan.start_offset = static_cast<uint32_t>(offset);
+    return true;
+}
+
+bool DDSFilterPayloadPlan::extract(
+        const IContentFilter::SerializedPayload& payload,
+        const FieldPlan& plan,
+        uint32_t max_alignment,
+        DDSFilterField& field) const
+{
+    PayloadCursor cursor(payload, plan.start_offset, max_alignment);
+    if (!cursor.is_valid())
+    {
+        return false;
+    }
+
+    for (const Step& step : plan.steps)
+    {
+        bool ret = false;
+        switch (step.kind)
+        {
+            case Step::Kind::SKIP_TYPE:
+                ret = cursor.skip(*step.layout, step.count);
+                break;
+
+            case Step::Kind::SKIP_DHEADER:
+                ret = cursor.skip_dheader();
+                break;
+
+            case Step::Kind::SELECT_SEQUENCE_ITEM:
+            {
+                uint32_t length = 0;
+                ret = cursor.read(length) && step.count < length && cursor.skip(*step.layout, step.count);
+            }
+            break;
+        }
+
+        if (!ret)
+        {
+            return false;
+        }
+    }
+
+    bool ret = false;
+    switch (plan.value_kind)
+    {
+        case TK_STRING8:
+        {
+            const char* str = nullptr;
+            uint32_t str_length = 0;
+            ret = cursor.read_string(str, str_length);
+            if (ret)
+            {
+                field.string_value.assign(str, str_length);
+            }
+        }
+        break;
+
+        case TK_BOOLEAN:
+        {
+            uint8_t value = 0;
+            ret = cursor.read(value) && 1u >= value;
+            field.boolean_value = 0u != value;
+        }
+        break;
+
+        case TK_CHAR8:
+            ret = cursor.read(field.char_value);
+            break;
+
+        case TK_INT8:
+        {
+            int8_t value = 0;
+            ret = cursor.read(value);
+            field.signed_integer_value = value;
+        }
+        break;
+
+        case TK_INT16:
+        {
+            int16_t value = 0;
+            ret = cursor.read(value);
+            field.signed_integer_value = value;
+        }
+        break;
+
+        case TK_INT32:
+        {
+            int32_t value = 0;
+            ret = cursor.read(value);
+            field.signed_integer_value = value;
+        }
+        break;
+
+        case TK_INT64:
+            ret = cursor.read(field.signed_integer_value);
+            break;
+
+        case TK_BYTE:
+        case TK_UINT8:
+        case TK_UINT16:
+        case TK_UINT32:
+        case TK_UINT64:
+        {
+            // All the unsigned kinds are read using their wire size
+            uint64_t value = 0;
+            uint8_t value8 = 0;
+            uint16_t value16 = 0;
+            uint32_t value32 = 0;
+            switch (plan.value_size)
+            {
+                case 1u:
+                    ret = cursor.read(value8);
+                    value = value8;
+                    break;
+                case 2u:
+                    ret = cursor.read(value16);
+                    value = value16;
+                    break;
+                case 4u:
+                    ret = cursor.read(value32);
+                    value = value32;
+                    break;
+                default:
+                    ret = cursor.read(value);
+                    break;
+            }
+
+            if (DDSFilterValue::ValueKind::ENUM == field.kind)
+            {
+                field.signed_integer_value = static_cast<int64_t>(value);
+            }
+            else
+            {
+                field.unsigned_integer_value = value;
+            }
+        }
+        break;
+
+        case TK_FLOAT32:
+        {
+            float value = 0;
+            ret = cursor.read(value);
+            field.float_value = value;
+        }
+        break;
+
+        case TK_FLOAT64:
+        {
+            double value = 0;
+            ret = cursor.read(value);
+            field.float_value = value;
+        }
+        break;
+
+        case TK_FLOAT128:
+            ret = cursor.read(&field.float_value, plan.value_size);
+            break;
+
+        default:
+            break;
+    }
+
+    if (ret)
+    {
+        field.value_was_set();
+    }
+
+    return ret;
+}
+
+}  // namespace DDSSQLFilter
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
@@ -0,0 +1,196 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterPayloadPlan.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPAYLOADPLAN_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPAYLOADPLAN_HPP_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/topic/IContentFilter.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
+
+#include "DDSFilterCondition.hpp"
+#include "DDSFilterField.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+/**
+ * A precompiled plan to extract the fields referenced by a DDS-SQL filter expression directly from a
+ * serialized payload, without deserializing the whole sample into a DynamicData.
+ *
+ * The plan is compiled against the DynamicType of the topic into a sequence of CDR offsets and skips for each
+ * field, once for each plain encoding (XCDRv1 and XCDRv2).
+ * Only types whose layout does not depend on member headers can be compiled (i.e. no mutable types, no optional
+ * members, no appendable types when using XCDRv2, and no unions, maps or wide strings before the referenced fields).
+ * When a payload cannot be processed by the plan, the full deserialization path should be used instead.
+ */
+class DDSFilterPayloadPlan final
+{
+
+public:
+
+    /**
+     * Compile the plan for a set of fields.
+     *
+     * @param [in] type    The DynamicType of the payloads that will be processed.
+     * @param [in] fields  The fields referenced by the filter expression, in evaluation order.
+     *
+     * @return whether the plan could be compiled for at least one encoding.
+     */
+    bool compile(
+            DynamicType::_ref_type type,
+            const std::map<std::string, std::shared_ptr<DDSFilterField>>& fields);
+
+    /**
+     * Clear the information held by this object.
+     */
+    void clear();
+
+    /**
+     * Check whether a payload can be processed by this plan.
+     *
+     * @param [in] payload  The payload to check.
+     *
+     * @return whether the payload encoding is one for which this plan has been compiled.
+     */
+    bool can_evaluate(
+            const IContentFilter::SerializedPayload& payload) const noexcept;
+
+    /**
+     * Evaluate a filter expression against a payload.
+     * Fields are extracted lazily, in evaluation order, until the root condition is decided.
+     *
+     * @param [in] payload  The payload to evaluate.
+     * @param [in] root     The root condition of the filter expression.
+     *
+     * @return whether the payload passes the filter.
+     *
+     * @pre Method @c can_evaluate returns true for @c payload.
+     * @pre The root condition has been reset.
+     */
+    bool evaluate(
+            const IContentFilter::SerializedPayload& payload,
+            const DDSFilterCondition& root) const;
+
+    /**
+     * Serialized layout of a type, as needed for skipping it on a payload.
+     */
+    struct TypeLayout final
+    {
+        enum class Kind : uint8_t
+        {
+            PRIMITIVE,  ///< Fixed size type (primitives, enumerations and bitmasks)
+            STRING,     ///< Length-prefixed string of 8-bit characters
+            STRUCTURE,  ///< Sequence of members
+            ARRAY,      ///< Fixed number of elements
+            SEQUENCE    ///< Length-prefixed sequence of elements
+        };
+
+        /// Kind of layout
+        Kind kind = Kind::PRIMITIVE;
+        /// Whether a delimiter header (DHEADER) is present before the contents (XCDRv2 only)
+        bool has_dheader = false;
+        /// PRIMITIVE: size of the type / ARRAY: number of elements
+        uint32_t size = 0;
+        /// PRIMITIVE: TypeKind used to represent the value on the wire
+        TypeKind primitive_kind = TK_NONE;
+        /// STRUCTURE: layouts of the members
+        std::vector<std::shared_ptr<TypeLayout>> members;
+        /// ARRAY / SEQUENCE: layout of the elements
+        std::shared_ptr<TypeLayout> element;
+    };
+
+private:
+
+    /**
+     * An operation on the way to the value of a field.
+     */
+    struct Step final
+    {
+        enum class Kind : uint8_t
+        {
+            SKIP_TYPE,           ///< Skip @c count consecutive values of type @c layout
+            SKIP_DHEADER,        ///< Skip a delimiter header
+            SELECT_SEQUENCE_ITEM ///< Read the length of a sequence, and position on element @c count
+        };
+
+        Kind kind;
+        uint32_t count;
+        const TypeLayout* layout;
+    };
+
+    /**
+     * The steps needed to extract a field from a payload encoded with a specific encoding.
+     */
+    struct FieldPlan final
+    {
+        /// Position where the first step should start (including the encapsulation header)
+        uint32_t start_offset = 0;
+        /// Steps to perform from start_offset
+        std::vector<Step> steps;
+        /// Kind of the value at the end of the access path
+        TypeKind value_kind = TK_NONE;
+        /// Size of the value at the end of the access path
+        uint32_t value_size = 0;
+    };
+
+    /**
+     * Plan for all the fields using a specific encoding.
+     */
+    struct EncodingPlan final
+    {
+        bool is_valid = false;
+        std::vector<FieldPlan> fields;
+    };
+
+    bool compile(
+            const DynamicType::_ref_type& type,
+            const DDSFilterField& field,
+            uint32_t max_alignment,
+            FieldPlan& plan);
+
+    bool extract(
+            const IContentFilter::SerializedPayload& payload,
+            const FieldPlan& plan,
+            uint32_t max_alignment,
+            DDSFilterField& field) const;
+
+    /// Fields to extract, in evaluation order
+    std::vector<std::shared_ptr<DDSFilterField>> fields_;
+    /// Plan for payloads encoded with XCDRv1 (PLAIN_CDR)
+    EncodingPlan xcdr1_plan_;
+    /// Plan for payloads encoded with XCDRv2 (PLAIN_CDR2)
+    EncodingPlan xcdr2_plan_;
+    /// Layouts referenced by the steps of the plans
+    std::vector<std::shared_ptr<TypeLayout>> layouts_;
+};
+
+}  // namespace DDSSQLFilter
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif  // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERPAYLOADPLAN_HPP_
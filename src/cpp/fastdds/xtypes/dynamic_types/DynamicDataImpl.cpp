@@ -150,6 +150,13 @@ ReturnCode_t clear_sequence_typed_element(
 
 DynamicDataImpl::DynamicDataImpl(
         traits<DynamicType>::ref_type type) noexcept
+    : DynamicDataImpl(type, nullptr)
+{
+}
+
+DynamicDataImpl::DynamicDataImpl(
+        traits<DynamicType>::ref_type type,
+        const std::shared_ptr<DynamicDataArena>& arena) noexcept
     : type_(traits<DynamicType>::narrow<DynamicTypeImpl>(type))
     , enclosing_type_(get_enclosing_type(type_))
 {
@@ -160,11 +167,23 @@ DynamicDataImpl::DynamicDataImpl(
             TK_STRUCTURE == type_kind ||
             TK_UNION == type_kind)
     {
-        for (auto& member : enclosing_type_->get_all_members_by_index())
+        const auto& members = enclosing_type_->get_all_members_by_index();
+        value_.reserve(members.size());
+
+        // All the members, and their primitive values, are allocated in a single block.
+        std::shared_ptr<DynamicDataArena> members_arena;
+        if (!members.empty())
         {
-            traits<DynamicData>::ref_type data = DynamicDataFactory::get_instance()->create_data(
-                member->get_descriptor().type());
-            traits<DynamicDataImpl>::ref_type data_impl = traits<DynamicData>::narrow<DynamicDataImpl>(data);
+            members_arena = std::make_shared<DynamicDataArena>(members.size() *
+                            (DynamicDataArena::shared_block_size(sizeof(DynamicDataImpl)) +
+                            DynamicDataArena::shared_block_size(sizeof(TypeForKind<TK_STRING16>))));
+        }
+
+        for (auto& member : members)
+        {
+            traits<DynamicDataImpl>::ref_type data_impl = make_dynamic_data_value<DynamicDataImpl>(members_arena,
+                            member->get_descriptor().type(), members_arena);
+            traits<DynamicData>::ref_type data = data_impl;
 
             set_default_value(member, data_impl);
 
@@ -188,7 +207,7 @@ DynamicDataImpl::DynamicDataImpl(
     }
     else if (TK_MAP != type_kind)     // Primitives
     {
-        add_value(type_kind, MEMBER_ID_INVALID);
+        add_value(type_kind, MEMBER_ID_INVALID, arena);
     }
 }
 
@@ -296,6 +315,7 @@ traits<DynamicData>::ref_type DynamicDataImpl::clone() noexcept
             TK_UNION == type_kind)
     {
         ret_value->selected_union_member_ = selected_union_member_;
+        ret_value->value_.reserve(value_.size());
         for (const auto& value : value_)
         {
             ret_value->value_.emplace(value.first, std::static_pointer_cast<DynamicDataImpl>(value.second)->clone());
@@ -320,6 +340,7 @@ traits<DynamicData>::ref_type DynamicDataImpl::clone() noexcept
                 get_enclosing_typekind(traits<DynamicType>::narrow<DynamicTypeImpl>(
                             enclosing_type_->get_descriptor().element_type()));
 
+        ret_value->value_.reserve(value_.size());
         for (const auto& value : value_)
         {
             if (is_complex_kind(element_kind))
@@ -2241,97 +2262,98 @@ void DynamicDataImpl::add_sequence_value(
     }
 }
 
-std::map<MemberId, std::shared_ptr<void>>::iterator DynamicDataImpl::add_value(
+DynamicDataValues::iterator DynamicDataImpl::add_value(
         TypeKind kind,
-        MemberId id) noexcept
+        MemberId id,
+        const std::shared_ptr<DynamicDataArena>& arena) noexcept
 {
-    std::map<MemberId, std::shared_ptr<void>>::iterator ret_value {value_.end()};
+    DynamicDataValues::iterator ret_value {value_.end()};
 
     switch (kind)
     {
         case TK_INT32:
         {
-            ret_value =  value_.emplace(id, std::make_shared<TypeForKind<TK_INT32>>()).first;
+            ret_value =  value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_INT32>>(arena)).first;
         }
         break;
         case TK_UINT32:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_UINT32>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_UINT32>>(arena)).first;
         }
         break;
         case TK_INT8:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_INT8>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_INT8>>(arena)).first;
         }
         break;
         case TK_INT16:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_INT16>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_INT16>>(arena)).first;
         }
         break;
         case TK_UINT16:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_UINT16>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_UINT16>>(arena)).first;
         }
         break;
         case TK_INT64:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_INT64>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_INT64>>(arena)).first;
         }
         break;
         case TK_UINT64:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_UINT64>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_UINT64>>(arena)).first;
         }
         break;
         case TK_FLOAT32:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_FLOAT32>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_FLOAT32>>(arena)).first;
         }
         break;
         case TK_FLOAT64:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_FLOAT64>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_FLOAT64>>(arena)).first;
         }
         break;
         case TK_FLOAT128:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_FLOAT128>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_FLOAT128>>(arena)).first;
         }
         break;
         case TK_CHAR8:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_CHAR8>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_CHAR8>>(arena)).first;
         }
         break;
         case TK_CHAR16:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_CHAR16>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_CHAR16>>(arena)).first;
         }
         break;
         case TK_BOOLEAN:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_BOOLEAN>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_BOOLEAN>>(arena)).first;
         }
         break;
         case TK_BYTE:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_BYTE>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_BYTE>>(arena)).first;
         }
         break;
         case TK_UINT8:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_UINT8>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_UINT8>>(arena)).first;
         }
         break;
         case TK_STRING8:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_STRING8>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_STRING8>>(arena)).first;
         }
         break;
         case TK_STRING16:
         {
-            ret_value = value_.emplace(id, std::make_shared<TypeForKind<TK_STRING16>>()).first;
+            ret_value = value_.emplace(id, make_dynamic_data_value<TypeForKind<TK_STRING16>>(arena)).first;
         }
         break;
         default:
@@ -3096,7 +3118,7 @@ TypeKind DynamicDataImpl::get_enclosing_typekind(
 template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::get_primitive_value(
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        DynamicDataValues::iterator value_iterator,
         TypeForKind<TK>& value,
         MemberId member_id) noexcept
 {
@@ -3301,7 +3323,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
 template<>
 ReturnCode_t DynamicDataImpl::get_primitive_value<TK_STRING8>(
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        DynamicDataValues::iterator value_iterator,
         TypeForKind<TK_STRING8>& value,
         MemberId member_id) noexcept
 {
@@ -3334,7 +3356,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value<TK_STRING8>(
 template<>
 ReturnCode_t DynamicDataImpl::get_primitive_value<TK_STRING16>(
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        DynamicDataValues::iterator value_iterator,
         TypeForKind<TK_STRING16>& value,
         MemberId member_id) noexcept
 {
@@ -3569,7 +3591,7 @@ ReturnCode_t DynamicDataImpl::get_sequence_values(
 template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::get_sequence_values_bitmask(
         MemberId id,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         SequenceTypeForKind<TK>& value,
         size_t number_of_elements) noexcept
 {
@@ -3608,7 +3630,7 @@ ReturnCode_t DynamicDataImpl::get_sequence_values_bitmask(
 template<>
 ReturnCode_t DynamicDataImpl::get_sequence_values_bitmask<TK_STRING8>(
         MemberId,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator,
+        DynamicDataValues::const_iterator,
         SequenceTypeForKind<TK_STRING8>&,
         size_t) noexcept
 {
@@ -3618,7 +3640,7 @@ ReturnCode_t DynamicDataImpl::get_sequence_values_bitmask<TK_STRING8>(
 template<>
 ReturnCode_t DynamicDataImpl::get_sequence_values_bitmask<TK_STRING16>(
         MemberId,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator,
+        DynamicDataValues::const_iterator,
         SequenceTypeForKind<TK_STRING16>&,
         size_t) noexcept
 {
@@ -3629,7 +3651,7 @@ template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::get_sequence_values_primitive(
         MemberId id,
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         SequenceTypeForKind<TK>& value,
         size_t number_of_elements) noexcept
 {
@@ -3691,7 +3713,7 @@ template<>
 ReturnCode_t DynamicDataImpl::get_sequence_values_primitive<TK_STRING8>(
         MemberId id,
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         SequenceTypeForKind<TK_STRING8>& value,
         size_t number_of_elements) noexcept
 {
@@ -3728,7 +3750,7 @@ template<>
 ReturnCode_t DynamicDataImpl::get_sequence_values_primitive<TK_STRING16>(
         MemberId id,
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         SequenceTypeForKind<TK_STRING16>& value,
         size_t number_of_elements) noexcept
 {
@@ -3764,7 +3786,7 @@ ReturnCode_t DynamicDataImpl::get_sequence_values_primitive<TK_STRING16>(
 template<TypeKind TK, TypeKind ToTK>
 ReturnCode_t DynamicDataImpl::get_sequence_values_promoting(
         MemberId id,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         SequenceTypeForKind<TK>& value,
         size_t number_of_elements) noexcept
 {
@@ -4111,7 +4133,7 @@ void DynamicDataImpl::set_discriminator_value(
 template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::set_primitive_value(
         const traits<DynamicTypeImpl>::ref_type& element_type,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        DynamicDataValues::iterator value_iterator,
         const TypeForKind<TK>& value) noexcept
 {
     ReturnCode_t ret_value = RETCODE_BAD_PARAMETER;
@@ -4257,7 +4279,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
 template<>
 ReturnCode_t DynamicDataImpl::set_primitive_value<TK_STRING8>(
         const traits<DynamicTypeImpl>::ref_type& element_type,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        DynamicDataValues::iterator value_iterator,
         const TypeForKind<TK_STRING8>& value) noexcept
 {
     ReturnCode_t ret_value = RETCODE_BAD_PARAMETER;
@@ -4281,7 +4303,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value<TK_STRING8>(
 template<>
 ReturnCode_t DynamicDataImpl::set_primitive_value<TK_STRING16>(
         const traits<DynamicTypeImpl>::ref_type& element_type,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        DynamicDataValues::iterator value_iterator,
         const TypeForKind<TK_STRING16>& value) noexcept
 {
     ReturnCode_t ret_value = RETCODE_BAD_PARAMETER;
@@ -4498,7 +4520,7 @@ ReturnCode_t DynamicDataImpl::set_sequence_values(
 template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::set_sequence_values_bitmask(
         MemberId id,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         const SequenceTypeForKind<TK>& value) noexcept
 {
     TypeKind type_kind = enclosing_type_->get_kind();
@@ -4540,7 +4562,7 @@ template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::set_sequence_values_primitive(
         MemberId id,
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         const SequenceTypeForKind<TK>& value) noexcept
 {
     ReturnCode_t ret_value {RETCODE_BAD_PARAMETER};
@@ -4601,7 +4623,7 @@ template<>
 ReturnCode_t DynamicDataImpl::set_sequence_values_primitive<TK_STRING8>(
         MemberId id,
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         const SequenceTypeForKind<TK_STRING8>& value) noexcept
 {
     if (TK_STRING8 == element_kind)
@@ -4635,7 +4657,7 @@ template<>
 ReturnCode_t DynamicDataImpl::set_sequence_values_primitive<TK_STRING16>(
         MemberId id,
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         const SequenceTypeForKind<TK_STRING16>& value) noexcept
 {
     if (TK_STRING16 == element_kind)
@@ -4668,7 +4690,7 @@ ReturnCode_t DynamicDataImpl::set_sequence_values_primitive<TK_STRING16>(
 template<TypeKind TK, TypeKind ToTK>
 ReturnCode_t DynamicDataImpl::set_sequence_values_promoting(
         MemberId id,
-        std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+        DynamicDataValues::const_iterator value_iterator,
         const SequenceTypeForKind<TK>& value) noexcept
 {
     TypeKind type_kind = enclosing_type_->get_kind();
@@ -6238,7 +6260,7 @@ bool DynamicDataImpl::deserialize(
                     }
                     MemberId id = next_map_member_id_++;
                     key_to_id_[key] = id;
-                    std::map<MemberId, std::shared_ptr<void>>::iterator insert_it {value_.end()};
+                    DynamicDataValues::iterator insert_it {value_.end()};
 
                     if (!is_complex_kind(element_kind))
                     {
@@ -6517,7 +6539,7 @@ bool DynamicDataImpl::deserialize(
                                 traits<DynamicData>::narrow<DynamicDataImpl>(DynamicDataFactory::get_instance()
                                         ->create_data(
                                     member_impl->get_descriptor().type()));
-                                value_.emplace(it->first, member_data);
+                                value_.emplace(member_impl->get_id(), member_data);
                             }
 
                             dcdr >> member_data;
@@ -21,6 +21,7 @@
 #include <fastdds/dds/core/Types.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
 
+#include "DynamicDataValues.hpp"
 #include "DynamicTypeImpl.hpp"
 #include "TypeForKind.hpp"
 
@@ -44,8 +45,8 @@ class DynamicDataImpl : public traits<DynamicData>::base_type
     //! Enclosed type in case of `type_` is TK_ALIAS or TK_ENUM. In other case, the same value as `type_`.
     traits<DynamicTypeImpl>::ref_type enclosing_type_;
 
-    //! Contains the values of the current sample.
-    std::map<MemberId, std::shared_ptr<void>> value_;
+    //! Contains the values of the current sample, sorted by MemberId.
+    DynamicDataValues value_;
 
     //! Used in TK_MAP to maintain correlation between keys and MemberIds.
     std::map<std::string, MemberId> key_to_id_;
@@ -70,6 +71,14 @@ public:
     DynamicDataImpl(
             traits<DynamicType>::ref_type type) noexcept;
 
+    /*!
+     * Creates the data of a member, allocating its primitive value in the arena of the data containing it.
+     * The arena is only used while constructing.
+     */
+    DynamicDataImpl(
+            traits<DynamicType>::ref_type type,
+            const std::shared_ptr<DynamicDataArena>& arena) noexcept;
+
     ReturnCode_t clear_all_values() noexcept override;
 
     ReturnCode_t clear_nonkey_values() noexcept override;
@@ -466,9 +475,10 @@ private:
             const traits<DynamicTypeImpl>::ref_type& sequence_type,
             uint32_t sequence_size) noexcept;
 
-    std::map<MemberId, std::shared_ptr<void>>::iterator add_value(
+    DynamicDataValues::iterator add_value(
             TypeKind kind,
-            MemberId id) noexcept;
+            MemberId id,
+            const std::shared_ptr<DynamicDataArena>& arena = nullptr) noexcept;
 
     /*!
      * Auxiliary function for getting the initial number of elements for TK_ARRAY.
@@ -558,7 +568,7 @@ private:
     template<TypeKind TK >
     ReturnCode_t get_primitive_value(
             TypeKind element_kind,
-            std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+            DynamicDataValues::iterator value_iterator,
             TypeForKind<TK>& value,
             MemberId member_id) noexcept;
 
@@ -583,7 +593,7 @@ private:
     template<TypeKind TK>
     ReturnCode_t get_sequence_values_bitmask(
             MemberId id,
-            std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+            DynamicDataValues::const_iterator value_iterator,
             SequenceTypeForKind<TK>& value,
             size_t number_of_elements) noexcept;
 
@@ -595,7 +605,7 @@ private:
     ReturnCode_t get_sequence_values_primitive(
             MemberId id,
             TypeKind element_kind,
-            std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+            DynamicDataValues::const_iterator value_iterator,
             SequenceTypeForKind<TK>& value,
             size_t number_of_elements) noexcept;
 
@@ -607,7 +617,7 @@ private:
     template<TypeKind TK, TypeKind ToTK>
     ReturnCode_t get_sequence_values_promoting(
             MemberId id,
-            std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+            DynamicDataValues::const_iterator value_iterator,
             SequenceTypeForKind<TK>& value,
             size_t number_of_elements) noexcept;
 
@@ -648,7 +658,7 @@ private:
     template<TypeKind TK>
     ReturnCode_t set_primitive_value(
             const traits<DynamicTypeImpl>::ref_type& element_type,
-            std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+            DynamicDataValues::iterator value_iterator,
             const TypeForKind<TK>& value) noexcept;
 
     /*!
@@ -665,7 +675,7 @@ private:
     template<TypeKind TK>
     ReturnCode_t set_sequence_values_bitmask(
             MemberId id,
-            std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+            DynamicDataValues::const_iterator value_iterator,
             const SequenceTypeForKind<TK>& value) noexcept;
 
     /*!
@@ -675,7 +685,7 @@ private:
     ReturnCode_t set_sequence_values_primitive(
             MemberId id,
             TypeKind element_kind,
-            std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+            DynamicDataValues::const_iterator value_iterator,
             const SequenceTypeForKind<TK>& value) noexcept;
 
     /*!
@@ -685,7 +695,7 @@ private:
     template<TypeKind TK, TypeKind ToTK>
     ReturnCode_t set_sequence_values_promoting(
             MemberId id,
-            std::map<MemberId, std::shared_ptr<void>>::const_iterator value_iterator,
+            DynamicDataValues::const_iterator value_iterator,
             const SequenceTypeForKind<TK>& value) noexcept;
 
 
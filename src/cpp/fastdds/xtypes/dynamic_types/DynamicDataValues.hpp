@@ -0,0 +1,354 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_XTYPES_DYNAMIC_TYPES_DYNAMICDATAVALUES_HPP
+#define FASTDDS_XTYPES_DYNAMIC_TYPES_DYNAMICDATAVALUES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/*!
+ * Memory block where the members of an aggregated DynamicDataImpl, and their primitive values, are allocated when the
+ * data is created, so laying them out takes a single heap allocation instead of one or two per member.
+ *
+ * Members are independent DynamicDataImpl objects that can be shared with the user and outlive the data containing
+ * them, so each one keeps the block alive through its DynamicDataArenaAllocator.
+ * Releasing a value allocated in the block does not return its memory, which is freed with the block.
+ * Allocations that do not fit in the block fall back to the heap.
+ *
+ * Only the constructor of the owning DynamicDataImpl allocates from the block, so it is not synchronized.
+ */
+class DynamicDataArena
+{
+public:
+
+    //! Room needed for a std::allocate_shared block holding an object of the given size.
+    static constexpr size_t shared_block_size(
+            size_t object_size) noexcept
+    {
+        // The control block holds a vtable pointer, both counters and the allocator (a std::shared_ptr)
+        return (object_size + 4 * sizeof(void*) + alignof(std::max_align_t) - 1) &
+               ~(alignof(std::max_align_t) - 1);
+    }
+
+    explicit DynamicDataArena(
+            size_t capacity)
+        : buffer_(new unsigned char[capacity])
+        , capacity_(capacity)
+    {
+    }
+
+    void* allocate(
+            size_t size,
+            size_t alignment)
+    {
+        size_t offset = (used_ + alignment - 1) & ~(alignment - 1);
+
+        if (alignment > alignof(std::max_align_t) || offset + size > capacity_)
+        {
+            return ::operator new(size);
+        }
+
+        used_ = offset + size;
+        return buffer_.get() + offset;
+    }
+
+    void deallocate(
+            void* ptr) noexcept
+    {
+        unsigned char* bytes = static_cast<unsigned char*>(ptr);
+
+        if (bytes < buffer_.get() || bytes >= buffer_.get() + capacity_)
+        {
+            ::operator delete(ptr);
+        }
+    }
+
+private:
+
+    std::unique_ptr<unsigned char[]> buffer_;
+
+    size_t capacity_ {0};
+
+    size_t used_ {0};
+};
+
+//! Allocator for std::allocate_shared placing the object, and its control block, in a DynamicDataArena.
+template<class T>
+class DynamicDataArenaAllocator
+{
+public:
+
+    using value_type = T;
+
+    explicit DynamicDataArenaAllocator(
+            std::shared_ptr<DynamicDataArena> arena) noexcept
+        : arena_(std::move(arena))
+    {
+    }
+
+    template<class U>
+    DynamicDataArenaAllocator(
+            const DynamicDataArenaAllocator<U>& other) noexcept
+        : arena_(other.arena_)
+    {
+    }
+
+    T* allocate(
+            size_t n)
+    {
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(
+            T* ptr,
+            size_t) noexcept
+    {
+        arena_->deallocate(ptr);
+    }
+
+    template<class U>
+    bool operator ==(
+            const DynamicDataArenaAllocator<U>& other) const noexcept
+    {
+        return arena_ == other.arena_;
+    }
+
+    template<class U>
+    bool operator !=(
+            const DynamicDataArenaAllocator<U>& other) const noexcept
+    {
+        return arena_ != other.arena_;
+    }
+
+private:
+
+    template<class U>
+    friend class DynamicDataArenaAllocator;
+
+    std::shared_ptr<DynamicDataArena> arena_;
+};
+
+/*!
+ * Creates a value in an arena, or in the heap when there is no arena.
+ */
+template<class T, class ... Args>
+std::shared_ptr<T> make_dynamic_data_value(
+        const std::shared_ptr<DynamicDataArena>& arena,
+        Args&&... args)
+{
+    if (arena)
+    {
+        return std::allocate_shared<T>(DynamicDataArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    }
+
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+/*!
+ * Values of a DynamicDataImpl, stored contiguously and sorted by MemberId.
+ *
+ * It offers the subset of the std::map interface used by DynamicDataImpl, without a heap node per value.
+ * The members of a type are laid out once, in MemberId order, when the data is created, so inserting them is an
+ * append. When the MemberIds are consecutive from zero (structures without @id annotations, unions, sequences) the
+ * value of a member is found at the position given by its MemberId, and a binary search is used otherwise.
+ *
+ * Unlike std::map, inserting or erasing a value invalidates the iterators to all the values.
+ */
+class DynamicDataValues
+{
+public:
+
+    using key_type = MemberId;
+    using mapped_type = std::shared_ptr<void>;
+    using value_type = std::pair<MemberId, std::shared_ptr<void>>;
+    using container_type = std::vector<value_type>;
+    using iterator = container_type::iterator;
+    using const_iterator = container_type::const_iterator;
+    using size_type = container_type::size_type;
+
+    iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return values_.cbegin();
+    }
+
+    iterator end() noexcept
+    {
+        return values_.end();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return values_.cend();
+    }
+
+    size_type size() const noexcept
+    {
+        return values_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    //! Reserves room for the values of all the members of a type.
+    void reserve(
+            size_type capacity)
+    {
+        values_.reserve(capacity);
+    }
+
+    void clear() noexcept
+    {
+        values_.clear();
+    }
+
+    iterator find(
+            MemberId id) noexcept
+    {
+        return values_.begin() + position_of(id);
+    }
+
+    const_iterator find(
+            MemberId id) const noexcept
+    {
+        return values_.begin() + position_of(id);
+    }
+
+    size_type count(
+            MemberId id) const noexcept
+    {
+        return position_of(id) != values_.size() ? 1u : 0u;
+    }
+
+    std::shared_ptr<void>& at(
+            MemberId id)
+    {
+        size_type pos = position_of(id);
+        if (pos == values_.size())
+        {
+            throw std::out_of_range("DynamicDataValues::at");
+        }
+        return values_[pos].second;
+    }
+
+    const std::shared_ptr<void>& at(
+            MemberId id) const
+    {
+        size_type pos = position_of(id);
+        if (pos == values_.size())
+        {
+            throw std::out_of_range("DynamicDataValues::at");
+        }
+        return values_[pos].second;
+    }
+
+    /*!
+     * Inserts a value if there is no value with the same MemberId.
+     * @return The iterator to the value with the MemberId, and whether the value was inserted.
+     */
+    template<class T>
+    std::pair<iterator, bool> emplace(
+            MemberId id,
+            T&& value)
+    {
+        // Members are usually inserted in MemberId order
+        if (values_.empty() || values_.back().first < id)
+        {
+            values_.emplace_back(id, std::forward<T>(value));
+            return std::make_pair(values_.end() - 1, true);
+        }
+
+        iterator it = lower_bound(id);
+        if (it != values_.end() && it->first == id)
+        {
+            return std::make_pair(it, false);
+        }
+
+        return std::make_pair(values_.emplace(it, id, std::forward<T>(value)), true);
+    }
+
+    //! Erases a value, returning the iterator to the next one.
+    iterator erase(
+            const_iterator it)
+    {
+        return values_.erase(it);
+    }
+
+private:
+
+    iterator lower_bound(
+            MemberId id)
+    {
+        return std::lower_bound(values_.begin(), values_.end(), id,
+                       [](const value_type& value, MemberId key)
+                       {
+                           return value.first < key;
+                       });
+    }
+
+    //! Position of the value of a MemberId, or size() when there is none.
+    size_type position_of(
+            MemberId id) const noexcept
+    {
+        // Direct access when MemberIds are consecutive up to the requested one
+        if (id < values_.size() && values_[id].first == id)
+        {
+            return id;
+        }
+
+        auto it = std::lower_bound(values_.begin(), values_.end(), id,
+                        [](const value_type& value, MemberId key)
+                        {
+                            return value.first < key;
+                        });
+        return (it != values_.end() && it->first == id) ?
+               static_cast<size_type>(it - values_.begin()) : values_.size();
+    }
+
+    container_type values_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_XTYPES_DYNAMIC_TYPES_DYNAMICDATAVALUES_HPP
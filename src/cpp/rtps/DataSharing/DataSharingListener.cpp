@@ -22,6 +22,7 @@
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
@@ -36,6 +37,7 @@ DataSharingListener::DataSharingListener(
         std::shared_ptr<DataSharingNotification> notification,
         const std::string& datasharing_pools_directory,
         const ThreadSettings& thr_config,
+        uint32_t spin_budget_us,
         ResourceLimitedContainerConfig limits,
         BaseReader* reader)
     : notification_(notification)
@@ -45,6 +47,8 @@ DataSharingListener::DataSharingListener(
     , writer_pools_changed_(false)
     , datasharing_pools_directory_(datasharing_pools_directory)
     , thread_config_(thr_config)
+    , max_spin_budget_(std::chrono::microseconds(spin_budget_us))
+    , spin_budget_(max_spin_budget_)
 {
 }
 
@@ -58,18 +62,22 @@ void DataSharingListener::run()
 {
     while (is_running_.load())
     {
-        try
+        // Only block when no data arrived while spinning
+        if (!spin_for_new_data())
         {
-            std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex);
-            notification_->notification_->notification_cv.wait(lock, [&]
-                    {
-                        return !is_running_.load() || notification_->notification_->new_data.load();
-                    });
-        }
-        catch (const boost::interprocess::interprocess_exception& /*e*/)
-        {
-            // Timeout when locking
-            continue;
+            try
+            {
+                std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex);
+                notification_->notification_->notification_cv.wait(lock, [&]
+                        {
+                            return !is_running_.load() || notification_->notification_->new_data.load();
+                        });
+            }
+            catch (const boost::interprocess::interprocess_exception& /*e*/)
+            {
+                // Timeout when locking
+                continue;
+            }
         }
 
         if (!is_running_.load())
@@ -89,6 +97,40 @@ void DataSharingListener::run()
     }
 }
 
+bool DataSharingListener::spin_for_new_data()
+{
+    // Never spin below this fraction of the configured budget, so arrivals are still detected
+    constexpr int min_spin_budget_divisor = 16;
+    // Number of polls between clock reads
+    constexpr uint32_t polls_per_clock_check = 64;
+
+    if (max_spin_budget_.count() == 0)
+    {
+        return false;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + spin_budget_;
+    uint32_t polls = 0;
+    while (is_running_.load(std::memory_order_relaxed) &&
+            !notification_->notification_->new_data.load(std::memory_order_acquire))
+    {
+        if (++polls == polls_per_clock_check)
+        {
+            polls = 0;
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                // Data is arriving slower than we spin, spin less next time
+                spin_budget_ = (std::max)(spin_budget_ / 2, max_spin_budget_ / min_spin_budget_divisor);
+                return false;
+            }
+        }
+    }
+
+    // Spinning paid off, allow spinning longer next time
+    spin_budget_ = (std::min)(spin_budget_ * 2, max_spin_budget_);
+    return true;
+}
+
 void DataSharingListener::start()
 {
     std::lock_guard<std::mutex> guard(mutex_);
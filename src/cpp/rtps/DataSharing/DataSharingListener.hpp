@@ -20,6 +20,7 @@
 #define RTPS_DATASHARING_DATASHARINGLISTENER_HPP
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 
@@ -61,6 +62,7 @@ public:
             std::shared_ptr<DataSharingNotification> notification,
             const std::string& datasharing_pools_directory,
             const ThreadSettings& thr_config,
+            uint32_t spin_budget_us,
             ResourceLimitedContainerConfig limits,
             BaseReader* reader);
 
@@ -102,6 +104,15 @@ protected:
      */
     void run();
 
+    /**
+     * Busy-polls the notification for new data, up to the current spin budget.
+     * The spin budget is adapted depending on whether data arrived while spinning.
+     *
+     * @return true if new data arrived or the listener was stopped while spinning,
+     *         false if the listener should block on the notification.
+     */
+    bool spin_for_new_data();
+
     /**
      * Processes a notification
      */
@@ -133,6 +144,11 @@ protected:
     ThreadSettings thread_config_;
     mutable std::mutex mutex_;
 
+    //! Configured maximum spin time, in nanoseconds (0 to always block)
+    std::chrono::nanoseconds max_spin_budget_;
+    //! Adapted spin time for the next wait
+    std::chrono::nanoseconds spin_budget_;
+
 };
 
 }  // namespace rtps
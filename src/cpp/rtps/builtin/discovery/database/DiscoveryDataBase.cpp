@@ -17,6 +17,7 @@
  *
  */
 
+#include <algorithm>
 #include <mutex>
 #include <set>
 
@@ -192,8 +193,9 @@ bool DiscoveryDataBase::pdp_is_relevant(
         return true;
     }
 
-    // Lock(shared mode) mutex locally
+    // Lock(shared mode) mutex locally, and the shard of the participant in case the EDP queue is being processed
     std::lock_guard<std::recursive_mutex> guard(mutex_);
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(change_guid_prefix);
 
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "PDP " << change.instanceHandle << " is relevant to " << reader_guid);
 
@@ -216,8 +218,9 @@ bool DiscoveryDataBase::edp_publications_is_relevant(
     // Get identity of the participant that generated the DATA
     fastdds::rtps::GUID_t change_guid = guid_from_change(&change);
 
-    // Lock(shared mode) mutex locally
+    // Lock(shared mode) mutex locally, and the shard of the participant in case the EDP queue is being processed
     std::lock_guard<std::recursive_mutex> guard(mutex_);
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(change_guid.guidPrefix);
 
     auto itp = participants_.find(change_guid.guidPrefix);
     if (itp == participants_.end())
@@ -249,8 +252,9 @@ bool DiscoveryDataBase::edp_subscriptions_is_relevant(
     // Get identity of the participant that generated the DATA
     fastdds::rtps::GUID_t change_guid = guid_from_change(&change);
 
-    // Lock(shared mode) mutex locally
+    // Lock(shared mode) mutex locally, and the shard of the participant in case the EDP queue is being processed
     std::lock_guard<std::recursive_mutex> guard(mutex_);
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(change_guid.guidPrefix);
 
     auto itp = participants_.find(change_guid.guidPrefix);
     if (itp == participants_.end())
@@ -279,7 +283,11 @@ void DiscoveryDataBase::update_change_and_unmatch_(
         fastdds::rtps::CacheChange_t* new_change,
         ddb::DiscoverySharedInfo& entity)
 {
-    changes_to_release_.push_back(entity.update_and_unmatch(new_change));
+    fastdds::rtps::CacheChange_t* old_change = entity.update_and_unmatch(new_change);
+    {
+        std::lock_guard<std::mutex> guard(lists_mutex_);
+        changes_to_release_.push_back(old_change);
+    }
     // Manually set relevant participants ACK status of this server, and of the participant that sent the
     // change, to 1. This way, we avoid backprogation of the data.
     entity.add_or_update_ack_participant(server_guid_prefix_, ParticipantState::ACKED);
@@ -528,60 +536,125 @@ bool DiscoveryDataBase::process_edp_data_queue()
 
     bool is_dirty_topic = false;
 
-    // Lock(exclusive mode) mutex locally
-    std::lock_guard<std::recursive_mutex> guard(mutex_);
-
-    eprosima::fastdds::rtps::CacheChange_t* change;
-    std::string topic_name;
-
-    // Process all messages in the queque
-    while (!edp_data_queue_.Empty())
+    // The general mutex is not held while processing the changes on regular topics: they only touch the entities of
+    // their participants and topic, which are guarded by the shard mutexes. The changes on the virtual topic modify
+    // every topic, so they are processed holding the general mutex, which keeps out the threads querying the database.
+    if (0 == processing_pool_.size())
     {
-        // Process each message with FrontAndPop(). Move it, do not copy it
-        DiscoveryEDPDataQueueInfo data_queue_info = edp_data_queue_.FrontAndPop();
-        change = data_queue_info.change();
-        topic_name = data_queue_info.topic();
-
-        // If the change is a DATA(w|r)
-        if (change->kind == eprosima::fastdds::rtps::ALIVE)
+        // Process all messages in the queque
+        while (!edp_data_queue_.Empty())
         {
-            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "ALIVE change received from: " << change->instanceHandle);
-            // DATA(w) case
-            if (is_writer(change))
+            // Process each message with FrontAndPop(). Move it, do not copy it
+            DiscoveryEDPDataQueueInfo data_queue_info = edp_data_queue_.FrontAndPop();
+            if (data_queue_info.topic().to_string() == virtual_topic_)
             {
-                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "DATA(w) in topic " << topic_name << " received from: "
-                                                                          << change->instanceHandle);
-                create_writers_from_change_(change, topic_name);
+                std::lock_guard<std::recursive_mutex> guard(mutex_);
+                process_edp_change_(data_queue_info);
             }
-            // DATA(r) case
-            else if (is_reader(change))
+            else
             {
-                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "DATA(r) in topic " << topic_name << " received from: "
-                                                                          << change->instanceHandle);
-                create_readers_from_change_(change, topic_name);
+                process_edp_change_(data_queue_info);
             }
         }
-        // If the change is a DATA(Uw|Ur)
+
+        return is_dirty_topic;
+    }
+
+    // Group the messages by the shard of their topic, keeping their order. Changes on the virtual topic are kept apart
+    // and processed afterwards by this thread alone.
+    std::vector<DiscoveryEDPDataQueueInfo> changes;
+    std::array<std::vector<size_t>, TopicMap::num_shards> changes_by_shard;
+    std::vector<size_t> virtual_changes;
+    while (!edp_data_queue_.Empty())
+    {
+        changes.push_back(edp_data_queue_.FrontAndPop());
+        std::string topic_name = changes.back().topic().to_string();
+        if (topic_name == virtual_topic_)
+        {
+            virtual_changes.push_back(changes.size() - 1);
+        }
         else
         {
-            // DATA(Uw) case
-            if (is_writer(change))
-            {
-                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "DATA(Uw) received from: " << change->instanceHandle);
-                process_dispose_writer_(change);
-            }
-            // DATA(Ur) case
-            else if (is_reader(change))
+            changes_by_shard[TopicMap::shard_of(topic_name)].push_back(changes.size() - 1);
+        }
+    }
+
+    processing_pool_.run(changes_by_shard.size(), [&](size_t shard)
             {
-                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "DATA(Ur) received from: " << change->instanceHandle);
-                process_dispose_reader_(change);
-            }
+                for (size_t index : changes_by_shard[shard])
+                {
+                    process_edp_change_(changes[index]);
+                }
+            });
+
+    if (!virtual_changes.empty())
+    {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
+        for (size_t index : virtual_changes)
+        {
+            process_edp_change_(changes[index]);
         }
     }
 
     return is_dirty_topic;
 }
 
+void DiscoveryDataBase::process_edp_change_(
+        DiscoveryEDPDataQueueInfo& data_queue_info)
+{
+    eprosima::fastdds::rtps::CacheChange_t* change = data_queue_info.change();
+    std::string topic_name = data_queue_info.topic().to_string();
+
+    // If the change is a DATA(w|r)
+    if (change->kind == eprosima::fastdds::rtps::ALIVE)
+    {
+        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "ALIVE change received from: " << change->instanceHandle);
+        // DATA(w) case
+        if (is_writer(change))
+        {
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "DATA(w) in topic " << topic_name << " received from: "
+                                                                      << change->instanceHandle);
+            create_writers_from_change_(change, topic_name);
+        }
+        // DATA(r) case
+        else if (is_reader(change))
+        {
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "DATA(r) in topic " << topic_name << " received from: "
+                                                                      << change->instanceHandle);
+            create_readers_from_change_(change, topic_name);
+        }
+    }
+    // If the change is a DATA(Uw|Ur)
+    else
+    {
+        // DATA(Uw) case
+        if (is_writer(change))
+        {
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "DATA(Uw) received from: " << change->instanceHandle);
+            process_dispose_writer_(change);
+        }
+        // DATA(Ur) case
+        else if (is_reader(change))
+        {
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "DATA(Ur) received from: " << change->instanceHandle);
+            process_dispose_reader_(change);
+        }
+    }
+}
+
+void DiscoveryDataBase::init_processing_threads(
+        uint32_t num_threads,
+        const fastdds::rtps::ThreadSettings& thread_cfg,
+        uint32_t thread_id)
+{
+    processing_pool_.init_threads(num_threads, thread_cfg, "dds.ds_db.%u.%u", thread_id);
+}
+
+void DiscoveryDataBase::stop_processing_threads()
+{
+    processing_pool_.stop_threads();
+}
+
 void DiscoveryDataBase::create_participant_from_change_(
         eprosima::fastdds::rtps::CacheChange_t* ch,
         const DiscoveryParticipantChangeData& change_data)
@@ -732,7 +805,7 @@ void DiscoveryDataBase::create_new_participant_from_change_(
 {
     fastdds::rtps::GUID_t change_guid = guid_from_change(ch);
 
-    std::pair<std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator, bool> ret =
+    std::pair<ParticipantMap::iterator, bool> ret =
             participants_.insert(
         std::make_pair(
             change_guid.guidPrefix,
@@ -902,6 +975,9 @@ void DiscoveryDataBase::create_writers_from_change_(
         const std::string& topic_name)
 {
     const eprosima::fastdds::rtps::GUID_t& writer_guid = guid_from_change(ch);
+
+    // The entities of the participant are only modified while holding its shard
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(writer_guid.guidPrefix);
     auto writer_it = writers_.find(writer_guid);
 
     // The writer was already known in the database
@@ -943,6 +1019,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             }
 
             // we release it if it's the same or if it is lower
+            std::lock_guard<std::mutex> guard(lists_mutex_);
             changes_to_release_.push_back(ch);
         }
     }
@@ -953,13 +1030,13 @@ void DiscoveryDataBase::create_writers_from_change_(
         // NOTE: Processing a DATA(w) should always be preceded by the reception and processing of its corresponding
         // participant. However, one may receive a DATA(w) just after the participant has been removed, case in which the
         // former should no longer be processed.
-        std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
-                participants_.find(writer_guid.guidPrefix);
+        auto writer_part_it = participants_.find(writer_guid.guidPrefix);
         if (writer_part_it == participants_.end())
         {
             EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE,
                     "Writer " << writer_guid << " has no associated participant. Skipping");
             assert(topic_name != virtual_topic_);
+            std::lock_guard<std::mutex> guard(lists_mutex_);
             changes_to_release_.push_back(ch); // Release change so it can be reused
             return;
         }
@@ -968,6 +1045,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             EPROSIMA_LOG_WARNING(DISCOVERY_DATABASE,
                     "Writer " << writer_guid << " is associated to a removed participant. Skipping");
             assert(topic_name != virtual_topic_);
+            std::lock_guard<std::mutex> guard(lists_mutex_);
             changes_to_release_.push_back(ch); // Release change so it can be reused
             return;
         }
@@ -979,8 +1057,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
-                writers_.insert(std::make_pair(writer_guid, tmp_writer));
+        auto ret = writers_.insert(std::make_pair(writer_guid, tmp_writer));
         if (!ret.second)
         {
             EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error inserting writer " << writer_guid);
@@ -994,13 +1071,16 @@ void DiscoveryDataBase::create_writers_from_change_(
         // Add entry to participants_[guid_prefix]::writers
         writer_part_it->second.add_writer(writer_guid);
 
-        // Add writer to writers_by_topic_[topic_name]
-        add_writer_to_topic_(writer_guid, topic_name);
-
         // Manually set to 1 the relevant participants ACK status of the participant that sent the change. This way,
         // we avoid backprogation of the data.
         writer_it->second.add_or_update_ack_participant(ch->writerGUID.guidPrefix, ParticipantState::ACKED);
 
+        // Matching locks the shards of both participants
+        shard_lock.unlock();
+
+        // Add writer to writers_by_topic_[topic_name]
+        add_writer_to_topic_(writer_guid, topic_name);
+
         // if topic is virtual, it must iterate over all readers
         if (topic_name == virtual_topic_)
         {
@@ -1011,13 +1091,18 @@ void DiscoveryDataBase::create_writers_from_change_(
         }
         else
         {
-            auto readers_it = readers_by_topic_.find(topic_name);
-            if (readers_it == readers_by_topic_.end())
+            std::vector<eprosima::fastdds::rtps::GUID_t> readers;
             {
-                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
-                return;
+                std::unique_lock<std::mutex> topic_lock = lock_topic_shard_(topic_name);
+                auto readers_it = readers_by_topic_.find(topic_name);
+                if (readers_it == readers_by_topic_.end())
+                {
+                    EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
+                    return;
+                }
+                readers = readers_it->second;
             }
-            for (auto reader : readers_it->second)
+            for (auto reader : readers)
             {
                 match_writer_reader_(writer_guid, reader);
             }
@@ -1032,6 +1117,9 @@ void DiscoveryDataBase::create_readers_from_change_(
         const std::string& topic_name)
 {
     const eprosima::fastdds::rtps::GUID_t& reader_guid = guid_from_change(ch);
+
+    // The entities of the participant are only modified while holding its shard
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(reader_guid.guidPrefix);
     auto reader_it = readers_.find(reader_guid);
 
     // The reader was already known in the database
@@ -1073,6 +1161,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             }
 
             // we release it if it's the same or if it is lower
+            std::lock_guard<std::mutex> guard(lists_mutex_);
             changes_to_release_.push_back(ch);
         }
     }
@@ -1083,13 +1172,13 @@ void DiscoveryDataBase::create_readers_from_change_(
         // NOTE: Processing a DATA(r) should always be preceded by the reception and processing of its corresponding
         // participant. However, one may receive a DATA(r) just after the participant has been removed, case in which the
         // former should no longer be processed.
-        std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
-                participants_.find(reader_guid.guidPrefix);
+        auto reader_part_it = participants_.find(reader_guid.guidPrefix);
         if (reader_part_it == participants_.end())
         {
             EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE,
                     "Reader " << reader_guid << " has no associated participant. Skipping");
             assert(topic_name != virtual_topic_);
+            std::lock_guard<std::mutex> guard(lists_mutex_);
             changes_to_release_.push_back(ch); // Release change so it can be reused
             return;
         }
@@ -1098,6 +1187,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             EPROSIMA_LOG_WARNING(DISCOVERY_DATABASE,
                     "Reader " << reader_guid << " is associated to a removed participant. Skipping");
             assert(topic_name != virtual_topic_);
+            std::lock_guard<std::mutex> guard(lists_mutex_);
             changes_to_release_.push_back(ch); // Release change so it can be reused
             return;
         }
@@ -1109,8 +1199,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
-                readers_.insert(std::make_pair(reader_guid, tmp_reader));
+        auto ret = readers_.insert(std::make_pair(reader_guid, tmp_reader));
         if (!ret.second)
         {
             EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error inserting reader " << reader_guid);
@@ -1124,13 +1213,16 @@ void DiscoveryDataBase::create_readers_from_change_(
         // Add entry to participants_[guid_prefix]::readers
         reader_part_it->second.add_reader(reader_guid);
 
-        // Add reader to readers_by_topic_[topic_name]
-        add_reader_to_topic_(reader_guid, topic_name);
-
         // Manually set to 1 the relevant participants ACK status of the participant that sent the change. This way,
         // we avoid backprogation of the data.
         reader_it->second.add_or_update_ack_participant(ch->writerGUID.guidPrefix, ParticipantState::ACKED);
 
+        // Matching locks the shards of both participants
+        shard_lock.unlock();
+
+        // Add reader to readers_by_topic_[topic_name]
+        add_reader_to_topic_(reader_guid, topic_name);
+
         // If topic is virtual, it must iterate over all readers
         if (topic_name == virtual_topic_)
         {
@@ -1141,13 +1233,18 @@ void DiscoveryDataBase::create_readers_from_change_(
         }
         else
         {
-            auto writers_it = writers_by_topic_.find(topic_name);
-            if (writers_it == writers_by_topic_.end())
+            std::vector<eprosima::fastdds::rtps::GUID_t> writers;
             {
-                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
-                return;
+                std::unique_lock<std::mutex> topic_lock = lock_topic_shard_(topic_name);
+                auto writers_it = writers_by_topic_.find(topic_name);
+                if (writers_it == writers_by_topic_.end())
+                {
+                    EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Topic error: " << topic_name << ". Must exist.");
+                    return;
+                }
+                writers = writers_it->second;
             }
-            for (auto writer : writers_it->second)
+            for (auto writer : writers)
             {
                 match_writer_reader_(writer, reader_guid);
             }
@@ -1163,6 +1260,21 @@ void DiscoveryDataBase::match_writer_reader_(
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Matching writer " << writer_guid << " with reader " << reader_guid);
 
+    // Lock the shards of both participants, which hold their endpoints as well
+    size_t writer_shard = ParticipantMap::shard_of(writer_guid.guidPrefix);
+    size_t reader_shard = ParticipantMap::shard_of(reader_guid.guidPrefix);
+    std::unique_lock<std::mutex> writer_shard_lock(participant_shard_mutexes_[writer_shard], std::defer_lock);
+    std::unique_lock<std::mutex> reader_shard_lock;
+    if (writer_shard == reader_shard)
+    {
+        writer_shard_lock.lock();
+    }
+    else
+    {
+        reader_shard_lock = std::unique_lock<std::mutex>(participant_shard_mutexes_[reader_shard], std::defer_lock);
+        std::lock(writer_shard_lock, reader_shard_lock);
+    }
+
     // writer entity
     auto wit = writers_.find(writer_guid);
     if (wit == writers_.end())
@@ -1315,7 +1427,10 @@ bool DiscoveryDataBase::set_dirty_topic_(
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Setting topic " << topic << " as dirty");
 
+    std::lock_guard<std::mutex> guard(lists_mutex_);
+
     // If topic is virtual, we need to set as dirty all the other (non-virtual) topics
+    // Changes on the virtual topic are only processed by the routine thread, so the topics can be read without locking
     if (topic == virtual_topic_)
     {
         // Set all topics to dirty
@@ -1352,7 +1467,7 @@ void DiscoveryDataBase::process_dispose_participant_(
     const eprosima::fastdds::rtps::GUID_t& participant_guid = guid_from_change(ch);
 
     // Change DATA(p) with DATA(Up) in participants map
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator pit =
+    ParticipantMap::iterator pit =
             participants_.find(participant_guid.guidPrefix);
     if (pit != participants_.end())
     {
@@ -1422,7 +1537,8 @@ void DiscoveryDataBase::process_dispose_writer_(
     const eprosima::fastdds::rtps::GUID_t& writer_guid = guid_from_change(ch);
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator wit = writers_.find(writer_guid);
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(writer_guid.guidPrefix);
+    EndpointMap::iterator wit = writers_.find(writer_guid);
     if (wit != writers_.end())
     {
         // Change DATA(w) with DATA(Uw)
@@ -1434,6 +1550,7 @@ void DiscoveryDataBase::process_dispose_writer_(
         // Add entry to disposals_
         if (wit->second.topic() != virtual_topic_)
         {
+            std::lock_guard<std::mutex> guard(lists_mutex_);
             if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
             {
                 disposals_.push_back(ch);
@@ -1452,7 +1569,8 @@ void DiscoveryDataBase::process_dispose_reader_(
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
 
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator rit = readers_.find(reader_guid);
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(reader_guid.guidPrefix);
+    EndpointMap::iterator rit = readers_.find(reader_guid);
     if (rit != readers_.end())
     {
         // Change DATA(r) with DATA(Ur)
@@ -1464,6 +1582,7 @@ void DiscoveryDataBase::process_dispose_reader_(
         // Add entry to disposals_
         if (rit->second.topic() != virtual_topic_)
         {
+            std::lock_guard<std::mutex> guard(lists_mutex_);
             if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
             {
                 disposals_.push_back(ch);
@@ -1488,10 +1607,14 @@ bool DiscoveryDataBase::process_dirty_topics()
     std::lock_guard<std::recursive_mutex> guard(mutex_);
 
     // Iterator objects are declared here because they are reused in each iteration of the loops
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_reader_it;
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_writer_it;
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator readers_it;
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator writers_it;
+    ParticipantMap::iterator parts_reader_it;
+    ParticipantMap::iterator parts_writer_it;
+    EndpointMap::iterator readers_it;
+    EndpointMap::iterator writers_it;
+
+    // Visit the topics in name order, as the ones marked while processing the EDP queue in parallel are appended in
+    // whatever order the threads reach them, and the changes to send depend on the order of the topics
+    std::sort(dirty_topics_.begin(), dirty_topics_.end());
 
     // Iterate over dirty_topics_
     for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end();)
@@ -1743,6 +1866,9 @@ eprosima::fastdds::rtps::GUID_t DiscoveryDataBase::guid_from_change(
 
 fastdds::rtps::CacheChange_t* DiscoveryDataBase::cache_change_own_participant()
 {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(server_guid_prefix_);
+
     auto part_it = participants_.find(server_guid_prefix_);
     if (part_it != participants_.end())
     {
@@ -1756,16 +1882,22 @@ const std::vector<fastdds::rtps::GuidPrefix_t> DiscoveryDataBase::direct_clients
     std::lock_guard<std::recursive_mutex> guard(mutex_);
 
     std::vector<fastdds::rtps::GuidPrefix_t> direct_clients_and_servers;
-    // Iterate over participants to add the remote ones that are direct clients or servers
-    for (auto participant: participants_)
+    // Iterate over participants to add the remote ones that are direct clients or servers, one shard at a time in case
+    // the EDP queue is being processed
+    for (size_t shard = 0; shard < ParticipantMap::num_shards; ++shard)
     {
-        // Only add participants other than the server
-        if (server_guid_prefix_ != participant.first)
+        std::lock_guard<std::mutex> shard_guard(participant_shard_mutexes_[shard]);
+        for (auto& participant: participants_.shard(shard))
         {
-            // Only add direct clients or server that are alive, not relayed ones.
-            if (participant.second.is_local() && participant.second.change()->kind == eprosima::fastdds::rtps::ALIVE)
+            // Only add participants other than the server
+            if (server_guid_prefix_ != participant.first)
             {
-                direct_clients_and_servers.push_back(participant.first);
+                // Only add direct clients or server that are alive, not relayed ones.
+                if (participant.second.is_local() &&
+                        participant.second.change()->kind == eprosima::fastdds::rtps::ALIVE)
+                {
+                    direct_clients_and_servers.push_back(participant.first);
+                }
             }
         }
     }
@@ -1775,6 +1907,9 @@ const std::vector<fastdds::rtps::GuidPrefix_t> DiscoveryDataBase::direct_clients
 LocatorList DiscoveryDataBase::participant_metatraffic_locators(
         fastdds::rtps::GuidPrefix_t participant_guid_prefix)
 {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(participant_guid_prefix);
+
     LocatorList locators;
     auto part_it = participants_.find(participant_guid_prefix);
     if (part_it != participants_.end())
@@ -2068,7 +2203,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
 {
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>::iterator topic_it;
+        TopicMap::iterator topic_it;
         for (topic_it = writers_by_topic_.begin(); topic_it != writers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastdds::rtps::GUID_t>::iterator writer_it = topic_it->second.begin();
@@ -2085,7 +2220,8 @@ void DiscoveryDataBase::remove_writer_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>::iterator topic_it =
+        std::unique_lock<std::mutex> topic_lock = lock_topic_shard_(topic_name);
+        TopicMap::iterator topic_it =
                 writers_by_topic_.find(topic_name);
         if (topic_it != writers_by_topic_.end())
         {
@@ -2116,7 +2252,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
 
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>::iterator topic_it;
+        TopicMap::iterator topic_it;
         for (topic_it = readers_by_topic_.begin(); topic_it != readers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastdds::rtps::GUID_t>::iterator reader_it = topic_it->second.begin();
@@ -2133,7 +2269,8 @@ void DiscoveryDataBase::remove_reader_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>::iterator topic_it =
+        std::unique_lock<std::mutex> topic_lock = lock_topic_shard_(topic_name);
+        TopicMap::iterator topic_it =
                 readers_by_topic_.find(topic_name);
         if (topic_it != readers_by_topic_.end())
         {
@@ -2156,45 +2293,38 @@ void DiscoveryDataBase::remove_reader_from_topic_(
 void DiscoveryDataBase::create_topic_(
         const std::string& topic_name)
 {
-    // Create writers topic
-    auto wit = writers_by_topic_.insert(
-        std::pair<std::string, std::vector<fastdds::rtps::GUID_t>>(
-            topic_name,
-            std::vector<fastdds::rtps::GUID_t>()));
-    if (wit.second)
+    // Take the virtual endpoints first, as the virtual topic may be on a different shard
+    std::vector<fastdds::rtps::GUID_t> virtual_writers;
+    std::vector<fastdds::rtps::GUID_t> virtual_readers;
+    if (topic_name != virtual_topic_)
     {
-        // Find virtual topic
+        // in case virtual topic does not exist do nothing
+        std::unique_lock<std::mutex> virtual_topic_lock = lock_topic_shard_(virtual_topic_);
         auto v_wit = writers_by_topic_.find(virtual_topic_);
         if (v_wit != writers_by_topic_.end())
         {
-            // add all virtual writers
-            // in case virtual topic does not exist do nothing
-            for (fastdds::rtps::GUID_t virtual_writer : v_wit->second)
-            {
-                wit.first->second.push_back(virtual_writer);
-            }
+            virtual_writers = v_wit->second;
         }
-    } // Else topic already existed
-
-    // Create readers topic
-    auto rit = readers_by_topic_.insert(
-        std::pair<std::string, std::vector<fastdds::rtps::GUID_t>>(
-            topic_name,
-            std::vector<fastdds::rtps::GUID_t>()));
-    if (rit.second)
-    {
-        // Find virtual topic
         auto v_rit = readers_by_topic_.find(virtual_topic_);
         if (v_rit != readers_by_topic_.end())
         {
-            // add all virtual readers
-            // in case virtual topic does not exist do nothing
-            for (fastdds::rtps::GUID_t virtual_reader : v_rit->second)
-            {
-                rit.first->second.push_back(virtual_reader);
-            }
+            virtual_readers = v_rit->second;
         }
-    } // Else topic already existed
+    }
+
+    std::unique_lock<std::mutex> topic_lock = lock_topic_shard_(topic_name);
+
+    // Create writers topic and add all virtual writers. Else topic already existed
+    writers_by_topic_.insert(
+        std::pair<std::string, std::vector<fastdds::rtps::GUID_t>>(
+            topic_name,
+            virtual_writers));
+
+    // Create readers topic and add all virtual readers. Else topic already existed
+    readers_by_topic_.insert(
+        std::pair<std::string, std::vector<fastdds::rtps::GUID_t>>(
+            topic_name,
+            virtual_readers));
 
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "New topic " << topic_name << " created");
 }
@@ -2203,18 +2333,16 @@ void DiscoveryDataBase::add_writer_to_topic_(
         const eprosima::fastdds::rtps::GUID_t& writer_guid,
         const std::string& topic_name)
 {
-    // Check if the topic exists already, if not create it
-    auto it = writers_by_topic_.find(topic_name);
-    if (it == writers_by_topic_.end())
-    {
-        create_topic_(topic_name);
-        it = writers_by_topic_.find(topic_name);
-    }
-
     // If the topic is virtual, add it in every topic, included virtual
     // could be recursive but it will call too many find functions
     if (topic_name == virtual_topic_)
     {
+        // Check if the topic exists already, if not create it
+        if (writers_by_topic_.find(topic_name) == writers_by_topic_.end())
+        {
+            create_topic_(topic_name);
+        }
+
         for (auto it_topics = writers_by_topic_.begin();
                 it_topics != writers_by_topic_.end();
                 ++it_topics)
@@ -2234,6 +2362,17 @@ void DiscoveryDataBase::add_writer_to_topic_(
         return;
     }
 
+    // Check if the topic exists already, if not create it
+    std::unique_lock<std::mutex> topic_lock = lock_topic_shard_(topic_name);
+    auto it = writers_by_topic_.find(topic_name);
+    if (it == writers_by_topic_.end())
+    {
+        topic_lock.unlock();
+        create_topic_(topic_name);
+        topic_lock.lock();
+        it = writers_by_topic_.find(topic_name);
+    }
+
     // Add the writer in the topic
     std::vector<eprosima::fastdds::rtps::GUID_t>::iterator writer_by_topic_it =
             std::find(it->second.begin(), it->second.end(), writer_guid);
@@ -2248,18 +2387,16 @@ void DiscoveryDataBase::add_reader_to_topic_(
         const eprosima::fastdds::rtps::GUID_t& reader_guid,
         const std::string& topic_name)
 {
-    // Check if the topic exists already, if not create it
-    auto it = readers_by_topic_.find(topic_name);
-    if (it == readers_by_topic_.end())
-    {
-        create_topic_(topic_name);
-        it = readers_by_topic_.find(topic_name);
-    }
-
     // If the topic is virtual, add it in every topic, included virtual
     // could be recursive but it will call too many find functions
     if (topic_name == virtual_topic_)
     {
+        // Check if the topic exists already, if not create it
+        if (readers_by_topic_.find(topic_name) == readers_by_topic_.end())
+        {
+            create_topic_(topic_name);
+        }
+
         for (auto it_topics = readers_by_topic_.begin();
                 it_topics != readers_by_topic_.end();
                 ++it_topics)
@@ -2279,6 +2416,17 @@ void DiscoveryDataBase::add_reader_to_topic_(
         return;
     }
 
+    // Check if the topic exists already, if not create it
+    std::unique_lock<std::mutex> topic_lock = lock_topic_shard_(topic_name);
+    auto it = readers_by_topic_.find(topic_name);
+    if (it == readers_by_topic_.end())
+    {
+        topic_lock.unlock();
+        create_topic_(topic_name);
+        topic_lock.lock();
+        it = readers_by_topic_.find(topic_name);
+    }
+
     // Add the reader in the topic
     std::vector<eprosima::fastdds::rtps::GUID_t>::iterator reader_by_topic_it =
             std::find(it->second.begin(), it->second.end(), reader_guid);
@@ -2302,9 +2450,8 @@ bool DiscoveryDataBase::delete_participant_entity_(
     return true;
 }
 
-std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator
-DiscoveryDataBase::delete_participant_entity_(
-        std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it)
+DiscoveryDataBase::ParticipantMap::iterator DiscoveryDataBase::delete_participant_entity_(
+        ParticipantMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting participant: " << it->first);
     if (it == participants_.end())
@@ -2329,8 +2476,8 @@ bool DiscoveryDataBase::delete_reader_entity_(
     return true;
 }
 
-std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_reader_entity_(
-        std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_reader_entity_(
+        EndpointMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting reader: " << it->first.guidPrefix);
     if (it == readers_.end())
@@ -2378,8 +2525,8 @@ bool DiscoveryDataBase::delete_writer_entity_(
     return true;
 }
 
-std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_writer_entity_(
-        std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_writer_entity_(
+        EndpointMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting writer: " << it->first.guidPrefix);
     if (it == writers_.end())
@@ -2435,6 +2582,7 @@ bool DiscoveryDataBase::add_edp_publications_to_send_(
         eprosima::fastdds::rtps::CacheChange_t* change)
 {
     // Add DATA(w) to send in next iteration if it is not already there
+    std::lock_guard<std::mutex> guard(lists_mutex_);
     if (std::find(
                 edp_publications_to_send_.begin(),
                 edp_publications_to_send_.end(),
@@ -2452,6 +2600,7 @@ bool DiscoveryDataBase::add_edp_subscriptions_to_send_(
         eprosima::fastdds::rtps::CacheChange_t* change)
 {
     // Add DATA(r) to send in next iteration if it is not already there
+    std::lock_guard<std::mutex> guard(lists_mutex_);
     if (std::find(
                 edp_subscriptions_to_send_.begin(),
                 edp_subscriptions_to_send_.end(),
@@ -2614,7 +2763,7 @@ bool DiscoveryDataBase::from_json(
             add_writer_to_topic_(guid_aux, topic);
 
             // Add writer to its participant
-            std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+            ParticipantMap::iterator writer_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (writer_part_it != participants_.end())
             {
@@ -2672,7 +2821,7 @@ bool DiscoveryDataBase::from_json(
             add_reader_to_topic_(guid_aux, topic);
 
             // Add reader to its participant
-            std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+            ParticipantMap::iterator reader_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (reader_part_it != participants_.end())
             {
@@ -2728,6 +2877,7 @@ bool DiscoveryDataBase::is_participant_local(
         const eprosima::fastdds::rtps::GuidPrefix_t& participant_prefix)
 {
     std::lock_guard<std::recursive_mutex> guard(mutex_);
+    std::unique_lock<std::mutex> shard_lock = lock_participant_shard_(participant_prefix);
 
     auto pit = participants_.find(participant_prefix);
     if (pit != participants_.end())
@@ -20,6 +20,7 @@
 #ifndef _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 #define _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -29,6 +30,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/common/CacheChange.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
@@ -36,8 +38,10 @@
 #include <rtps/builtin/discovery/database/DiscoveryDataQueueInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryEndpointInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryParticipantInfo.hpp>
+#include <rtps/builtin/discovery/database/ShardedMap.hpp>
 #include <rtps/writer/ReaderProxy.hpp>
 #include <utils/DBQueue.hpp>
+#include <utils/WorkerPool.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -46,6 +50,15 @@ namespace ddb {
 
 /**
  * Class to manage the discovery data base
+ *
+ * Participants are stored on a map sharded by GuidPrefix_t, and each participant shares its shard with its
+ * readers and writers. The per-topic indexes are sharded by topic name.
+ * The PDP queue and the changes on the virtual topic are processed by the routine thread alone, holding @c mutex_.
+ * The rest of the EDP queue is processed without @c mutex_, possibly by several threads, each of them taking the
+ * changes of a group of topic shards, so the changes on a topic are processed in order. While doing so, the entities
+ * are guarded by the mutex of their participant shard, the per-topic indexes by the mutex of their topic shard, and
+ * the lists of changes to send and release by @c lists_mutex_, always acquired in that order.
+ * The queries that may come from other threads take @c mutex_ and then the participant shard mutexes they need.
  *@ingroup DISCOVERY_MODULE
  */
 class DiscoveryDataBase
@@ -56,6 +69,11 @@ class DiscoveryDataBase
 
 public:
 
+    using ParticipantMap = ShardedMap<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo,
+                    GuidPrefixHash>;
+    using EndpointMap = ShardedMap<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo, GuidPrefixOfGuidHash>;
+    using TopicMap = ShardedMap<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>;
+
     class AckedFunctor;
 
     ////////////
@@ -203,6 +221,21 @@ public:
 
     bool process_edp_data_queue();
 
+    /**
+     * Create the threads used to process the EDP data queue in parallel.
+     *
+     * @param num_threads  Number of threads to create. Zero keeps the processing on the calling thread.
+     * @param thread_cfg   Settings to apply to the created threads.
+     * @param thread_id    Identifier added to the name of the threads.
+     */
+    void init_processing_threads(
+            uint32_t num_threads,
+            const fastdds::rtps::ThreadSettings& thread_cfg,
+            uint32_t thread_id);
+
+    //! Stop the threads created by init_processing_threads.
+    void stop_processing_threads();
+
     ////////////
     // Functions to process_dirty_topics()
     bool process_dirty_topics();
@@ -448,22 +481,22 @@ protected:
     bool delete_participant_entity_(
             const fastdds::rtps::GuidPrefix_t& guid_prefix);
 
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator delete_participant_entity_(
-            std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it);
+    ParticipantMap::iterator delete_participant_entity_(
+            ParticipantMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_writer_entity_(
             const fastdds::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_writer_entity_(
-            std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_writer_entity_(
+            EndpointMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_reader_entity_(
             const fastdds::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_reader_entity_(
-            std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_reader_entity_(
+            EndpointMap::iterator it);
 
     // return if there are more than one writer in the participant in the same topic
     bool repeated_writer_topic_(
@@ -520,6 +553,24 @@ protected:
     std::vector<eprosima::fastdds::rtps::GUID_t> get_readers_in_topic(
             const std::string& topic_name);
 
+    // Process a change taken from the EDP data queue
+    void process_edp_change_(
+            DiscoveryEDPDataQueueInfo& data_queue_info);
+
+    // Lock the shard holding a participant and its endpoints
+    std::unique_lock<std::mutex> lock_participant_shard_(
+            const eprosima::fastdds::rtps::GuidPrefix_t& prefix) const
+    {
+        return std::unique_lock<std::mutex>(participant_shard_mutexes_[ParticipantMap::shard_of(prefix)]);
+    }
+
+    // Lock the shard holding the readers and writers of a topic
+    std::unique_lock<std::mutex> lock_topic_shard_(
+            const std::string& topic_name) const
+    {
+        return std::unique_lock<std::mutex>(topic_shard_mutexes_[TopicMap::shard_of(topic_name)]);
+    }
+
     ////////////////
     // Variables
 
@@ -528,21 +579,21 @@ protected:
     DBQueue<eprosima::fastdds::rtps::ddb::DiscoveryEDPDataQueueInfo> edp_data_queue_;
 
     //! Convenient per-topic mapping of readers and writers to speed-up queries
-    std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>> readers_by_topic_;
-    std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>> writers_by_topic_;
+    TopicMap readers_by_topic_;
+    TopicMap writers_by_topic_;
 
     //! Collection of participant proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - keeps an account of participant's readers and writers
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo> participants_;
+    ParticipantMap participants_;
 
     //! Collection of reader and writer proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - stores the topic name (only matching criteria available)
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo> readers_;
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo> writers_;
+    EndpointMap readers_;
+    EndpointMap writers_;
 
     //! Collection of topics whose related endpoints have changed and require a match recalculation
     std::vector<std::string> dirty_topics_;
@@ -564,6 +615,18 @@ protected:
     //! Mutex to lock updating to queues
     mutable std::recursive_mutex data_queues_mutex_;
 
+    //! Mutexes of the shards of participants_, readers_ and writers_, used while processing the EDP queue in parallel
+    mutable std::array<std::mutex, ParticipantMap::num_shards> participant_shard_mutexes_;
+
+    //! Mutexes of the shards of readers_by_topic_ and writers_by_topic_
+    mutable std::array<std::mutex, TopicMap::num_shards> topic_shard_mutexes_;
+
+    //! Mutex guarding the lists of changes, used while processing the EDP queue in parallel
+    std::mutex lists_mutex_;
+
+    //! Threads processing the EDP queue
+    WorkerPool processing_pool_;
+
     //! GUID prefix from own server
     const fastdds::rtps::GuidPrefix_t server_guid_prefix_;
 
@@ -0,0 +1,330 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShardedMap.hpp
+ */
+
+#ifndef FASTDDS_RTPS_BUILTIN_DISCOVERY_DATABASE__SHARDEDMAP_HPP
+#define FASTDDS_RTPS_BUILTIN_DISCOVERY_DATABASE__SHARDEDMAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <utility>
+
+#include <fastdds/rtps/common/EntityId_t.hpp>
+#include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+//! FNV-1a hash of the bytes of a GuidPrefix_t.
+struct GuidPrefixHash
+{
+    size_t operator ()(
+            const fastdds::rtps::GuidPrefix_t& prefix) const
+    {
+        return static_cast<size_t>(fnv1a(14695981039346656037ull, prefix.value, fastdds::rtps::GuidPrefix_t::size));
+    }
+
+    static uint64_t fnv1a(
+            uint64_t hash,
+            const fastdds::rtps::octet* data,
+            size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= data[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+};
+
+//! Hash of a GUID_t taking only its prefix, so the endpoints of a participant live on the shard of the participant.
+struct GuidPrefixOfGuidHash
+{
+    size_t operator ()(
+            const fastdds::rtps::GUID_t& guid) const
+    {
+        return GuidPrefixHash()(guid.guidPrefix);
+    }
+
+};
+
+/**
+ * Ordered map split in a fixed number of independent shards.
+ *
+ * The shard of a key is selected with @c ShardHash, and each shard is an @c std::map ordered by @c Compare.
+ * The container does no locking: users protecting each shard with its own mutex may access different shards from
+ * different threads, using @c shard_of to know which mutex guards a key.
+ * Iteration visits the shards in order, and the elements of each shard in key order, so the order of a traversal
+ * only depends on the keys stored and not on the history of insertions and removals.
+ *
+ * Inserting an element invalidates no iterator, and erasing one only invalidates the iterators to it.
+ */
+template<
+    class Key,
+    class Value,
+    class ShardHash = std::hash<Key>,
+    class Compare = std::less<Key>>
+class ShardedMap
+{
+public:
+
+    static constexpr size_t shard_bits = 4;
+    static constexpr size_t num_shards = size_t(1) << shard_bits;
+
+    using map_type = std::map<Key, Value, Compare>;
+    using value_type = typename map_type::value_type;
+
+    template<bool IsConst>
+    class Iterator
+    {
+        friend class ShardedMap;
+
+        using shards_type = typename std::conditional<IsConst,
+                        const std::array<map_type, num_shards>, std::array<map_type, num_shards>>::type;
+        using inner_iterator = typename std::conditional<IsConst,
+                        typename map_type::const_iterator, typename map_type::iterator>::type;
+
+    public:
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename map_type::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = typename std::conditional<IsConst, const value_type&, value_type&>::type;
+        using pointer = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+
+        Iterator() = default;
+
+        //! Conversion from a non-const iterator to a const one
+        template<bool OtherConst, class = typename std::enable_if<IsConst && !OtherConst>::type>
+        Iterator(
+                const Iterator<OtherConst>& other)
+            : shards_(other.shards_)
+            , shard_(other.shard_)
+            , it_(other.it_)
+        {
+        }
+
+        reference operator *() const
+        {
+            return *it_;
+        }
+
+        pointer operator ->() const
+        {
+            return &(*it_);
+        }
+
+        Iterator& operator ++()
+        {
+            ++it_;
+            skip_empty_shards();
+            return *this;
+        }
+
+        Iterator operator ++(
+                int)
+        {
+            Iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator ==(
+                const Iterator& other) const
+        {
+            return shard_ == other.shard_ && (num_shards == shard_ || it_ == other.it_);
+        }
+
+        bool operator !=(
+                const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+
+        template<bool>
+        friend class Iterator;
+
+        Iterator(
+                shards_type* shards,
+                size_t shard,
+                inner_iterator it)
+            : shards_(shards)
+            , shard_(shard)
+            , it_(it)
+        {
+        }
+
+        //! Move to the first element of the next non-empty shard when the current one has been exhausted
+        void skip_empty_shards()
+        {
+            while (num_shards != shard_ && it_ == (*shards_)[shard_].end())
+            {
+                if (num_shards == ++shard_)
+                {
+                    it_ = inner_iterator();
+                    return;
+                }
+                it_ = (*shards_)[shard_].begin();
+            }
+        }
+
+        shards_type* shards_ = nullptr;
+        size_t shard_ = num_shards;
+        inner_iterator it_ {};
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    //! Index of the shard holding a key.
+    static size_t shard_of(
+            const Key& key)
+    {
+        // Multiplicative hashing, taking the top bits so that weak hashes still spread over all the shards
+        return static_cast<size_t>((static_cast<uint64_t>(ShardHash()(key)) * 0x9E3779B97F4A7C15ull) >>
+               (64 - shard_bits));
+    }
+
+    //! Direct access to a shard, e.g. to iterate only the elements guarded by one lock.
+    map_type& shard(
+            size_t index)
+    {
+        return shards_[index];
+    }
+
+    const map_type& shard(
+            size_t index) const
+    {
+        return shards_[index];
+    }
+
+    iterator begin()
+    {
+        iterator it(&shards_, 0, shards_[0].begin());
+        it.skip_empty_shards();
+        return it;
+    }
+
+    const_iterator begin() const
+    {
+        const_iterator it(&shards_, 0, shards_[0].begin());
+        it.skip_empty_shards();
+        return it;
+    }
+
+    iterator end()
+    {
+        return iterator(&shards_, num_shards, typename map_type::iterator());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(&shards_, num_shards, typename map_type::const_iterator());
+    }
+
+    iterator find(
+            const Key& key)
+    {
+        size_t index = shard_of(key);
+        auto it = shards_[index].find(key);
+        return (it == shards_[index].end()) ? end() : iterator(&shards_, index, it);
+    }
+
+    const_iterator find(
+            const Key& key) const
+    {
+        size_t index = shard_of(key);
+        auto it = shards_[index].find(key);
+        return (it == shards_[index].end()) ? end() : const_iterator(&shards_, index, it);
+    }
+
+    std::pair<iterator, bool> insert(
+            const value_type& value)
+    {
+        size_t index = shard_of(value.first);
+        auto ret = shards_[index].insert(value);
+        return std::make_pair(iterator(&shards_, index, ret.first), ret.second);
+    }
+
+    Value& operator [](
+            const Key& key)
+    {
+        return shards_[shard_of(key)][key];
+    }
+
+    //! Erase the element pointed by @c it, returning the iterator to the next one.
+    iterator erase(
+            iterator it)
+    {
+        iterator next(&shards_, it.shard_, shards_[it.shard_].erase(it.it_));
+        next.skip_empty_shards();
+        return next;
+    }
+
+    void clear()
+    {
+        for (map_type& shard : shards_)
+        {
+            shard.clear();
+        }
+    }
+
+    size_t size() const
+    {
+        size_t ret = 0;
+        for (const map_type& shard : shards_)
+        {
+            ret += shard.size();
+        }
+        return ret;
+    }
+
+    bool empty() const
+    {
+        for (const map_type& shard : shards_)
+        {
+            if (!shard.empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+
+    std::array<map_type, num_shards> shards_;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* FASTDDS_RTPS_BUILTIN_DISCOVERY_DATABASE__SHARDEDMAP_HPP */
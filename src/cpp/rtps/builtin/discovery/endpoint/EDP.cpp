@@ -51,7 +51,6 @@
 #endif // if HAVE_SECURITY
 #include <rtps/writer/BaseWriter.hpp>
 #include <utils/collections/node_size_helpers.hpp>
-#include <utils/StringMatching.hpp>
 #ifdef FASTDDS_STATISTICS
 #include <statistics/rtps/monitor-service/interfaces/IProxyObserver.hpp>
 #endif //FASTDDS_STATISTICS
@@ -67,12 +66,6 @@ namespace rtps {
 using reader_map_helper = utilities::collections::map_size_helper<GUID_t, SubscriptionMatchedStatus>;
 using writer_map_helper = utilities::collections::map_size_helper<GUID_t, PublicationMatchedStatus>;
 
-static bool is_partition_empty(
-        const fastdds::dds::Partition_t& partition)
-{
-    return partition.size() <= 1 && 0 == strlen(partition.name());
-}
-
 static bool is_same_type(
         const dds::xtypes::TypeInformation& t1,
         const dds::xtypes::TypeInformation& t2)
@@ -978,55 +971,7 @@ bool EDP::valid_matching(
     }
 
     //Partition check:
-    bool matched = false;
-    if (wdata->partition.empty() && rdata->partition.empty())
-    {
-        matched = true;
-    }
-    else if (wdata->partition.empty() && rdata->partition.size() > 0)
-    {
-        for (auto rnameit = rdata->partition.begin();
-                rnameit != rdata->partition.end(); ++rnameit)
-        {
-            if (is_partition_empty(*rnameit))
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else if (wdata->partition.size() > 0 && rdata->partition.empty())
-    {
-        for (auto wnameit = wdata->partition.begin();
-                wnameit !=  wdata->partition.end(); ++wnameit)
-        {
-            if (is_partition_empty(*wnameit))
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else
-    {
-        for (auto wnameit = wdata->partition.begin();
-                wnameit !=  wdata->partition.end(); ++wnameit)
-        {
-            for (auto rnameit = rdata->partition.begin();
-                    rnameit != rdata->partition.end(); ++rnameit)
-            {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if (matched)
-            {
-                break;
-            }
-        }
-    }
+    bool matched = partition_matcher_.match(wdata->partition, rdata->partition);
     if (!matched) //Different partitions
     {
         EPROSIMA_LOG_WARNING(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topic_name << "): Different Partitions");
@@ -1117,78 +1062,79 @@ bool EDP::pairingReader(
     EPROSIMA_LOG_INFO(RTPS_EDP, rdata.guid << " in topic: \"" << rdata.topic_name << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-    if (!this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
-    {
-        pit++;
-    }
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+    bool match_local_endpoints = mp_PDP->getRTPSParticipant()->should_match_local_endpoints();
 
-    for (; pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
-    {
-        for (auto& pair : *(*pit)->m_writers)
-        {
-            WriterProxyData* wdatait = pair.second;
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
-            const GUID_t& reader_guid = reader->getGuid();
-            const GUID_t& writer_guid = wdatait->guid;
-
-            if (valid)
+    // Only writers on the same topic (and type, when there is no type information) can match
+    mp_PDP->writers_topic_index().for_each_candidate(rdata.topic_name.to_string(), rdata.type_name.to_string(),
+            rdata.has_type_information(), [&](WriterProxyData* wdatait)
             {
-#if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_writer(reader_guid, (*pit)->guid,
-                        *wdatait, reader->getAttributes().security_attributes()))
+                if (!match_local_endpoints && wdatait->guid.guidPrefix == local_prefix)
                 {
-                    EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
+                    return;
                 }
-#else
-                if (reader->matched_writer_add_edp(*wdatait))
+
+                MatchingFailureMask no_match_reason;
+                fastdds::dds::PolicyMask incompatible_qos;
+                bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
+                const GUID_t& reader_guid = reader->getGuid();
+                const GUID_t& writer_guid = wdatait->guid;
+
+                if (valid)
                 {
-                    static_cast<void>(reader_guid);  // Void cast to force usage if we don't have LOG_INFOs
-                    EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "WP:" << wdatait->guid << " match R:" << reader_guid << ". RLoc:" <<
-                            wdatait->remote_locators);
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (reader->get_listener() != nullptr)
+#if HAVE_SECURITY
+                    GUID_t remote_participant_guid(writer_guid.guidPrefix, c_EntityId_RTPSParticipant);
+                    if (!mp_RTPSParticipant->security_manager().discovered_writer(reader_guid, remote_participant_guid,
+                            *wdatait, reader->getAttributes().security_attributes()))
                     {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        reader->get_listener()->on_reader_matched(reader, info);
+                        EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
+                    }
+#else
+                    if (reader->matched_writer_add_edp(*wdatait))
+                    {
+                        static_cast<void>(reader_guid);  // Void cast to force usage if we don't have LOG_INFOs
+                        EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                                "WP:" << wdatait->guid << " match R:" << reader_guid << ". RLoc:" <<
+                                wdatait->remote_locators);
+                        //MATCHED AND ADDED CORRECTLY:
+                        if (reader->get_listener() != nullptr)
+                        {
+                            MatchingInfo info;
+                            info.status = MATCHED_MATCHING;
+                            info.remoteEndpointGuid = writer_guid;
+                            reader->get_listener()->on_reader_matched(reader, info);
+                        }
                     }
-                }
 #endif // if HAVE_SECURITY
-            }
-            else
-            {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && reader->get_listener() != nullptr)
-                {
-                    reader->get_listener()->on_requested_incompatible_qos(reader, incompatible_qos);
-                    mp_PDP->notify_incompatible_qos_matching(R->getGuid(), wdatait->guid, incompatible_qos);
                 }
-
-                //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->guid<<RTPS_DEF<<endl);
-                if (reader->matched_writer_is_matched(wdatait->guid)
-                        && reader->matched_writer_remove(wdatait->guid))
+                else
                 {
+                    if (no_match_reason.test(MatchingFailureMask::incompatible_qos) &&
+                            reader->get_listener() != nullptr)
+                    {
+                        reader->get_listener()->on_requested_incompatible_qos(reader, incompatible_qos);
+                        mp_PDP->notify_incompatible_qos_matching(R->getGuid(), wdatait->guid, incompatible_qos);
+                    }
+
+                    if (reader->matched_writer_is_matched(wdatait->guid)
+                            && reader->matched_writer_remove(wdatait->guid))
+                    {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
-                            wdatait->guid);
+                        mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
+                                wdatait->guid);
 #endif // if HAVE_SECURITY
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (reader->get_listener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        reader->get_listener()->on_reader_matched(reader, info);
+                        //MATCHED AND ADDED CORRECTLY:
+                        if (reader->get_listener() != nullptr)
+                        {
+                            MatchingInfo info;
+                            info.status = REMOVED_MATCHING;
+                            info.remoteEndpointGuid = writer_guid;
+                            reader->get_listener()->on_reader_matched(reader, info);
+                        }
                     }
                 }
-            }
-        }
-    }
+            });
     return true;
 }
 
@@ -1207,78 +1153,76 @@ bool EDP::pairingWriter(
     EPROSIMA_LOG_INFO(RTPS_EDP, writer_guid << " in topic: \"" << wdata.topic_name << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-    if (!this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
-    {
-        pit++;
-    }
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+    bool match_local_endpoints = mp_PDP->getRTPSParticipant()->should_match_local_endpoints();
 
-    for (; pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
-    {
-        for (auto& pair : *(*pit)->m_readers)
-        {
-            ReaderProxyData* rdatait = pair.second;
-            const GUID_t& reader_guid = rdatait->guid;
-            if (reader_guid == c_Guid_Unknown)
+    // Only readers on the same topic (and type, when there is no type information) can match
+    mp_PDP->readers_topic_index().for_each_candidate(wdata.topic_name.to_string(), wdata.type_name.to_string(),
+            wdata.has_type_information(), [&](ReaderProxyData* rdatait)
             {
-                continue;
-            }
+                const GUID_t& reader_guid = rdatait->guid;
+                if (reader_guid == c_Guid_Unknown ||
+                        (!match_local_endpoints && reader_guid.guidPrefix == local_prefix))
+                {
+                    return;
+                }
 
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+                MatchingFailureMask no_match_reason;
+                fastdds::dds::PolicyMask incompatible_qos;
+                bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
 
-            if (valid)
-            {
-#if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_reader(writer_guid, (*pit)->guid,
-                        *rdatait, writer->getAttributes().security_attributes()))
+                if (valid)
                 {
-                    EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << writer_guid);
-                }
+#if HAVE_SECURITY
+                    GUID_t remote_participant_guid(reader_guid.guidPrefix, c_EntityId_RTPSParticipant);
+                    if (!mp_RTPSParticipant->security_manager().discovered_reader(writer_guid, remote_participant_guid,
+                            *rdatait, writer->getAttributes().security_attributes()))
+                    {
+                        EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << writer_guid);
+                    }
 #else
-                if (writer->matched_reader_add_edp(*rdatait))
-                {
-                    EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "RP:" << rdatait->guid << " match W:" << writer_guid << ". WLoc:" <<
-                            rdatait->remote_locators);
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (writer->get_listener() != nullptr)
+                    if (writer->matched_reader_add_edp(*rdatait))
                     {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        writer->get_listener()->on_writer_matched(writer, info);
+                        EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                                "RP:" << rdatait->guid << " match W:" << writer_guid << ". WLoc:" <<
+                                rdatait->remote_locators);
+                        //MATCHED AND ADDED CORRECTLY:
+                        if (writer->get_listener() != nullptr)
+                        {
+                            MatchingInfo info;
+                            info.status = MATCHED_MATCHING;
+                            info.remoteEndpointGuid = reader_guid;
+                            writer->get_listener()->on_writer_matched(writer, info);
+                        }
                     }
-                }
 #endif // if HAVE_SECURITY
-            }
-            else
-            {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && writer->get_listener() != nullptr)
-                {
-                    writer->get_listener()->on_offered_incompatible_qos(writer, incompatible_qos);
-                    mp_PDP->notify_incompatible_qos_matching(W->getGuid(), rdatait->guid, incompatible_qos);
                 }
-
-                //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->guid<<RTPS_DEF<<endl);
-                if (writer->matched_reader_is_matched(reader_guid) && writer->matched_reader_remove(reader_guid))
+                else
                 {
+                    if (no_match_reason.test(MatchingFailureMask::incompatible_qos) &&
+                            writer->get_listener() != nullptr)
+                    {
+                        writer->get_listener()->on_offered_incompatible_qos(writer, incompatible_qos);
+                        mp_PDP->notify_incompatible_qos_matching(W->getGuid(), rdatait->guid, incompatible_qos);
+                    }
+
+                    if (writer->matched_reader_is_matched(reader_guid) && writer->matched_reader_remove(reader_guid))
+                    {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(writer_guid, participant_guid, reader_guid);
+                        mp_RTPSParticipant->security_manager().remove_reader(writer_guid, participant_guid,
+                                reader_guid);
 #endif // if HAVE_SECURITY
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (writer->get_listener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        writer->get_listener()->on_writer_matched(writer, info);
+                        //MATCHED AND ADDED CORRECTLY:
+                        if (writer->get_listener() != nullptr)
+                        {
+                            MatchingInfo info;
+                            info.status = REMOVED_MATCHING;
+                            info.remoteEndpointGuid = reader_guid;
+                            writer->get_listener()->on_writer_matched(writer, info);
+                        }
                     }
                 }
-            }
-        }
-    }
+            });
     return true;
 }
 
@@ -30,6 +30,7 @@
 
 #include <rtps/builtin/data/ReaderProxyData.hpp>
 #include <rtps/builtin/data/WriterProxyData.hpp>
+#include <rtps/builtin/discovery/endpoint/PartitionMatcher.hpp>
 #include <utils/ProxyPool.hpp>
 
 #define MATCH_FAILURE_REASON_COUNT size_t(16)
@@ -401,6 +402,9 @@ private:
     bool checkDataRepresentationQos(
             const WriterProxyData* wdata,
             const ReaderProxyData* rdata) const;
+
+    //! Compiled partition sets of the endpoints checked by valid_matching
+    PartitionMatcher partition_matcher_;
 };
 
 } // namespace rtps
@@ -0,0 +1,207 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EndpointTopicIndex.hpp
+ */
+
+#ifndef FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__ENDPOINTTOPICINDEX_HPP
+#define FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__ENDPOINTTOPICINDEX_HPP
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Index of discovered endpoint proxies by topic name and type name.
+ *
+ * It lets the endpoint discovery protocol visit only the endpoints that could match a local one, instead of every
+ * endpoint of every known participant.
+ * Entries are identified by the address of the proxy object, so they can be removed even if the proxy contents
+ * changed after being indexed.
+ * This class is not thread-safe; it is meant to be protected by the PDP mutex.
+ *
+ * @tparam ProxyData Either ReaderProxyData or WriterProxyData.
+ */
+template<typename ProxyData>
+class EndpointTopicIndex
+{
+public:
+
+    using Bucket = std::vector<ProxyData*>;
+
+    /**
+     * Add a proxy to the index, or move it to a different bucket if its topic or type name changed.
+     * @param proxy Pointer to the proxy to index.
+     */
+    void update(
+            ProxyData* proxy)
+    {
+        std::string topic_name = proxy->topic_name.to_string();
+        std::string type_name = proxy->type_name.to_string();
+
+        auto it = locations_.find(proxy);
+        if (it != locations_.end())
+        {
+            if (it->second.first == topic_name && it->second.second == type_name)
+            {
+                return;
+            }
+            erase_from_bucket(proxy, it->second);
+            locations_.erase(it);
+        }
+
+        topics_[topic_name][type_name].push_back(proxy);
+        locations_.emplace(proxy, Location(std::move(topic_name), std::move(type_name)));
+    }
+
+    /**
+     * Remove a proxy from the index.
+     * @param proxy Pointer to the proxy to remove.
+     */
+    void remove(
+            const ProxyData* proxy)
+    {
+        auto it = locations_.find(proxy);
+        if (it != locations_.end())
+        {
+            erase_from_bucket(proxy, it->second);
+            locations_.erase(it);
+        }
+    }
+
+    //! Remove all the proxies from the index.
+    void clear()
+    {
+        topics_.clear();
+        locations_.clear();
+    }
+
+    //! Number of indexed proxies.
+    size_t size() const
+    {
+        return locations_.size();
+    }
+
+    /**
+     * Call a functor on every indexed proxy that could match an endpoint on the given topic.
+     *
+     * When the endpoint carries type information, the type names do not need to be the same for a match, so all the
+     * proxies on the topic are visited.
+     *
+     * @param topic_name  Name of the topic of the endpoint.
+     * @param type_name   Name of the type of the endpoint.
+     * @param any_type    Whether proxies with a different type name should be visited.
+     * @param functor     Functor receiving a @c ProxyData* for each candidate.
+     */
+    template<typename Functor>
+    void for_each_candidate(
+            const std::string& topic_name,
+            const std::string& type_name,
+            bool any_type,
+            Functor functor) const
+    {
+        auto topic_it = topics_.find(topic_name);
+        if (topic_it == topics_.end())
+        {
+            return;
+        }
+
+        if (any_type)
+        {
+            for (const auto& type_entry : topic_it->second)
+            {
+                visit(type_entry.second, functor);
+            }
+        }
+        else
+        {
+            auto type_it = topic_it->second.find(type_name);
+            if (type_it != topic_it->second.end())
+            {
+                visit(type_it->second, functor);
+            }
+        }
+    }
+
+private:
+
+    //! Topic name and type name under which a proxy is indexed
+    using Location = std::pair<std::string, std::string>;
+
+    template<typename Functor>
+    static void visit(
+            const Bucket& bucket,
+            Functor& functor)
+    {
+        // Iterate by position, as matching callbacks may add endpoints to the same bucket
+        for (size_t i = 0; i < bucket.size(); ++i)
+        {
+            functor(bucket[i]);
+        }
+    }
+
+    void erase_from_bucket(
+            const ProxyData* proxy,
+            const Location& location)
+    {
+        auto topic_it = topics_.find(location.first);
+        if (topic_it == topics_.end())
+        {
+            return;
+        }
+
+        auto type_it = topic_it->second.find(location.second);
+        if (type_it != topic_it->second.end())
+        {
+            Bucket& bucket = type_it->second;
+            for (auto bit = bucket.begin(); bit != bucket.end(); ++bit)
+            {
+                if (*bit == proxy)
+                {
+                    bucket.erase(bit);
+                    break;
+                }
+            }
+
+            if (bucket.empty())
+            {
+                topic_it->second.erase(type_it);
+            }
+        }
+
+        if (topic_it->second.empty())
+        {
+            topics_.erase(topic_it);
+        }
+    }
+
+    //! Proxies indexed by topic name and type name
+    std::unordered_map<std::string, std::unordered_map<std::string, Bucket>> topics_;
+
+    //! Location of each indexed proxy
+    std::unordered_map<const ProxyData*, Location> locations_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__ENDPOINTTOPICINDEX_HPP
@@ -0,0 +1,321 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.cpp
+ */
+
+#include <rtps/builtin/discovery/endpoint/PartitionMatcher.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <utils/StringMatching.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+bool PartitionMatcher::match(
+        const fastdds::dds::PartitionQosPolicy& writer_partitions,
+        const fastdds::dds::PartitionQosPolicy& reader_partitions)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    uint32_t resets = cache_resets_;
+    uint32_t writer_set = compile_set(writer_partitions);
+    uint32_t reader_set = compile_set(reader_partitions);
+    if (resets != cache_resets_)
+    {
+        // The cache was discarded while compiling the reader set
+        writer_set = compile_set(writer_partitions);
+    }
+
+    // Matching is symmetric, so both orders share the same entry
+    uint64_t key = (static_cast<uint64_t>(std::min(writer_set, reader_set)) << 32) |
+            std::max(writer_set, reader_set);
+    auto it = results_.find(key);
+    if (it != results_.end())
+    {
+        return it->second;
+    }
+
+    bool matched = match_sets(sets_[writer_set], sets_[reader_set]);
+    if (results_.size() >= max_cached_results)
+    {
+        results_.clear();
+    }
+    results_.emplace(key, matched);
+    return matched;
+}
+
+size_t PartitionMatcher::partition_sets() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return sets_.size();
+}
+
+size_t PartitionMatcher::partition_names() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return names_.size();
+}
+
+uint32_t PartitionMatcher::compile_set(
+        const fastdds::dds::PartitionQosPolicy& partitions)
+{
+    // Names cannot contain '\0', so it is used as separator on the key
+    std::string key;
+    for (auto it = partitions.begin(); it != partitions.end(); ++it)
+    {
+        key.append(it->name());
+        key.push_back('\0');
+    }
+
+    auto it = set_ids_.find(key);
+    if (it != set_ids_.end())
+    {
+        return it->second;
+    }
+
+    if (sets_.size() >= max_partition_sets)
+    {
+        // Identifiers of sets and names are invalidated together
+        set_ids_.clear();
+        sets_.clear();
+        name_ids_.clear();
+        names_.clear();
+        results_.clear();
+        ++cache_resets_;
+    }
+
+    PartitionSet set;
+    for (auto pit = partitions.begin(); pit != partitions.end(); ++pit)
+    {
+        set.is_empty = false;
+        const char* name = pit->name();
+        if (0 == strlen(name))
+        {
+            set.has_default = true;
+        }
+
+        uint32_t name_id = intern_name(name);
+        if (NameKind::LITERAL == names_[name_id].kind)
+        {
+            set.literals.push_back(name_id);
+        }
+        else
+        {
+            set.wildcards.push_back(name_id);
+        }
+    }
+    std::sort(set.literals.begin(), set.literals.end());
+    set.literals.erase(std::unique(set.literals.begin(), set.literals.end()), set.literals.end());
+
+    uint32_t set_id = static_cast<uint32_t>(sets_.size());
+    sets_.push_back(std::move(set));
+    set_ids_.emplace(std::move(key), set_id);
+    return set_id;
+}
+
+uint32_t PartitionMatcher::intern_name(
+        const char* name)
+{
+    std::string text(name);
+    auto it = name_ids_.find(text);
+    if (it != name_ids_.end())
+    {
+        return it->second;
+    }
+
+    PartitionName entry;
+    entry.text = text;
+    if (std::string::npos != text.find_first_of("*?["))
+    {
+#if defined(_WIN32)
+        // PathMatchSpec has its own rules (e.g. it is case insensitive), so keep using it
+        entry.kind = NameKind::EXTERNAL;
+#else
+        entry.kind = (std::string::npos != text.find('[')) ? NameKind::EXTERNAL : NameKind::GLOB;
+#endif // if defined(_WIN32)
+    }
+#if defined(_WIN32)
+    else
+    {
+        entry.kind = NameKind::EXTERNAL;
+    }
+#endif // if defined(_WIN32)
+
+    if (NameKind::GLOB == entry.kind)
+    {
+        size_t start = 0;
+        size_t star = text.find('*');
+        while (std::string::npos != star)
+        {
+            entry.segments.push_back(text.substr(start, star - start));
+            start = star + 1;
+            star = text.find('*', start);
+        }
+        entry.segments.push_back(text.substr(start));
+    }
+
+    uint32_t name_id = static_cast<uint32_t>(names_.size());
+    names_.push_back(std::move(entry));
+    name_ids_.emplace(std::move(text), name_id);
+    return name_id;
+}
+
+bool PartitionMatcher::match_sets(
+        const PartitionSet& set_1,
+        const PartitionSet& set_2) const
+{
+    // An empty list only matches an empty list or one containing the default partition
+    if (set_1.is_empty || set_2.is_empty)
+    {
+        return (set_1.is_empty && set_2.is_empty) || set_1.has_default || set_2.has_default;
+    }
+
+    // Common literal names
+    auto it_1 = set_1.literals.begin();
+    auto it_2 = set_2.literals.begin();
+    while (it_1 != set_1.literals.end() && it_2 != set_2.literals.end())
+    {
+        if (*it_1 == *it_2)
+        {
+            return true;
+        }
+        if (*it_1 < *it_2)
+        {
+            ++it_1;
+        }
+        else
+        {
+            ++it_2;
+        }
+    }
+
+    // Wildcards on either side against every name on the other one
+    for (uint32_t wildcard : set_1.wildcards)
+    {
+        for (uint32_t name : set_2.literals)
+        {
+            if (match_names(wildcard, name))
+            {
+                return true;
+            }
+        }
+        for (uint32_t name : set_2.wildcards)
+        {
+            if (match_names(wildcard, name))
+            {
+                return true;
+            }
+        }
+    }
+    for (uint32_t wildcard : set_2.wildcards)
+    {
+        for (uint32_t name : set_1.literals)
+        {
+            if (match_names(wildcard, name))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool PartitionMatcher::match_names(
+        uint32_t name_1,
+        uint32_t name_2) const
+{
+    const PartitionName& entry_1 = names_[name_1];
+    const PartitionName& entry_2 = names_[name_2];
+
+    if (NameKind::EXTERNAL == entry_1.kind || NameKind::EXTERNAL == entry_2.kind)
+    {
+        return StringMatching::matchString(entry_1.text.c_str(), entry_2.text.c_str());
+    }
+
+    return name_1 == name_2 ||
+           (NameKind::GLOB == entry_1.kind && match_glob(entry_1, entry_2.text)) ||
+           (NameKind::GLOB == entry_2.kind && match_glob(entry_2, entry_1.text));
+}
+
+static bool match_segment_at(
+        const std::string& segment,
+        const std::string& input,
+        size_t position)
+{
+    for (size_t i = 0; i < segment.size(); ++i)
+    {
+        if ('?' != segment[i] && segment[i] != input[position + i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PartitionMatcher::match_glob(
+        const PartitionName& glob,
+        const std::string& input)
+{
+    const std::vector<std::string>& segments = glob.segments;
+    const std::string& first = segments.front();
+
+    if (1 == segments.size())
+    {
+        return input.size() == first.size() && match_segment_at(first, input, 0);
+    }
+
+    // The first segment is anchored at the beginning and the last one at the end
+    const std::string& last = segments.back();
+    if (input.size() < first.size() + last.size() ||
+            !match_segment_at(first, input, 0) ||
+            !match_segment_at(last, input, input.size() - last.size()))
+    {
+        return false;
+    }
+
+    // The segments in between are searched for left to right, taking the first occurrence of each one
+    size_t position = first.size();
+    size_t end = input.size() - last.size();
+    for (size_t s = 1; s + 1 < segments.size(); ++s)
+    {
+        const std::string& segment = segments[s];
+        bool found = false;
+        while (position + segment.size() <= end)
+        {
+            if (match_segment_at(segment, input, position))
+            {
+                found = true;
+                break;
+            }
+            ++position;
+        }
+        if (!found)
+        {
+            return false;
+        }
+        position += segment.size();
+    }
+
+    return true;
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,148 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.hpp
+ */
+
+#ifndef FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__PARTITIONMATCHER_HPP
+#define FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__PARTITIONMATCHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Checks whether the partitions of a writer and a reader match, with the same rules as
+ * StringMatching::matchString on every pair of partition names.
+ *
+ * Each distinct partition name is interned once. Names without wildcards are compared by identifier, and names
+ * with '*' or '?' wildcards are compiled into a list of segments.
+ * Each distinct partition set is compiled once as well, and the result of matching two sets is cached by the
+ * identifiers of both sets.
+ * This class is thread-safe.
+ */
+class PartitionMatcher
+{
+public:
+
+    //! Maximum number of partition sets kept before the whole cache is discarded.
+    static constexpr size_t max_partition_sets = 4096;
+
+    //! Maximum number of results kept before the cached results are discarded.
+    static constexpr size_t max_cached_results = 65536;
+
+    /**
+     * Check whether a writer and a reader with the given partitions match.
+     *
+     * @param writer_partitions  Partitions of the writer.
+     * @param reader_partitions  Partitions of the reader.
+     *
+     * @return true when both lists are empty, when one is empty and the other one contains the default (empty)
+     *         partition, or when a name on one list matches a name on the other one.
+     */
+    bool match(
+            const fastdds::dds::PartitionQosPolicy& writer_partitions,
+            const fastdds::dds::PartitionQosPolicy& reader_partitions);
+
+    //! Number of distinct partition sets compiled.
+    size_t partition_sets() const;
+
+    //! Number of distinct partition names interned.
+    size_t partition_names() const;
+
+private:
+
+    //! How a partition name is compared against other names.
+    enum class NameKind : uint8_t
+    {
+        //! No wildcards; equal only to itself.
+        LITERAL,
+        //! Wildcards '*' and '?'; matched with the compiled segments.
+        GLOB,
+        //! Any other wildcard, or a platform without compiled matching; delegated to StringMatching.
+        EXTERNAL
+    };
+
+    //! An interned partition name.
+    struct PartitionName
+    {
+        std::string text;
+        NameKind kind = NameKind::LITERAL;
+        //! Parts of a GLOB name between '*' characters. A '?' on a segment matches any character.
+        std::vector<std::string> segments;
+    };
+
+    //! A compiled partition set.
+    struct PartitionSet
+    {
+        //! Whether the policy has no partitions.
+        bool is_empty = true;
+        //! Whether the policy contains the default (empty) partition.
+        bool has_default = false;
+        //! Sorted identifiers of the LITERAL names.
+        std::vector<uint32_t> literals;
+        //! Identifiers of the GLOB and EXTERNAL names.
+        std::vector<uint32_t> wildcards;
+    };
+
+    uint32_t compile_set(
+            const fastdds::dds::PartitionQosPolicy& partitions);
+
+    uint32_t intern_name(
+            const char* name);
+
+    bool match_sets(
+            const PartitionSet& set_1,
+            const PartitionSet& set_2) const;
+
+    bool match_names(
+            uint32_t name_1,
+            uint32_t name_2) const;
+
+    static bool match_glob(
+            const PartitionName& glob,
+            const std::string& input);
+
+    mutable std::mutex mutex_;
+
+    //! Interned names and their identifiers
+    std::unordered_map<std::string, uint32_t> name_ids_;
+    std::vector<PartitionName> names_;
+
+    //! Compiled sets, identified by the concatenation of their names
+    std::unordered_map<std::string, uint32_t> set_ids_;
+    std::vector<PartitionSet> sets_;
+
+    //! Results of matching two sets, keyed by both identifiers
+    std::unordered_map<uint64_t, bool> results_;
+
+    //! Number of times the whole cache was discarded
+    uint32_t cache_resets_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_BUILTIN_DISCOVERY_ENDPOINT__PARTITIONMATCHER_HPP
@@ -844,6 +844,7 @@ bool PDP::removeReaderProxyData(
 #endif // ifdef FASTDDS_STATISTICS
 
                 // Clear reader proxy data and move to pool in order to allow reuse
+                readers_topic_index_.remove(pR);
                 pR->clear();
                 pit->m_readers->erase(rit);
                 reader_proxies_pool_.push_back(pR);
@@ -891,6 +892,7 @@ bool PDP::removeWriterProxyData(
 #endif // ifdef FASTDDS_STATISTICS
 
                 // Clear writer proxy data and move to pool in order to allow reuse
+                writers_topic_index_.remove(pW);
                 pW->clear();
                 pit->m_writers->erase(wit);
                 writer_proxies_pool_.push_back(pW);
@@ -966,6 +968,7 @@ ReaderProxyData* PDP::addReaderProxyData(
                 {
                     return nullptr;
                 }
+                readers_topic_index_.update(ret_val);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
@@ -1020,6 +1023,7 @@ ReaderProxyData* PDP::addReaderProxyData(
             {
                 return nullptr;
             }
+            readers_topic_index_.update(ret_val);
 
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
@@ -1068,6 +1072,7 @@ WriterProxyData* PDP::addWriterProxyData(
                 {
                     return nullptr;
                 }
+                writers_topic_index_.update(ret_val);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
@@ -1121,6 +1126,7 @@ WriterProxyData* PDP::addWriterProxyData(
             {
                 return nullptr;
             }
+            writers_topic_index_.update(ret_val);
 
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
@@ -1421,6 +1427,7 @@ void PDP::actions_on_remote_participant_removed(
         // Return reader proxy objects to pool
         for (auto pit : *pdata->m_readers)
         {
+            readers_topic_index_.remove(pit.second);
             pit.second->clear();
             reader_proxies_pool_.push_back(pit.second);
         }
@@ -1429,6 +1436,7 @@ void PDP::actions_on_remote_participant_removed(
         // Return writer proxy objects to pool
         for (auto pit : *pdata->m_writers)
         {
+            writers_topic_index_.remove(pit.second);
             pit.second->clear();
             writer_proxies_pool_.push_back(pit.second);
         }
@@ -53,6 +53,7 @@
 #include <rtps/builtin/data/ParticipantProxyData.hpp>
 #include <rtps/builtin/data/ReaderProxyData.hpp>
 #include <rtps/builtin/data/WriterProxyData.hpp>
+#include <rtps/builtin/discovery/endpoint/EndpointTopicIndex.hpp>
 #include <statistics/rtps/monitor-service/interfaces/IProxyObserver.hpp>
 #include <statistics/rtps/monitor-service/interfaces/IProxyQueryable.hpp>
 #include <utils/ProxyPool.hpp>
@@ -372,6 +373,26 @@ public:
         return participant_proxies_.end();
     }
 
+    /**
+     * Get the index of known readers (local and remote) by topic.
+     * The PDP mutex should be taken while accessing it.
+     * @return const reference to the index.
+     */
+    const EndpointTopicIndex<ReaderProxyData>& readers_topic_index() const
+    {
+        return readers_topic_index_;
+    }
+
+    /**
+     * Get the index of known writers (local and remote) by topic.
+     * The PDP mutex should be taken while accessing it.
+     * @return const reference to the index.
+     */
+    const EndpointTopicIndex<WriterProxyData>& writers_topic_index() const
+    {
+        return writers_topic_index_;
+    }
+
     /**
      * Get the number of participant proxies.
      * @return size_t.
@@ -539,6 +560,10 @@ protected:
     size_t writer_proxies_number_;
     //!Pool of writer proxy data objects ready for reuse
     ResourceLimitedVector<WriterProxyData*> writer_proxies_pool_;
+    //!Index by topic of the reader proxy data objects in use
+    EndpointTopicIndex<ReaderProxyData> readers_topic_index_;
+    //!Index by topic of the writer proxy data objects in use
+    EndpointTopicIndex<WriterProxyData> writers_topic_index_;
     //!Variable to indicate if any parameter has changed.
     std::atomic_bool m_hasChangedLocalPDP;
     //! ProxyPool for temporary reader proxies
@@ -24,6 +24,7 @@
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.hpp>
 #include <fastdds/rtps/history/History.hpp>
 #include <fastdds/rtps/history/ReaderHistory.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
@@ -89,6 +90,7 @@ PDPServer::~PDPServer()
 
     // Disable database
     discovery_db_.disable();
+    discovery_db_.stop_processing_threads();
 
     // Delete timed events
     delete(routine_);
@@ -125,6 +127,22 @@ bool PDPServer::init(
     const fastdds::rtps::ThreadSettings& thr_config = part_attr.discovery_server_thread;
     resource_event_thread_.init_thread(thr_config, "dds.ds_ev.%u", id_for_thread);
 
+    // Initialize the threads processing the EDP updates of the database in parallel
+    const std::string* db_threads_property =
+            PropertyPolicyHelper::find_property(part_attr.properties, "fastdds.discovery_server.database_threads");
+    if (nullptr != db_threads_property)
+    {
+        try
+        {
+            discovery_db_.init_processing_threads(static_cast<uint32_t>(std::stoul(*db_threads_property)),
+                    thr_config, id_for_thread);
+        }
+        catch (const std::exception& e)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error parsing database_threads property: " << e.what());
+        }
+    }
+
     /*
         Given the fact that a participant is either a client or a server the
         discoveryServer_client_syncperiod parameter has a context defined meaning.
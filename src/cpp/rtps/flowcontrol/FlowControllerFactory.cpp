@@ -60,7 +60,70 @@ void FlowControllerFactory::register_flow_controller (
 
     const ThreadSettings& sender_thread_settings = flow_controller_descr.sender_thread;
 
-    if (0 < flow_controller_descr.max_bytes_per_period)
+    if ((0 < flow_controller_descr.token_bucket_depth) != (0 < flow_controller_descr.token_bucket_refill_rate))
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                "Error registering FlowController " << flow_controller_descr.name <<
+                ". Both token_bucket_depth and token_bucket_refill_rate should be set to use a token bucket");
+        return;
+    }
+
+    if (0 < flow_controller_descr.token_bucket_depth)
+    {
+        if (0 < flow_controller_descr.max_bytes_per_period)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT,
+                    "FlowController " << flow_controller_descr.name <<
+                    " uses a token bucket. max_bytes_per_period and period_ms will be ignored");
+        }
+
+        switch (flow_controller_descr.scheduler)
+        {
+            case FlowControllerSchedulerPolicy::FIFO:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerFifoSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            case FlowControllerSchedulerPolicy::ROUND_ROBIN:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerRoundRobinSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerHighPrioritySchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerPriorityWithReservationSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            case FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerDeficitRoundRobinSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            default:
+                assert(false);
+        }
+    }
+    else if (0 < flow_controller_descr.max_bytes_per_period)
     {
         switch (flow_controller_descr.scheduler)
         {
@@ -96,6 +159,14 @@ void FlowControllerFactory::register_flow_controller (
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
                                 &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
                 break;
+            case FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                                FlowControllerDeficitRoundRobinSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
             default:
                 assert(false);
         }
@@ -136,6 +207,14 @@ void FlowControllerFactory::register_flow_controller (
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
                                 &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
                 break;
+            case FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                                FlowControllerDeficitRoundRobinSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
             default:
                 assert(false);
         }
@@ -4,8 +4,11 @@
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cmath>
+#include <limits>
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 #include "FlowController.hpp"
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
@@ -376,6 +379,176 @@ private:
     std::chrono::steady_clock::time_point last_period_ = std::chrono::steady_clock::now();
 };
 
+//! Sends all samples asynchronously, pacing them with a token bucket.
+struct FlowControllerTokenBucketPublishMode : public FlowControllerAsyncPublishMode
+{
+    FlowControllerTokenBucketPublishMode(
+            RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerAsyncPublishMode(participant, descriptor)
+    {
+        assert(nullptr != descriptor);
+        assert(0 < descriptor->token_bucket_depth);
+        assert(0 < descriptor->token_bucket_refill_rate);
+
+        bucket_depth = descriptor->token_bucket_depth;
+        refill_rate = descriptor->token_bucket_refill_rate;
+
+        // The bucket starts full.
+        tokens_ = bucket_depth;
+        group.set_sent_bytes_limitation(bucket_depth);
+    }
+
+    bool fast_check_is_there_slot_for_change(
+            CacheChange_t* change)
+    {
+        // Not fragmented sample, the fast check is if the serialized payload fit.
+        uint32_t size_to_check = change->serializedPayload.length;
+
+        if (0 != change->getFragmentCount())
+        {
+            // For fragmented sample, the fast check is the minor fragments fit.
+            size_to_check = change->serializedPayload.length % change->getFragmentSize();
+
+            if (0 == size_to_check)
+            {
+                size_to_check = change->getFragmentSize();
+            }
+        }
+
+        // Tokens needed by the next message, used if the delivery exceeds the limitation.
+        next_message_tokens_ = static_cast<uint64_t>(0 != change->getFragmentCount() ?
+                change->getFragmentSize() : change->serializedPayload.length) + message_overhead;
+
+        bool ret = available_tokens() > size_to_check;
+
+        if (!ret)
+        {
+            force_wait_ = true;
+            wait_tokens_ = (std::min)(static_cast<uint64_t>(size_to_check) + message_overhead, bucket_depth);
+        }
+
+        return ret;
+    }
+
+    /*!
+     * Wait until there is a new change added (notified by other thread) or, when the sender was stopped because there
+     * were not enough tokens, until the bucket has been refilled with the required ones.
+     *
+     * @return true if a whole bucket depth has been refilled since the last time true was returned.
+     */
+    bool wait(
+            std::unique_lock<fastdds::TimedMutex>& lock)
+    {
+        refill_tokens();
+
+        if (force_wait_)
+        {
+            if (tokens_ < wait_tokens_)
+            {
+                // Time needed to refill the missing tokens, rounded up to the next microsecond.
+                uint64_t missing_us = static_cast<uint64_t>(
+                    std::ceil((wait_tokens_ - tokens_) * 1000000.0 / static_cast<double>(refill_rate)));
+                cv.wait_for(lock, std::chrono::microseconds(missing_us));
+                refill_tokens();
+            }
+
+            if (tokens_ >= wait_tokens_)
+            {
+                force_wait_ = false;
+            }
+        }
+        else
+        {
+            cv.wait(lock);
+            refill_tokens();
+        }
+
+        bool reset_limit = false;
+        if (refilled_since_reset_ >= bucket_depth)
+        {
+            refilled_since_reset_ = std::fmod(refilled_since_reset_, static_cast<double>(bucket_depth));
+            reset_limit = true;
+        }
+
+        return reset_limit;
+    }
+
+    bool force_wait() const
+    {
+        return force_wait_;
+    }
+
+    void process_deliver_retcode(
+            const DeliveryRetCode& ret_value)
+    {
+        if (DeliveryRetCode::EXCEEDED_LIMIT == ret_value)
+        {
+            // The fast check passed but the message did not fit, so wait for more tokens than currently available.
+            force_wait_ = true;
+            wait_tokens_ = (std::min)((std::max)(static_cast<uint64_t>(available_tokens()) + message_overhead,
+                            next_message_tokens_), bucket_depth);
+        }
+    }
+
+    uint64_t bucket_depth = 0;
+
+    //! Bytes per second.
+    uint64_t refill_rate = 0;
+
+private:
+
+    //! Estimation of the bytes added to a sample when it is sent in a message.
+    static constexpr uint64_t message_overhead = RTPSMESSAGE_HEADER_SIZE + RTPSMESSAGE_INFOTS_SIZE +
+            RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + RTPSMESSAGE_OCTETSTOINLINEQOS_DATAFRAGSUBMSG;
+
+    uint32_t available_tokens()
+    {
+        uint32_t processed = group.get_current_bytes_processed();
+        uint32_t tokens = static_cast<uint32_t>(tokens_);
+        return tokens > processed ? tokens - processed : 0;
+    }
+
+    /*!
+     * Remove the bytes sent since the last refill from the bucket and add the tokens generated since then.
+     * The group limitation is updated to the resulting number of tokens.
+     * Should be called when the group has no pending messages.
+     */
+    void refill_tokens()
+    {
+        auto now = std::chrono::steady_clock::now();
+        double elapsed_us = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - last_refill_).count());
+        // Keep the time not converted into a whole microsecond for the next refill.
+        last_refill_ += std::chrono::microseconds(static_cast<int64_t>(elapsed_us));
+
+        double refilled = elapsed_us * static_cast<double>(refill_rate) / 1000000.0;
+        refilled_since_reset_ += refilled;
+        tokens_ -= group.get_current_bytes_processed();
+        tokens_ = (std::min)((std::max)(tokens_, 0.0) + refilled, static_cast<double>(bucket_depth));
+        group.reset_current_bytes_processed();
+
+        // A limitation of 0 means no limitation.
+        group.set_sent_bytes_limitation((std::max)(static_cast<uint32_t>(tokens_), 1u));
+    }
+
+    bool force_wait_ = false;
+
+    //! Tokens in the bucket at the last refill.
+    double tokens_ = 0;
+
+    //! Tokens required to stop waiting when force_wait_ is set.
+    uint64_t wait_tokens_ = 0;
+
+    //! Tokens required by the next message of the last checked change.
+    uint64_t next_message_tokens_ = 0;
+
+    //! Tokens refilled since the last time the scheduler limitation was reset.
+    double refilled_since_reset_ = 0;
+
+    std::chrono::steady_clock::time_point last_refill_ = std::chrono::steady_clock::now();
+};
+
 
 /** Classes used to specify FlowController's sample scheduling **/
 
@@ -939,6 +1112,272 @@ private:
     uint32_t size_being_processed_ = 0;
 };
 
+//! Deficit round robin scheduling
+struct FlowControllerDeficitRoundRobinSchedule
+{
+    //! Bytes added to the deficit of a writer with weight 1 each time its turn starts.
+    static constexpr uint32_t quantum_per_weight = 1500;
+
+    void register_writer(
+            BaseWriter* writer)
+    {
+        assert(nullptr != writer);
+        uint32_t weight = 1;
+        auto property = PropertyPolicyHelper::find_property(
+            writer->getAttributes().properties, "fastdds.sfc.weight");
+
+        if (nullptr != property)
+        {
+            char* ptr = nullptr;
+            unsigned long value = strtoul(property->c_str(), &ptr, 10);
+
+            if (property->c_str() != ptr)     // A valid integer was read.
+            {
+                if (1 > value || 1000 < value)
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                            "Wrong value for fastdds.sfc.weight property. Range is [1, 1000]. "
+                            "Weight set to lowest (1)");
+                }
+                else
+                {
+                    weight = static_cast<uint32_t>(value);
+                }
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                        "Not numerical value for fastdds.sfc.weight property. Weight set to lowest (1)");
+            }
+        }
+
+        assert(writers_queue_.end() == find(writer));
+        writers_queue_.emplace_back(writer, static_cast<uint64_t>(weight) * quantum_per_weight);
+    }
+
+    void unregister_writer(
+            BaseWriter* writer)
+    {
+        auto it = find(writer);
+        if (it == writers_queue_.end())
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                    "FlowControllerDeficitRoundRobinSchedule::unregister_writer: writer not found");
+            return;
+        }
+        assert(it->queue.is_empty());
+
+        if (writer == writer_being_processed_)
+        {
+            writer_being_processed_ = nullptr;
+            size_being_processed_ = 0;
+        }
+
+        size_t index = static_cast<size_t>(std::distance(writers_queue_.begin(), it));
+        writers_queue_.erase(it);
+
+        // Keep the turn on the same writer, or give it to the next one when unregistering the current one.
+        if (index < next_writer_)
+        {
+            --next_writer_;
+        }
+        else if (index == next_writer_)
+        {
+            turn_started_ = false;
+        }
+
+        if (next_writer_ >= writers_queue_.size())
+        {
+            next_writer_ = 0;
+        }
+    }
+
+    void work_done()
+    {
+        if (nullptr != writer_being_processed_)
+        {
+            WriterQueue& current = writers_queue_[next_writer_];
+            assert(current.writer == writer_being_processed_);
+            current.deficit -= (std::min)(current.deficit, size_being_processed_);
+            writer_being_processed_ = nullptr;
+            size_being_processed_ = 0;
+        }
+    }
+
+    void add_new_sample(
+            BaseWriter* writer,
+            CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        it->queue.add_new_sample(change);
+    }
+
+    void add_old_sample(
+            BaseWriter* writer,
+            CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        it->queue.add_old_sample(change);
+    }
+
+    CacheChange_t* get_next_change_nts()
+    {
+        if (writers_queue_.empty())
+        {
+            return nullptr;
+        }
+
+        if (nullptr != writer_being_processed_)
+        {
+            // The last returned change could not be delivered. The writer ends its turn, but keeps its deficit.
+            writer_being_processed_ = nullptr;
+            size_being_processed_ = 0;
+            set_next_writer();
+        }
+
+        while (true)
+        {
+            bool any_pending = false;
+
+            for (size_t visited = 0; visited < writers_queue_.size(); ++visited)
+            {
+                WriterQueue& current = writers_queue_[next_writer_];
+                CacheChange_t* change = current.queue.get_next_change();
+
+                if (nullptr == change)
+                {
+                    // A writer with nothing to send does not keep its deficit.
+                    current.deficit = 0;
+                    set_next_writer();
+                    continue;
+                }
+
+                any_pending = true;
+                uint64_t size = change->serializedPayload.length;
+
+                if (!turn_started_)
+                {
+                    turn_started_ = true;
+                    // A writer whose turn ended before delivering its change already has enough deficit for it.
+                    if (current.deficit < size)
+                    {
+                        current.deficit += current.quantum;
+                    }
+                }
+
+                if (size <= current.deficit)
+                {
+                    writer_being_processed_ = current.writer;
+                    size_being_processed_ = size;
+                    return change;
+                }
+
+                set_next_writer();
+            }
+
+            if (!any_pending)
+            {
+                return nullptr;
+            }
+
+            // No writer had enough deficit in a whole round. Instead of iterating round by round, grant at once the
+            // quantums of the rounds before the one in which the first writer will be able to send.
+            uint64_t rounds = (std::numeric_limits<uint64_t>::max)();
+            for (auto& queue : writers_queue_)
+            {
+                CacheChange_t* change = queue.queue.get_next_change();
+                if (nullptr != change)
+                {
+                    uint64_t missing = change->serializedPayload.length - queue.deficit;
+                    rounds = (std::min)(rounds, (missing + queue.quantum - 1) / queue.quantum);
+                }
+            }
+
+            for (auto& queue : writers_queue_)
+            {
+                if (nullptr != queue.queue.get_next_change())
+                {
+                    queue.deficit += (rounds - 1) * queue.quantum;
+                }
+            }
+        }
+    }
+
+    void add_interested_changes_to_queue_nts()
+    {
+        // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
+        for (auto& queue : writers_queue_)
+        {
+            queue.queue.add_interested_changes_to_queue();
+        }
+    }
+
+    void set_bandwith_limitation(
+            uint32_t) const
+    {
+    }
+
+    void trigger_bandwidth_limit_reset() const
+    {
+    }
+
+private:
+
+    struct WriterQueue
+    {
+        WriterQueue(
+                BaseWriter* writer_,
+                uint64_t quantum_)
+            : writer(writer_)
+            , quantum(quantum_)
+        {
+        }
+
+        BaseWriter* writer = nullptr;
+
+        FlowQueue queue;
+
+        //! Bytes added to the deficit each time the turn of the writer starts.
+        uint64_t quantum = 0;
+
+        //! Bytes the writer is allowed to send.
+        uint64_t deficit = 0;
+    };
+
+    using container = std::vector<WriterQueue>;
+    using iterator = container::iterator;
+
+    iterator find(
+            const BaseWriter* writer)
+    {
+        return std::find_if(writers_queue_.begin(), writers_queue_.end(),
+                       [writer](const WriterQueue& queue) -> bool
+                       {
+                           return writer == queue.writer;
+                       });
+    }
+
+    void set_next_writer()
+    {
+        next_writer_ = (next_writer_ + 1) % writers_queue_.size();
+        turn_started_ = false;
+    }
+
+    container writers_queue_;
+
+    //! Position of the writer whose turn is in progress.
+    size_t next_writer_ = 0;
+
+    //! Whether the writer at next_writer_ already received the quantum of its current turn.
+    bool turn_started_ = false;
+
+    BaseWriter* writer_being_processed_ = nullptr;
+
+    uint64_t size_being_processed_ = 0;
+};
+
 template<typename PublishMode, typename SampleScheduling>
 class FlowControllerImpl : public FlowController
 {
@@ -1488,7 +1927,15 @@ private:
     }
 
     template<typename PubMode = PublishMode>
-    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    typename std::enable_if<std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, uint32_t>::type
+    get_max_payload_impl()
+    {
+        return static_cast<uint32_t>(async_mode.bucket_depth);
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value &&
+            !std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, uint32_t>::type
     constexpr get_max_payload_impl() const
     {
         return (std::numeric_limits<uint32_t>::max)();
@@ -44,24 +44,28 @@ bool TopicPayloadPool::do_get_payload(
 {
     PayloadNode* payload_node = nullptr;
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
+    ThreadCache& cache = thread_cache();
+    if (thread_caches_enabled_)
     {
-        payload_node = allocate(size); //Allocates a single payload
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        if (0 < cache.count)
+        {
+            payload_node = cache.payloads[--cache.count];
+            ++cache.hits;
+        }
+    }
+
+    if (payload_node == nullptr)
+    {
+        payload_node = take_free_payload(size, cache);
         if (payload_node == nullptr)
         {
-            lock.unlock();
             payload.data = nullptr;
             payload.max_size = 0;
             payload.payload_owner = nullptr;
             return false;
         }
     }
-    else
-    {
-        payload_node = free_payloads_.back();
-        free_payloads_.pop_back();
-    }
 
     // Resize if needed
     if (resizeable && size > payload_node->data_size())
@@ -69,8 +73,7 @@ bool TopicPayloadPool::do_get_payload(
         if (!payload_node->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload_node);
-            lock.unlock();
+            free_payload(payload_node);
             EPROSIMA_LOG_ERROR(RTPS_HISTORY, "Failed to resize the payload");
 
             payload.data = nullptr;
@@ -80,7 +83,6 @@ bool TopicPayloadPool::do_get_payload(
         }
     }
 
-    lock.unlock();
     payload_node->reference();
     payload.data = payload_node->data();
     payload.max_size = payload_node->data_size();
@@ -128,9 +130,7 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(payload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload_node = all_payloads_.at(PayloadNode::data_index(payload.data));
-        free_payloads_.push_back(payload_node);
+        free_payload(PayloadNode::node(payload.data));
     }
 
     payload.length = 0;
@@ -165,6 +165,116 @@ bool TopicPayloadPool::release_history(
     return shrink(max_pool_size_);
 }
 
+size_t TopicPayloadPool::payload_pool_available_size() const
+{
+    size_t available = free_payloads_.size();
+    for (ThreadCache& cache : thread_caches_)
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        available += cache.count;
+    }
+    return available;
+}
+
+TopicPayloadPool::CacheStatistics TopicPayloadPool::cache_statistics() const
+{
+    CacheStatistics statistics;
+    for (ThreadCache& cache : thread_caches_)
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        statistics.hits += cache.hits;
+        statistics.misses += cache.misses;
+    }
+    return statistics;
+}
+
+TopicPayloadPool::ThreadCache& TopicPayloadPool::thread_cache()
+{
+    // The index is shared by all pools, so it does not depend on the lifetime of any of them.
+    static std::atomic<size_t> next_cache_index{0};
+    static thread_local size_t cache_index = next_cache_index.fetch_add(1, std::memory_order_relaxed) %
+            num_thread_caches;
+    return thread_caches_[cache_index];
+}
+
+TopicPayloadPool::PayloadNode* TopicPayloadPool::take_free_payload(
+        uint32_t size,
+        ThreadCache& cache)
+{
+    PayloadNode* payload_node = nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_payloads_.empty())
+    {
+        // Payloads kept by other threads should be reused before allocating new ones
+        flush_thread_caches();
+    }
+
+    if (free_payloads_.empty())
+    {
+        payload_node = allocate(size); //Allocates a single payload
+    }
+    else
+    {
+        payload_node = free_payloads_.back();
+        free_payloads_.pop_back();
+    }
+
+    if (thread_caches_enabled_)
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        ++cache.misses;
+        while (cache.count < thread_cache_capacity / 2 && !free_payloads_.empty())
+        {
+            cache.payloads[cache.count++] = free_payloads_.back();
+            free_payloads_.pop_back();
+        }
+    }
+
+    return payload_node;
+}
+
+void TopicPayloadPool::free_payload(
+        PayloadNode* payload)
+{
+    ThreadCache& cache = thread_cache();
+    if (thread_caches_enabled_)
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        if (cache.count < thread_cache_capacity)
+        {
+            cache.payloads[cache.count++] = payload;
+            ++cache.hits;
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (thread_caches_enabled_)
+    {
+        // Leave half of the cache for the following releases
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        ++cache.misses;
+        while (cache.count > thread_cache_capacity / 2)
+        {
+            free_payloads_.push_back(cache.payloads[--cache.count]);
+        }
+    }
+    free_payloads_.push_back(payload);
+}
+
+void TopicPayloadPool::flush_thread_caches()
+{
+    for (ThreadCache& cache : thread_caches_)
+    {
+        std::lock_guard<std::mutex> cache_lock(cache.mutex);
+        while (0 < cache.count)
+        {
+            free_payloads_.push_back(cache.payloads[--cache.count]);
+        }
+    }
+}
+
 TopicPayloadPool::PayloadNode* TopicPayloadPool::allocate(
         uint32_t size)
 {
@@ -253,6 +363,12 @@ void TopicPayloadPool::reserve (
 bool TopicPayloadPool::shrink (
         uint32_t max_num_payloads)
 {
+    if (max_num_payloads < all_payloads_.size())
+    {
+        // Only payloads on the free list can be deleted
+        flush_thread_caches();
+    }
+
     assert(payload_pool_allocated_size() - payload_pool_available_size() <= max_num_payloads);
 
     while (max_num_payloads < all_payloads_.size())
@@ -26,8 +26,10 @@
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -37,11 +39,29 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+/**
+ * Payload pool shared by the histories of a topic.
+ *
+ * Free payloads are kept on a shared free list and on a number of thread caches. Each thread is assigned one of the
+ * caches, so most get and release operations only lock the cache of the calling thread, and payloads are moved
+ * between the caches and the shared free list in batches.
+ * Payloads kept on the caches are available to all threads: they are moved back to the free list before allocating
+ * new payloads or freeing them.
+ */
 class TopicPayloadPool : public ITopicPayloadPool
 {
 
 public:
 
+    //! Statistics of the thread caches of a pool.
+    struct CacheStatistics
+    {
+        //! Number of get and release operations served by the cache of the calling thread
+        uint64_t hits = 0;
+        //! Number of get and release operations that accessed the shared free list
+        uint64_t misses = 0;
+    };
+
     TopicPayloadPool() = default;
 
     virtual ~TopicPayloadPool()
@@ -122,10 +142,10 @@ public:
         return all_payloads_.size();
     }
 
-    size_t payload_pool_available_size() const override
-    {
-        return free_payloads_.size();
-    }
+    size_t payload_pool_available_size() const override;
+
+    //! Get the accumulated statistics of the thread caches.
+    CacheStatistics cache_statistics() const;
 
     static std::unique_ptr<ITopicPayloadPool> get(
             const BasicPoolConfig& config);
@@ -157,6 +177,7 @@ protected:
 
             // The atomic may need some initialization depending on the platform
             new (buffer) NodeInfo();
+            info().node = this;
             data_size(size);
         }
 
@@ -244,6 +265,12 @@ protected:
             return (info(data).ref_counter.fetch_sub(1, std::memory_order_acq_rel) == 1);
         }
 
+        static PayloadNode* node(
+                octet* data)
+        {
+            return info(data).node;
+        }
+
     private:
 
         struct NodeInfo
@@ -251,6 +278,7 @@ protected:
             std::atomic<uint32_t> ref_counter{ 0 };
             uint32_t data_size = 0;
             uint32_t data_index = 0;
+            PayloadNode* node = nullptr;
             octet data[1];
         };
 
@@ -351,6 +379,49 @@ protected:
 
     virtual MemoryManagementPolicy_t memory_policy() const = 0;
 
+    //! Number of thread caches of each pool. Threads are assigned a cache in a round robin fashion.
+    static constexpr size_t num_thread_caches = 16;
+    //! Maximum number of free payloads kept on a thread cache
+    static constexpr size_t thread_cache_capacity = 16;
+
+    //! Free payloads kept for the threads assigned to it.
+    struct ThreadCache
+    {
+        std::mutex mutex;
+        std::array<PayloadNode*, thread_cache_capacity> payloads;
+        size_t count = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        //! Keeps the caches used by different threads on different cache lines
+        char padding[64];
+    };
+
+    //! Cache assigned to the calling thread.
+    ThreadCache& thread_cache();
+
+    /**
+     * Take a payload from the shared free list, allocating a new one if none is free.
+     * The cache of the calling thread is refilled with a batch of free payloads.
+     *
+     * @param [IN] size   Minimum size required for the payload data, if a new one is allocated
+     * @param [IN] cache  Cache of the calling thread
+     *
+     * @return The node of the payload, or nullptr if the pool is exhausted.
+     */
+    PayloadNode* take_free_payload(
+            uint32_t size,
+            ThreadCache& cache);
+
+    //! Return a payload to the cache of the calling thread, or to the shared free list if the cache is full.
+    void free_payload(
+            PayloadNode* payload);
+
+    //! Move the payloads of all the thread caches to the shared free list. Called with @c mutex_ locked.
+    void flush_thread_caches();
+
+    //! Whether released payloads are kept for reuse on the thread caches. Disabled by pools freeing them instead.
+    bool thread_caches_enabled_ = true;
+
     uint32_t max_pool_size_             = 0;  //< Maximum size of the pool
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
@@ -360,6 +431,8 @@ protected:
 
     std::mutex mutex_;
 
+    mutable std::array<ThreadCache, num_thread_caches> thread_caches_;
+
 };
 
 
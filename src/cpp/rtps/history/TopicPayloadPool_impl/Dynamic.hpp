@@ -29,6 +29,12 @@ class DynamicTopicPayloadPool : public TopicPayloadPool
 {
 public:
 
+    DynamicTopicPayloadPool()
+    {
+        // Released payloads are freed, so there is nothing to keep on the thread caches
+        thread_caches_enabled_ = false;
+    }
+
     bool get_payload(
             uint32_t size,
             SerializedPayload_t& payload) override
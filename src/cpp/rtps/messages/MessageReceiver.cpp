@@ -256,7 +256,8 @@ void MessageReceiver::associateEndpoint(
     if (to_add->getAttributes().endpointKind == WRITER)
     {
         const auto writer = BaseWriter::downcast(to_add);
-        for (const auto& it : associated_writers_)
+        auto& writers = associated_writers_[writer->getGuid().entityId];
+        for (const auto& it : writers)
         {
             if (it == writer)
             {
@@ -264,7 +265,7 @@ void MessageReceiver::associateEndpoint(
             }
         }
 
-        associated_writers_.push_back(writer);
+        writers.push_back(writer);
     }
     else
     {
@@ -290,6 +291,9 @@ void MessageReceiver::associateEndpoint(
 
             readers->second.push_back(reader);
         }
+
+        std::lock_guard<std::mutex> cache_guard(interested_readers_mtx_);
+        interested_readers_.clear();
     }
 }
 
@@ -300,13 +304,21 @@ void MessageReceiver::removeEndpoint(
 
     if (to_remove->getAttributes().endpointKind == WRITER)
     {
-        auto* var = dynamic_cast<BaseWriter*>(to_remove);
-        for (auto it = associated_writers_.begin(); it != associated_writers_.end(); ++it)
+        auto writers = associated_writers_.find(to_remove->getGuid().entityId);
+        if (writers != associated_writers_.end())
         {
-            if (*it == var)
+            auto* var = dynamic_cast<BaseWriter*>(to_remove);
+            for (auto it = writers->second.begin(); it != writers->second.end(); ++it)
             {
-                associated_writers_.erase(it);
-                break;
+                if (*it == var)
+                {
+                    writers->second.erase(it);
+                    if (writers->second.empty())
+                    {
+                        associated_writers_.erase(writers);
+                    }
+                    break;
+                }
             }
         }
     }
@@ -329,6 +341,9 @@ void MessageReceiver::removeEndpoint(
                 }
             }
         }
+
+        std::lock_guard<std::mutex> cache_guard(interested_readers_mtx_);
+        interested_readers_.clear();
     }
 }
 
@@ -730,14 +745,62 @@ void MessageReceiver::findAllReaders(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        // The callbacks are run without locking the cache, as they process the message and notify the user
+        ReaderList readers = interested_readers(source_guid_prefix_);
+        for (const auto& it : *readers)
+        {
+            callback(it);
+        }
+    }
+}
+
+MessageReceiver::ReaderList MessageReceiver::interested_readers(
+        const GuidPrefix_t& source_guid_prefix) const
+{
+    // Read the generation before asking the readers, so a match happening meanwhile invalidates the result
+#if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+    uint64_t generation = participant_->reader_matching_generation();
+#else
+    // There is no participant to track the matching of its readers, so the cache is not kept
+    uint64_t generation = interested_readers_generation_ + 1;
+#endif // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+
+    {
+        std::lock_guard<std::mutex> cache_guard(interested_readers_mtx_);
+        if (generation != interested_readers_generation_)
         {
-            for (const auto& it : readers.second)
+            interested_readers_.clear();
+            interested_readers_generation_ = generation;
+        }
+
+        auto cached = interested_readers_.find(source_guid_prefix);
+        if (cached != interested_readers_.end())
+        {
+            return cached->second;
+        }
+    }
+
+    // Readers lock their own mutex to answer, so they are not asked with the cache locked
+    std::vector<BaseReader*> readers;
+    for (const auto& entity_readers : associated_readers_)
+    {
+        for (const auto& it : entity_readers.second)
+        {
+            if (it->may_accept_messages_from(source_guid_prefix))
             {
-                callback(it);
+                readers.push_back(it);
             }
         }
     }
+    ReaderList result = std::make_shared<const std::vector<BaseReader*>>(std::move(readers));
+
+    std::lock_guard<std::mutex> cache_guard(interested_readers_mtx_);
+    if (generation == interested_readers_generation_)
+    {
+        interested_readers_.emplace(source_guid_prefix, result);
+    }
+
+    return result;
 }
 
 bool MessageReceiver::proc_Submsg_Data(
@@ -1173,25 +1236,29 @@ bool MessageReceiver::proc_Submsg_Acknack(
     }
 
     //Look for the correct writer to use the acknack
-    for (BaseWriter* it : associated_writers_)
+    const auto writers = associated_writers_.find(writerGUID.entityId);
+    if (writers != associated_writers_.end())
     {
+        for (BaseWriter* it : writers->second)
+        {
 #if HAVE_SECURITY
-        if (was_decoded || !it->getAttributes().security_attributes().is_submessage_protected)
+            if (was_decoded || !it->getAttributes().security_attributes().is_submessage_protected)
 #endif  // HAVE_SECURITY
-        {
-            bool result;
-            if (it->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result, source_vendor_id_))
             {
-                if (!result)
+                bool result;
+                if (it->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result, source_vendor_id_))
                 {
-                    EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to NOT stateful writer ");
+                    if (!result)
+                    {
+                        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to NOT stateful writer ");
+                    }
+                    return result;
                 }
-                return result;
             }
         }
     }
-    EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (I looked through "
-            << associated_writers_.size() << " writers in this ListenResource)");
+    EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (not among the "
+            << associated_writers_.size() << " writer entities in this ListenResource)");
     return false;
 }
 
@@ -1373,25 +1440,29 @@ bool MessageReceiver::proc_Submsg_NackFrag(
     }
 
     //Look for the correct writer to use the acknack
-    for (BaseWriter* it : associated_writers_)
+    const auto writers = associated_writers_.find(writerGUID.entityId);
+    if (writers != associated_writers_.end())
     {
+        for (BaseWriter* it : writers->second)
+        {
 #if HAVE_SECURITY
-        if (was_decoded || !it->getAttributes().security_attributes().is_submessage_protected)
+            if (was_decoded || !it->getAttributes().security_attributes().is_submessage_protected)
 #endif  // HAVE_SECURITY
-        {
-            bool result;
-            if (it->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result, source_vendor_id_))
             {
-                if (!result)
+                bool result;
+                if (it->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result, source_vendor_id_))
                 {
-                    EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to NOT stateful writer ");
+                    if (!result)
+                    {
+                        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to NOT stateful writer ");
+                    }
+                    return result;
                 }
-                return result;
             }
         }
     }
-    EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (I looked through "
-            << associated_writers_.size() << " writers in this ListenResource)");
+    EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (not among the "
+            << associated_writers_.size() << " writer entities in this ListenResource)");
     return false;
 }
 
@@ -20,8 +20,13 @@
 #define FASTDDS_RTPS_MESSAGES__MESSAGERECEIVER_H
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <fastdds/rtps/common/CDRMessage_t.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
@@ -93,9 +98,34 @@ public:
 private:
 
     mutable eprosima::shared_mutex mtx_;
-    std::vector<BaseWriter*> associated_writers_;
+    std::unordered_map<EntityId_t, std::vector<BaseWriter*>> associated_writers_;
     std::unordered_map<EntityId_t, std::vector<BaseReader*>> associated_readers_;
 
+    //! Hash of the GUID prefix of a remote participant
+    struct GuidPrefixHash
+    {
+        std::size_t operator ()(
+                const GuidPrefix_t& prefix) const
+        {
+            // The first octets only identify the vendor and the host, so they are left out of the hash
+            uint32_t process_bits;
+            uint32_t instance_bits;
+            memcpy(&process_bits, &prefix.value[4], sizeof(process_bits));
+            memcpy(&instance_bits, &prefix.value[8], sizeof(instance_bits));
+            return (static_cast<std::size_t>(process_bits) << 16) ^ static_cast<std::size_t>(instance_bits);
+        }
+
+    };
+
+    using ReaderList = std::shared_ptr<const std::vector<BaseReader*>>;
+
+    //! Protects the cache of readers interested in messages from each remote participant
+    mutable std::mutex interested_readers_mtx_;
+    //! Matching generation the cache of interested readers was filled on
+    mutable uint64_t interested_readers_generation_ = 0;
+    //! Readers that may accept messages not directed to a specific reader, by GUID prefix of the sender
+    mutable std::unordered_map<GuidPrefix_t, ReaderList, GuidPrefixHash> interested_readers_;
+
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
     //!Pointer to the RTPSParticipantImpl
     RTPSParticipantImpl* participant_;
@@ -167,12 +197,26 @@ private:
     /**
      * Find all readers (in associated_readers_), with the given entity ID, and call the
      * callback provided.
+     * When the entity ID is unknown, only the readers that may accept messages from the
+     * participant that sent the message are called.
      */
     template<typename Functor>
     void findAllReaders(
             const EntityId_t& readerID,
             const Functor& callback) const;
 
+    /**
+     * Get the readers that may accept messages from a remote participant, refreshing the cache
+     * when the matching generation of the participant's readers has changed.
+     * Should be called with mtx_ locked, and without interested_readers_mtx_ locked, as the readers are asked
+     * while building the list.
+     * @param source_guid_prefix GUID prefix of the remote participant.
+     * @return Readers that may accept messages from the remote participant. The list is not modified when the cache
+     * is refreshed, so it can be used without locking.
+     */
+    ReaderList interested_readers(
+            const GuidPrefix_t& source_guid_prefix) const;
+
     /**@name Processing methods.
      * These methods are designed to read a part of the message
      * and perform the corresponding actions:
@@ -20,6 +20,7 @@
 #include "RTPSMessageGroup.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/messages/RTPSMessageCreator.hpp>
@@ -260,6 +261,7 @@ RTPSMessageGroup::RTPSMessageGroup(
     , max_blocking_time_point_(max_blocking_time_point)
     , send_buffer_(!internal_buffer ? participant->get_send_buffer(max_blocking_time_point) : nullptr)
     , internal_buffer_(internal_buffer)
+    , segments_enabled_(!internal_buffer && participant->segmentation_offload())
 {
     // Avoid warning when neither SECURITY nor DEBUG is used
     (void)participant;
@@ -352,26 +354,30 @@ void RTPSMessageGroup::reset_to_header()
     payloads_to_send_->clear();
 }
 
-void RTPSMessageGroup::flush()
+void RTPSMessageGroup::flush(
+        bool more_messages_follow)
 {
-    send();
+    send(more_messages_follow);
 
     reset_to_header();
 }
 
-void RTPSMessageGroup::send()
+void RTPSMessageGroup::send(
+        bool more_messages_follow)
 {
     if (endpoint_ && sender_)
     {
         if (header_msg_->length > RTPSMESSAGE_HEADER_SIZE)
         {
             std::lock_guard<RTPSMessageSenderInterface> lock(*sender_);
+            bool is_segment = segments_enabled_;
 
 #if HAVE_SECURITY
             CDRMessage_t* msgToSend = header_msg_;
             // TODO(Ricardo) Control message size if it will be encrypted.
             if (participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection())
             {
+                is_segment = false;
                 CDRMessage::initCDRMsg(encrypt_msg_);
                 header_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
                 encrypt_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
@@ -400,6 +406,15 @@ void RTPSMessageGroup::send()
             }
 #endif // FASTDDS_STATISTICS
 
+            if (is_segment)
+            {
+                add_segment(more_messages_follow);
+                return;
+            }
+
+            // Keep the order of the messages
+            send_segments();
+
             if (!sender_->send(*buffers_to_send_,
                     buffers_bytes_,
                     max_blocking_time_point_))
@@ -408,6 +423,101 @@ void RTPSMessageGroup::send()
             }
             current_sent_bytes_ += buffers_bytes_;
         }
+        else if (0 < segments_count_)
+        {
+            std::lock_guard<RTPSMessageSenderInterface> lock(*sender_);
+            send_segments();
+        }
+    }
+}
+
+void RTPSMessageGroup::add_segment(
+        bool more_messages_follow)
+{
+    // A bigger message, or one not fitting on the train, ends the pending train
+    if (0 < segments_count_ &&
+            (buffers_bytes_ > segment_size_ || max_train_segments_ == segments_count_ ||
+            max_train_size_ < segments_bytes_ + buffers_bytes_))
+    {
+        send_segments();
+    }
+
+    // A train needs at least two messages
+    if ((0 == segments_count_ && !more_messages_follow) || (max_train_size_ / 2) < buffers_bytes_)
+    {
+        if (!sender_->send(*buffers_to_send_,
+                buffers_bytes_,
+                max_blocking_time_point_))
+        {
+            throw timeout();
+        }
+        current_sent_bytes_ += buffers_bytes_;
+        return;
+    }
+
+    std::vector<octet>& data = send_buffer_->segments_data_;
+    std::vector<NetworkBuffer>& segments_buffers = send_buffer_->segments_buffers_;
+    if (data.empty())
+    {
+        // Allocated once, so the buffers pointing to it are never invalidated
+        data.resize(max_train_size_);
+        segments_buffers.reserve(2 * max_train_segments_);
+    }
+
+    // The message is copied as a single buffer, except its last one, which may be the statistics submessage the
+    // transport fills for each datagram
+    octet* segment = &data[segments_bytes_];
+    uint32_t segment_bytes = 0;
+    size_t last_buffer = buffers_to_send_->size() - 1;
+    for (size_t i = 0; i < last_buffer; ++i)
+    {
+        const NetworkBuffer& buffer = buffers_to_send_->at(i);
+        std::memcpy(segment + segment_bytes, buffer.buffer, buffer.size);
+        segment_bytes += static_cast<uint32_t>(buffer.size);
+    }
+    if (0 < segment_bytes)
+    {
+        segments_buffers.emplace_back(segment, segment_bytes);
+    }
+    const NetworkBuffer& buffer = buffers_to_send_->at(last_buffer);
+    std::memcpy(segment + segment_bytes, buffer.buffer, buffer.size);
+    segments_buffers.emplace_back(segment + segment_bytes, buffer.size);
+
+    if (0 == segments_count_)
+    {
+        segment_size_ = buffers_bytes_;
+    }
+    ++segments_count_;
+    segments_bytes_ += buffers_bytes_;
+    current_sent_bytes_ += buffers_bytes_;
+
+    // Only the last message of a train may be smaller
+    if (buffers_bytes_ < segment_size_ || !more_messages_follow)
+    {
+        send_segments();
+    }
+}
+
+void RTPSMessageGroup::send_segments()
+{
+    if (0 == segments_count_)
+    {
+        return;
+    }
+
+    std::vector<NetworkBuffer>& segments_buffers = send_buffer_->segments_buffers_;
+    bool ret = (1 == segments_count_) ?
+            sender_->send(segments_buffers, segments_bytes_, max_blocking_time_point_) :
+            sender_->send_segments(segments_buffers, segments_bytes_, segment_size_, max_blocking_time_point_);
+
+    segments_buffers.clear();
+    segments_count_ = 0;
+    segments_bytes_ = 0;
+    segment_size_ = 0;
+
+    if (!ret)
+    {
+        throw timeout();
     }
 }
 
@@ -455,7 +565,7 @@ bool RTPSMessageGroup::insert_submessage(
     uint32_t total_size = submessage_msg_->length + pending_buffer_.size + buffers_bytes_ + pending_padding_;
     if (!check_space(header_msg_, total_size))
     {
-        flush();
+        flush(true);
         add_info_dst_in_buffer(header_msg_, destination_guid_prefix);
     }
 
@@ -238,6 +238,12 @@ public:
         sent_bytes_limitation_ = limit;
     }
 
+    //! Whether a limitation on the sent bytes has been set with @c set_sent_bytes_limitation.
+    inline bool has_sent_bytes_limitation() const
+    {
+        return 0 < sent_bytes_limitation_;
+    }
+
     void reset_current_bytes_processed()
     {
         current_sent_bytes_ = 0;
@@ -253,11 +259,37 @@ private:
     static constexpr uint32_t data_frag_header_size_ = 28;
     static constexpr uint32_t max_inline_qos_size_ = 32;
 
+    //! Maximum number of messages on a train sent with segmentation offload
+    static constexpr uint32_t max_train_segments_ = 64;
+    //! Maximum size of a train sent with segmentation offload, leaving room for the IP and UDP headers
+    static constexpr uint32_t max_train_size_ = 65000;
+
     void reset_to_header();
 
-    void flush();
+    /**
+     * Sends the current message and resets it to the header.
+     * @param more_messages_follow true when the message is sent because the next submessage did not fit in it.
+     */
+    void flush(
+            bool more_messages_follow = false);
+
+    /**
+     * Sends the current message.
+     * @param more_messages_follow true when the message is sent because the next submessage did not fit in it.
+     */
+    void send(
+            bool more_messages_follow = false);
+
+    /**
+     * Adds the current message to the train of messages of the same size, sending the train when the message ends
+     * it. A message not followed by others is sent on its own.
+     * @param more_messages_follow true when the message is sent because the next submessage did not fit in it.
+     */
+    void add_segment(
+            bool more_messages_follow);
 
-    void send();
+    //! Sends the pending train of messages of the same size, if any.
+    void send_segments();
 
     void check_and_maybe_flush()
     {
@@ -371,6 +403,18 @@ private:
 
     // Fixed padding to be used whenever needed
     const octet padding_[3] = {0, 0, 0};
+
+    // Whether consecutive messages of the same size are sent as a single train
+    bool segments_enabled_ = false;
+
+    // Number of messages on the pending train
+    uint32_t segments_count_ = 0;
+
+    // Bytes of the pending train
+    uint32_t segments_bytes_ = 0;
+
+    // Size of each message on the pending train, except the last one
+    uint32_t segment_size_ = 0;
 };
 
 } // namespace rtps
@@ -21,6 +21,8 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <vector>
+
 #include <fastdds/rtps/common/CDRMessage_t.hpp>
 #include <rtps/messages/CDRMessage.hpp>
 #include <rtps/messages/RTPSMessageCreator.hpp>
@@ -117,6 +119,13 @@ public:
 
     //! Mirror vector of buffers_ to store the serialized payloads.
     eprosima::fastdds::ResourceLimitedVector<eprosima::fastdds::rtps::SerializedPayload_t> payloads_;
+
+    //! Copy of the consecutive messages of the same size waiting to be sent as a single train.
+    //! Only allocated when the participant uses segmentation offload.
+    std::vector<octet> segments_data_;
+
+    //! Buffers pointing to segments_data_, where each message ends at the end of a buffer.
+    std::vector<eprosima::fastdds::rtps::NetworkBuffer> segments_buffers_;
 };
 
 } // namespace rtps
@@ -573,6 +573,17 @@ std::vector<TransportNetmaskFilterInfo> NetworkFactory::netmask_filter_info() co
     return ret;
 }
 
+std::vector<SendQueueStatistics> NetworkFactory::send_queue_statistics() const
+{
+    std::vector<SendQueueStatistics> ret;
+    for (auto& transport : mRegisteredTransports)
+    {
+        std::vector<SendQueueStatistics> transport_statistics = transport->send_queue_statistics();
+        ret.insert(ret.end(), transport_statistics.begin(), transport_statistics.end());
+    }
+    return ret;
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
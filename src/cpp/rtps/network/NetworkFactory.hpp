@@ -332,6 +332,11 @@ public:
      */
     std::vector<fastdds::rtps::TransportNetmaskFilterInfo> netmask_filter_info() const;
 
+    /**
+     * Returns the statistics of the send queues of the connections of all the registered transports.
+     */
+    std::vector<fastdds::rtps::SendQueueStatistics> send_queue_statistics() const;
+
     /**
      * Calculate well-known ports.
      */
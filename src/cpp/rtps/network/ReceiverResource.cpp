@@ -14,6 +14,7 @@
 
 #include <rtps/network/ReceiverResource.h>
 
+#include <algorithm>
 #include <cassert>
 #include <thread>
 
@@ -38,8 +39,8 @@ ReceiverResource::ReceiverResource(
     , mValid(false)
     , mtx()
     , cv_()
-    , receiver(nullptr)
     , max_message_size_(max_recv_buffer_size)
+    , max_concurrent_receptions_(1)
     , active_callbacks_(0)
 {
     // Internal channel is opened and assigned to this resource.
@@ -48,6 +49,7 @@ ReceiverResource::ReceiverResource(
     {
         return; // Invalid resource to be discarded by the factory.
     }
+    max_concurrent_receptions_ = (std::max)(transport.max_concurrent_receptions(locator), 1u);
 
     // Implementation functions are bound to the right transport parameters
     Cleanup = [&transport, locator]()
@@ -67,11 +69,12 @@ ReceiverResource::ReceiverResource(
 
     Cleanup.swap(rValueResource.Cleanup);
     LocatorMapsToManagedChannel.swap(rValueResource.LocatorMapsToManagedChannel);
-    receiver = rValueResource.receiver;
-    rValueResource.receiver = nullptr;
+    receivers_.swap(rValueResource.receivers_);
+    idle_receivers_.swap(rValueResource.idle_receivers_);
     mValid = rValueResource.mValid;
     rValueResource.mValid = false;
     max_message_size_ = rValueResource.max_message_size_;
+    max_concurrent_receptions_ = rValueResource.max_concurrent_receptions_;
     active_callbacks_ = rValueResource.active_callbacks_;
     rValueResource.active_callbacks_ = 0;
 }
@@ -89,23 +92,77 @@ bool ReceiverResource::SupportsLocator(
 void ReceiverResource::RegisterReceiver(
         MessageReceiver* rcv)
 {
-    std::lock_guard<std::mutex> _(mtx);
-
-    if (receiver == nullptr)
     {
-        receiver = rcv;
+        std::lock_guard<std::mutex> _(mtx);
+
+        if (receivers_.end() != std::find(receivers_.begin(), receivers_.end(), rcv))
+        {
+            return;
+        }
+
+        receivers_.push_back(rcv);
+        idle_receivers_.push_back(rcv);
     }
+    cv_.notify_all();
 }
 
 void ReceiverResource::UnregisterReceiver(
         MessageReceiver* rcv)
 {
-    std::lock_guard<std::mutex> _(mtx);
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+
+        auto it = std::find(receivers_.begin(), receivers_.end(), rcv);
+        if (receivers_.end() == it)
+        {
+            return;
+        }
+        receivers_.erase(it);
+
+        // Wait for the receiver to finish processing the message it may be processing
+        auto idle_it = idle_receivers_.end();
+        cv_.wait(lock, [&]()
+                {
+                    idle_it = std::find(idle_receivers_.begin(), idle_receivers_.end(), rcv);
+                    return idle_receivers_.end() != idle_it;
+                });
+        idle_receivers_.erase(idle_it);
+    }
+    cv_.notify_all();
+}
+
+MessageReceiver* ReceiverResource::acquire_receiver()
+{
+    std::unique_lock<std::mutex> lock(mtx);
 
-    if (receiver == rcv)
+    // All the registered receivers may be busy with the messages of other reception threads
+    cv_.wait(lock, [this]()
+            {
+                return active_callbacks_ < 0 || receivers_.empty() || !idle_receivers_.empty();
+            });
+
+    if (active_callbacks_ < 0 || idle_receivers_.empty())
     {
-        receiver = nullptr;
+        return nullptr;
     }
+
+    ++active_callbacks_;
+    MessageReceiver* rcv = idle_receivers_.back();
+    idle_receivers_.pop_back();
+    return rcv;
+}
+
+void ReceiverResource::release_receiver(
+        MessageReceiver* rcv)
+{
+    {
+        std::lock_guard<std::mutex> _(mtx);
+        idle_receivers_.push_back(rcv);
+        --active_callbacks_;
+    }
+
+    // Wake up reception threads waiting for a receiver, and disabling or unregistering waiting for this one
+    cv_.notify_all();
 }
 
 void ReceiverResource::OnDataReceived(
@@ -114,16 +171,10 @@ void ReceiverResource::OnDataReceived(
         const Locator_t& localLocator,
         const Locator_t& remoteLocator)
 {
-    (void)localLocator;
-
-    std::lock_guard<std::mutex> _(mtx);
-
-    MessageReceiver* rcv = receiver;
+    MessageReceiver* rcv = acquire_receiver();
 
-    if (rcv != nullptr && active_callbacks_ >= 0)
+    if (rcv != nullptr)
     {
-        ++active_callbacks_;
-
         CDRMessage_t msg(0);
         msg.wraps = true;
         msg.buffer = const_cast<octet*>(data);
@@ -131,22 +182,45 @@ void ReceiverResource::OnDataReceived(
         msg.max_size = size;
         msg.reserved_size = size;
 
-        // TODO: Should we unlock in case UnregisterReceiver is called from callback ?
         rcv->processCDRMsg(remoteLocator, localLocator, &msg);
 
-        // allow disabling
-        if (--active_callbacks_ == 0)
+        release_receiver(rcv);
+    }
+}
+
+void ReceiverResource::OnDataBatchReceived(
+        const ReceivedDatagram* datagrams,
+        const uint32_t count,
+        const Locator_t& localLocator)
+{
+    MessageReceiver* rcv = acquire_receiver();
+
+    if (rcv != nullptr)
+    {
+        for (uint32_t i = 0; i < count; ++i)
         {
-            cv_.notify_one();
+            const ReceivedDatagram& datagram = datagrams[i];
+            CDRMessage_t msg(0);
+            msg.wraps = true;
+            msg.buffer = const_cast<octet*>(datagram.data);
+            msg.length = datagram.size;
+            msg.max_size = datagram.size;
+            msg.reserved_size = datagram.size;
+
+            rcv->processCDRMsg(datagram.remote_locator, localLocator, &msg);
         }
+
+        release_receiver(rcv);
     }
 }
 
 void ReceiverResource::disable()
 {
+    // The resource may be shared by several receiver control blocks, close the channel only once
     if (Cleanup)
     {
         Cleanup();
+        Cleanup = nullptr;
     }
 
     // wait until all callbacks are finished
@@ -57,6 +57,18 @@ public:
             const Locator_t& localLocator,
             const Locator_t& remoteLocator) override;
 
+    /**
+     * Method called by the transport when receiving several datagrams at once.
+     * All the datagrams are processed while holding the resource lock only once.
+     * @param datagrams Pointer to the first received datagram.
+     * @param count Number of datagrams received.
+     * @param localLocator Locator identifying the local endpoint.
+     */
+    virtual void OnDataBatchReceived(
+            const ReceivedDatagram* datagrams,
+            const uint32_t count,
+            const Locator_t& localLocator) override;
+
     /**
      * Reports whether this resource supports the given local locator (i.e., said locator
      * maps to the transport channel managed by this resource).
@@ -66,6 +78,9 @@ public:
 
     /**
      * Register a MessageReceiver object to be called upon reception of data.
+     * Several message receivers can be registered. Each received message is processed by one of the receivers not
+     * busy with another message, so the messages delivered by different reception threads of the channel are
+     * processed in parallel.
      * @param receiver The message receiver to register.
      */
     void RegisterReceiver(
@@ -73,6 +88,7 @@ public:
 
     /**
      * Unregister a MessageReceiver object to be called upon reception of data.
+     * Waits for the receiver to finish processing the message it may be processing.
      * @param receiver The message receiver to unregister.
      */
     void UnregisterReceiver(
@@ -88,6 +104,15 @@ public:
         return max_message_size_;
     }
 
+    /**
+     * Number of threads that may deliver data concurrently on the channel managed by this resource, and hence the
+     * number of message receivers worth registering on it.
+     */
+    inline uint32_t max_concurrent_receptions() const
+    {
+        return max_concurrent_receptions_;
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -109,14 +134,29 @@ private:
             fastdds::rtps::TransportInterface&,
             const Locator_t&,
             uint32_t);
+
+    /**
+     * Takes a registered receiver not busy with another message, waiting for one if all of them are busy.
+     * @return The receiver to process a message with, or nullptr if there is none or the resource is disabled.
+     */
+    MessageReceiver* acquire_receiver();
+
+    //! Gives back a receiver taken with acquire_receiver.
+    void release_receiver(
+            MessageReceiver* rcv);
+
     std::function<void()> Cleanup;
     std::function<bool(const Locator_t&)> LocatorMapsToManagedChannel;
     bool mValid; // Post-construction validity check for the NetworkFactory
 
     std::mutex mtx;
     std::condition_variable cv_;
-    MessageReceiver* receiver;
+    //! Registered receivers
+    std::vector<MessageReceiver*> receivers_;
+    //! Registered receivers not processing a message
+    std::vector<MessageReceiver*> idle_receivers_;
     uint32_t max_message_size_;
+    uint32_t max_concurrent_receptions_;
     int active_callbacks_;
 };
 
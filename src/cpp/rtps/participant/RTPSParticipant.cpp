@@ -211,6 +211,11 @@ std::vector<TransportNetmaskFilterInfo> RTPSParticipant::get_netmask_filter_info
     return mp_impl->get_netmask_filter_info();
 }
 
+std::vector<SendQueueStatistics> RTPSParticipant::get_send_queue_statistics() const
+{
+    return mp_impl->get_send_queue_statistics();
+}
+
 bool RTPSParticipant::get_publication_info(
         PublicationBuiltinTopicData& data,
         const GUID_t& writer_guid) const
@@ -525,6 +525,11 @@ bool RTPSParticipantImpl::setup_transports()
         {
             has_shm_transport_ |=
                     (nullptr != dynamic_cast<SharedMemTransportDescriptor*>(transportDescriptor.get()));
+#if defined(__linux__)
+            // Segmentation offload is only available on Linux
+            auto udp_descriptor = dynamic_cast<UDPTransportDescriptor*>(transportDescriptor.get());
+            segmentation_offload_ |= (nullptr != udp_descriptor && udp_descriptor->generic_segmentation_offload);
+#endif // if defined(__linux__)
         }
         else
         {
@@ -577,7 +582,24 @@ void RTPSParticipantImpl::setup_timed_events()
 {
     uint32_t id_for_thread = static_cast<uint32_t>(m_att.participantID);
     const ThreadSettings& thr_config = m_att.timed_events_thread;
-    mp_event_thr.init_thread(thr_config, "dds.ev.%u", id_for_thread);
+
+    bool use_timer_wheel = false;
+    const std::string* wheel_property =
+            PropertyPolicyHelper::find_property(m_att.properties, "fastdds.timed_events_wheel");
+    if (nullptr != wheel_property)
+    {
+        if (*wheel_property == "true")
+        {
+            use_timer_wheel = true;
+        }
+        else if (*wheel_property != "false")
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                    "Wrong value '" << *wheel_property << "' for property fastdds.timed_events_wheel");
+        }
+    }
+
+    mp_event_thr.init_thread(thr_config, "dds.ev.%u", id_for_thread, use_timer_wheel);
 }
 
 void RTPSParticipantImpl::setup_meta_traffic()
@@ -747,6 +769,10 @@ void RTPSParticipantImpl::setup_output_traffic()
             m_att.allocation.send_buffers.network_buffers_config));
     send_buffers_->init(this);
 
+    // Create the threads used by writers to send to their matched readers in parallel
+    writer_send_pool_.init_threads(m_att.writer_send_threads_number, m_att.writer_send_threads, "dds.wsend.%u.%u",
+            static_cast<uint32_t>(m_att.participantID));
+
     // Initialize flow controller factory.
     // This must be done after initiate network layer.
     flow_controller_factory_.init(this);
@@ -804,6 +830,8 @@ void RTPSParticipantImpl::disable()
         delete(mp_builtinProtocols);
         mp_builtinProtocols = nullptr;
     }
+
+    writer_send_pool_.stop_threads();
 }
 
 RTPSParticipantImpl::~RTPSParticipantImpl()
@@ -2023,15 +2051,19 @@ bool RTPSParticipantImpl::createReceiverResources(
         for (auto it_buffer = newItemsBuffer.begin(); it_buffer != newItemsBuffer.end(); ++it_buffer)
         {
             std::lock_guard<std::mutex> lock(m_receiverResourcelistMutex);
-            //Push the new items into the ReceiverResource buffer
-            m_receiverResourcelist.emplace_back(*it_buffer);
-            //Create and init the MessageReceiver
-            auto mr = new MessageReceiver(this, (*it_buffer)->max_message_size());
-            m_receiverResourcelist.back().mp_receiver = mr;
-            //Start reception
-            if (RegisterReceiver)
+            // One MessageReceiver for each thread that may receive concurrently on the resource
+            for (uint32_t i = 0; i < (*it_buffer)->max_concurrent_receptions(); ++i)
             {
-                m_receiverResourcelist.back().Receiver->RegisterReceiver(mr);
+                //Push the new items into the ReceiverResource buffer
+                m_receiverResourcelist.emplace_back(*it_buffer);
+                //Create and init the MessageReceiver
+                auto mr = new MessageReceiver(this, (*it_buffer)->max_message_size());
+                m_receiverResourcelist.back().mp_receiver = mr;
+                //Start reception
+                if (RegisterReceiver)
+                {
+                    m_receiverResourcelist.back().Receiver->RegisterReceiver(mr);
+                }
             }
         }
         newItemsBuffer.clear();
@@ -2967,6 +2999,11 @@ std::vector<TransportNetmaskFilterInfo> RTPSParticipantImpl::get_netmask_filter_
     return m_network_Factory.netmask_filter_info();
 }
 
+std::vector<SendQueueStatistics> RTPSParticipantImpl::get_send_queue_statistics() const
+{
+    return m_network_Factory.send_queue_statistics();
+}
+
 bool RTPSParticipantImpl::get_publication_info(
         PublicationBuiltinTopicData& data,
         const GUID_t& writer_guid) const
@@ -20,7 +20,9 @@
 #define FASTDDS_RTPS_PARTICIPANT__RTPSPARTICIPANTIMPL_H
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <algorithm>
 #include <atomic>
+#include <cassert>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
@@ -64,6 +66,7 @@
 #include <statistics/rtps/StatisticsBase.hpp>
 #include <statistics/types/monitorservice_types.hpp>
 #include <utils/shared_mutex.hpp>
+#include <utils/WorkerPool.hpp>
 
 #if HAVE_SECURITY
 #include <fastdds/rtps/Endpoint.hpp>
@@ -154,6 +157,8 @@ class RTPSParticipantImpl
        It contains:
        -A ReceiverResource (as produced by the NetworkFactory Element)
        -Its associated MessageReceiver
+       A ReceiverResource that may receive on several threads concurrently is shared by several blocks, one for each
+       of its MessageReceivers.
      */
     typedef struct ReceiverControlBlock
     {
@@ -288,6 +293,29 @@ public:
         return mp_event_thr;
     }
 
+    //! Get the pool of threads used by writers to send to their matched readers in parallel.
+    WorkerPool& get_writer_send_pool()
+    {
+        return writer_send_pool_;
+    }
+
+    /**
+     * @brief Get the matching generation of the readers of this participant.
+     * It changes every time any of them matches or unmatches a writer.
+     *
+     * @return The current matching generation.
+     */
+    uint64_t reader_matching_generation() const
+    {
+        return reader_matching_generation_.load(std::memory_order_acquire);
+    }
+
+    //! Notify that the set of writers matched with a reader of this participant has changed.
+    void notify_reader_matching_changed()
+    {
+        reader_matching_generation_.fetch_add(1, std::memory_order_release);
+    }
+
     /**
      * Send a message to several locations
      * @param buffers Vector of buffers to send.
@@ -344,6 +372,95 @@ public:
         return ret_code;
     }
 
+    /**
+     * Send a train of messages of the same size.
+     * Transports supporting segmentation offload send the whole train in a single operation, while the rest send
+     * each message on its own.
+     * @param buffers Buffers of all the messages. Each message ends at the end of a buffer.
+     * @param total_bytes Size of all the messages.
+     * @param segment_size Size of each message, except the last one, which may be smaller.
+     * @param sender_guid GUID of the entity sending the messages.
+     * @param destination_locators_begin Start of the destination locators.
+     * @param destination_locators_end End of the destination locators.
+     * @param max_blocking_time_point Maximum time point the send operation may block.
+     * @return true if the send operation was attempted on every transport.
+     */
+    template<class LocatorIteratorT>
+    bool sendSync(
+            const std::vector<NetworkBuffer>& buffers,
+            const uint32_t& total_bytes,
+            uint32_t segment_size,
+            const GUID_t& sender_guid,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        assert(0 < segment_size);
+
+        bool ret_code = false;
+#if HAVE_STRICT_REALTIME
+        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
+        if (lock.try_lock_until(max_blocking_time_point))
+#else
+        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_);
+#endif // if HAVE_STRICT_REALTIME
+        {
+            ret_code = true;
+
+            for (auto& send_resource : send_resource_list_)
+            {
+                if (send_resource->supports_segments())
+                {
+                    LocatorIteratorT locators_begin = destination_locators_begin;
+                    LocatorIteratorT locators_end = destination_locators_end;
+                    send_resource->send_segments(buffers, total_bytes, segment_size, &locators_begin,
+                            &locators_end, max_blocking_time_point);
+                }
+                else
+                {
+                    for_each_segment(buffers, segment_size,
+                            [&](const std::vector<NetworkBuffer>& segment, uint32_t segment_bytes)
+                            {
+                                LocatorIteratorT locators_begin = destination_locators_begin;
+                                LocatorIteratorT locators_end = destination_locators_end;
+                                send_resource->send(segment, segment_bytes, &locators_begin, &locators_end,
+                                max_blocking_time_point);
+                                return true;
+                            });
+                }
+            }
+
+            lock.unlock();
+
+            for (uint32_t sent_bytes = 0; sent_bytes < total_bytes; sent_bytes += segment_size)
+            {
+                // notify statistics module
+                on_rtps_send(
+                    sender_guid,
+                    destination_locators_begin,
+                    destination_locators_end,
+                    std::min(segment_size, total_bytes - sent_bytes));
+
+                // checkout if sender is a discovery endpoint
+                on_discovery_packet(
+                    sender_guid,
+                    destination_locators_begin,
+                    destination_locators_end);
+            }
+        }
+
+        return ret_code;
+    }
+
+    /**
+     * Whether a transport of this participant sends trains of messages of the same size in a single operation.
+     * @return true when a transport has segmentation offload enabled.
+     */
+    bool segmentation_offload() const
+    {
+        return segmentation_offload_;
+    }
+
     /**
      * Get the participant listener
      * @return participant listener
@@ -563,6 +680,10 @@ private:
     GUID_t m_persistence_guid;
     //! Event Resource
     ResourceEvent mp_event_thr;
+    //! Threads used by writers to send to their matched readers in parallel
+    WorkerPool writer_send_pool_;
+    //! Changes every time a reader of this participant matches or unmatches a writer
+    std::atomic<uint64_t> reader_matching_generation_{0};
     //! BuiltinProtocols of this RTPSParticipant
     BuiltinProtocols* mp_builtinProtocols;
     //!Id counter to correctly assign the ids to writers and readers.
@@ -611,6 +732,8 @@ private:
     //!SenderResource List
     std::timed_mutex m_send_resources_mutex_;
     SendResourceList send_resource_list_;
+    //! Whether a transport sends trains of messages in a single operation
+    bool segmentation_offload_ = false;
 
     //!Participant Listener
     RTPSParticipantListener* mp_participantListener;
@@ -1167,6 +1290,13 @@ public:
      */
     std::vector<TransportNetmaskFilterInfo> get_netmask_filter_info() const;
 
+    /**
+     * @brief Returns the statistics of the send queues of the connections of the registered transports.
+     *
+     * @return A vector with the send queue statistics of each connection.
+     */
+    std::vector<SendQueueStatistics> get_send_queue_statistics() const;
+
     /**
      * @brief Fills the provided @ref PublicationBuiltinTopicData with the information of the
      * writer identified by writer_guid.
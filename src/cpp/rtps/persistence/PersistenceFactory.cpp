@@ -23,9 +23,13 @@
 #include <rtps/persistence/SQLite3PersistenceService.h>
 #endif // if HAVE_SQLITE3
 
+#include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/attributes/PropertyPolicy.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
+#include <limits>
+#include <string>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -43,6 +47,37 @@ void IPersistenceService::set_fragments(
     history->set_fragments(change);
 }
 
+#if HAVE_SQLITE3
+static void parse_positive_property(
+        const PropertyPolicy& property_policy,
+        const char* property_name,
+        uint32_t& value)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(property_policy, property_name);
+    if (property != nullptr)
+    {
+        try
+        {
+            unsigned long parsed = std::stoul(*property);
+            if (0 < parsed && parsed <= std::numeric_limits<uint32_t>::max())
+            {
+                value = static_cast<uint32_t>(parsed);
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Invalid value " << *property << " for property " << property_name
+                                                                      << ". Using default " << value);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Error parsing " << property_name << " property: " << e.what());
+        }
+    }
+}
+
+#endif // if HAVE_SQLITE3
+
 IPersistenceService* PersistenceFactory::create_persistence_service(
         const PropertyPolicy& property_policy)
 {
@@ -72,7 +107,24 @@ IPersistenceService* PersistenceFactory::create_persistence_service(
             {
                 update_schema = true;
             }
-            ret_val = create_SQLite3_persistence_service(filename, update_schema);
+
+            SQLite3WriteBehindSettings write_behind;
+            const std::string* write_behind_value = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.sqlite3.write_behind");
+            if (write_behind_value != nullptr &&
+                    ((write_behind_value->compare("TRUE") == 0) ||
+                    (write_behind_value->compare("true") == 0)))
+            {
+                write_behind.enabled = true;
+            }
+            parse_positive_property(property_policy, "dds.persistence.sqlite3.flush_interval_ms",
+                    write_behind.flush_interval_ms);
+            parse_positive_property(property_policy, "dds.persistence.sqlite3.max_batch_size",
+                    write_behind.max_batch_size);
+            parse_positive_property(property_policy, "dds.persistence.sqlite3.max_pending_bytes",
+                    write_behind.max_pending_bytes);
+
+            ret_val = create_SQLite3_persistence_service(filename, update_schema, write_behind);
         }
 #endif // if HAVE_SQLITE3
     }
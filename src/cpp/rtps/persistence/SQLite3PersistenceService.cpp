@@ -20,10 +20,14 @@
 #include <rtps/persistence/SQLite3PersistenceService.h>
 #include <rtps/persistence/SQLite3PersistenceServiceStatements.h>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
 #include <rtps/persistence/sqlite3.h>
+#include <utils/threading.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <sstream>
 
 namespace eprosima {
@@ -183,15 +187,18 @@ static void finalize_statement(
 
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema)
+        bool update_schema,
+        const SQLite3WriteBehindSettings& write_behind)
 {
     sqlite3* db = open_or_create_database(filename, update_schema);
-    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db);
+    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db, write_behind);
 }
 
 SQLite3PersistenceService::SQLite3PersistenceService(
-        sqlite3* db)
+        sqlite3* db,
+        const SQLite3WriteBehindSettings& write_behind)
     : db_(db)
+    , write_behind_(write_behind)
     , load_writer_stmt_(NULL)
     , add_writer_change_stmt_(NULL)
     , remove_writer_change_stmt_(NULL)
@@ -221,10 +228,33 @@ SQLite3PersistenceService::SQLite3PersistenceService(
             SQLITE_PREPARE_PERSISTENT, &load_reader_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT OR REPLACE INTO readers VALUES(?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT,
             &update_reader_stmt_, NULL);
+
+    if (write_behind_.enabled)
+    {
+        static std::atomic<uint32_t> next_thread_id{0};
+        write_behind_thread_ = create_thread([this]()
+                        {
+                            write_behind_run();
+                        }, ThreadSettings{}, "dds.sqlite.%u", next_thread_id++);
+    }
 }
 
 SQLite3PersistenceService::~SQLite3PersistenceService()
 {
+    if (write_behind_.enabled)
+    {
+        {
+            std::lock_guard<std::mutex> guard(pending_mutex_);
+            stop_write_behind_ = true;
+        }
+        pending_cv_.notify_one();
+        write_behind_thread_.join();
+
+        // Write what was queued after the last batch
+        std::lock_guard<std::mutex> guard(db_mutex_);
+        flush_pending_nts();
+    }
+
     // Finalize writer statements
     finalize_statement(load_writer_stmt_);
     finalize_statement(add_writer_change_stmt_);
@@ -264,6 +294,9 @@ bool SQLite3PersistenceService::load_writer_from_storage(
 {
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
 
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    flush_pending_nts();
+
     if (load_writer_stmt_ != NULL)
     {
         sqlite3_reset(load_writer_stmt_);
@@ -344,44 +377,83 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
 
+    // related sample identity
+    std::ostringstream os;
+    auto& si = change.write_params.related_sample_identity();
+    os << si.writer_guid();
+
+    if (write_behind_.enabled)
+    {
+        PendingOperation operation;
+        operation.kind = PendingOperation::Kind::ADD_WRITER_CHANGE;
+        operation.guid = persistence_guid;
+        operation.sequence_number = change.sequenceNumber;
+        operation.instance_handle = change.instanceHandle;
+        operation.payload.assign(change.serializedPayload.data,
+                change.serializedPayload.data + change.serializedPayload.length);
+        operation.related_writer_guid = os.str();
+        operation.related_sequence_number = si.sequence_number();
+        operation.source_timestamp = change.sourceTimestamp.to_ns();
+        queue_operation(std::move(operation));
+        return true;
+    }
+
+    // IMPORTANT: this element must survive until the call (sqlite3_step) has been fulfilled.
+    // Another way would be to use SQLITE_TRANSIENT instead of static, forcing an internal copy,
+    // but this way a copy is saved (with cost of taking care that this string should survive)
+    std::string guids = os.str();
+
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    return add_writer_change_nts(persistence_guid, change.sequenceNumber, change.instanceHandle,
+                   change.serializedPayload.data, change.serializedPayload.length, guids, si.sequence_number(),
+                   change.sourceTimestamp.to_ns());
+}
+
+bool SQLite3PersistenceService::add_writer_change_nts(
+        const std::string& persistence_guid,
+        const SequenceNumber_t& sequence_number,
+        const InstanceHandle_t& instance_handle,
+        const octet* payload,
+        uint32_t payload_length,
+        const std::string& related_writer_guid,
+        const SequenceNumber_t& related_sequence_number,
+        int64_t source_timestamp)
+{
     if (add_writer_change_stmt_ != NULL)
     {
         //First add the last seq number, it is needed for the foreign key on writers_histories
         sqlite3_reset(update_writer_last_seq_num_stmt_);
         sqlite3_bind_text(update_writer_last_seq_num_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, sequence_number.to64long());
 
         if (sqlite3_step(update_writer_last_seq_num_stmt_) == SQLITE_DONE)
         {
             sqlite3_reset(add_writer_change_stmt_);
             sqlite3_bind_text(add_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 2, change.sequenceNumber.to64long());
-            if (change.instanceHandle.isDefined())
+            sqlite3_bind_int64(add_writer_change_stmt_, 2, sequence_number.to64long());
+            if (instance_handle.isDefined())
             {
-                sqlite3_bind_blob(add_writer_change_stmt_, 3, change.instanceHandle.value, 16, SQLITE_STATIC);
+                sqlite3_bind_blob(add_writer_change_stmt_, 3, instance_handle.value, 16, SQLITE_STATIC);
             }
             else
             {
                 sqlite3_bind_zeroblob(add_writer_change_stmt_, 3, 16);
             }
-            sqlite3_bind_blob(add_writer_change_stmt_, 4, change.serializedPayload.data,
-                    change.serializedPayload.length, SQLITE_STATIC);
+            if (payload != nullptr)
+            {
+                sqlite3_bind_blob(add_writer_change_stmt_, 4, payload, payload_length, SQLITE_STATIC);
+            }
+            else
+            {
+                sqlite3_bind_zeroblob(add_writer_change_stmt_, 4, 0);
+            }
 
             // related sample identity
-            std::ostringstream os;
-            auto& si = change.write_params.related_sample_identity();
-            os << si.writer_guid();
-
-            // IMPORTANT: this element must survive until the call (sqlite3_step) has been fulfilled.
-            // Another way would be to use SQLITE_TRANSIENT instead of static, forcing an internal copy,
-            // but this way a copy is saved (with cost of taking care that this string should survive)
-            std::string guids = os.str();
-
-            sqlite3_bind_text(add_writer_change_stmt_, 5, guids.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 6, si.sequence_number().to64long());
+            sqlite3_bind_text(add_writer_change_stmt_, 5, related_writer_guid.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(add_writer_change_stmt_, 6, related_sequence_number.to64long());
 
             // source time stamp
-            sqlite3_bind_int64(add_writer_change_stmt_, 7, change.sourceTimestamp.to_ns());
+            sqlite3_bind_int64(add_writer_change_stmt_, 7, source_timestamp);
 
             return sqlite3_step(add_writer_change_stmt_) == SQLITE_DONE;
         }
@@ -402,11 +474,29 @@ bool SQLite3PersistenceService::remove_writer_change_from_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
 
+    if (write_behind_.enabled)
+    {
+        PendingOperation operation;
+        operation.kind = PendingOperation::Kind::REMOVE_WRITER_CHANGE;
+        operation.guid = persistence_guid;
+        operation.sequence_number = change.sequenceNumber;
+        queue_operation(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    return remove_writer_change_nts(persistence_guid, change.sequenceNumber);
+}
+
+bool SQLite3PersistenceService::remove_writer_change_nts(
+        const std::string& persistence_guid,
+        const SequenceNumber_t& sequence_number)
+{
     if (remove_writer_change_stmt_ != NULL)
     {
         sqlite3_reset(remove_writer_change_stmt_);
         sqlite3_bind_text(remove_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(remove_writer_change_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(remove_writer_change_stmt_, 2, sequence_number.to64long());
         return sqlite3_step(remove_writer_change_stmt_) == SQLITE_DONE;
     }
 
@@ -424,6 +514,9 @@ bool SQLite3PersistenceService::load_reader_from_storage(
 {
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
 
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    flush_pending_nts();
+
     if (load_reader_stmt_ != NULL)
     {
         sqlite3_reset(load_reader_stmt_);
@@ -458,6 +551,26 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
 
+    if (write_behind_.enabled)
+    {
+        PendingOperation operation;
+        operation.kind = PendingOperation::Kind::UPDATE_READER_SEQ;
+        operation.guid = reader_guid;
+        operation.sequence_number = seq_number;
+        operation.writer_guid = writer_guid;
+        queue_operation(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    return update_writer_seq_nts(reader_guid, writer_guid, seq_number);
+}
+
+bool SQLite3PersistenceService::update_writer_seq_nts(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
     if (update_reader_stmt_ != NULL)
     {
         sqlite3_reset(update_reader_stmt_);
@@ -471,6 +584,126 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     return false;
 }
 
+void SQLite3PersistenceService::queue_operation(
+        PendingOperation&& operation)
+{
+    const uint64_t operation_size = sizeof(PendingOperation) + operation.guid.size() + operation.payload.size() +
+            operation.related_writer_guid.size();
+
+    bool batch_full = false;
+    {
+        std::unique_lock<std::mutex> lock(pending_mutex_);
+
+        // An operation bigger than the queue is accepted when the queue is empty
+        auto has_space = [&]()
+                {
+                    return pending_operations_.empty() ||
+                           pending_bytes_ + operation_size <= write_behind_.max_pending_bytes;
+                };
+        if (!has_space())
+        {
+            ++waiting_for_space_;
+            pending_cv_.notify_one();
+            space_cv_.wait(lock, has_space);
+            --waiting_for_space_;
+        }
+
+        pending_operations_.push_back(std::move(operation));
+        pending_bytes_ += operation_size;
+        batch_full = pending_operations_.size() == write_behind_.max_batch_size;
+    }
+
+    if (batch_full)
+    {
+        pending_cv_.notify_one();
+    }
+}
+
+void SQLite3PersistenceService::flush_pending_nts()
+{
+    // Taking the queue while holding db_mutex_ keeps the batches in the order they were queued
+    {
+        std::lock_guard<std::mutex> guard(pending_mutex_);
+        flushing_operations_.swap(pending_operations_);
+        pending_bytes_ = 0;
+    }
+    space_cv_.notify_all();
+
+    if (flushing_operations_.empty())
+    {
+        return;
+    }
+
+    bool in_transaction = sqlite3_exec(db_, "BEGIN TRANSACTION;", 0, 0, 0) == SQLITE_OK;
+    if (!in_transaction)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Could not begin transaction. Writing "
+                << flushing_operations_.size() << " operations one by one");
+    }
+
+    for (const PendingOperation& operation : flushing_operations_)
+    {
+        bool result = false;
+        switch (operation.kind)
+        {
+            case PendingOperation::Kind::ADD_WRITER_CHANGE:
+                result = add_writer_change_nts(operation.guid, operation.sequence_number,
+                                operation.instance_handle, operation.payload.data(),
+                                static_cast<uint32_t>(operation.payload.size()), operation.related_writer_guid,
+                                operation.related_sequence_number, operation.source_timestamp);
+                break;
+            case PendingOperation::Kind::REMOVE_WRITER_CHANGE:
+                result = remove_writer_change_nts(operation.guid, operation.sequence_number);
+                break;
+            case PendingOperation::Kind::UPDATE_READER_SEQ:
+                result = update_writer_seq_nts(operation.guid, operation.writer_guid, operation.sequence_number);
+                break;
+        }
+
+        if (!result)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Queued operation on " << operation.guid << " for seq "
+                                                                          << operation.sequence_number
+                                                                          << " could not be written: "
+                                                                          << sqlite3_errmsg(db_));
+        }
+    }
+
+    if (in_transaction && sqlite3_exec(db_, "COMMIT;", 0, 0, 0) != SQLITE_OK)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not commit " << flushing_operations_.size()
+                                                                 << " operations: " << sqlite3_errmsg(db_));
+        sqlite3_exec(db_, "ROLLBACK;", 0, 0, 0);
+    }
+
+    flushing_operations_.clear();
+}
+
+void SQLite3PersistenceService::write_behind_run()
+{
+    std::unique_lock<std::mutex> lock(pending_mutex_);
+    while (!stop_write_behind_)
+    {
+        pending_cv_.wait_for(lock, std::chrono::milliseconds(write_behind_.flush_interval_ms), [this]()
+                {
+                    return stop_write_behind_ || pending_operations_.size() >= write_behind_.max_batch_size ||
+                           (0 < waiting_for_space_ && !pending_operations_.empty());
+                });
+
+        if (stop_write_behind_ || pending_operations_.empty())
+        {
+            continue;
+        }
+
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> guard(db_mutex_);
+            flush_pending_nts();
+        }
+        lock.lock();
+    }
+}
+
 bool SQLite3PersistenceServiceSchemaV3::database_create_temporary_defaults_table(
         sqlite3* db)
 {
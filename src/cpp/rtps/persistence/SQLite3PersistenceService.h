@@ -19,24 +19,65 @@
 #ifndef SQLITE3PERSISTENCESERVICE_H_
 #define SQLITE3PERSISTENCESERVICE_H_
 
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+
 #include <rtps/persistence/PersistenceService.h>
 #include <rtps/persistence/sqlite3.h>
+#include <utils/thread.hpp>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+/**
+ * Configuration of the write-behind mode of the SQLite3 persistence service.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+struct SQLite3WriteBehindSettings
+{
+    //! Whether operations are queued and written by a background thread, grouped in one transaction per batch
+    bool enabled = false;
+    //! Maximum time, in milliseconds, an operation waits on the queue before its batch is committed
+    uint32_t flush_interval_ms = 100;
+    //! Number of queued operations that triggers a commit before the flush interval expires
+    uint32_t max_batch_size = 256;
+    //! Maximum memory, in bytes, taken by the queued operations and their payloads. Callers block while it is full
+    uint32_t max_pending_bytes = 16 * 1024 * 1024;
+};
+
 /**
  * Create a new SQLite3 implementation of persistence service
  * @ingroup RTPS_PERSISTENCE_MODULE
  */
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema);
+        bool update_schema,
+        const SQLite3WriteBehindSettings& write_behind = SQLite3WriteBehindSettings());
 
 
 /**
  * Persistence service implementation over SQLite3
+ *
+ * By default every operation is executed on the database before returning.
+ * When the write-behind mode is enabled, writer changes added or removed and reader sequence updates are queued and
+ * a background thread commits them in a single transaction every flush interval, or as soon as the maximum batch
+ * size is reached.
+ * In this mode:
+ * - Storage operations return true once the operation is queued. Failures are only logged when the batch is written.
+ * - Queued changes hold a copy of their payload. When the queue reaches its maximum size, callers block until the
+ *   background thread takes the queued operations.
+ * - Loading from storage first writes all the queued operations, so it always observes them.
+ * - The queue is written when the service is destroyed, i.e. when the endpoint is deleted.
+ * - DataWriter::wait_for_acknowledgments only reports that the matched readers acknowledged the samples.
+ *   Samples written up to one flush interval before an abrupt termination of the process may be missing from the
+ *   database, even if they were acknowledged.
+ *
  * @ingroup RTPS_PERSISTENCE_MODULE
  */
 class SQLite3PersistenceService : public IPersistenceService
@@ -44,7 +85,8 @@ class SQLite3PersistenceService : public IPersistenceService
 public:
 
     SQLite3PersistenceService(
-            sqlite3* db);
+            sqlite3* db,
+            const SQLite3WriteBehindSettings& write_behind = SQLite3WriteBehindSettings());
     virtual ~SQLite3PersistenceService() override;
 
     bool load_writer_from_storage(
@@ -94,8 +136,90 @@ public:
 
 private:
 
+    //! Operation queued to be written by the write-behind thread
+    struct PendingOperation
+    {
+        enum class Kind
+        {
+            ADD_WRITER_CHANGE,
+            REMOVE_WRITER_CHANGE,
+            UPDATE_READER_SEQ
+        };
+
+        Kind kind;
+        //! Persistence GUID of the writer, or GUID of the reader
+        std::string guid;
+        SequenceNumber_t sequence_number;
+
+        // ADD_WRITER_CHANGE
+        InstanceHandle_t instance_handle;
+        std::vector<octet> payload;
+        std::string related_writer_guid;
+        SequenceNumber_t related_sequence_number;
+        int64_t source_timestamp = 0;
+
+        // UPDATE_READER_SEQ
+        GUID_t writer_guid;
+    };
+
+    bool add_writer_change_nts(
+            const std::string& persistence_guid,
+            const SequenceNumber_t& sequence_number,
+            const InstanceHandle_t& instance_handle,
+            const octet* payload,
+            uint32_t payload_length,
+            const std::string& related_writer_guid,
+            const SequenceNumber_t& related_sequence_number,
+            int64_t source_timestamp);
+
+    bool remove_writer_change_nts(
+            const std::string& persistence_guid,
+            const SequenceNumber_t& sequence_number);
+
+    bool update_writer_seq_nts(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number);
+
+    /**
+     * Queue an operation for the write-behind thread, waking it up if the batch is full.
+     * Blocks while there is no room for the operation on the queue.
+     * @param operation Operation to queue.
+     */
+    void queue_operation(
+            PendingOperation&& operation);
+
+    /**
+     * Write all the queued operations in a single transaction.
+     * Should be called with db_mutex_ locked.
+     */
+    void flush_pending_nts();
+
+    //! Body of the write-behind thread
+    void write_behind_run();
+
     sqlite3* db_;
 
+    //! Configuration of the write-behind mode
+    SQLite3WriteBehindSettings write_behind_;
+    //! Serializes the use of the database and the prepared statements
+    std::mutex db_mutex_;
+    //! Protects pending_operations_, pending_bytes_, waiting_for_space_ and stop_write_behind_
+    std::mutex pending_mutex_;
+    std::condition_variable pending_cv_;
+    //! Notified when the queued operations are taken to be written
+    std::condition_variable space_cv_;
+    //! Operations queued by the callers
+    std::vector<PendingOperation> pending_operations_;
+    //! Memory taken by pending_operations_
+    uint64_t pending_bytes_ = 0;
+    //! Number of callers waiting for room on the queue
+    uint32_t waiting_for_space_ = 0;
+    //! Operations being written, swapped with pending_operations_ to reuse their storage
+    std::vector<PendingOperation> flushing_operations_;
+    bool stop_write_behind_ = false;
+    eprosima::thread write_behind_thread_;
+
     sqlite3_stmt* load_writer_stmt_;
     sqlite3_stmt* add_writer_change_stmt_;
     sqlite3_stmt* remove_writer_change_stmt_;
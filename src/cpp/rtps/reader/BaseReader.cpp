@@ -270,6 +270,12 @@ void BaseReader::allow_unknown_writers()
 {
     assert(fastdds::rtps::EntityId_t::unknown() != trusted_writer_entity_id_);
     accept_messages_from_unkown_writers_ = true;
+    notify_matching_changed();
+}
+
+void BaseReader::notify_matching_changed()
+{
+    mp_RTPSParticipant->notify_reader_matching_changed();
 }
 
 std::shared_ptr<LocalReaderPointer> BaseReader::get_local_pointer()
@@ -526,6 +532,7 @@ void BaseReader::setup_datasharing(
                         notification,
                         att.endpoint.data_sharing_configuration().shm_directory(),
                         att.data_sharing_listener_thread,
+                        att.data_sharing_listener_spin_budget,
                         att.matched_writers_allocation,
                         this));
 
@@ -141,6 +141,21 @@ public:
      */
     void allow_unknown_writers();
 
+    /**
+     * @brief Check whether messages sent by the writers of a participant may be processed by this reader.
+     * Used to skip this reader when dispatching messages not directed to a specific reader.
+     *
+     * @param participant_guid_prefix  GUID prefix of the participant that sent the messages.
+     *
+     * @return False only when none of those messages would be accepted by this reader.
+     */
+    virtual bool may_accept_messages_from(
+            const fastdds::rtps::GuidPrefix_t& participant_guid_prefix) const
+    {
+        static_cast<void>(participant_guid_prefix);
+        return true;
+    }
+
     /**
      * @return The liveliness kind of this reader
      */
@@ -362,6 +377,13 @@ protected:
     virtual bool may_remove_history_record(
             bool removed_by_lease);
 
+    /**
+     * @brief Notify that the set of writers matched with this reader has changed.
+     * Should be called after the matched writer is added to, or removed from, the collection of matched writers.
+     * Changes the reader matching generation of the participant.
+     */
+    void notify_matching_changed();
+
     /**
      * @brief Add a remote writer to the persistence_guid map.
      *
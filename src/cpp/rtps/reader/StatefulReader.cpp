@@ -19,6 +19,7 @@
 
 #include <rtps/reader/StatefulReader.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <mutex>
 #include <thread>
@@ -343,6 +344,8 @@ bool StatefulReader::matched_writer_add_edp(
             matched_writers_.push_back(wp);
             EPROSIMA_LOG_INFO(RTPS_READER, "Writer Proxy " << wp->guid() << " added to " << m_guid.entityId);
         }
+
+        notify_matching_changed();
     }
     if (liveliness_lease_duration_ < dds::c_TimeInfinite)
     {
@@ -399,6 +402,7 @@ bool StatefulReader::matched_writer_remove(
                 EPROSIMA_LOG_INFO(RTPS_READER, "Writer proxy " << writer_guid << " removed from " << m_guid.entityId);
                 wproxy = *it;
                 matched_writers_.erase(it);
+                notify_matching_changed();
 
                 break;
             }
@@ -499,6 +503,22 @@ bool StatefulReader::matched_writer_is_matched(
     return false;
 }
 
+bool StatefulReader::may_accept_messages_from(
+        const GuidPrefix_t& participant_guid_prefix) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    if (accept_messages_from_unkown_writers_ || (c_EntityId_Unknown != trusted_writer_entity_id_))
+    {
+        return true;
+    }
+
+    return std::any_of(matched_writers_.begin(), matched_writers_.end(),
+                   [&participant_guid_prefix](const WriterProxy* writer)
+                   {
+                       return writer->guid().guidPrefix == participant_guid_prefix;
+                   });
+}
+
 bool StatefulReader::matched_writer_lookup(
         const GUID_t& writerGUID,
         WriterProxy** WP)
@@ -104,6 +104,9 @@ public:
     bool matched_writer_is_matched(
             const GUID_t& writer_guid) override;
 
+    bool may_accept_messages_from(
+            const GuidPrefix_t& participant_guid_prefix) const override;
+
     /**
      * Look for a specific WriterProxy.
      * @param writerGUID GUID_t of the writer we are looking for.
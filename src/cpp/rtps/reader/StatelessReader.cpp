@@ -17,6 +17,7 @@
  *
  */
 
+#include <algorithm>
 #include <cassert>
 #include <mutex>
 #include <thread>
@@ -185,6 +186,7 @@ bool StatelessReader::matched_writer_add_edp(
             return false;
         }
         EPROSIMA_LOG_INFO(RTPS_READER, "Writer " << wdata.guid << " added to reader " << m_guid);
+        notify_matching_changed();
 
         add_persistence_guid(info.guid, info.persistence_guid);
 
@@ -265,6 +267,7 @@ bool StatelessReader::matched_writer_remove(
 
                 remove_persistence_guid(it->guid, it->persistence_guid, removed_by_lease);
                 matched_writers_.erase(it);
+                notify_matching_changed();
                 if (nullptr != listener_)
                 {
                     // call the listener without lock
@@ -335,6 +338,22 @@ bool StatelessReader::matched_writer_is_matched(
     return false;
 }
 
+bool StatelessReader::may_accept_messages_from(
+        const GuidPrefix_t& participant_guid_prefix) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    if (accept_messages_from_unkown_writers_ || (c_EntityId_Unknown != trusted_writer_entity_id_))
+    {
+        return true;
+    }
+
+    return std::any_of(matched_writers_.begin(), matched_writers_.end(),
+                   [&participant_guid_prefix](const RemoteWriterInfo_t& writer)
+                   {
+                       return writer.guid.guidPrefix == participant_guid_prefix;
+                   });
+}
+
 bool StatelessReader::change_received(
         CacheChange_t* change)
 {
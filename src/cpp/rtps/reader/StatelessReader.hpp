@@ -101,6 +101,9 @@ public:
     bool matched_writer_is_matched(
             const GUID_t& writer_guid) override;
 
+    bool may_accept_messages_from(
+            const GuidPrefix_t& participant_guid_prefix) const override;
+
     /**
      * Method to indicate the reader that some change has been removed due to HistoryQos requirements.
      * @param change Pointer to the CacheChange_t.
@@ -23,6 +23,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include "TimedEventImpl.h"
+#include "TimerWheel.hpp"
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
 
@@ -97,16 +98,25 @@ void ResourceEvent::unregister_timer(
     std::vector<TimedEventImpl*>::iterator it;
 
     // Remove from pending
-    it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
-    if (it != pending_timers_.end())
+    if (event->is_pending())
     {
+        it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
+        assert(it != pending_timers_.end());
         pending_timers_.erase(it);
+        event->set_pending(false);
         should_notify = true;
     }
 
     // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
+    if (timer_wheel_)
+    {
+        if (event->is_scheduled())
+        {
+            timer_wheel_->cancel(event);
+            should_notify = true;
+        }
+    }
+    else if ((it = std::find(active_timers_.begin(), active_timers_.end(), event)) != active_timers_.end())
     {
         active_timers_.erase(it);
 
@@ -120,6 +130,12 @@ void ResourceEvent::unregister_timer(
         should_notify = true;
     }
 
+    if (is_service_thread && event == triggering_timer_)
+    {
+        //! Warn the execution thread not to reschedule the timer after its callback
+        triggering_timer_unregistered_ = true;
+    }
+
     // Decrement counter of created timers
     --timers_count_;
 
@@ -130,6 +146,20 @@ void ResourceEvent::unregister_timer(
     }
 }
 
+void ResourceEvent::delete_timer(
+        TimedEventImpl* event)
+{
+    if (thread_->is_calling_thread() && event == triggering_timer_)
+    {
+        // Still being used by trigger_timer
+        triggering_timer_deleted_ = true;
+    }
+    else
+    {
+        delete event;
+    }
+}
+
 void ResourceEvent::notify(
         TimedEventImpl* event)
 {
@@ -165,8 +195,9 @@ void ResourceEvent::notify(
 bool ResourceEvent::register_timer_nts(
         TimedEventImpl* event)
 {
-    if (std::find(pending_timers_.begin(), pending_timers_.end(), event) == pending_timers_.end())
+    if (!event->is_pending())
     {
+        event->set_pending(true);
         pending_timers_.push_back(event);
         return true;
     }
@@ -201,10 +232,19 @@ void ResourceEvent::event_service()
         cv_manipulation_.notify_all();
 
         // Wait for the first timer to be triggered
-        std::chrono::steady_clock::time_point next_trigger =
-                active_timers_.empty() ?
-                current_time_ + std::chrono::seconds(1) :
-                active_timers_[0]->next_trigger_time();
+        std::chrono::steady_clock::time_point next_trigger;
+        if (timer_wheel_)
+        {
+            next_trigger = timer_wheel_->empty() ?
+                    current_time_ + std::chrono::seconds(1) :
+                    timer_wheel_->next_expiration();
+        }
+        else
+        {
+            next_trigger = active_timers_.empty() ?
+                    current_time_ + std::chrono::seconds(1) :
+                    active_timers_[0]->next_trigger_time();
+        }
 
         auto current_time = std::chrono::steady_clock::now();
         if (current_time > next_trigger)
@@ -249,6 +289,18 @@ void ResourceEvent::do_timer_actions()
         std::lock_guard<TimedMutex> lock(mutex_);
         for (TimedEventImpl* tp : pending_timers_)
         {
+            tp->set_pending(false);
+
+            if (timer_wheel_)
+            {
+                timer_wheel_->cancel(tp);
+                if (tp->update(current_time_, cancel_time))
+                {
+                    timer_wheel_->schedule(tp, tp->next_trigger_time());
+                }
+                continue;
+            }
+
             // Remove item from active timers
             auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
             current_pos = std::find(current_pos, active_timers_.end(), tp);
@@ -271,6 +323,12 @@ void ResourceEvent::do_timer_actions()
         pending_timers_.clear();
     }
 
+    if (timer_wheel_)
+    {
+        do_timer_wheel_actions(cancel_time);
+        return;
+    }
+
     // Trigger active timers
     skip_checking_active_timers_.store(false);
     for (TimedEventImpl* tp : active_timers_)
@@ -278,7 +336,7 @@ void ResourceEvent::do_timer_actions()
         if (tp->next_trigger_time() <= current_time_)
         {
             did_something = true;
-            tp->trigger(current_time_, cancel_time);
+            trigger_timer(tp, cancel_time);
 
             //! skip this iteration as active_timers has been manipulated
             if (skip_checking_active_timers_.load())
@@ -310,13 +368,58 @@ void ResourceEvent::do_timer_actions()
     }
 }
 
+void ResourceEvent::do_timer_wheel_actions(
+        std::chrono::steady_clock::time_point cancel_time)
+{
+    timer_wheel_->advance(current_time_);
+
+    // Timers rescheduled here are not popped again on this call, as the wheel does not expire them until it is
+    // advanced again. Other timers unregistered by a callback are directly removed from the wheel, but the one being
+    // triggered has already been popped, so it must not be touched again.
+    while (TimerWheel::Node* node = timer_wheel_->pop_expired())
+    {
+        TimedEventImpl* tp = static_cast<TimedEventImpl*>(node);
+        if (trigger_timer(tp, cancel_time) && tp->next_trigger_time() < cancel_time)
+        {
+            timer_wheel_->schedule(tp, tp->next_trigger_time());
+        }
+    }
+}
+
+bool ResourceEvent::trigger_timer(
+        TimedEventImpl* event,
+        std::chrono::steady_clock::time_point cancel_time)
+{
+    triggering_timer_ = event;
+    triggering_timer_unregistered_ = false;
+    triggering_timer_deleted_ = false;
+
+    event->trigger(current_time_, cancel_time);
+
+    triggering_timer_ = nullptr;
+    if (triggering_timer_deleted_)
+    {
+        delete event;
+    }
+
+    return !triggering_timer_unregistered_;
+}
+
 void ResourceEvent::init_thread(
         const fastdds::rtps::ThreadSettings& thread_cfg,
         const char* name_fmt,
-        uint32_t thread_id)
+        uint32_t thread_id,
+        bool use_timer_wheel)
 {
     std::lock_guard<TimedMutex> lock(mutex_);
 
+    if (use_timer_wheel && !timer_wheel_)
+    {
+        // Timers are only activated by the execution thread, so there are none yet
+        assert(active_timers_.empty());
+        timer_wheel_.reset(new TimerWheel());
+    }
+
     allow_vector_manipulation_ = false;
     stop_.store(false);
     resize_collections();
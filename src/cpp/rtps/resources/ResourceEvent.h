@@ -39,6 +39,7 @@ namespace fastdds {
 namespace rtps {
 
 class TimedEventImpl;
+class TimerWheel;
 
 /**
  * This class centralizes all operations over timed events in the same thread.
@@ -60,11 +61,15 @@ public:
      *                         a `snprintf` like function, taking `thread_id` as additional
      *                         argument, and used to give a name to the created thread.
      * @param [in]  thread_id   Single variadic argument passed to the formatting function.
+     * @param [in]  use_timer_wheel  Whether to keep the active timers on a hierarchical timing wheel, with O(1)
+     *                               scheduling and cancellation, instead of a sorted collection.
+     *                               Only taken into account the first time the thread is initialized.
      */
     void init_thread(
             const fastdds::rtps::ThreadSettings& thread_cfg = {},
             const char* name_fmt = "event %u",
-            uint32_t thread_id = 0);
+            uint32_t thread_id = 0,
+            bool use_timer_wheel = false);
 
     void stop_thread();
 
@@ -89,6 +94,15 @@ public:
     void unregister_timer(
             TimedEventImpl* event);
 
+    /*!
+     * @brief This method deletes a TimedEventImpl object that has been unregistered.
+     *
+     * When called from the callback of the event being deleted, the deletion is deferred until the callback returns.
+     * @param event TimedEventImpl object to be deleted.
+     */
+    void delete_timer(
+            TimedEventImpl* event);
+
     /*!
      * @brief This method notifies to ResourceEvent that the TimedEventImpl object has operations to be scheduled.
      *
@@ -139,6 +153,18 @@ private:
     //! Prevents iterator invalidation when active_timers are manipulated inside loops
     std::atomic<bool> skip_checking_active_timers_;
 
+    //! Timer whose callback is being run by the execution thread.
+    TimedEventImpl* triggering_timer_ = nullptr;
+
+    //! Whether triggering_timer_ has been unregistered from a callback.
+    bool triggering_timer_unregistered_ = false;
+
+    //! Whether triggering_timer_ has to be deleted once its callback returns.
+    bool triggering_timer_deleted_ = false;
+
+    //! Keeps the active timers instead of active_timers_, when enabled.
+    std::unique_ptr<TimerWheel> timer_wheel_;
+
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
 
@@ -166,6 +192,21 @@ private:
     //! Method called by the internal thread to process due actions.
     void do_timer_actions();
 
+    //! Method called by the internal thread to trigger the due timers of the timing wheel.
+    void do_timer_wheel_actions(
+            std::chrono::steady_clock::time_point cancel_time);
+
+    /*!
+     * @brief Triggers a timer from the execution thread, taking care of the timer being unregistered or deleted by
+     * its own callback.
+     * @param event Event to be triggered.
+     * @param cancel_time Trigger time set on the event when it is not restarted.
+     * @return False when the timer was unregistered, and so cannot be accessed anymore.
+     */
+    bool trigger_timer(
+            TimedEventImpl* event,
+            std::chrono::steady_clock::time_point cancel_time);
+
     //! Ensures internal collections can accommodate current total number of timers.
     void resize_collections()
     {
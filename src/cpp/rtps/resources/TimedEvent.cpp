@@ -42,7 +42,7 @@ TimedEvent::TimedEvent(
 TimedEvent::~TimedEvent()
 {
     service_.unregister_timer(impl_);
-    delete(impl_);
+    service_.delete_timer(impl_);
 }
 
 void TimedEvent::cancel_timer()
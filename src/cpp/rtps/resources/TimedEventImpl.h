@@ -24,6 +24,7 @@
 
 #include <fastdds/rtps/common/Time_t.hpp>
 #include <rtps/resources/TimedEvent.h>
+#include <rtps/resources/TimerWheel.hpp>
 
 #include <atomic>
 #include <functional>
@@ -35,9 +36,10 @@ namespace rtps {
 /*!
  * This class encapsulates a timer.
  * It also manages the state of the event (INACTIVE, READY, WAITING..).
+ * It can be scheduled on the TimerWheel of a ResourceEvent.
  * @ingroup MANAGEMENT_MODULE
  */
-class TimedEventImpl
+class TimedEventImpl : public TimerWheel::Node
 {
     using Callback = std::function<bool ()>;
 
@@ -111,6 +113,25 @@ public:
         return next_trigger_time_;
     }
 
+    /*!
+     * @brief Returns whether the event is on the collection of events pending update of its ResourceEvent.
+     * @warning Only accessed by ResourceEvent with its mutex locked.
+     */
+    bool is_pending() const
+    {
+        return pending_;
+    }
+
+    /*!
+     * @brief Sets whether the event is on the collection of events pending update of its ResourceEvent.
+     * @warning Only accessed by ResourceEvent with its mutex locked.
+     */
+    void set_pending(
+            bool pending)
+    {
+        pending_ = pending;
+    }
+
     /*!
      * @brief Tries to set the event as READY.
      * To achieve it, the event has to be INACTIVE.
@@ -156,6 +177,9 @@ private:
 
     //! Current state of this event
     std::atomic<StateCode> state_;
+
+    //! Whether this event is on the pending collection of its ResourceEvent
+    bool pending_ = false;
 };
 
 } // namespace rtps
@@ -0,0 +1,467 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerWheel.hpp
+ */
+
+#ifndef FASTDDS_RTPS_RESOURCES__TIMERWHEEL_HPP
+#define FASTDDS_RTPS_RESOURCES__TIMERWHEEL_HPP
+
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Hierarchical timing wheel.
+ *
+ * Time is divided in ticks of a fixed resolution. Each level of the wheel has a number of slots, and each slot of
+ * level @c L covers @c slots^L ticks. A scheduled node is linked on the slot of the lowest level whose range holds
+ * its expiration tick, and moved to a lower level (cascaded) when time reaches the start of its slot.
+ * Scheduling, cancelling and rescheduling a node are O(1), as nodes are intrusive and slots are doubly linked lists.
+ *
+ * Nodes never expire before their expiration time, and expire at most one tick after it.
+ * Expiration times farther than the range of the wheel are kept on the last level and cascaded again until they
+ * are in range.
+ */
+class TimerWheel
+{
+    static constexpr size_t slot_bits = 8;
+    static constexpr size_t num_slots = size_t(1) << slot_bits;
+    static constexpr uint64_t slot_mask = num_slots - 1;
+    static constexpr size_t num_levels = 4;
+    //! Index of the list holding the expired nodes
+    static constexpr size_t expired_list = num_levels * num_slots;
+
+public:
+
+    using clock = std::chrono::steady_clock;
+
+    //! Hook to be inherited by the objects scheduled on a TimerWheel.
+    class Node
+    {
+        friend class TimerWheel;
+
+    public:
+
+        //! Whether the node is scheduled on a wheel, either waiting or expired.
+        bool is_scheduled() const
+        {
+            return nullptr != next_;
+        }
+
+    private:
+
+        Node* prev_ = nullptr;
+        Node* next_ = nullptr;
+        uint64_t tick_ = 0;
+        size_t list_ = 0;
+    };
+
+    /**
+     * Construct an empty wheel.
+     *
+     * @param resolution  Duration of a tick.
+     * @param origin      Time point of tick zero. Expiration times before it are considered expired.
+     */
+    explicit TimerWheel(
+            clock::duration resolution = std::chrono::microseconds(100),
+            clock::time_point origin = clock::now())
+        : resolution_(resolution)
+        , origin_(origin)
+    {
+        assert(resolution_.count() > 0);
+
+        for (Node& head : lists_)
+        {
+            head.prev_ = head.next_ = &head;
+        }
+        for (auto& level : occupied_)
+        {
+            level.fill(0u);
+        }
+    }
+
+    TimerWheel(
+            const TimerWheel&) = delete;
+    TimerWheel& operator =(
+            const TimerWheel&) = delete;
+
+    //! Nodes still scheduled are not accessed, so they may be destroyed before the wheel.
+    ~TimerWheel() = default;
+
+    //! Number of scheduled nodes, including the expired ones not yet popped.
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+    /**
+     * Schedule a node, or reschedule it if it was already scheduled.
+     * A node is never considered expired on the same call to @c advance on which it was scheduled, so a node
+     * rescheduled while processing the expired ones is not popped again by the same pass.
+     *
+     * @param node        Node to schedule.
+     * @param expiration  Time at which the node expires.
+     */
+    void schedule(
+            Node* node,
+            clock::time_point expiration)
+    {
+        cancel(node);
+
+        uint64_t tick = ticks_until(expiration, true);
+        node->tick_ = (tick > current_tick_) ? tick : current_tick_ + 1;
+        link(node);
+        ++size_;
+    }
+
+    //! Remove a node from the wheel. Nothing is done if it is not scheduled.
+    void cancel(
+            Node* node)
+    {
+        if (node->is_scheduled())
+        {
+            unlink(node);
+            --size_;
+        }
+    }
+
+    //! Remove all the nodes from the wheel.
+    void clear()
+    {
+        for (size_t list = 0; list <= expired_list; ++list)
+        {
+            Node& head = lists_[list];
+            while (head.next_ != &head)
+            {
+                Node* node = head.next_;
+                unlink(node);
+            }
+        }
+        size_ = 0;
+    }
+
+    /**
+     * Returns the time at which @c advance should be called next.
+     * It is the time point of the earliest tick on which a node expires or a slot is cascaded.
+     * When there are expired nodes not yet popped, the time point of the current tick is returned.
+     * When the wheel is empty, clock::time_point::max() is returned.
+     */
+    clock::time_point next_expiration() const
+    {
+        if (empty())
+        {
+            return clock::time_point::max();
+        }
+
+        if (!is_empty_list(expired_list))
+        {
+            return origin_ + resolution_ * static_cast<clock::rep>(current_tick_);
+        }
+
+        return origin_ + resolution_ * static_cast<clock::rep>(next_tick());
+    }
+
+    /**
+     * Advance the wheel up to a time point, making the nodes expiring until then ready to be popped.
+     *
+     * @param now  Current time.
+     */
+    void advance(
+            clock::time_point now)
+    {
+        uint64_t target = ticks_until(now, false);
+
+        while (current_tick_ < target && expired_count_ < size_)
+        {
+            uint64_t tick = next_tick();
+            if (tick > target)
+            {
+                break;
+            }
+            current_tick_ = tick;
+
+            // Higher levels first, so the nodes cascaded down to the lowest level are expired now
+            for (size_t level = num_levels - 1; level > 0; --level)
+            {
+                if (0 == (current_tick_ & ((uint64_t(1) << (slot_bits * level)) - 1)))
+                {
+                    cascade(level, static_cast<size_t>((current_tick_ >> (slot_bits * level)) & slot_mask));
+                }
+            }
+
+            splice_to_expired(static_cast<size_t>(current_tick_ & slot_mask));
+        }
+
+        if (current_tick_ < target)
+        {
+            current_tick_ = target;
+        }
+    }
+
+    /**
+     * Take the next expired node, in expiration tick order.
+     *
+     * @return Pointer to the node, which is no longer scheduled, or nullptr if there are no expired nodes.
+     */
+    Node* pop_expired()
+    {
+        if (is_empty_list(expired_list))
+        {
+            return nullptr;
+        }
+
+        Node* node = lists_[expired_list].next_;
+        unlink(node);
+        --size_;
+        return node;
+    }
+
+private:
+
+    //! Number of ticks from the origin until a time point, rounded down or up.
+    uint64_t ticks_until(
+            clock::time_point time,
+            bool round_up) const
+    {
+        if (time <= origin_)
+        {
+            return 0;
+        }
+
+        clock::duration elapsed = time - origin_;
+        uint64_t ticks = static_cast<uint64_t>(elapsed / resolution_);
+        if (round_up && (elapsed % resolution_) != clock::duration::zero())
+        {
+            ++ticks;
+        }
+        return ticks;
+    }
+
+    bool is_empty_list(
+            size_t list) const
+    {
+        return lists_[list].next_ == &lists_[list];
+    }
+
+    //! Link a node on the list of its expiration tick, relative to the current tick.
+    void link(
+            Node* node)
+    {
+        size_t list = expired_list;
+
+        if (node->tick_ > current_tick_)
+        {
+            uint64_t delta = node->tick_ - current_tick_;
+            uint64_t tick = node->tick_;
+            size_t level = 0;
+
+            while (level + 1 < num_levels && delta >= (uint64_t(1) << (slot_bits * (level + 1))))
+            {
+                ++level;
+            }
+
+            if (delta >= (uint64_t(1) << (slot_bits * num_levels)))
+            {
+                // Out of range: park it on the farthest slot, it is linked again when cascaded from there
+                tick = current_tick_ + (uint64_t(1) << (slot_bits * num_levels)) - 1;
+            }
+
+            size_t slot = static_cast<size_t>((tick >> (slot_bits * level)) & slot_mask);
+            list = level * num_slots + slot;
+            occupied_[level][slot >> 6] |= uint64_t(1) << (slot & 63);
+        }
+        else
+        {
+            ++expired_count_;
+        }
+
+        Node& head = lists_[list];
+        node->list_ = list;
+        node->prev_ = head.prev_;
+        node->next_ = &head;
+        head.prev_->next_ = node;
+        head.prev_ = node;
+    }
+
+    void unlink(
+            Node* node)
+    {
+        size_t list = node->list_;
+        node->prev_->next_ = node->next_;
+        node->next_->prev_ = node->prev_;
+        node->prev_ = node->next_ = nullptr;
+
+        if (expired_list == list)
+        {
+            --expired_count_;
+        }
+        else if (is_empty_list(list))
+        {
+            clear_occupied(list);
+        }
+    }
+
+    void clear_occupied(
+            size_t list)
+    {
+        size_t level = list / num_slots;
+        size_t slot = list % num_slots;
+        occupied_[level][slot >> 6] &= ~(uint64_t(1) << (slot & 63));
+    }
+
+    //! Move the nodes on a slot of the lowest level to the list of expired nodes.
+    void splice_to_expired(
+            size_t slot)
+    {
+        Node& head = lists_[slot];
+        while (head.next_ != &head)
+        {
+            Node* node = head.next_;
+            unlink(node);
+            node->tick_ = current_tick_;
+            link(node);
+        }
+    }
+
+    //! Link again the nodes on a slot of a level, so they are moved to lower levels.
+    void cascade(
+            size_t level,
+            size_t slot)
+    {
+        Node& head = lists_[level * num_slots + slot];
+        if (head.next_ == &head)
+        {
+            return;
+        }
+
+        // Detach the whole list first, as nodes out of range may be linked back on the same slot
+        Node* node = head.next_;
+        head.prev_->next_ = nullptr;
+        head.prev_ = head.next_ = &head;
+        clear_occupied(level * num_slots + slot);
+
+        while (nullptr != node)
+        {
+            Node* next = node->next_;
+            link(node);
+            node = next;
+        }
+    }
+
+    //! Returns the earliest tick, after the current one, on which a node expires or a slot is cascaded.
+    uint64_t next_tick() const
+    {
+        uint64_t result = UINT64_MAX;
+
+        for (size_t level = 0; level < num_levels; ++level)
+        {
+            size_t shift = slot_bits * level;
+            size_t index = static_cast<size_t>((current_tick_ >> shift) & slot_mask);
+            size_t distance = 0;
+            if (next_occupied(level, index, distance))
+            {
+                uint64_t tick = ((current_tick_ >> shift) + distance) << shift;
+                if (tick < result)
+                {
+                    result = tick;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Look for the next occupied slot of a level, cyclically after a given one.
+     *
+     * @param [in]  level     Level to look at.
+     * @param [in]  index     Slot after which to start looking.
+     * @param [out] distance  Number of slots from @c index to the occupied one, in [1, num_slots].
+     *
+     * @return Whether an occupied slot was found.
+     */
+    bool next_occupied(
+            size_t level,
+            size_t index,
+            size_t& distance) const
+    {
+        const std::array<uint64_t, num_slots / 64>& bits = occupied_[level];
+
+        for (size_t step = 1; step <= num_slots; )
+        {
+            size_t slot = (index + step) & slot_mask;
+            uint64_t word = bits[slot >> 6] >> (slot & 63);
+            if (0 != word)
+            {
+                size_t offset = count_trailing_zeros(word);
+                if (step + offset <= num_slots)
+                {
+                    distance = step + offset;
+                    return true;
+                }
+                return false;
+            }
+            step += 64 - (slot & 63);
+        }
+
+        return false;
+    }
+
+    static size_t count_trailing_zeros(
+            uint64_t value)
+    {
+        assert(0 != value);
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(value));
+#else
+        size_t count = 0;
+        while (0 == (value & 1u))
+        {
+            value >>= 1;
+            ++count;
+        }
+        return count;
+#endif // if defined(__GNUC__) || defined(__clang__)
+    }
+
+    clock::duration resolution_;
+    clock::time_point origin_;
+    uint64_t current_tick_ = 0;
+    size_t size_ = 0;
+    size_t expired_count_ = 0;
+
+    //! Sentinels of the slot lists of every level, followed by the one of the expired list
+    std::array<Node, num_levels * num_slots + 1> lists_;
+    //! Bit i of a level is set when slot i of the level holds nodes
+    std::array<std::array<uint64_t, num_slots / 64>, num_levels> occupied_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_RESOURCES__TIMERWHEEL_HPP
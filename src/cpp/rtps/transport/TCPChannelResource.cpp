@@ -14,6 +14,7 @@
 
 #include <rtps/transport/TCPChannelResource.h>
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -21,6 +22,7 @@
 
 #include <rtps/transport/asio_helpers.hpp>
 #include <rtps/transport/TCPTransportInterface.h>
+#include <utils/threading.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -417,6 +419,164 @@ void TCPChannelResource::set_socket_options(
     socket.set_option(asio::ip::tcp::no_delay(options->enable_tcp_nodelay));
 }
 
+size_t TCPChannelResource::enqueue_send(
+        const octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        uint32_t queue_size)
+{
+    std::unique_lock<std::mutex> lock(send_queue_mutex_);
+
+    // Checked again under the lock, as disconnect() may be stopping the sender thread
+    if (stop_sender_ || eConnecting >= connection_status_)
+    {
+        return 0;
+    }
+
+    if (!sender_thread_.joinable())
+    {
+        asio::error_code ec;
+        uint16_t port = local_endpoint(ec).port();
+        sender_thread_ = create_thread([this]()
+                        {
+                            send_queue_run();
+                        }, ThreadSettings{}, "dds.tcps.%u", port);
+    }
+
+    while (send_queue_.size() >= queue_size)
+    {
+        if (parent_->configuration()->non_blocking_send)
+        {
+            // Behave as if the message was sent but lost, as the synchronous non-blocking path does
+            ++send_queue_stats_.dropped_messages;
+            return 0;
+        }
+
+        send_queue_space_cv_.wait(lock);
+        if (stop_sender_ || eConnecting >= connection_status_)
+        {
+            return 0;
+        }
+    }
+
+    std::vector<octet> message;
+    if (!free_send_buffers_.empty())
+    {
+        message.swap(free_send_buffers_.back());
+        free_send_buffers_.pop_back();
+    }
+    message.clear();
+    message.reserve(header_size + total_bytes);
+    message.insert(message.end(), header, header + header_size);
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        const octet* data = static_cast<const octet*>(buffer.buffer);
+        message.insert(message.end(), data, data + buffer.size);
+    }
+    send_queue_.push_back(std::move(message));
+
+    ++send_queue_stats_.enqueued_messages;
+    send_queue_stats_.current_depth = static_cast<uint32_t>(send_queue_.size());
+    send_queue_stats_.max_depth = (std::max)(send_queue_stats_.max_depth, send_queue_stats_.current_depth);
+
+    // Only the first message of a batch needs to wake up the sender thread
+    if (1 == send_queue_.size())
+    {
+        send_queue_cv_.notify_one();
+    }
+
+    return header_size + total_bytes;
+}
+
+void TCPChannelResource::send_queue_run()
+{
+    std::vector<std::vector<octet>> batch;
+    std::vector<asio::const_buffer> asio_buffers;
+
+    std::unique_lock<std::mutex> lock(send_queue_mutex_);
+    while (true)
+    {
+        send_queue_cv_.wait(lock, [this]()
+                {
+                    return stop_sender_ || !send_queue_.empty();
+                });
+        if (stop_sender_)
+        {
+            break;
+        }
+
+        // Take all the queued messages, making room for the callers
+        batch.swap(send_queue_);
+        send_queue_stats_.current_depth = 0;
+        send_queue_space_cv_.notify_all();
+        lock.unlock();
+
+        asio_buffers.clear();
+        for (const std::vector<octet>& message : batch)
+        {
+            asio_buffers.push_back(asio::buffer(message));
+        }
+
+        asio::error_code ec;
+        write_queued(asio_buffers, ec);
+        if (ec)
+        {
+            // The reception thread detects the broken connection and handles it
+            EPROSIMA_LOG_WARNING(RTCP, "Failed to write " << batch.size() << " queued messages: " << ec.message());
+        }
+
+        lock.lock();
+        ++send_queue_stats_.coalesced_writes;
+        for (std::vector<octet>& message : batch)
+        {
+            if (free_send_buffers_.size() >= parent_->configuration()->send_queue_size)
+            {
+                break;
+            }
+            free_send_buffers_.push_back(std::move(message));
+        }
+        batch.clear();
+    }
+}
+
+void TCPChannelResource::stop_send_queue()
+{
+    {
+        std::lock_guard<std::mutex> lock(send_queue_mutex_);
+        stop_sender_ = true;
+    }
+    send_queue_cv_.notify_all();
+    send_queue_space_cv_.notify_all();
+
+    if (sender_thread_.joinable())
+    {
+        sender_thread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(send_queue_mutex_);
+    if (0 < send_queue_stats_.enqueued_messages)
+    {
+        EPROSIMA_LOG_INFO(RTCP, "Send queue of " << locator_ << " stopped. Enqueued: "
+                << send_queue_stats_.enqueued_messages << ", dropped: " << send_queue_stats_.dropped_messages
+                << ", discarded: " << send_queue_.size() << ", max depth: " << send_queue_stats_.max_depth
+                << ", writes: " << send_queue_stats_.coalesced_writes);
+    }
+    send_queue_.clear();
+    send_queue_stats_.current_depth = 0;
+
+    // Allow the sender thread to be started again if the channel reconnects
+    stop_sender_ = false;
+}
+
+SendQueueStatistics TCPChannelResource::send_queue_statistics() const
+{
+    std::lock_guard<std::mutex> lock(send_queue_mutex_);
+    SendQueueStatistics statistics = send_queue_stats_;
+    statistics.remote_locator = locator_;
+    return statistics;
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
@@ -15,12 +15,19 @@
 #ifndef _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 #define _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 #include <asio.hpp>
+#include <fastdds/rtps/transport/SendQueueStatistics.hpp>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.hpp>
 #include <fastdds/rtps/transport/TransportReceiverInterface.hpp>
 #include <fastdds/rtps/common/Locator.hpp>
 #include <rtps/transport/ChannelResource.h>
 #include <rtps/transport/tcp/RTCPMessageManager.h>
+#include <utils/thread.hpp>
 
 
 namespace eprosima {
@@ -224,6 +231,9 @@ public:
         return tcp_connection_type_;
     }
 
+    //! Returns a snapshot of the statistics of the send queue of this connection
+    SendQueueStatistics send_queue_statistics() const;
+
 protected:
 
     // Constructor called when trying to connect to a remote server
@@ -279,6 +289,42 @@ protected:
             asio::basic_socket<asio::ip::tcp>& socket,
             const TCPTransportDescriptor* options);
 
+    /**
+     * Copies a message into the send queue, starting the sender thread if needed.
+     * Used by the implementations of send() when TCPTransportDescriptor::send_queue_size is not zero.
+     *
+     * @return Number of bytes queued, or zero if the message was discarded.
+     */
+    size_t enqueue_send(
+            const octet* header,
+            size_t header_size,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t queue_size);
+
+    /**
+     * Stops and joins the sender thread, discarding the messages not yet written.
+     * Must be called by the derived classes before their socket is destroyed.
+     */
+    void stop_send_queue();
+
+    //! Returns whether the sender thread of the send queue is running
+    bool send_queue_running() const
+    {
+        std::lock_guard<std::mutex> lock(send_queue_mutex_);
+        return sender_thread_.joinable();
+    }
+
+    /**
+     * Writes a batch of queued messages to the socket. Only called from the sender thread.
+     *
+     * @param buffers Messages to write, in order.
+     * @param ec Set to indicate what error occurred, if any.
+     */
+    virtual void write_queued(
+            const std::vector<asio::const_buffer>& buffers,
+            asio::error_code& ec) = 0;
+
     TCPConnectionType tcp_connection_type_;
 
     friend class TCPTransportInterface;
@@ -298,6 +344,24 @@ private:
 
     void set_all_ports_pending();
 
+    //! Body of the sender thread: writes the queued messages until stop_send_queue() is called
+    void send_queue_run();
+
+    /*
+     * Send queue, only used when TCPTransportDescriptor::send_queue_size is not zero.
+     * Each queued message is copied to its own buffer, which is recycled once written to the socket.
+     */
+    mutable std::mutex send_queue_mutex_;
+    //! Notifies the sender thread that there are messages to write, or that it should stop
+    std::condition_variable send_queue_cv_;
+    //! Notifies the callers waiting for room in the queue
+    std::condition_variable send_queue_space_cv_;
+    std::vector<std::vector<octet>> send_queue_;
+    std::vector<std::vector<octet>> free_send_buffers_;
+    bool stop_sender_ = false;
+    eprosima::thread sender_thread_;
+    SendQueueStatistics send_queue_stats_;
+
     TCPChannelResource(
             const TCPChannelResource&) = delete;
 
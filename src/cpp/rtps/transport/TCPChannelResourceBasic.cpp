@@ -52,6 +52,13 @@ TCPChannelResourceBasic::TCPChannelResourceBasic(
 
 TCPChannelResourceBasic::~TCPChannelResourceBasic()
 {
+    if (send_queue_running())
+    {
+        // Unblock a write the sender thread may be waiting on
+        asio::error_code ec;
+        socket_->shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+    }
+    stop_send_queue();
 }
 
 void TCPChannelResourceBasic::connect(
@@ -120,6 +127,9 @@ void TCPChannelResourceBasic::disconnect()
                     {
                     }
                 });
+
+        // The socket has been shut down, so the sender thread is not blocked on it anymore
+        stop_send_queue();
     }
 }
 
@@ -149,6 +159,12 @@ size_t TCPChannelResourceBasic::send(
 
     if (eConnecting < connection_status_)
     {
+        uint32_t queue_size = parent_->configuration()->send_queue_size;
+        if (0 < queue_size)
+        {
+            return enqueue_send(header, header_size, buffers, total_bytes, queue_size);
+        }
+
         std::lock_guard<std::mutex> send_guard(send_mutex_);
 
         if (parent_->configuration()->non_blocking_send &&
@@ -170,6 +186,14 @@ size_t TCPChannelResourceBasic::send(
     return bytes_sent;
 }
 
+void TCPChannelResourceBasic::write_queued(
+        const std::vector<asio::const_buffer>& buffers,
+        asio::error_code& ec)
+{
+    std::lock_guard<std::mutex> send_guard(send_mutex_);
+    asio::write(*socket_, buffers, ec);
+}
+
 asio::ip::tcp::endpoint TCPChannelResourceBasic::remote_endpoint() const
 {
     return socket_->remote_endpoint();
@@ -88,6 +88,12 @@ public:
         return socket_;
     }
 
+protected:
+
+    void write_queued(
+            const std::vector<asio::const_buffer>& buffers,
+            asio::error_code& ec) override;
+
 private:
 
     TCPChannelResourceBasic(
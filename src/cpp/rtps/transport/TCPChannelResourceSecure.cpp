@@ -62,6 +62,13 @@ TCPChannelResourceSecure::TCPChannelResourceSecure(
 
 TCPChannelResourceSecure::~TCPChannelResourceSecure()
 {
+    if (send_queue_running())
+    {
+        // Unblock a write the sender thread may be waiting on
+        asio::error_code ec;
+        secure_socket_->lowest_layer().shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+    }
+    stop_send_queue();
 }
 
 void TCPChannelResourceSecure::connect(
@@ -142,6 +149,13 @@ void TCPChannelResourceSecure::disconnect()
     {
         auto socket = secure_socket_;
 
+        if (send_queue_running())
+        {
+            // Unblock a write the sender thread may be waiting on, as the close below runs on the context threads
+            std::error_code ec;
+            socket->lowest_layer().shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+        }
+
         post(context_, [&, socket]()
                 {
                     std::error_code ec;
@@ -150,6 +164,8 @@ void TCPChannelResourceSecure::disconnect()
                     {
                     });
                 });
+
+        stop_send_queue();
     }
 }
 
@@ -207,6 +223,12 @@ size_t TCPChannelResourceSecure::send(
 
     if (eConnecting < connection_status_)
     {
+        uint32_t queue_size = parent_->configuration()->send_queue_size;
+        if (0 < queue_size)
+        {
+            return enqueue_send(header, header_size, buffers, total_bytes, queue_size);
+        }
+
         if (parent_->configuration()->non_blocking_send &&
                 !check_socket_send_buffer(header_size + total_bytes,
                 secure_socket_->lowest_layer().native_handle()))
@@ -253,6 +275,30 @@ size_t TCPChannelResourceSecure::send(
     return bytes_sent;
 }
 
+void TCPChannelResourceSecure::write_queued(
+        const std::vector<asio::const_buffer>& buffers,
+        asio::error_code& ec)
+{
+    // Writes are serialized with the rest of the operations on the TLS stream through the write strand
+    std::promise<void> write_promise;
+    auto write_future = write_promise.get_future();
+    auto socket = secure_socket_;
+
+    asio::post(strand_write_, [&, socket]()
+            {
+                if (socket->lowest_layer().is_open())
+                {
+                    asio::write(*socket, buffers, ec);
+                }
+                else
+                {
+                    ec = asio::error::not_connected;
+                }
+                write_promise.set_value();
+            });
+    write_future.wait();
+}
+
 asio::ip::tcp::endpoint TCPChannelResourceSecure::remote_endpoint() const
 {
     return secure_socket_->lowest_layer().remote_endpoint();
@@ -97,6 +97,12 @@ public:
         return secure_socket_;
     }
 
+protected:
+
+    void write_queued(
+            const std::vector<asio::const_buffer>& buffers,
+            asio::error_code& ec) override;
+
 private:
 
     TCPChannelResourceSecure(
@@ -94,6 +94,7 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , check_crc(true)
     , apply_security(false)
     , non_blocking_send(false)
+    , send_queue_size(0)
 {
 }
 
@@ -115,6 +116,7 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , keep_alive_thread(t.keep_alive_thread)
     , accept_thread(t.accept_thread)
     , non_blocking_send(t.non_blocking_send)
+    , send_queue_size(t.send_queue_size)
 {
 }
 
@@ -137,6 +139,7 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     keep_alive_thread = t.keep_alive_thread;
     accept_thread = t.accept_thread;
     non_blocking_send = t.non_blocking_send;
+    send_queue_size = t.send_queue_size;
     return *this;
 }
 
@@ -158,6 +161,7 @@ bool TCPTransportDescriptor::operator ==(
            this->keep_alive_thread == t.keep_alive_thread &&
            this->accept_thread == t.accept_thread &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->send_queue_size == t.send_queue_size &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -2057,6 +2061,37 @@ NetmaskFilterInfo TCPTransportInterface::netmask_filter_info() const
     return {netmask_filter_, allowed_interfaces_};
 }
 
+std::vector<SendQueueStatistics> TCPTransportInterface::send_queue_statistics() const
+{
+    std::vector<SendQueueStatistics> ret;
+    if (0 == configuration()->send_queue_size)
+    {
+        return ret;
+    }
+
+    std::vector<std::shared_ptr<TCPChannelResource>> channels;
+    {
+        std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
+        std::unique_lock<std::mutex> unbound_lock(unbound_map_mutex_);
+
+        channels = unbound_channel_resources_;
+        for (const auto& channel : channel_resources_)
+        {
+            // Several locators may share the same channel
+            if (std::find(channels.begin(), channels.end(), channel.second) == channels.end())
+            {
+                channels.push_back(channel.second);
+            }
+        }
+    }
+
+    for (const auto& channel : channels)
+    {
+        ret.push_back(channel->send_queue_statistics());
+    }
+    return ret;
+}
+
 void TCPTransportInterface::fill_local_physical_port(
         Locator& locator) const
 {
@@ -503,6 +503,8 @@ public:
 
     NetmaskFilterInfo netmask_filter_info() const override;
 
+    std::vector<SendQueueStatistics> send_queue_statistics() const override;
+
     /**
      * Method to fill local locator physical port.
      * @param locator locator to be filled.
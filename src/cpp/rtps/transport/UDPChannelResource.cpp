@@ -14,12 +14,19 @@
 
 #include <rtps/transport/UDPChannelResource.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
 #include <asio.hpp>
 
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/transport/TransportReceiverInterface.hpp>
 
 #include <rtps/messages/MessageReceiver.h>
 #include <rtps/transport/UDPTransportInterface.h>
+#include <rtps/transport/udp_offload.hpp>
 #include <utils/threading.hpp>
 
 namespace eprosima {
@@ -28,6 +35,11 @@ namespace rtps {
 
 using Log = fastdds::dds::Log;
 
+#if defined(__linux__)
+//! Maximum size of a buffer holding datagrams coalesced by the kernel
+static constexpr uint32_t max_coalesced_size = 65536;
+#endif // if defined(__linux__)
+
 UDPChannelResource::UDPChannelResource(
         UDPTransportInterface* transport,
         eProsimaUDPSocket& socket,
@@ -43,9 +55,19 @@ UDPChannelResource::UDPChannelResource(
     , interface_(sInterface)
     , transport_(transport)
 {
-    auto fn = [this, locator]()
+    uint32_t datagrams_per_batch = transport->configuration()->datagrams_per_batch;
+    bool receive_offload = transport->configuration()->generic_receive_offload;
+    auto fn = [this, locator, datagrams_per_batch, receive_offload]()
             {
-                perform_listen_operation(locator);
+                if (datagrams_per_batch > 1 || receive_offload)
+                {
+                    perform_batched_listen_operation(locator, std::max<uint32_t>(datagrams_per_batch, 1),
+                            receive_offload);
+                }
+                else
+                {
+                    perform_listen_operation(locator);
+                }
             };
     thread(create_thread(fn, thread_config, "dds.udp.%u", locator.port));
 }
@@ -86,6 +108,142 @@ void UDPChannelResource::perform_listen_operation(
     message_receiver(nullptr);
 }
 
+void UDPChannelResource::perform_batched_listen_operation(
+        Locator input_locator,
+        uint32_t datagrams_per_batch,
+        bool receive_offload)
+{
+#if defined(__linux__)
+    // Control buffer able to hold the segment size reported by UDP_GRO
+    union ControlBuffer
+    {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    };
+
+    // Ring of receive buffers, one per datagram in the batch.
+    // When the kernel coalesces datagrams, a single buffer may hold up to 64 KB.
+    const uint32_t buffer_size = receive_offload ?
+            std::max<uint32_t>(message_buffer().max_size, max_coalesced_size) : message_buffer().max_size;
+    std::vector<octet> buffers(static_cast<size_t>(datagrams_per_batch) * buffer_size);
+    std::vector<struct mmsghdr> headers(datagrams_per_batch);
+    std::vector<struct iovec> iovecs(datagrams_per_batch);
+    std::vector<struct sockaddr_storage> addresses(datagrams_per_batch);
+    std::vector<ControlBuffer> controls(receive_offload ? datagrams_per_batch : 0);
+    std::vector<ReceivedDatagram> datagrams;
+    datagrams.reserve(datagrams_per_batch);
+
+    while (alive())
+    {
+        for (uint32_t i = 0; i < datagrams_per_batch; ++i)
+        {
+            iovecs[i].iov_base = &buffers[static_cast<size_t>(i) * buffer_size];
+            iovecs[i].iov_len = buffer_size;
+            std::memset(&headers[i], 0, sizeof(struct mmsghdr));
+            headers[i].msg_hdr.msg_name = &addresses[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+            if (receive_offload)
+            {
+                headers[i].msg_hdr.msg_control = controls[i].buffer;
+                headers[i].msg_hdr.msg_controllen = sizeof(ControlBuffer);
+            }
+        }
+
+        // Blocking receive of at least one datagram. Already queued ones are returned without blocking.
+        int received = recvmmsg(socket()->native_handle(), headers.data(), datagrams_per_batch, MSG_WAITFORONE,
+                        nullptr);
+        if (received <= 0)
+        {
+            if (received < 0 && errno != EINTR && alive())
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "Error receiving data: " << std::strerror(errno)
+                                                                            << " (" << this << ")");
+            }
+            continue;
+        }
+
+        datagrams.clear();
+        for (int i = 0; i < received; ++i)
+        {
+            struct msghdr& header = headers[i].msg_hdr;
+            uint32_t size = static_cast<uint32_t>(headers[i].msg_len);
+            const octet* data = static_cast<const octet*>(iovecs[i].iov_base);
+
+            // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+            if (size == 0 || (size == 13 && memcmp(data, "EPRORTPSCLOSE", 13) == 0))
+            {
+                continue;
+            }
+
+            if (0 != (header.msg_flags & MSG_TRUNC))
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Received datagram truncated to " << size << " bytes");
+                continue;
+            }
+
+            asio::ip::udp::endpoint sender_endpoint;
+            size_t address_length = std::min<size_t>(header.msg_namelen, sender_endpoint.capacity());
+            std::memcpy(sender_endpoint.data(), &addresses[i], address_length);
+            sender_endpoint.resize(address_length);
+
+            ReceivedDatagram datagram;
+            transport_->endpoint_to_locator(sender_endpoint, datagram.remote_locator);
+
+            // Coalesced datagrams are split back into their original segments
+            uint32_t segment_size = size;
+            if (receive_offload)
+            {
+                for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); nullptr != cmsg;
+                        cmsg = CMSG_NXTHDR(&header, cmsg))
+                {
+                    if (SOL_UDP == cmsg->cmsg_level && UDP_GRO == cmsg->cmsg_type)
+                    {
+                        int gro_size = 0;
+                        std::memcpy(&gro_size, CMSG_DATA(cmsg), sizeof(gro_size));
+                        if (gro_size > 0)
+                        {
+                            segment_size = static_cast<uint32_t>(gro_size);
+                        }
+                    }
+                }
+            }
+
+            for (uint32_t offset = 0; offset < size; offset += segment_size)
+            {
+                datagram.data = data + offset;
+                datagram.size = std::min(segment_size, size - offset);
+                datagrams.push_back(datagram);
+            }
+        }
+
+        if (datagrams.empty())
+        {
+            continue;
+        }
+
+        // Processes the data through the CDR Message interface.
+        if (message_receiver() != nullptr)
+        {
+            message_receiver()->OnDataBatchReceived(datagrams.data(), static_cast<uint32_t>(datagrams.size()),
+                    input_locator);
+        }
+        else if (alive())
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Received Message, but no receiver attached");
+        }
+    }
+
+    message_receiver(nullptr);
+#else
+    // Batched reception and receive offload are only available on Linux
+    static_cast<void>(datagrams_per_batch);
+    static_cast<void>(receive_offload);
+    perform_listen_operation(input_locator);
+#endif // if defined(__linux__)
+}
+
 bool UDPChannelResource::Receive(
         octet* receive_buffer,
         uint32_t receive_buffer_capacity,
@@ -227,6 +227,19 @@ protected:
     void perform_listen_operation(
             Locator input_locator);
 
+    /**
+     * Function to be called from a new thread, which takes cares of performing blocking receive operations
+     * of several datagrams at once on the ReceiveResource.
+     * Received datagrams are delivered to the receiver in a single call.
+     * @param input_locator - Locator that triggered the creation of the resource
+     * @param datagrams_per_batch - Maximum number of datagrams to receive on each operation
+     * @param receive_offload - Whether the socket may return several datagrams coalesced by the kernel (UDP_GRO)
+     */
+    void perform_batched_listen_operation(
+            Locator input_locator,
+            uint32_t datagrams_per_batch,
+            bool receive_offload);
+
     /**
      * Blocking Receive from the specified channel.
      * @param receive_buffer vector with enough capacity (not size) to accomodate a full receive buffer. That
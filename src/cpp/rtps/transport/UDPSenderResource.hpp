@@ -57,6 +57,24 @@ public:
                                    destination_locators_end, only_multicast_purpose_, whitelisted_,
                                    max_blocking_time_point);
                 };
+
+#if defined(__linux__)
+        if (transport.configuration()->generic_segmentation_offload)
+        {
+            send_segments_lambda_ = [this, &transport](
+                const std::vector<NetworkBuffer>& buffers,
+                uint32_t total_bytes,
+                uint32_t segment_size,
+                LocatorsIterator* destination_locators_begin,
+                LocatorsIterator* destination_locators_end,
+                const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
+                    {
+                        return transport.send_segments(buffers, total_bytes, segment_size, socket_,
+                                       destination_locators_begin, destination_locators_end, only_multicast_purpose_,
+                                       whitelisted_, max_blocking_time_point);
+                    };
+        }
+#endif // if defined(__linux__)
     }
 
     virtual ~UDPSenderResource()
@@ -15,17 +15,27 @@
 #include <rtps/transport/UDPTransportInterface.h>
 
 #include <algorithm>
+#include <cerrno>
 #include <chrono>
 #include <cstring>
 #include <limits>
+#include <set>
 #include <utility>
 
+#if defined(__linux__)
+#include <fstream>
+#include <sstream>
+
+#include <sys/stat.h>
+#endif // if defined(__linux__)
+
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/transport/TransportInterface.hpp>
 #include <fastdds/utils/IPLocator.hpp>
 #include <rtps/messages/CDRMessage.hpp>
 #include <rtps/transport/asio_helpers.hpp>
 #include <rtps/transport/UDPSenderResource.hpp>
+#include <rtps/transport/udp_offload.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 
 using namespace std;
@@ -37,6 +47,100 @@ namespace rtps {
 
 using Log = fastdds::dds::Log;
 
+#if defined(__linux__)
+//! Maximum number of datagrams sent on each sendmmsg call
+static constexpr size_t s_max_datagrams_per_send = 32;
+//! Maximum number of buffers of a datagram sent with sendmmsg
+static constexpr size_t s_max_buffers_per_batched_datagram = 16;
+//! Maximum size of a train of datagrams sent with UDP_SEGMENT, leaving room for the IP and UDP headers
+static constexpr uint32_t s_max_segmented_train_size = 65000;
+//! Maximum number of buffers of a train of datagrams sent with UDP_SEGMENT (UIO_MAXIOV)
+static constexpr size_t s_max_buffers_per_segmented_train = 1024;
+
+/**
+ * Check, on the kernel table of UDP sockets, that no socket other than the given ones is bound to a port and address
+ * overlapping theirs.
+ * @param native_handles Sockets of a SO_REUSEPORT group.
+ * @param is_ipv6 Whether the sockets are IPv6 ones.
+ * @return false when a foreign socket joined the group, true otherwise, also when the table cannot be read.
+ */
+static bool is_reuse_port_group_exclusive(
+        const std::vector<int>& native_handles,
+        bool is_ipv6)
+{
+    std::set<unsigned long> own_inodes;
+    for (int fd : native_handles)
+    {
+        struct stat info;
+        if (0 == fstat(fd, &info))
+        {
+            own_inodes.insert(static_cast<unsigned long>(info.st_ino));
+        }
+    }
+
+    std::ifstream table(is_ipv6 ? "/proc/net/udp6" : "/proc/net/udp");
+    if (!table.is_open())
+    {
+        return true;
+    }
+
+    // Each entry is "sl local_address rem_address st tx_queue:rx_queue tr:tm->when retrnsmt uid timeout inode ...",
+    // with the addresses as HEXADDRESS:HEXPORT.
+    struct Entry
+    {
+        std::string address;
+        unsigned long port;
+        unsigned long inode;
+    };
+    std::vector<Entry> foreign_entries;
+    std::set<std::pair<std::string, unsigned long>> own_bindings;
+    std::string line;
+    std::getline(table, line);
+    while (std::getline(table, line))
+    {
+        std::istringstream fields(line);
+        std::string slot, local_address, remote_address, state, queues, timer, retransmits, uid, timeout;
+        unsigned long inode = 0;
+        if (!(fields >> slot >> local_address >> remote_address >> state >> queues >> timer >> retransmits >> uid
+                >> timeout >> inode))
+        {
+            continue;
+        }
+
+        std::string::size_type separator = local_address.rfind(':');
+        if (std::string::npos == separator)
+        {
+            continue;
+        }
+        Entry entry{local_address.substr(0, separator),
+                    std::strtoul(local_address.c_str() + separator + 1, nullptr, 16), inode};
+        if (own_inodes.count(inode) > 0)
+        {
+            own_bindings.emplace(entry.address, entry.port);
+        }
+        else
+        {
+            foreign_entries.push_back(std::move(entry));
+        }
+    }
+
+    const std::string any_address(is_ipv6 ? 32 : 8, '0');
+    for (const Entry& entry : foreign_entries)
+    {
+        for (const auto& binding : own_bindings)
+        {
+            if (entry.port == binding.second &&
+                    (entry.address == binding.first || entry.address == any_address || binding.first == any_address))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+#endif // if defined(__linux__)
+
 UDPTransportDescriptor::UDPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , m_output_udp_socket(0)
@@ -48,6 +152,10 @@ bool UDPTransportDescriptor::operator ==(
 {
     return (this->m_output_udp_socket == t.m_output_udp_socket &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->datagrams_per_batch == t.datagrams_per_batch &&
+           this->generic_receive_offload == t.generic_receive_offload &&
+           this->generic_segmentation_offload == t.generic_segmentation_offload &&
+           this->unicast_receive_threads == t.unicast_receive_threads &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -195,6 +303,21 @@ bool UDPTransportInterface::IsInputChannelOpen(
                locator)) != mInputSockets.end());
 }
 
+uint32_t UDPTransportInterface::max_concurrent_receptions(
+        const Locator& locator) const
+{
+    return IPLocator::isMulticast(locator) ? 1u : sockets_per_unicast_port();
+}
+
+uint32_t UDPTransportInterface::sockets_per_unicast_port() const
+{
+#if defined(__linux__)
+    return (std::max)(configuration()->unicast_receive_threads, 1u);
+#else
+    return 1u;
+#endif // if defined(__linux__)
+}
+
 bool UDPTransportInterface::IsLocatorSupported(
         const Locator& locator) const
 {
@@ -207,28 +330,79 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
         bool is_multicast,
         uint32_t maxMsgSize)
 {
-    std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
-
-    try
+    std::vector<UDPChannelResource*> channel_resources;
     {
-        std::vector<std::string> vInterfaces = get_binding_interfaces_list();
-        for (std::string sInterface : vInterfaces)
+        std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
+
+        uint16_t port = IPLocator::getPhysicalPort(locator);
+        try
         {
-            UDPChannelResource* p_channel_resource;
-            p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize, receiver);
-            mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            uint32_t num_sockets = is_multicast ? 1u : sockets_per_unicast_port();
+            bool reuse_port = num_sockets > 1u;
+            std::vector<std::string> vInterfaces = get_binding_interfaces_list();
+            for (std::string sInterface : vInterfaces)
+            {
+                if (reuse_port)
+                {
+                    // Bind the port exclusively first, so it fails as usual when the port is already in use.
+                    // The probe cannot be kept open while the group is bound, as SO_REUSEPORT sockets cannot bind
+                    // a port held by an exclusive socket, so a participant opening the same port at the same time
+                    // may also pass its probe. That is detected once the group is bound.
+                    eProsimaUDPSocket probe_socket = OpenAndBindInputSocket(sInterface, port, false, false);
+                    getSocketPtr(probe_socket)->close();
+                }
+
+                for (uint32_t i = 0; i < num_sockets; ++i)
+                {
+                    UDPChannelResource* p_channel_resource;
+                    p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize,
+                                    receiver, reuse_port);
+                    mInputSockets[port].push_back(p_channel_resource);
+                }
+            }
+
+#if defined(__linux__)
+            if (reuse_port)
+            {
+                // Another participant sharing the group would get part of the traffic, so both give up the port.
+                std::vector<int> native_handles;
+                for (UDPChannelResource* channel : mInputSockets[port])
+                {
+                    native_handles.push_back(channel->socket()->native_handle());
+                }
+                if (!is_reuse_port_group_exclusive(native_handles, LOCATOR_KIND_UDPv6 == transport_kind_))
+                {
+                    throw asio::system_error(asio::error::make_error_code(asio::error::address_in_use));
+                }
+            }
+#endif // if defined(__linux__)
+
+            return true;
+        }
+        catch (asio::system_error const& e)
+        {
+            (void)e;
+            EPROSIMA_LOG_INFO(TRANSPORT_UDP, "UDPTransport Error binding at port: ("
+                    << port << ")" << " with msg: " << e.what());
+            auto it = mInputSockets.find(port);
+            if (it != mInputSockets.end())
+            {
+                channel_resources = std::move(it->second);
+                mInputSockets.erase(it);
+            }
         }
     }
-    catch (asio::system_error const& e)
+
+    // Release the channels already created for the port
+    for (UDPChannelResource* channel : channel_resources)
     {
-        (void)e;
-        EPROSIMA_LOG_INFO(TRANSPORT_UDP, "UDPTransport Error binding at port: ("
-                << IPLocator::getPhysicalPort(locator) << ")" << " with msg: " << e.what());
-        mInputSockets.erase(IPLocator::getPhysicalPort(locator));
-        return false;
+        channel->disable();
+        channel->release();
+        channel->clear();
+        delete channel;
     }
 
-    return true;
+    return false;
 }
 
 UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
@@ -236,10 +410,23 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
         const Locator& locator,
         bool is_multicast,
         uint32_t maxMsgSize,
-        TransportReceiverInterface* receiver)
+        TransportReceiverInterface* receiver,
+        bool reuse_port)
 {
     eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
-                    IPLocator::getPhysicalPort(locator), is_multicast);
+                    IPLocator::getPhysicalPort(locator), is_multicast, reuse_port);
+#if defined(__linux__)
+    if (configuration()->generic_receive_offload)
+    {
+        int enable = 1;
+        if (0 != setsockopt(getSocketPtr(unicastSocket)->native_handle(), SOL_UDP, UDP_GRO, &enable,
+                sizeof(enable)))
+        {
+            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "UDP_GRO could not be enabled on port "
+                    << IPLocator::getPhysicalPort(locator) << ": " << std::strerror(errno));
+        }
+    }
+#endif // if defined(__linux__)
     UDPChannelResource* p_channel_resource = new UDPChannelResource(this, unicastSocket, maxMsgSize, locator,
                     sInterface, receiver, configuration()->get_thread_config_for_port(locator.port));
     return p_channel_resource;
@@ -515,6 +702,15 @@ bool UDPTransportInterface::send(
     auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
         max_blocking_time_point - std::chrono::steady_clock::now());
 
+#if defined(__linux__)
+    if (configuration()->datagrams_per_batch > 1 && !buffers.empty() &&
+            buffers.size() <= s_max_buffers_per_batched_datagram)
+    {
+        return send_batch(buffers, total_bytes, socket, it, *destination_locators_end,
+                       only_multicast_purpose, whitelisted, time_out);
+    }
+#endif // if defined(__linux__)
+
     while (it != *destination_locators_end)
     {
         if (IsLocatorSupported(*it))
@@ -614,6 +810,308 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+#if defined(__linux__)
+bool UDPTransportInterface::send_batch(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        LocatorsIterator& destination_locators_begin,
+        LocatorsIterator& destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout)
+{
+    using namespace eprosima::fastdds::statistics::rtps;
+
+    const size_t max_datagrams =
+            std::min<size_t>(configuration()->datagrams_per_batch, s_max_datagrams_per_send);
+    const size_t num_buffers = buffers.size();
+    const bool fits_in_send_buffer = total_bytes <= configuration()->sendBufferSize;
+    const int fd = getSocketPtr(socket)->native_handle();
+
+    struct mmsghdr headers[s_max_datagrams_per_send];
+    struct sockaddr_storage addresses[s_max_datagrams_per_send];
+    struct iovec iovecs[s_max_datagrams_per_send * s_max_buffers_per_batched_datagram];
+#ifdef FASTDDS_STATISTICS
+    // Each destination carries its own statistics submessage
+    octet statistics_submessages[s_max_datagrams_per_send][statistics_submessage_length];
+#endif // ifdef FASTDDS_STATISTICS
+
+    struct timeval timeStruct;
+    timeStruct.tv_sec = 0;
+    timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+
+    bool ret = true;
+    size_t pending = 0;
+
+    auto flush = [&]()
+            {
+                size_t sent = 0;
+                while (sent < pending)
+                {
+                    int result = sendmmsg(fd, &headers[sent], static_cast<unsigned int>(pending - sent), 0);
+                    if (result < 0)
+                    {
+                        if (EINTR == errno)
+                        {
+                            continue;
+                        }
+
+                        if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+                        {
+                            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "UDP send would have blocked. Packet is dropped.");
+                        }
+                        else
+                        {
+                            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, std::strerror(errno));
+                            ret = false;
+                        }
+
+                        // Skip the destination that failed, and continue with the rest
+                        ++sent;
+                        continue;
+                    }
+
+                    for (int i = 0; i < result; ++i)
+                    {
+                        if (headers[sent + i].msg_len != total_bytes)
+                        {
+                            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "sendmmsg wasn't able to send all bytes");
+                        }
+                    }
+                    sent += static_cast<size_t>(result);
+                }
+
+                EPROSIMA_LOG_INFO(TRANSPORT_UDP,
+                        "UDPTransport: " << total_bytes << " bytes TO " << pending << " endpoints");
+                pending = 0;
+            };
+
+    for (LocatorsIterator& it = destination_locators_begin; it != destination_locators_end; ++it)
+    {
+        const Locator& remote_locator = *it;
+
+        if (!IsLocatorSupported(remote_locator))
+        {
+            continue;
+        }
+
+        bool is_multicast_remote_address = IPLocator::isMulticast(remote_locator);
+        if (!fits_in_send_buffer || (is_multicast_remote_address != only_multicast_purpose && !whitelisted))
+        {
+            ret = false;
+            continue;
+        }
+
+        if (!is_multicast_remote_address && socket.should_filter(remote_locator))
+        {
+            // Filter unicast remote locators according to socket conditions (e.g. netmask filtering)
+            continue;
+        }
+
+        auto destinationEndpoint = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
+        std::memcpy(&addresses[pending], destinationEndpoint.data(), destinationEndpoint.size());
+
+        struct iovec* datagram_iovecs = &iovecs[pending * s_max_buffers_per_batched_datagram];
+        for (size_t i = 0; i < num_buffers; ++i)
+        {
+            datagram_iovecs[i].iov_base = const_cast<void*>(buffers[i].buffer);
+            datagram_iovecs[i].iov_len = buffers[i].size;
+        }
+
+#ifdef FASTDDS_STATISTICS
+        // Statistics submessage is always the last buffer to be added
+        statistics_info_.set_statistics_message_data(remote_locator, buffers.back(), total_bytes);
+        if (is_statistics_buffer(buffers.back()))
+        {
+            std::memcpy(statistics_submessages[pending], buffers.back().buffer, statistics_submessage_length);
+            datagram_iovecs[num_buffers - 1].iov_base = statistics_submessages[pending];
+        }
+#endif // ifdef FASTDDS_STATISTICS
+
+        std::memset(&headers[pending], 0, sizeof(struct mmsghdr));
+        headers[pending].msg_hdr.msg_name = &addresses[pending];
+        headers[pending].msg_hdr.msg_namelen = static_cast<socklen_t>(destinationEndpoint.size());
+        headers[pending].msg_hdr.msg_iov = datagram_iovecs;
+        headers[pending].msg_hdr.msg_iovlen = num_buffers;
+
+        if (++pending == max_datagrams)
+        {
+            flush();
+        }
+    }
+
+    if (pending > 0)
+    {
+        flush();
+    }
+
+    return ret;
+}
+
+bool UDPTransportInterface::send_segments(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        uint32_t segment_size,
+        eProsimaUDPSocket& socket,
+        fastdds::rtps::LocatorsIterator* destination_locators_begin,
+        fastdds::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    fastdds::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+
+    auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
+        max_blocking_time_point - std::chrono::steady_clock::now());
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            ret &= send_segments(buffers,
+                            total_bytes,
+                            segment_size,
+                            socket,
+                            *it,
+                            only_multicast_purpose,
+                            whitelisted,
+                            time_out);
+        }
+
+        ++it;
+    }
+
+    return ret;
+}
+
+bool UDPTransportInterface::send_segments(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        uint32_t segment_size,
+        eProsimaUDPSocket& socket,
+        const Locator& remote_locator,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout)
+{
+    auto send_one_by_one = [&]()
+            {
+                return for_each_segment(buffers, segment_size,
+                               [&](const std::vector<NetworkBuffer>& segment, uint32_t segment_bytes)
+                               {
+                                   return send(segment, segment_bytes, socket, remote_locator,
+                                   only_multicast_purpose, whitelisted, timeout);
+                               });
+            };
+
+    if (!segmentation_offload_supported_ || segment_size > configuration()->sendBufferSize ||
+            total_bytes > s_max_segmented_train_size || buffers.size() > s_max_buffers_per_segmented_train)
+    {
+        return send_one_by_one();
+    }
+
+    bool is_multicast_remote_address = IPLocator::isMulticast(remote_locator);
+
+    if (is_multicast_remote_address != only_multicast_purpose && !whitelisted)
+    {
+        return false;
+    }
+
+    if (!is_multicast_remote_address && socket.should_filter(remote_locator))
+    {
+        // Filter unicast remote locators according to socket conditions (e.g. netmask filtering)
+        return true;
+    }
+
+    auto destinationEndpoint = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
+    const int fd = getSocketPtr(socket)->native_handle();
+
+    struct timeval timeStruct;
+    timeStruct.tv_sec = 0;
+    timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+
+    std::vector<struct iovec> iovecs(buffers.size());
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        iovecs[i].iov_base = const_cast<void*>(buffers[i].buffer);
+        iovecs[i].iov_len = buffers[i].size;
+    }
+
+    // Statistics submessage is always the last buffer of each datagram
+    for_each_segment(buffers, segment_size,
+            [&](const std::vector<NetworkBuffer>& segment, uint32_t segment_bytes)
+            {
+                statistics_info_.set_statistics_message_data(remote_locator, segment.back(), segment_bytes);
+                return true;
+            });
+
+    uint16_t gso_size = static_cast<uint16_t>(segment_size);
+    alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(gso_size))];
+    std::memset(control, 0, sizeof(control));
+
+    struct msghdr header;
+    std::memset(&header, 0, sizeof(header));
+    header.msg_name = const_cast<void*>(static_cast<const void*>(destinationEndpoint.data()));
+    header.msg_namelen = static_cast<socklen_t>(destinationEndpoint.size());
+    header.msg_iov = iovecs.data();
+    header.msg_iovlen = iovecs.size();
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header);
+    cmsg->cmsg_level = SOL_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(gso_size));
+    std::memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+    ssize_t result = 0;
+    do
+    {
+        result = sendmsg(fd, &header, 0);
+    } while (result < 0 && EINTR == errno);
+
+    if (result < 0)
+    {
+        if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+        {
+            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "UDP send would have blocked. Packet is dropped.");
+            return true;
+        }
+
+        if ((ENOPROTOOPT == errno) || (EOPNOTSUPP == errno))
+        {
+            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "UDP_SEGMENT not supported. Datagrams will be sent one by one.");
+            segmentation_offload_supported_ = false;
+        }
+        else if ((EINVAL != errno) && (EIO != errno))
+        {
+            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, std::strerror(errno));
+            return false;
+        }
+
+        // The train could not be segmented on this route (e.g. the datagrams exceed its MTU, or the device cannot
+        // checksum them), so the datagrams are sent one by one
+        return send_one_by_one();
+    }
+
+    if (static_cast<uint32_t>(result) != total_bytes)
+    {
+        EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "sendmsg wasn't able to send all bytes");
+    }
+
+    EPROSIMA_LOG_INFO(TRANSPORT_UDP,
+            "UDPTransport: " << total_bytes << " bytes in segments of " << segment_size << " TO endpoint: " <<
+            destinationEndpoint << " FROM " << getSocketPtr(socket)->local_endpoint());
+    return true;
+}
+
+#endif // if defined(__linux__)
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -147,6 +147,38 @@ public:
             bool whitelisted,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+#if defined(__linux__)
+    /**
+     * Blocking Send of a train of equal-size datagrams through the specified channel, letting the kernel split it
+     * (UDP generic segmentation offload). The datagrams are sent one by one when the kernel cannot do it.
+     *
+     * @param buffers Vector of buffers of all the datagrams. Each datagram ends at the end of a buffer.
+     * @param total_bytes Total amount of bytes of the train.
+     * @param segment_size Size of each datagram, except the last one, which may be smaller.
+     * It must not exceed the send_buffer_size fed to this class during construction.
+     * @param socket channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param only_multicast_purpose multicast network interface
+     * @param whitelisted network interface included in the user whitelist
+     * @param max_blocking_time_point maximum blocking time.
+     *
+     * @pre Open the output channel of each remote locator by invoking \ref OpenOutputChannel function.
+     */
+    virtual bool send_segments(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            eProsimaUDPSocket& socket,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+#endif // if defined(__linux__)
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -186,6 +218,13 @@ public:
         return configuration()->maxMessageSize;
     }
 
+    /**
+     * Unicast input channels are served by unicast_receive_threads sockets sharing the port, each one with its
+     * own reception thread. Multicast input channels have a single reception thread per socket.
+     */
+    uint32_t max_concurrent_receptions(
+            const Locator& locator) const override;
+
     void update_network_interfaces() override;
 
     bool is_localhost_allowed() const override;
@@ -271,11 +310,16 @@ protected:
             const Locator& locator,
             bool is_multicast,
             uint32_t maxMsgSize,
-            TransportReceiverInterface* receiver);
+            TransportReceiverInterface* receiver,
+            bool reuse_port = false);
     virtual eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
             uint16_t port,
-            bool is_multicast) = 0;
+            bool is_multicast,
+            bool reuse_port) = 0;
+
+    //! Number of sockets to open on each unicast input port, taking into account platform support.
+    uint32_t sockets_per_unicast_port() const;
     eProsimaUDPSocket OpenAndBindUnicastOutputSocket(
             const asio::ip::udp::endpoint& endpoint,
             uint16_t& port);
@@ -304,6 +348,43 @@ protected:
             bool whitelisted,
             const std::chrono::microseconds& timeout);
 
+#if defined(__linux__)
+    /**
+     * Send a Vector of buffers to several destinations, using a single system call for up to
+     * @c datagrams_per_batch destinations.
+     *
+     * @param destination_locators_begin destination locators iterator begin, it is advanced inside this function.
+     * @param destination_locators_end destination locators iterator end.
+     *
+     * @return true when the buffers were sent (or dropped because the socket would block) to all the
+     * destinations, false otherwise.
+     */
+    bool send_batch(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            LocatorsIterator& destination_locators_begin,
+            LocatorsIterator& destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout);
+
+    /**
+     * Send a train of equal-size datagrams to a destination, using a single system call with UDP_SEGMENT.
+     *
+     * @return true when the datagrams were sent (or dropped because the socket would block), false otherwise.
+     */
+    bool send_segments(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            uint32_t segment_size,
+            eProsimaUDPSocket& socket,
+            const Locator& remote_locator,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout);
+#endif // if defined(__linux__)
+
     /**
      * @brief Return list of not yet open network interfaces
      *
@@ -318,6 +399,9 @@ protected:
 
     std::atomic_bool rescan_interfaces_ = {true};
 
+    //! Cleared when the kernel does not support UDP_SEGMENT, so the datagrams of a train are always sent one by one
+    std::atomic_bool segmentation_offload_supported_ = {true};
+
 };
 
 } // namespace rtps
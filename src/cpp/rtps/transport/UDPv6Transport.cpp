@@ -389,7 +389,8 @@ const std::string& UDPv6Transport::localhost_name()
 eProsimaUDPSocket UDPv6Transport::OpenAndBindInputSocket(
         const std::string& sIp,
         uint16_t port,
-        bool is_multicast)
+        bool is_multicast,
+        bool reuse_port)
 {
     eProsimaUDPSocket socket = createUDPSocket(io_context_);
     getSocketPtr(socket)->open(generate_protocol());
@@ -425,6 +426,16 @@ eProsimaUDPSocket UDPv6Transport::OpenAndBindInputSocket(
         getSocketPtr(socket)->set_option(asio::detail::socket_option::integer<
                     ASIO_OS_DEF(SOL_SOCKET), SO_EXCLUSIVEADDRUSE>(1));
 #endif // if defined(_WIN32)
+#if defined(__linux__)
+        if (reuse_port)
+        {
+            // Several sockets share the port, and the kernel spreads the datagrams among them
+            getSocketPtr(socket)->set_option(asio::detail::socket_option::boolean<
+                        ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+        }
+#else
+        static_cast<void>(reuse_port);
+#endif // if defined(__linux__)
     }
 
     getSocketPtr(socket)->bind(generate_endpoint(sIp, port));
@@ -16,6 +16,7 @@
 #define _FASTDDS_SHAREDMEM_MPC_RINGBUFFER_
 
 #include <atomic>
+#include <cassert>
 #include <memory>
 #include <cstdlib>
 
@@ -136,6 +137,62 @@ public:
             return (counter == 1);
         }
 
+        /**
+         * Pops, in a single pass, all the cells available to the listener, up to max_count.
+         * The free cells of the buffer are incremented once for all the cells freed.
+         * @param [out] data array where the data of the popped cells is copied.
+         * @param [out] was_cell_freed array where, for each popped cell, it is stored whether its ref_counter
+         * reached 0 after the pop.
+         * @param max_count maximum number of cells to pop, and size of the output arrays.
+         * @return the number of cells popped, 0 if the buffer is empty.
+         */
+        uint32_t pop(
+                T* data,
+                bool* was_cell_freed,
+                uint32_t max_count)
+        {
+            auto pointer = buffer_.node_->pointer_.load(std::memory_order_relaxed);
+
+            uint32_t popped = 0;
+            uint32_t freed_cells = 0;
+            while (popped < max_count && read_p_ != pointer.ptr.write_p)
+            {
+                auto& cell = buffer_.cells_[get_pointer_value(read_p_)];
+
+                // The cell could be reserved by a producer that has not finished writing it yet
+                if (cell.ref_counter_.load(std::memory_order_acquire) == 0)
+                {
+                    break;
+                }
+
+                // The data has to be copied before releasing the cell
+                data[popped] = cell.data();
+                auto counter = cell.ref_counter_.fetch_sub(1);
+                assert(counter > 0);
+
+                was_cell_freed[popped] = (counter == 1);
+                if (counter == 1)
+                {
+                    ++freed_cells;
+                }
+
+                read_p_ = buffer_.inc_pointer(read_p_);
+                ++popped;
+            }
+
+            if (freed_cells > 0)
+            {
+                while (!buffer_.node_->pointer_.compare_exchange_weak(pointer,
+                        { { pointer.ptr.write_p, pointer.ptr.free_cells + freed_cells } },
+                        std::memory_order_release,
+                        std::memory_order_relaxed))
+                {
+                }
+            }
+
+            return popped;
+        }
+
     private:
 
         MultiProducerConsumerRingBuffer<T>& buffer_;
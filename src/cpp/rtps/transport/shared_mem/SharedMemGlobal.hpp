@@ -112,10 +112,19 @@ public:
         uint32_t max_buffer_descriptors;
         uint32_t waiting_count;
 
-        uint32_t is_port_ok : 1;
-        uint32_t is_opened_read_exclusive : 1;
-        uint32_t is_opened_for_reading : 1;
-        uint32_t pad : 29;
+        // Status flags of the port. Some of them are written without holding empty_cv_mutex, so the whole word is
+        // always updated atomically. Bit positions match the bit-fields used by previous versions.
+        std::atomic<uint32_t> status_flags;
+
+        static constexpr uint32_t PORT_OK_FLAG = 1u << 0;
+        static constexpr uint32_t OPENED_READ_EXCLUSIVE_FLAG = 1u << 1;
+        static constexpr uint32_t OPENED_FOR_READING_FLAG = 1u << 2;
+        // Set if the waiting listeners have been notified and none of them has gone back to sleep since then
+        static constexpr uint32_t NOTIFICATION_PENDING_FLAG = 1u << 3;
+        // Number of waiting listeners that clear NOTIFICATION_PENDING_FLAG before sleeping.
+        // Listeners from versions not using NOTIFICATION_PENDING_FLAG are notified on every push.
+        static constexpr uint32_t COALESCING_WAITING_COUNT_SHIFT = 4;
+        static constexpr uint32_t COALESCING_WAITING_COUNT_MASK = 0x7FFu << COALESCING_WAITING_COUNT_SHIFT;
 
         UUID<8> uuid;
 
@@ -160,6 +169,31 @@ public:
         ListenerStatus listeners_status[LISTENERS_STATUS_SIZE];
 
         char domain_name[MAX_DOMAIN_NAME_LENGTH + 1];
+
+        inline bool has_flag(
+                uint32_t flag) const
+        {
+            return 0 != (status_flags.load() & flag);
+        }
+
+        inline void set_flag(
+                uint32_t flag,
+                bool value)
+        {
+            if (value)
+            {
+                status_flags.fetch_or(flag);
+            }
+            else
+            {
+                status_flags.fetch_and(~flag);
+            }
+        }
+
+        inline uint32_t coalescing_waiting_count() const
+        {
+            return (status_flags.load() & COALESCING_WAITING_COUNT_MASK) >> COALESCING_WAITING_COUNT_SHIFT;
+        }
     };
 
     /**
@@ -184,18 +218,46 @@ public:
         std::unique_ptr<RobustExclusiveLock> read_exclusive_lock_;
         std::unique_ptr<RobustSharedLock> read_shared_lock_;
 
-        inline void notify_unicast(
+        /**
+         * Decides whether the waiting listeners have to be notified after a push.
+         * Listeners are notified once, and not again until one of them goes back to sleep.
+         * @pre empty_cv_mutex is locked
+         * @param [in] was_buffer_empty_before_push whether the buffer was empty before the push
+         * @return true if the listeners have to be notified
+         */
+        inline bool needs_notification(
                 bool was_buffer_empty_before_push)
         {
-            if (was_buffer_empty_before_push)
+            bool are_legacy_listeners_waiting = node_->waiting_count > node_->coalescing_waiting_count();
+            bool are_listeners_sleeping = node_->coalescing_waiting_count() > 0 &&
+                    !node_->has_flag(PortNode::NOTIFICATION_PENDING_FLAG);
+
+            if (!are_legacy_listeners_waiting && !are_listeners_sleeping)
             {
-                node_->empty_cv.notify_one();
+                return false;
+            }
+
+            // The only listener of a unicast port cannot be sleeping if the buffer was not empty
+            if (node_->has_flag(PortNode::OPENED_READ_EXCLUSIVE_FLAG) && !was_buffer_empty_before_push)
+            {
+                return false;
             }
+
+            node_->set_flag(PortNode::NOTIFICATION_PENDING_FLAG, true);
+            return true;
         }
 
-        inline void notify_multicast()
+        inline void notify(
+                bool was_opened_as_unicast_port)
         {
-            node_->empty_cv.notify_all();
+            if (was_opened_as_unicast_port)
+            {
+                node_->empty_cv.notify_one();
+            }
+            else
+            {
+                node_->empty_cv.notify_all();
+            }
         }
 
         /**
@@ -359,7 +421,7 @@ public:
                             {
                                 if (!update_status_all_listeners(*(*port_it)))
                                 {
-                                    (*port_it)->node->is_port_ok = false;
+                                    (*port_it)->node->set_flag(PortNode::PORT_OK_FLAG, false);
                                 }
                             }
 
@@ -367,7 +429,7 @@ public:
                         }
                         catch (std::exception& e)
                         {
-                            (*port_it)->node->is_port_ok = false;
+                            (*port_it)->node->set_flag(PortNode::PORT_OK_FLAG, false);
 
                             EPROSIMA_LOG_WARNING(RTPS_TRANSPORT_SHM, "Port " << (*port_it)->node->port_id
                                                                              << ": " << e.what());
@@ -482,7 +544,7 @@ public:
                 {
                     // This check avoid locking port_mutex when the port is not OK, also avoid
                     // recursive lock of port_mutex in create_port()
-                    if (node_->is_port_ok)
+                    if (node_->has_flag(PortNode::PORT_OK_FLAG))
                     {
                         deleted_unique_ptr<SharedMemSegment::named_mutex> port_mutex =
                                 SharedMemSegment::try_open_and_lock_named_mutex(segment_name + "_mutex");
@@ -493,7 +555,7 @@ public:
                         if (node_->ref_counter.load(std::memory_order_relaxed) == 0
                                 && is_port_ok())
                         {
-                            node_->is_port_ok = false;
+                            node_->set_flag(PortNode::PORT_OK_FLAG, false);
                             node_ = nullptr;
                             port_segment_.reset();
 
@@ -506,7 +568,7 @@ public:
                 {
                     if (node_)
                     {
-                        node_->is_port_ok = false;
+                        node_->set_flag(PortNode::PORT_OK_FLAG, false);
                     }
 
                     EPROSIMA_LOG_WARNING(RTPS_TRANSPORT_SHM, THREADID << segment_name.c_str()
@@ -528,31 +590,25 @@ public:
         {
             std::unique_lock<SharedMemSegment::mutex> lock_empty(node_->empty_cv_mutex);
 
-            if (!node_->is_port_ok)
+            if (!node_->has_flag(PortNode::PORT_OK_FLAG))
             {
                 throw std::runtime_error("the port is marked as not ok!");
             }
 
             try
             {
-                bool was_opened_as_unicast_port = node_->is_opened_read_exclusive;
+                bool was_opened_as_unicast_port = node_->has_flag(PortNode::OPENED_READ_EXCLUSIVE_FLAG);
                 bool was_buffer_empty_before_push = buffer_->is_buffer_empty();
-                bool was_someone_listening = (node_->waiting_count > 0);
 
                 *listeners_active = buffer_->push(buffer_descriptor);
 
+                bool must_notify = needs_notification(was_buffer_empty_before_push);
+
                 lock_empty.unlock();
 
-                if (was_someone_listening)
+                if (must_notify)
                 {
-                    if (was_opened_as_unicast_port)
-                    {
-                        notify_unicast(was_buffer_empty_before_push);
-                    }
-                    else
-                    {
-                        notify_multicast();
-                    }
+                    notify(was_opened_as_unicast_port);
                 }
 
                 return true;
@@ -581,7 +637,7 @@ public:
             {
                 std::unique_lock<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
 
-                if (!node_->is_port_ok)
+                if (!node_->has_flag(PortNode::PORT_OK_FLAG))
                 {
                     throw std::runtime_error("port marked as not ok");
                 }
@@ -591,6 +647,7 @@ public:
                 status.is_waiting = 1;
                 status.counter = status.last_verified_counter + 1;
                 node_->waiting_count++;
+                node_->status_flags.fetch_add(1u << PortNode::COALESCING_WAITING_COUNT_SHIFT);
 
                 do
                 {
@@ -599,14 +656,21 @@ public:
 
                     if (node_->empty_cv.timed_wait(lock, timeout, [&]
                             {
-                                return is_listener_closed.load() || listener.head() != nullptr;
+                                if (is_listener_closed.load() || listener.head() != nullptr)
+                                {
+                                    return true;
+                                }
+
+                                // Going to sleep, the next push has to notify
+                                node_->set_flag(PortNode::NOTIFICATION_PENDING_FLAG, false);
+                                return false;
                             }))
                     {
                         break; // Codition met, Break the while
                     }
                     else // Timeout
                     {
-                        if (!node_->is_port_ok)
+                        if (!node_->has_flag(PortNode::PORT_OK_FLAG))
                         {
                             throw std::runtime_error("port marked as not ok");
                         }
@@ -616,19 +680,20 @@ public:
                 } while (1);
 
                 node_->waiting_count--;
+                node_->status_flags.fetch_sub(1u << PortNode::COALESCING_WAITING_COUNT_SHIFT);
                 status.is_waiting = 0;
 
             }
             catch (const std::exception&)
             {
-                node_->is_port_ok = false;
+                node_->set_flag(PortNode::PORT_OK_FLAG, false);
                 throw;
             }
         }
 
         inline bool is_port_ok() const
         {
-            return node_->is_port_ok;
+            return node_->has_flag(PortNode::PORT_OK_FLAG);
         }
 
         /**
@@ -636,7 +701,9 @@ public:
          */
         inline bool port_has_listeners() const
         {
-            return node_->is_port_ok && node_->is_opened_for_reading && node_->num_listeners > 0;
+            return node_->has_flag(PortNode::PORT_OK_FLAG) &&
+                   node_->has_flag(PortNode::OPENED_FOR_READING_FLAG) &&
+                   node_->num_listeners > 0;
         }
 
         inline uint32_t port_id() const
@@ -646,9 +713,10 @@ public:
 
         inline OpenMode open_mode() const
         {
-            if (node_->is_opened_for_reading)
+            if (node_->has_flag(PortNode::OPENED_FOR_READING_FLAG))
             {
-                return node_->is_opened_read_exclusive ? OpenMode::ReadExclusive : OpenMode::ReadShared;
+                return node_->has_flag(PortNode::OPENED_READ_EXCLUSIVE_FLAG) ?
+                       OpenMode::ReadExclusive : OpenMode::ReadShared;
             }
 
             return OpenMode::Write;
@@ -703,6 +771,24 @@ public:
             was_cell_freed = listener.pop();
         }
 
+        /**
+         * Removes, in a single pass, all the buffer descriptors available in the listener's queue, up to max_count.
+         * @param [in] listener reference to the listener that will pop the buffer descriptors.
+         * @param [out] buffer_descriptors array where the popped buffer descriptors are copied
+         * @param [out] was_cell_freed array where, for each popped descriptor, it is stored whether the port's cell
+         * is freed because all listeners have popped the cell
+         * @param [in] max_count maximum number of descriptors to pop, and size of the output arrays
+         * @return the number of buffer descriptors popped, 0 if the listener's queue is empty
+         */
+        uint32_t pop(
+                Listener& listener,
+                BufferDescriptor* buffer_descriptors,
+                bool* was_cell_freed,
+                uint32_t max_count)
+        {
+            return listener.pop(buffer_descriptors, was_cell_freed, max_count);
+        }
+
         /**
          * Register a new listener
          * The new listener's read pointer is equal to the ring-buffer write pointer at the registering moment.
@@ -764,7 +850,7 @@ public:
             }
             catch (const std::exception&)
             {
-                node_->is_port_ok = false;
+                node_->set_flag(PortNode::PORT_OK_FLAG, false);
 
                 (*listener).reset();
 
@@ -864,7 +950,7 @@ public:
          */
         void healthy_check()
         {
-            if (!node_->is_port_ok)
+            if (!node_->has_flag(PortNode::PORT_OK_FLAG))
             {
                 throw std::runtime_error("port is marked as not ok");
             }
@@ -882,7 +968,7 @@ public:
                     std::unique_lock<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
                     is_check_ok = check_status_all_listeners();
 
-                    if (!node_->is_port_ok)
+                    if (!node_->has_flag(PortNode::PORT_OK_FLAG))
                     {
                         throw std::runtime_error("port marked as not ok");
                     }
@@ -894,9 +980,9 @@ public:
                 }
             }
 
-            if (!is_check_ok || !node_->is_port_ok)
+            if (!is_check_ok || !node_->has_flag(PortNode::PORT_OK_FLAG))
             {
-                node_->is_port_ok = false;
+                node_->set_flag(PortNode::PORT_OK_FLAG, false);
                 throw std::runtime_error("healthy_check failed");
             }
         }
@@ -1167,8 +1253,14 @@ private:
                 {
                     port->healthy_check();
 
-                    port_node->is_opened_read_exclusive |= (open_mode == Port::OpenMode::ReadExclusive);
-                    port_node->is_opened_for_reading |= (open_mode != Port::OpenMode::Write);
+                    if (open_mode == Port::OpenMode::ReadExclusive)
+                    {
+                        port_node->set_flag(PortNode::OPENED_READ_EXCLUSIVE_FLAG, true);
+                    }
+                    if (open_mode != Port::OpenMode::Write)
+                    {
+                        port_node->set_flag(PortNode::OPENED_FOR_READING_FLAG, true);
+                    }
 
                     EPROSIMA_LOG_INFO(RTPS_TRANSPORT_SHM, THREADID << "Port "
                                                                    << port_node->port_id << " (" << port_node->uuid.to_string() <<
@@ -1179,7 +1271,7 @@ private:
             {
                 port->unlock_read_locks();
 
-                port_node->is_port_ok = false;
+                port_node->set_flag(PortNode::PORT_OK_FLAG, false);
 
                 auto port_uuid = port_node->uuid.to_string();
 
@@ -1269,12 +1361,12 @@ private:
         port_node =
                 segment->get().construct<PortNode>(("port_node_abi" +
                         std::to_string(CURRENT_ABI_VERSION)).c_str())();
-        port_node->is_port_ok = false;
+        port_node->status_flags.store(
+            (open_mode == Port::OpenMode::ReadExclusive ? PortNode::OPENED_READ_EXCLUSIVE_FLAG : 0u) |
+            (open_mode != Port::OpenMode::Write ? PortNode::OPENED_FOR_READING_FLAG : 0u));
         port_node->port_id = port_id;
         UUID<8>::generate(port_node->uuid);
         port_node->waiting_count = 0;
-        port_node->is_opened_read_exclusive = (open_mode == Port::OpenMode::ReadExclusive);
-        port_node->is_opened_for_reading = (open_mode != Port::OpenMode::Write);
         port_node->num_listeners = 0;
         port_node->healthy_check_timeout_ms = healthy_check_timeout_ms;
         port_node->last_listeners_status_check_time_ms =
@@ -1304,7 +1396,7 @@ private:
 
         port_node->buffer_node = segment->get_offset_from_address(buffer_node);
 
-        port_node->is_port_ok = true;
+        port_node->set_flag(PortNode::PORT_OK_FLAG, true);
         port = std::make_shared<Port>(std::move(segment), port_node, std::move(lock_read_exclusive));
 
         if (open_mode == Port::OpenMode::ReadShared)
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_SHAREDMEM_MANAGER_H_
 #define _FASTDDS_SHAREDMEM_MANAGER_H_
 
+#include <algorithm>
 #include <atomic>
 #include <list>
 #include <thread>
@@ -670,6 +671,8 @@ public:
         {
             if (global_port_)
             {
+                discard_popped_descriptors();
+
                 try
                 {
                     global_port_->unregister_listener(&global_listener_, listener_index_);
@@ -690,6 +693,14 @@ public:
             other.global_port_.reset();
             shared_mem_manager_ = other.shared_mem_manager_;
             is_closed_.exchange(other.is_closed_);
+            std::copy(other.popped_descriptors_, other.popped_descriptors_ + other.popped_count_,
+                    popped_descriptors_);
+            std::copy(other.was_popped_cell_freed_, other.was_popped_cell_freed_ + other.popped_count_,
+                    was_popped_cell_freed_);
+            popped_count_ = other.popped_count_;
+            next_popped_ = other.next_popped_;
+            other.popped_count_ = 0;
+            other.next_popped_ = 0;
 
             return *this;
         }
@@ -698,6 +709,8 @@ public:
          * Extract the first buffer enqueued in the port.
          * If the queue is empty, blocks until a buffer is pushed
          * to the port.
+         * All the descriptors available in the port, up to max_popped_descriptors, are popped at once and kept
+         * in the listener, so the following calls return them without accessing the port.
          * @return A shared_ptr to the buffer, this shared_ptr can be nullptr if the
          * wait was interrupted because errors or close operations.
          * @remark Multithread not supported.
@@ -711,30 +724,39 @@ public:
             {
                 while (!is_buffer_valid)
                 {
-                    bool was_cell_freed;
-
-                    SharedMemGlobal::PortCell* head_cell = nullptr;
                     buffer_ref.reset();
 
-                    while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
+                    if (next_popped_ == popped_count_)
                     {
-                        // Wait until there's data to pop
-                        global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
-                    }
+                        popped_count_ = 0;
+                        next_popped_ = 0;
 
-                    if (!head_cell)
-                    {
-                        return nullptr;
-                    }
+                        SharedMemGlobal::PortCell* head_cell = nullptr;
 
-                    if (!global_port_->is_port_ok())
-                    {
-                        throw std::runtime_error("");
+                        while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
+                        {
+                            // Wait until there's data to pop
+                            global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                        }
+
+                        if (!head_cell)
+                        {
+                            return nullptr;
+                        }
+
+                        if (!global_port_->is_port_ok())
+                        {
+                            throw std::runtime_error("");
+                        }
+
+                        // Pop all the available descriptors
+                        popped_count_ = global_port_->pop(*global_listener_, popped_descriptors_,
+                                        was_popped_cell_freed_, max_popped_descriptors);
                     }
 
-                    // Read and pop descriptor
-                    SharedMemGlobal::BufferDescriptor buffer_descriptor = head_cell->data();
-                    global_port_->pop(*global_listener_, was_cell_freed);
+                    SharedMemGlobal::BufferDescriptor buffer_descriptor = popped_descriptors_[next_popped_];
+                    bool was_cell_freed = was_popped_cell_freed_[next_popped_];
+                    ++next_popped_;
 
                     auto segment = shared_mem_manager_->find_segment(buffer_descriptor.source_segment_id);
                     if (!segment)
@@ -802,6 +824,8 @@ public:
 
         void regenerate_port()
         {
+            discard_popped_descriptors();
+
             auto new_port = global_port_;
             shared_mem_manager_->regenerate_port(new_port, new_port->open_mode());
             auto new_listener = std::make_shared<Listener>(shared_mem_manager_, new_port);
@@ -820,6 +844,34 @@ public:
 
     private:
 
+        /**
+         * Releases the descriptors popped from the port but not returned by pop() yet.
+         */
+        void discard_popped_descriptors()
+        {
+            for (; next_popped_ < popped_count_; ++next_popped_)
+            {
+                if (was_popped_cell_freed_[next_popped_])
+                {
+                    const SharedMemGlobal::BufferDescriptor& buffer_descriptor = popped_descriptors_[next_popped_];
+                    auto segment = shared_mem_manager_->find_segment(buffer_descriptor.source_segment_id);
+                    if (segment)
+                    {
+                        auto buffer_node =
+                                static_cast<BufferNode*>(segment->get_address_from_offset(buffer_descriptor.
+                                        buffer_node_offset));
+                        buffer_node->dec_enqueued_count(buffer_descriptor.validity_id);
+                    }
+                }
+            }
+
+            popped_count_ = 0;
+            next_popped_ = 0;
+        }
+
+        //! Maximum number of descriptors popped from the port at once
+        static constexpr uint32_t max_popped_descriptors = 32;
+
         std::shared_ptr<SharedMemGlobal::Port> global_port_;
 
         std::unique_ptr<SharedMemGlobal::Listener> global_listener_;
@@ -829,6 +881,12 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        //! Descriptors popped from the port and not returned by pop() yet
+        SharedMemGlobal::BufferDescriptor popped_descriptors_[max_popped_descriptors];
+        bool was_popped_cell_freed_[max_popped_descriptors];
+        uint32_t popped_count_ = 0;
+        uint32_t next_popped_ = 0;
+
     }; // Listener
 
     /**
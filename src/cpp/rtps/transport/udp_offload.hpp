@@ -0,0 +1,41 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file udp_offload.hpp
+ *
+ * Socket level definitions for the UDP segmentation (UDP_SEGMENT) and receive (UDP_GRO) offloads, which older C
+ * libraries do not provide even when the running kernel supports them.
+ */
+
+#ifndef RTPS_TRANSPORT__UDP_OFFLOAD_HPP_
+#define RTPS_TRANSPORT__UDP_OFFLOAD_HPP_
+
+#if defined(__linux__)
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif // ifndef SOL_UDP
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif // ifndef UDP_SEGMENT
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif // ifndef UDP_GRO
+#endif // if defined(__linux__)
+
+#endif // RTPS_TRANSPORT__UDP_OFFLOAD_HPP_
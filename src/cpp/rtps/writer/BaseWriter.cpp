@@ -245,6 +245,21 @@ bool BaseWriter::send_nts(
                    locator_selector.locator_selector.end(), max_blocking_time_point);
 }
 
+bool BaseWriter::send_segments_nts(
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        const uint32_t& total_bytes,
+        uint32_t segment_size,
+        const LocatorSelectorSender& locator_selector,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    RTPSParticipantImpl* participant = get_participant_impl();
+
+    return locator_selector.locator_selector.selected_size() == 0 ||
+           participant->sendSync(buffers, total_bytes, segment_size, m_guid,
+                   locator_selector.locator_selector.begin(), locator_selector.locator_selector.end(),
+                   max_blocking_time_point);
+}
+
 const dds::LivelinessQosPolicyKind& BaseWriter::get_liveliness_kind() const
 {
     return liveliness_kind_;
@@ -172,6 +172,23 @@ public:
             const LocatorSelectorSender& locator_selector,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const;
 
+    /**
+     * Send a train of messages of the same size through this interface.
+     *
+     * @param buffers Vector of NetworkBuffers of all the messages. Each message ends at the end of a buffer.
+     * @param total_bytes Total number of bytes to send. Should be equal to the sum of the @c size field of all buffers.
+     * @param segment_size Size of each message, except the last one, which may be smaller.
+     * @param locator_selector RTPSMessageSenderInterface reference uses for selecting locators. The reference has to
+     * be a member of this RTPSWriter object.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    virtual bool send_segments_nts(
+            const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+            const uint32_t& total_bytes,
+            uint32_t segment_size,
+            const LocatorSelectorSender& locator_selector,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const;
+
     /**
      * Process an incoming ACKNACK submessage.
      * @param [in] writer_guid      GUID of the writer the submessage is directed to.
@@ -52,6 +52,13 @@ class ChangeForReader_t
 
 public:
 
+    //! Construct an empty object, not associated to any change.
+    ChangeForReader_t()
+        : status_(UNSENT)
+        , change_(nullptr)
+    {
+    }
+
     explicit ChangeForReader_t(
             CacheChange_t* change)
         : status_(UNSENT)
@@ -0,0 +1,435 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ChangeForReaderRing.hpp
+ */
+
+#ifndef RTPS_WRITER__CHANGEFORREADERRING_HPP
+#define RTPS_WRITER__CHANGEFORREADERRING_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <fastdds/rtps/common/SequenceNumber.hpp>
+#include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
+
+#include <rtps/writer/ChangeForReader.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Collection of ChangeForReader_t objects of a ReaderProxy, sorted by sequence number.
+ *
+ * Changes are kept contiguously on a ring buffer, in sequence number order.
+ * Sequence numbers of irrelevant or removed changes leave gaps, but do not take space on the ring, so its capacity
+ * only depends on the number of changes, and never exceeds the maximum given on construction.
+ * Looking up a change is O(1) while there are no gaps between the change and the head, and a binary search otherwise.
+ * Removing changes from the front only advances the head of the ring, so processing an ACKNACK does not move the
+ * rest of the changes.
+ */
+class ChangeForReaderRing
+{
+public:
+
+    /**
+     * Construct the collection.
+     *
+     * @param allocation  Allocation configuration. Its @c initial field gives the initial capacity of the ring, and
+     *                    its @c maximum field limits the number of changes on the collection.
+     */
+    explicit ChangeForReaderRing(
+            const ResourceLimitedContainerConfig& allocation)
+        : max_size_(allocation.maximum)
+    {
+        allocate(ring_capacity(allocation.initial));
+    }
+
+    bool empty() const
+    {
+        return 0 == size_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    //! Number of changes the ring can hold before growing.
+    size_t capacity() const
+    {
+        return slots_.size();
+    }
+
+    void clear()
+    {
+        size_ = 0;
+        head_ = 0;
+    }
+
+    //! Returns the change with the lowest sequence number. The collection should not be empty.
+    const ChangeForReader_t& front() const
+    {
+        assert(!empty());
+        return slots_[head_];
+    }
+
+    //! Returns the change with the highest sequence number. The collection should not be empty.
+    const ChangeForReader_t& back() const
+    {
+        assert(!empty());
+        return at(size_ - 1);
+    }
+
+    /**
+     * Add a change with a sequence number higher than the one of any change on the collection.
+     *
+     * @param change  Change to add.
+     *
+     * @return Pointer to the added change, or nullptr if the maximum number of changes has been reached.
+     */
+    ChangeForReader_t* push_back(
+            const ChangeForReader_t& change)
+    {
+        assert(empty() || change.getSequenceNumber() > back().getSequenceNumber());
+
+        if (!reserve_one())
+        {
+            return nullptr;
+        }
+
+        ChangeForReader_t& slot = at(size_);
+        slot = change;
+        ++size_;
+        return &slot;
+    }
+
+    /**
+     * Add a change with any sequence number not present on the collection.
+     *
+     * @param change  Change to add.
+     *
+     * @return Pointer to the added change, or nullptr if the maximum number of changes has been reached.
+     */
+    ChangeForReader_t* insert(
+            const ChangeForReader_t& change)
+    {
+        if (empty() || change.getSequenceNumber() > back().getSequenceNumber())
+        {
+            return push_back(change);
+        }
+
+        assert(nullptr == find(change.getSequenceNumber()));
+
+        if (!reserve_one())
+        {
+            return nullptr;
+        }
+
+        size_t index = lower_bound_index(change.getSequenceNumber().to64long());
+        if (index < size_ - index)
+        {
+            // Move the changes before the new one towards the front.
+            head_ = (0 == head_ ? capacity() : head_) - 1;
+            for (size_t i = 0; i < index; ++i)
+            {
+                at(i) = at(i + 1);
+            }
+        }
+        else
+        {
+            // Move the changes after the new one towards the back.
+            for (size_t i = size_; i > index; --i)
+            {
+                at(i) = at(i - 1);
+            }
+        }
+
+        ++size_;
+        ChangeForReader_t& slot = at(index);
+        slot = change;
+        return &slot;
+    }
+
+    /**
+     * Look for the change with a given sequence number.
+     *
+     * @return Pointer to the change, or nullptr if it is not on the collection.
+     */
+    ChangeForReader_t* find(
+            const SequenceNumber_t& seq_num)
+    {
+        if (empty())
+        {
+            return nullptr;
+        }
+
+        uint64_t seq = seq_num.to64long();
+        uint64_t first_seq = front().getSequenceNumber().to64long();
+        if (seq < first_seq)
+        {
+            return nullptr;
+        }
+
+        // Fast path: no gaps between the head and the change.
+        if (seq - first_seq < size_)
+        {
+            ChangeForReader_t& candidate = at(static_cast<size_t>(seq - first_seq));
+            if (candidate.getSequenceNumber() == seq_num)
+            {
+                return &candidate;
+            }
+        }
+
+        size_t index = lower_bound_index(seq);
+        if (index < size_ && at(index).getSequenceNumber() == seq_num)
+        {
+            return &at(index);
+        }
+
+        return nullptr;
+    }
+
+    const ChangeForReader_t* find(
+            const SequenceNumber_t& seq_num) const
+    {
+        return const_cast<ChangeForReaderRing*>(this)->find(seq_num);
+    }
+
+    /**
+     * Look for the first change with a sequence number not less than a given one.
+     *
+     * @return Pointer to the change, or nullptr if there is no such change.
+     */
+    ChangeForReader_t* lower_bound(
+            const SequenceNumber_t& seq_num)
+    {
+        size_t index = lower_bound_index(seq_num.to64long());
+        return index < size_ ? &at(index) : nullptr;
+    }
+
+    /**
+     * Look for the last change with a sequence number lower than a given one.
+     *
+     * @return Pointer to the change, or nullptr if there is no such change.
+     */
+    const ChangeForReader_t* previous(
+            const SequenceNumber_t& seq_num) const
+    {
+        size_t index = lower_bound_index(seq_num.to64long());
+        return 0 < index ? &at(index - 1) : nullptr;
+    }
+
+    /**
+     * Remove the change with a given sequence number, if present.
+     *
+     * @return Whether the change was on the collection.
+     */
+    bool erase(
+            const SequenceNumber_t& seq_num)
+    {
+        size_t index = lower_bound_index(seq_num.to64long());
+        if (index >= size_ || at(index).getSequenceNumber() != seq_num)
+        {
+            return false;
+        }
+
+        if (index < size_ - index - 1)
+        {
+            // Move the changes before the removed one towards the back.
+            for (size_t i = index; i > 0; --i)
+            {
+                at(i) = at(i - 1);
+            }
+            head_ = wrap(head_ + 1);
+        }
+        else
+        {
+            // Move the changes after the removed one towards the front.
+            for (size_t i = index + 1; i < size_; ++i)
+            {
+                at(i - 1) = at(i);
+            }
+        }
+
+        --size_;
+        if (0 == size_)
+        {
+            head_ = 0;
+        }
+
+        return true;
+    }
+
+    //! Remove all the changes with a sequence number lower than a given one.
+    void erase_before(
+            const SequenceNumber_t& seq_num)
+    {
+        size_t count = lower_bound_index(seq_num.to64long());
+        head_ = (0 == size_ - count) ? 0 : wrap(head_ + count);
+        size_ -= count;
+    }
+
+    /**
+     * Look for the end of the run of consecutive sequence numbers, starting at a given one, whose changes are on the
+     * collection and fulfill a predicate.
+     *
+     * @return The first sequence number, not less than @c seq_num, without a change on the collection fulfilling the
+     *         predicate.
+     */
+    template<typename Predicate>
+    SequenceNumber_t end_of_run(
+            const SequenceNumber_t& seq_num,
+            Predicate pred) const
+    {
+        SequenceNumber_t next = seq_num;
+        for (size_t i = lower_bound_index(seq_num.to64long());
+                i < size_ && at(i).getSequenceNumber() == next && pred(at(i)); ++i)
+        {
+            ++next;
+        }
+        return next;
+    }
+
+    //! Call a functor for each change on the collection, in sequence number order.
+    template<typename Functor>
+    void for_each(
+            Functor f)
+    {
+        for (size_t i = 0; i < size_; ++i)
+        {
+            f(at(i));
+        }
+    }
+
+    /**
+     * Look for the first change, in sequence number order, fulfilling a predicate.
+     *
+     * @return Pointer to the change, or nullptr if there is no such change.
+     */
+    template<typename Predicate>
+    const ChangeForReader_t* find_if(
+            Predicate pred) const
+    {
+        for (size_t i = 0; i < size_; ++i)
+        {
+            if (pred(at(i)))
+            {
+                return &at(i);
+            }
+        }
+
+        return nullptr;
+    }
+
+private:
+
+    static constexpr size_t min_capacity = 16;
+
+    size_t ring_capacity(
+            size_t count) const
+    {
+        return (std::min)((std::max)(count, min_capacity), max_size_);
+    }
+
+    //! Slot of a position, which should be lower than twice the capacity.
+    size_t wrap(
+            size_t position) const
+    {
+        return position < capacity() ? position : position - capacity();
+    }
+
+    ChangeForReader_t& at(
+            size_t index)
+    {
+        return slots_[wrap(head_ + index)];
+    }
+
+    const ChangeForReader_t& at(
+            size_t index) const
+    {
+        return slots_[wrap(head_ + index)];
+    }
+
+    //! Index of the first change with a sequence number not less than a given one.
+    size_t lower_bound_index(
+            uint64_t seq) const
+    {
+        size_t low = 0;
+        size_t high = size_;
+        while (low < high)
+        {
+            size_t mid = low + (high - low) / 2;
+            if (at(mid).getSequenceNumber().to64long() < seq)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    //! Make room for one more change, growing the ring if needed.
+    bool reserve_one()
+    {
+        if (size_ >= max_size_)
+        {
+            return false;
+        }
+
+        if (size_ == capacity())
+        {
+            // Double the capacity, without going over the maximum number of changes
+            size_t new_capacity = capacity() < max_size_ - capacity() ? capacity() << 1 : max_size_;
+            std::vector<ChangeForReader_t> old_slots;
+            old_slots.swap(slots_);
+            size_t old_head = head_;
+
+            allocate(new_capacity);
+            for (size_t i = 0; i < size_; ++i)
+            {
+                size_t old_slot = old_head + i;
+                slots_[i] = old_slots[old_slot < size_ ? old_slot : old_slot - size_];
+            }
+            head_ = 0;
+        }
+
+        return true;
+    }
+
+    void allocate(
+            size_t capacity)
+    {
+        slots_.assign(capacity, ChangeForReader_t());
+    }
+
+    std::vector<ChangeForReader_t> slots_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+    size_t max_size_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // RTPS_WRITER__CHANGEFORREADERRING_HPP
@@ -14,6 +14,15 @@ bool LocatorSelectorSender::send(
     return writer_.send_nts(buffers, total_bytes, *this, max_blocking_time_point);
 }
 
+bool LocatorSelectorSender::send_segments(
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        const uint32_t& total_bytes,
+        uint32_t segment_size,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    return writer_.send_segments_nts(buffers, total_bytes, segment_size, *this, max_blocking_time_point);
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
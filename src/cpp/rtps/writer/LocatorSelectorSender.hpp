@@ -94,6 +94,20 @@ public:
             const uint32_t& total_bytes,
             std::chrono::steady_clock::time_point max_blocking_time_point) const override;
 
+    /*!
+     * Send a train of messages of the same size through this interface.
+     *
+     * @param buffers Vector of NetworkBuffers of all the messages. Each message ends at the end of a buffer.
+     * @param total_bytes Total number of bytes to send. Should be equal to the sum of the @c size field of all buffers.
+     * @param segment_size Size of each message, except the last one, which may be smaller.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    bool send_segments(
+            const std::vector<fastdds::rtps::NetworkBuffer>& buffers,
+            const uint32_t& total_bytes,
+            uint32_t segment_size,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const override;
+
     /*!
      * Lock the object.
      *
@@ -265,8 +265,8 @@ bool ReaderProxy::change_is_acked(
         return true;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    const ChangeForReader_t* chit = changes_for_reader_.find(seq_num);
+    if (nullptr == chit)
     {
         // There is a hole in changes_for_reader_
         // This means a change was removed, or was not relevant.
@@ -288,8 +288,8 @@ bool ReaderProxy::change_is_unsent(
         return false;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    const ChangeForReader_t* chit = changes_for_reader_.find(seq_num);
+    if (nullptr == chit)
     {
         // There is a hole in changes_for_reader_
         // This means a change was removed.
@@ -306,9 +306,10 @@ bool ReaderProxy::change_is_unsent(
         if (is_reliable_ && !chit->has_been_delivered())
         {
             need_reactivate_periodic_heartbeat |= true;
+            const ChangeForReader_t* prev_change = changes_for_reader_.previous(seq_num);
             SequenceNumber_t prev =
-                    (changes_for_reader_.begin() != chit ?
-                    std::prev(chit)->getSequenceNumber() :
+                    (nullptr != prev_change ?
+                    prev_change->getSequenceNumber() :
                     changes_low_mark_
                     ) + 1;
 
@@ -342,16 +343,13 @@ void ReaderProxy::acked_changes_set(
 
     if (seq_num > changes_low_mark_)
     {
-        ChangeIterator chit = find_change(seq_num, false);
         // continue advancing until next change is not acknowledged
-        while (chit != changes_for_reader_.end()
-                && chit->getSequenceNumber() == future_low_mark
-                && chit->getStatus() == ACKNOWLEDGED)
-        {
-            ++chit;
-            ++future_low_mark;
-        }
-        changes_for_reader_.erase(changes_for_reader_.begin(), chit);
+        future_low_mark = changes_for_reader_.end_of_run(seq_num, [](const ChangeForReader_t& change)
+                        {
+                            return change.getStatus() == ACKNOWLEDGED;
+                        });
+        // Every change before future_low_mark has been acknowledged
+        changes_for_reader_.erase_before(future_low_mark);
     }
     else
     {
@@ -372,17 +370,13 @@ void ReaderProxy::acked_changes_set(
                 }
                 future_low_mark = current_sequence;
 
-                bool should_sort = false;
                 for (; current_sequence <= changes_low_mark_; ++current_sequence)
                 {
                     // Skip all consecutive changes already in the collection
-                    ChangeConstIterator it = find_change(current_sequence);
-                    while ( it != changes_for_reader_.end() &&
-                            current_sequence <= changes_low_mark_ &&
-                            it->getSequenceNumber() == current_sequence)
+                    while (current_sequence <= changes_low_mark_ &&
+                            nullptr != changes_for_reader_.find(current_sequence))
                     {
                         ++current_sequence;
-                        ++it;
                     }
 
                     if (current_sequence <= changes_low_mark_)
@@ -390,18 +384,13 @@ void ReaderProxy::acked_changes_set(
                         CacheChange_t* change = nullptr;
                         if (writer_->get_history()->get_change(current_sequence, writer_->getGuid(), &change))
                         {
-                            should_sort = true;
+                            // Keeps changes sorted by sequence number
                             ChangeForReader_t cr(change);
                             cr.setStatus(UNACKNOWLEDGED);
-                            changes_for_reader_.push_back(cr);
+                            changes_for_reader_.insert(cr);
                         }
                     }
                 }
-                // Keep changes sorted by sequence number
-                if (should_sort)
-                {
-                    std::sort(changes_for_reader_.begin(), changes_for_reader_.end(), ChangeForReaderCmp());
-                }
             }
             else if (!is_local_reader())
             {
@@ -423,8 +412,8 @@ bool ReaderProxy::requested_changes_set(
     {
         seq_num_set.for_each([&](SequenceNumber_t sit)
                 {
-                    ChangeIterator chit = find_change(sit, true);
-                    if (chit != changes_for_reader_.end())
+                    ChangeForReader_t* chit = changes_for_reader_.find(sit);
+                    if (nullptr != chit)
                     {
                         if (UNACKNOWLEDGED == chit->getStatus())
                         {
@@ -477,15 +466,15 @@ void ReaderProxy::from_unsent_to_status(
 
     // Called when delivering an UNSENT sample, the seq_number must exists in the ReaderProxy.
     assert(seq_num > changes_low_mark_);
-    ChangeIterator it = find_change(seq_num, true);
-    assert(changes_for_reader_.end() != it);
+    ChangeForReader_t* it = changes_for_reader_.find(seq_num);
+    assert(nullptr != it);
     assert(UNSENT == it->getStatus());
     assert(UNSENT != status);
 
     if (ACKNOWLEDGED == status && seq_num == changes_low_mark_ + 1)
     {
-        assert(changes_for_reader_.begin() == it);
-        changes_for_reader_.erase(it);
+        assert(&changes_for_reader_.front() == it);
+        changes_for_reader_.erase(seq_num);
         acked_changes_set(seq_num + 1);
         return;
     }
@@ -511,9 +500,9 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(
     }
 
     bool change_found = false;
-    ChangeIterator it = find_change(seq_num, true);
+    ChangeForReader_t* it = changes_for_reader_.find(seq_num);
 
-    if (it != changes_for_reader_.end())
+    if (nullptr != it)
     {
         change_found = true;
         it->markFragmentsAsSent(frag_num);
@@ -545,19 +534,19 @@ uint32_t ReaderProxy::convert_status_on_all_changes(
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
     uint32_t changed = 0;
-    for (ChangeForReader_t& change : changes_for_reader_)
-    {
-        if (change.getStatus() == previous)
-        {
-            ++changed;
-            change.setStatus(next);
-
-            if (func)
+    changes_for_reader_.for_each([&](ChangeForReader_t& change)
             {
-                func(change);
-            }
-        }
-    }
+                if (change.getStatus() == previous)
+                {
+                    ++changed;
+                    change.setStatus(next);
+
+                    if (func)
+                    {
+                        func(change);
+                    }
+                }
+            });
 
     return changed;
 }
@@ -566,14 +555,14 @@ void ReaderProxy::change_has_been_removed(
         const SequenceNumber_t& seq_num)
 {
     // Check sequence number is in the container, because it was not clean up.
-    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->getSequenceNumber())
+    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.front().getSequenceNumber())
     {
         return;
     }
 
-    auto chit = find_change(seq_num);
+    const ChangeForReader_t* chit = changes_for_reader_.find(seq_num);
 
-    if (chit == this->changes_for_reader_.end())
+    if (nullptr == chit)
     {
         // No change for this sequence number
         return;
@@ -586,7 +575,7 @@ void ReaderProxy::change_has_been_removed(
     }
 
     // Element may not be in the container when marked as irrelevant.
-    changes_for_reader_.erase(chit);
+    changes_for_reader_.erase(seq_num);
 
     // When removing the next-to-be-acknowledged, we should auto-acknowledge it.
     if ((changes_low_mark_ + 1) == seq_num)
@@ -603,15 +592,10 @@ bool ReaderProxy::has_unacknowledged(
         return true;
     }
 
-    for (const ChangeForReader_t& it : changes_for_reader_)
-    {
-        if (it.getStatus() == UNACKNOWLEDGED)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return nullptr != changes_for_reader_.find_if([](const ChangeForReader_t& change)
+                   {
+                       return change.getStatus() == UNACKNOWLEDGED;
+                   });
 }
 
 bool ReaderProxy::requested_fragment_set(
@@ -619,8 +603,8 @@ bool ReaderProxy::requested_fragment_set(
         const FragmentNumberSet_t& frag_set)
 {
     // Locate the outbound change referenced by the NACK_FRAG
-    ChangeIterator changeIter = find_change(seq_num, true);
-    if (changeIter == changes_for_reader_.end())
+    ChangeForReader_t* changeIter = changes_for_reader_.find(seq_num);
+    if (nullptr == changeIter)
     {
         return false;
     }
@@ -657,40 +641,6 @@ bool ReaderProxy::process_nack_frag(
     return false;
 }
 
-static bool change_less_than_sequence(
-        const ChangeForReader_t& change,
-        const SequenceNumber_t& seq_num)
-{
-    return change.getSequenceNumber() < seq_num;
-}
-
-ReaderProxy::ChangeIterator ReaderProxy::find_change(
-        const SequenceNumber_t& seq_num,
-        bool exact)
-{
-    ReaderProxy::ChangeIterator it;
-    ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
-
-    return (!exact)
-           ? it
-           : it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
-}
-
-ReaderProxy::ChangeConstIterator ReaderProxy::find_change(
-        const SequenceNumber_t& seq_num) const
-{
-    ReaderProxy::ChangeConstIterator it;
-    ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
-
-    return it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
-}
-
 bool ReaderProxy::has_been_delivered(
         const SequenceNumber_t& seq_number,
         bool& found) const
@@ -701,8 +651,8 @@ bool ReaderProxy::has_been_delivered(
         return true;
     }
 
-    ChangeConstIterator it = find_change(seq_number);
-    if (it != changes_for_reader_.end())
+    const ChangeForReader_t* it = changes_for_reader_.find(seq_number);
+    if (nullptr != it)
     {
         found = true;
         return it->has_been_delivered();
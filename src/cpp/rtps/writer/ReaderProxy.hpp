@@ -34,6 +34,7 @@
 
 #include <rtps/builtin/data/ReaderProxyData.hpp>
 #include <rtps/writer/ChangeForReader.hpp>
+#include <rtps/writer/ChangeForReaderRing.hpp>
 #include <rtps/writer/ReaderLocator.hpp>
 
 namespace eprosima {
@@ -435,7 +436,7 @@ private:
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
     //!Set of the changes and its state.
-    ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    ChangeForReaderRing changes_for_reader_;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     TimedEvent* nack_supression_event_;
     TimedEvent* initial_heartbeat_event_;
@@ -450,9 +451,6 @@ private:
 
     bool active_ = false;
 
-    using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
-    using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
-
     void disable_timers();
 
     /*
@@ -480,25 +478,6 @@ private:
     void add_change(
             const ChangeForReader_t& change,
             bool is_relevant);
-
-    /**
-     * @brief Find a change with the specified sequence number.
-     * @param seq_num Sequence number to find.
-     * @param exact When false, the first change with a sequence number not less than seq_num will be returned.
-     * When true, the change with a sequence number value of seq_num will be returned.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
-     */
-    ChangeIterator find_change(
-            const SequenceNumber_t& seq_num,
-            bool exact);
-
-    /**
-     * @brief Find a change with the specified sequence number.
-     * @param seq_num Sequence number to find.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
-     */
-    ChangeConstIterator find_change(
-            const SequenceNumber_t& seq_num) const;
 };
 
 } /* namespace rtps */
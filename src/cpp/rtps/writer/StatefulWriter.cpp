@@ -19,6 +19,7 @@
 
 #include "StatefulWriter.hpp"
 
+#include <algorithm>
 #include <mutex>
 #include <stdexcept>
 #include <vector>
@@ -54,6 +55,7 @@
 #include <rtps/writer/BaseWriter.hpp>
 #include <rtps/writer/ReaderProxy.hpp>
 #include <utils/TimeConversion.hpp>
+#include <utils/WorkerPool.hpp>
 
 #ifdef FASTDDS_STATISTICS
 #include <statistics/types/monitorservice_types.hpp>
@@ -526,9 +528,16 @@ void StatefulWriter::send_heartbeat_to_all_readers()
 
     if (separate_sending_enabled_)
     {
-        for (ReaderProxy* reader : matched_remote_readers_)
+        if (can_send_to_readers_in_parallel_nts())
         {
-            send_heartbeat_to_nts(*reader);
+            send_heartbeat_to_readers_in_parallel_nts();
+        }
+        else
+        {
+            for (ReaderProxy* reader : matched_remote_readers_)
+            {
+                send_heartbeat_to_nts(*reader);
+            }
         }
     }
     else
@@ -804,6 +813,11 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
                         send_heartbeat_piggyback_nts_(group, locator_selector, last_processed);
                     }
                 }
+                else if (!group.has_sent_bytes_limitation() && can_send_to_readers_in_parallel_nts())
+                {
+                    ret_code = deliver_sample_to_readers_in_parallel_nts(change, first_relevant_reader,
+                                    min_unsent_fragment, inline_qos, max_blocking_time);
+                }
                 else
                 {
                     for (auto remote_reader = first_relevant_reader;
@@ -921,6 +935,317 @@ DeliveryRetCode StatefulWriter::deliver_sample_to_network(
     return ret_code;
 }
 
+bool StatefulWriter::can_send_to_readers_in_parallel_nts()
+{
+    if (0 == mp_RTPSParticipant->get_writer_send_pool().size())
+    {
+        return false;
+    }
+
+#if HAVE_SECURITY
+    // Cryptographic transformations of the same writer are not run concurrently
+    const security::EndpointSecurityAttributes& security_attributes = getAttributes().security_attributes();
+    if (security_attributes.is_submessage_protected || security_attributes.is_payload_protected ||
+            mp_RTPSParticipant->security_attributes().is_rtps_protected)
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+
+    return true;
+}
+
+static uint64_t locator_group_hash(
+        ReaderProxy* reader)
+{
+    // FNV-1a over the first locator of the reader, so readers reached through the same locators are grouped
+    uint64_t hash = 14695981039346656037ull;
+    auto add_bytes = [&hash](const octet* data, size_t size)
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    hash = (hash ^ data[i]) * 1099511628211ull;
+                }
+            };
+
+    const LocatorSelectorEntry* entry = reader->general_locator_selector_entry();
+    const ResourceLimitedVector<Locator_t>& locators = entry->unicast.empty() ? entry->multicast : entry->unicast;
+    if (locators.empty())
+    {
+        add_bytes(reader->guid().guidPrefix.value, GuidPrefix_t::size);
+    }
+    else
+    {
+        const Locator_t& locator = locators.front();
+        add_bytes(reinterpret_cast<const octet*>(&locator.kind), sizeof(locator.kind));
+        add_bytes(reinterpret_cast<const octet*>(&locator.port), sizeof(locator.port));
+        add_bytes(locator.address, sizeof(locator.address));
+    }
+
+    return hash;
+}
+
+size_t StatefulWriter::prepare_parallel_send_tasks_nts(
+        size_t num_readers)
+{
+    size_t num_tasks = std::min(mp_RTPSParticipant->get_writer_send_pool().size() + 1, num_readers);
+    if (parallel_send_tasks_.size() < num_tasks)
+    {
+        parallel_send_tasks_.resize(num_tasks);
+    }
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        parallel_send_tasks_[i].clear();
+    }
+
+    return num_tasks;
+}
+
+DeliveryRetCode StatefulWriter::deliver_sample_to_readers_in_parallel_nts(
+        CacheChange_t* change,
+        ReaderProxyIterator first_reader,
+        FragmentNumber_t fragment,
+        bool inline_qos,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    WorkerPool& pool = mp_RTPSParticipant->get_writer_send_pool();
+    uint32_t n_fragments = change->getFragmentCount();
+
+    size_t num_active_readers = 0;
+    for (auto remote_reader = first_reader; remote_reader != matched_remote_readers_.end(); ++remote_reader)
+    {
+        if ((*remote_reader)->active())
+        {
+            ++num_active_readers;
+        }
+    }
+
+    size_t num_tasks = prepare_parallel_send_tasks_nts(num_active_readers);
+
+    // Same piggyback decision as send_heartbeat_piggyback_nts_, taken once for all the readers, accounting the
+    // bytes of a single submessage as done when sending a message for all of them.
+    bool send_heartbeat = false;
+    if (!disable_heartbeat_piggyback_)
+    {
+        if (history_->isFull() || next_all_acked_notify_sequence_ < get_seq_num_min())
+        {
+            send_heartbeat = true;
+        }
+        else
+        {
+            currentUsageSendBufferSize_ -= static_cast<int32_t>(0 < n_fragments ?
+                    change->getFragmentSize() : change->serializedPayload.length);
+            send_heartbeat = currentUsageSendBufferSize_ < 0;
+        }
+    }
+
+    // The heartbeat sent after the change is the same for all readers but its count, which is assigned here
+    // to keep it increasing regardless of the order on which tasks are run.
+    SequenceNumber_t first_seq = get_seq_num_min();
+    SequenceNumber_t last_seq = get_seq_num_max();
+    assert(first_seq != c_SequenceNumber_Unknown && last_seq != c_SequenceNumber_Unknown);
+
+    bool any_heartbeat = false;
+    for (auto remote_reader = first_reader; remote_reader != matched_remote_readers_.end(); ++remote_reader)
+    {
+        if ((*remote_reader)->active())
+        {
+            // Heartbeats are only sent to reliable readers
+            bool reader_heartbeat = send_heartbeat && (*remote_reader)->is_reliable();
+            if (reader_heartbeat)
+            {
+                increment_hb_count();
+                any_heartbeat = true;
+            }
+            size_t task = static_cast<size_t>(locator_group_hash(*remote_reader) % num_tasks);
+            parallel_send_tasks_[task].push_back({*remote_reader, reader_heartbeat, heartbeat_count_, 0u, false});
+        }
+    }
+
+    pool.run(num_tasks, [&](size_t task)
+            {
+                std::vector<ParallelSendEntry>& entries = parallel_send_tasks_[task];
+                if (entries.empty())
+                {
+                    return;
+                }
+
+                try
+                {
+                    RTPSMessageGroup group(mp_RTPSParticipant, this, entries.front().reader->message_sender(),
+                            max_blocking_time);
+
+                    for (ParallelSendEntry& entry : entries)
+                    {
+                        ReaderProxy* reader = entry.reader;
+                        group.sender(this, reader->message_sender());
+
+                        bool data_added = false;
+                        bool all_fragments_sent = true;
+                        if (0 < n_fragments)
+                        {
+                            if (fragment != n_fragments + 1)
+                            {
+                                data_added = group.add_data_frag(*change, fragment, inline_qos);
+                                entry.delivered = data_added;
+                                if (data_added)
+                                {
+                                    reader->mark_fragment_as_sent_for_change(change->sequenceNumber, fragment,
+                                            all_fragments_sent);
+                                }
+                            }
+                            else
+                            {
+                                // All the fragments were already sent
+                                entry.delivered = true;
+                            }
+                        }
+                        else
+                        {
+                            data_added = group.add_data(*change, reader->expects_inline_qos());
+                            entry.delivered = data_added;
+                        }
+
+                        if (data_added)
+                        {
+                            if (all_fragments_sent)
+                            {
+                                if (!reader->is_reliable())
+                                {
+                                    reader->acked_changes_set(change->sequenceNumber + 1);
+                                }
+                                else
+                                {
+                                    reader->from_unsent_to_status(change->sequenceNumber, UNDERWAY, true);
+                                }
+                            }
+                            entry.sent_locators = reader->locators_size();
+                        }
+
+                        if (entry.send_heartbeat)
+                        {
+                            group.add_heartbeat(first_seq, last_seq, entry.heartbeat_count, disable_positive_acks_,
+                                    false);
+                        }
+                    }
+                }
+                catch (const RTPSMessageGroup::timeout&)
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+                    // The messages of the readers on this task may not have been sent
+                    for (ParallelSendEntry& entry : entries)
+                    {
+                        entry.delivered = false;
+                    }
+                }
+            });
+
+    DeliveryRetCode ret_code = DeliveryRetCode::DELIVERED;
+    size_t sent_locators = 0;
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        for (const ParallelSendEntry& entry : parallel_send_tasks_[i])
+        {
+            if (!entry.delivered)
+            {
+                ret_code = DeliveryRetCode::NOT_DELIVERED;
+            }
+            sent_locators += entry.sent_locators;
+        }
+    }
+
+    if (0 < sent_locators)
+    {
+        add_statistics_sent_submessage(change, sent_locators);
+    }
+    if (any_heartbeat)
+    {
+        // Update calculate of heartbeat piggyback.
+        currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
+    }
+
+    return ret_code;
+}
+
+void StatefulWriter::send_heartbeat_to_readers_in_parallel_nts()
+{
+    SequenceNumber_t first_seq_to_check_acknowledge = get_seq_num_min();
+    if (SequenceNumber_t::unknown() == first_seq_to_check_acknowledge)
+    {
+        first_seq_to_check_acknowledge = history_->next_sequence_number() - 1;
+    }
+
+    // Same readers send_heartbeat_to_nts would send a heartbeat to
+    size_t num_readers = 0;
+    for (ReaderProxy* reader : matched_remote_readers_)
+    {
+        if (reader->is_reliable() && reader->has_unacknowledged(first_seq_to_check_acknowledge))
+        {
+            ++num_readers;
+        }
+    }
+
+    if (0 == num_readers)
+    {
+        return;
+    }
+
+    SequenceNumber_t first_seq = get_seq_num_min();
+    SequenceNumber_t last_seq = get_seq_num_max();
+    bool history_has_changes = (first_seq != c_SequenceNumber_Unknown && last_seq != c_SequenceNumber_Unknown);
+    if (!history_has_changes)
+    {
+        first_seq = next_sequence_number();
+        last_seq = first_seq - 1;
+    }
+
+    size_t num_tasks = prepare_parallel_send_tasks_nts(num_readers);
+    for (ReaderProxy* reader : matched_remote_readers_)
+    {
+        if (reader->is_reliable() && reader->has_unacknowledged(first_seq_to_check_acknowledge))
+        {
+            increment_hb_count();
+            size_t task = static_cast<size_t>(locator_group_hash(reader) % num_tasks);
+            parallel_send_tasks_[task].push_back({reader, true, heartbeat_count_, 0u, false});
+        }
+    }
+
+    mp_RTPSParticipant->get_writer_send_pool().run(num_tasks, [&](size_t task)
+            {
+                std::vector<ParallelSendEntry>& entries = parallel_send_tasks_[task];
+                if (entries.empty())
+                {
+                    return;
+                }
+
+                try
+                {
+                    RTPSMessageGroup group(mp_RTPSParticipant, this, entries.front().reader->message_sender());
+
+                    for (ParallelSendEntry& entry : entries)
+                    {
+                        group.sender(this, entry.reader->message_sender());
+                        if (history_has_changes)
+                        {
+                            add_gaps_for_holes_in_history(group);
+                        }
+                        group.add_heartbeat(first_seq, last_seq, entry.heartbeat_count, disable_positive_acks_, false);
+                    }
+                }
+                catch (const RTPSMessageGroup::timeout&)
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+                }
+            });
+
+    // Update calculate of heartbeat piggyback.
+    currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
+
+    EPROSIMA_LOG_INFO(RTPS_WRITER,
+            getGuid().entityId << " Sending Heartbeat (" << first_seq << " - " << last_seq << ") to " <<
+            num_readers << " readers in parallel");
+}
+
 /*
  * MATCHED_READER-RELATED METHODS
  */
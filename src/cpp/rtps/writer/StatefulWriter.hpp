@@ -21,6 +21,7 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/history/IChangePool.hpp>
@@ -399,6 +400,56 @@ private:
             LocatorSelectorSender& locator_selector,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /**
+     * Check whether the messages for the remote readers can be built and sent in parallel on the participant's
+     * writer send pool.
+     * Only the separate messages of the remote readers are sent in parallel: local readers are served on the
+     * calling thread, as delivering to them runs their reception code and listeners, and data-sharing readers
+     * only receive a notification.
+     * Liveliness heartbeats are also sent serially.
+     * When sending changes, callers must also check the message group of the flow controller does not limit the
+     * sent bytes, as that limitation is accounted on a single message group.
+     */
+    bool can_send_to_readers_in_parallel_nts();
+
+    /**
+     * Prepare @c parallel_send_tasks_ to distribute readers among tasks of the participant's writer send pool.
+     *
+     * @param num_readers  Number of readers to distribute.
+     *
+     * @return Number of tasks to run.
+     */
+    size_t prepare_parallel_send_tasks_nts(
+            size_t num_readers);
+
+    /**
+     * Send a change to the active remote readers, using a separate message group for each reader, on the
+     * participant's writer send pool.
+     * Readers are partitioned by their locators, and the readers of each partition are served in order by the same
+     * thread, so the order of the messages sent to a reader is kept.
+     *
+     * @param change             Change to send.
+     * @param first_reader       First reader to check for activity.
+     * @param fragment           Fragment to send, when the change is fragmented.
+     * @param inline_qos         Whether to add inline QoS to the fragments.
+     * @param max_blocking_time  Maximum time to wait while sending.
+     *
+     * @return DELIVERED when the change was added to the messages of all the active readers.
+     */
+    DeliveryRetCode deliver_sample_to_readers_in_parallel_nts(
+            CacheChange_t* change,
+            ResourceLimitedVector<ReaderProxy*>::iterator first_reader,
+            FragmentNumber_t fragment,
+            bool inline_qos,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Send a periodic heartbeat to the reliable remote readers with unacknowledged changes, using a separate message
+     * group for each reader, on the participant's writer send pool.
+     * Readers are partitioned by their locators as in @c deliver_sample_to_readers_in_parallel_nts.
+     */
+    void send_heartbeat_to_readers_in_parallel_nts();
+
     void prepare_datasharing_delivery(
             CacheChange_t* change);
 
@@ -436,6 +487,22 @@ private:
     using ReaderProxyIterator = ResourceLimitedVector<ReaderProxy*>::iterator;
     using ReaderProxyConstIterator = ResourceLimitedVector<ReaderProxy*>::const_iterator;
 
+    /// Work of a reader when sending a change or a heartbeat to the matched readers in parallel.
+    struct ParallelSendEntry
+    {
+        ReaderProxy* reader;
+        /// Whether a heartbeat is sent to the reader.
+        bool send_heartbeat;
+        /// Count of the heartbeat sent to the reader.
+        Count_t heartbeat_count;
+        /// Number of locators the change was sent to, for statistics.
+        size_t sent_locators;
+        bool delivered;
+    };
+
+    /// Readers served by each task when sending to the matched readers in parallel.
+    std::vector<std::vector<ParallelSendEntry>> parallel_send_tasks_;
+
     /// To avoid notifying twice of the same sequence number
     SequenceNumber_t next_all_acked_notify_sequence_;
     SequenceNumber_t min_readers_low_mark_;
@@ -730,6 +730,28 @@ bool StatelessWriter::send_nts(
     return send_to_fixed_locators(buffers, total_bytes, max_blocking_time_point);
 }
 
+bool StatelessWriter::send_segments_nts(
+        const std::vector<NetworkBuffer>& buffers,
+        const uint32_t& total_bytes,
+        uint32_t segment_size,
+        const LocatorSelectorSender& locator_selector,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    if (!BaseWriter::send_segments_nts(buffers, total_bytes, segment_size, locator_selector,
+            max_blocking_time_point))
+    {
+        return false;
+    }
+
+    // Fixed locators may be handled differently by derived writers, so each message is sent on its own
+    return fixed_locators_.empty() ||
+           for_each_segment(buffers, segment_size,
+                   [&](const std::vector<NetworkBuffer>& segment, uint32_t segment_bytes)
+                   {
+                       return send_to_fixed_locators(segment, segment_bytes, max_blocking_time_point);
+                   });
+}
+
 bool StatelessWriter::send_to_fixed_locators(
         const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
         const uint32_t& total_bytes,
@@ -148,6 +148,13 @@ public:
             const LocatorSelectorSender& locator_selector,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const final;
 
+    bool send_segments_nts(
+            const std::vector<NetworkBuffer>& buffers,
+            const uint32_t& total_bytes,
+            uint32_t segment_size,
+            const LocatorSelectorSender& locator_selector,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const final;
+
     bool process_acknack(
             const GUID_t& writer_guid,
             const GUID_t& reader_guid,
@@ -34,6 +34,7 @@
 #include <string.h>
 
 #include <security/cryptography/AESGCMGMAC_KeyFactory.h>
+#include <utils/WorkerPool.hpp>
 
 // Solve error with Win32 macro
 #ifdef WIN32
@@ -166,6 +167,7 @@ std::shared_ptr<ParticipantCryptoHandle> AESGCMGMAC_KeyFactory::register_local_p
             (plugin_attrs & PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ORIGIN_AUTHENTICATED) != 0;
     bool use_256_bits = true;
     uint64_t maxblockspersession = 32; //Default to key update every 32 usages if the user does not specify otherwise
+    uint32_t mac_threads = 0; //Default to computing the receiver specific MACs on the sending thread
     if (!participant_properties.empty())
     {
         for (auto it = participant_properties.begin(); it != participant_properties.end(); ++it)
@@ -191,11 +193,32 @@ std::shared_ptr<ParticipantCryptoHandle> AESGCMGMAC_KeyFactory::register_local_p
                 {
                 }
             }
+            if ((it)->name().compare("dds.sec.crypto.mac_threads") == 0)
+            {
+                try
+                {
+                    int tmp = std::stoi((it)->value());
+                    if (tmp > 0)
+                    {
+                        mac_threads = static_cast<uint32_t>(tmp);
+                    }
+                }
+                catch (std::invalid_argument&)
+                {
+                }
+            }
         }//endfor
     }//endif
 
     create_key((*PCrypto)->ParticipantKeyMaterial, is_rtps_encrypted, use_256_bits);
 
+    //Workers for the receiver specific MACs, shared with the local endpoints of the participant
+    if (mac_threads > 0)
+    {
+        (*PCrypto)->MacWorkers = std::make_shared<WorkerPool>();
+        (*PCrypto)->MacWorkers->init_threads(mac_threads, ThreadSettings{}, "dds.mac.%u.%u", 0);
+    }
+
     //Set values related to key update policy
     (*PCrypto)->max_blocks_per_session = maxblockspersession;
     (*PCrypto)->Session.session_block_counter = maxblockspersession + 1; //Set to update upon first usage
@@ -453,6 +476,7 @@ DatawriterCryptoHandle* AESGCMGMAC_KeyFactory::register_local_datawriter(
     std::unique_lock<std::mutex> david_loftus_lock(participant_handle->mutex_);
 
     (*WCrypto)->Participant_master_key_id = participant_handle->ParticipantKeyMaterial.sender_key_id;
+    (*WCrypto)->MacWorkers = participant_handle->MacWorkers;
 
     // TODO: promote to weak_from_this() when c++17 is enforced
     (*WCrypto)->Parent_participant = std::weak_ptr<ParticipantCryptoHandle>(participant_crypto.shared_from_this());
@@ -657,6 +681,7 @@ DatareaderCryptoHandle* AESGCMGMAC_KeyFactory::register_local_datareader(
     std::unique_lock<std::mutex> lock(participant_handle->mutex_);
 
     (*RCrypto)->Participant_master_key_id = participant_handle->ParticipantKeyMaterial.sender_key_id;
+    (*RCrypto)->MacWorkers = participant_handle->MacWorkers;
 
     (*RCrypto)->Parent_participant
         = std::weak_ptr<ParticipantCryptoHandle>(participant_crypto.shared_from_this());
@@ -21,10 +21,13 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/common/CdrSerialization.hpp>
 #include <rtps/messages/CDRMessage.hpp>
+#include <utils/WorkerPool.hpp>
 
 #include <openssl/aes.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
+
+#include <algorithm>
 #include <cstring>
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
@@ -65,6 +68,171 @@ static KeyMaterial_AES_GCM_GMAC* find_key(
     return nullptr;
 }
 
+/**
+ * Cipher contexts reused by all the transformations done on a thread, instead of allocating one for each of them.
+ * There is one context for each cipher and direction, bound to its cipher when created, so each transformation only
+ * sets its key and initialization vector.
+ */
+class ThreadCipherContexts
+{
+public:
+
+    ~ThreadCipherContexts()
+    {
+        for (EVP_CIPHER_CTX* ctx : contexts_)
+        {
+            if (nullptr != ctx)
+            {
+                EVP_CIPHER_CTX_free(ctx);
+            }
+        }
+    }
+
+    /**
+     * Get the context of the calling thread for a cipher and direction.
+     * @return The context, or nullptr if it could not be created.
+     */
+    static EVP_CIPHER_CTX* get(
+            bool use_256_bits,
+            bool encrypt)
+    {
+        static thread_local ThreadCipherContexts contexts;
+        return contexts.context(use_256_bits, encrypt);
+    }
+
+private:
+
+    EVP_CIPHER_CTX* context(
+            bool use_256_bits,
+            bool encrypt)
+    {
+        EVP_CIPHER_CTX*& ctx = contexts_[(use_256_bits ? 2 : 0) + (encrypt ? 1 : 0)];
+
+        if (nullptr == ctx)
+        {
+            ctx = EVP_CIPHER_CTX_new();
+            const EVP_CIPHER* cipher = use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm();
+            if (nullptr != ctx && !EVP_CipherInit_ex(ctx, cipher, nullptr, nullptr, nullptr, encrypt ? 1 : 0))
+            {
+                EVP_CIPHER_CTX_free(ctx);
+                ctx = nullptr;
+            }
+        }
+
+        return ctx;
+    }
+
+    std::array<EVP_CIPHER_CTX*, 4> contexts_ {{nullptr, nullptr, nullptr, nullptr}};
+};
+
+//! Minimum number of receivers whose MACs are computed by each task when a pool of MAC workers is used.
+constexpr size_t receivers_per_mac_task = 8;
+
+//! Receiver specific MAC to be added to the SecureDataTag of a message.
+template<typename ReceiverHandle>
+struct ReceiverSpecificMac
+{
+    ReceiverHandle* receiver = nullptr;
+    CryptoTransformKeyId key_id = c_transformKeyIdZero;
+    std::array<uint8_t, 16> mac {};
+    bool valid = false;
+};
+
+/**
+ * Compute the receiver specific MAC of a message, as the GMAC of its common MAC with the session key of the receiver.
+ * @return Whether the MAC could be computed.
+ */
+static bool compute_receiver_specific_mac(
+        bool use_256_bits,
+        const std::array<uint8_t, 32>& session_key,
+        const std::array<uint8_t, 12>& initialization_vector,
+        const std::array<uint8_t, 16>& common_mac,
+        std::array<uint8_t, 16>& mac)
+{
+    int actual_size = 0, final_size = 0;
+    EVP_CIPHER_CTX* e_ctx = ThreadCipherContexts::get(use_256_bits, true);
+    if (nullptr == e_ctx ||
+            !EVP_EncryptInit_ex(e_ctx, nullptr, nullptr, session_key.data(), initialization_vector.data()))
+    {
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to encode the payload. EVP_EncryptInit function returns an error");
+        return false;
+    }
+    if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, common_mac.data(), 16))
+    {
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
+        return false;
+    }
+    if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+    {
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
+        return false;
+    }
+    return 1 == EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, mac.data());
+}
+
+/**
+ * Compute the receiver specific MACs of a message and serialize them, in the order of the receivers.
+ *
+ * With a pool of MAC workers and enough receivers, the receivers are split in consecutive ranges computed in
+ * parallel. Each receiver is only accessed by the task of its range, and the MACs are serialized once all of them
+ * are computed, so the result is the same as when they are computed one after the other.
+ *
+ * @param serializer   Serializer where the key id and MAC of each receiver are added.
+ * @param macs         Receivers of the message, where the MACs are computed.
+ * @param mac_workers  Pool of MAC workers, or nullptr to compute the MACs on the calling thread.
+ * @param compute_mac  Functor filling the key id and MAC of a receiver, returning whether it succeeded.
+ *
+ * @return Number of receiver specific MACs serialized.
+ */
+template<typename ReceiverHandle, typename ComputeMac>
+static uint32_t serialize_receiver_specific_macs(
+        eprosima::fastcdr::Cdr& serializer,
+        std::vector<ReceiverSpecificMac<ReceiverHandle>>& macs,
+        WorkerPool* mac_workers,
+        const ComputeMac& compute_mac)
+{
+    size_t num_tasks = 1;
+    if (nullptr != mac_workers && 0 < mac_workers->size())
+    {
+        num_tasks = (std::min)(mac_workers->size() + 1, macs.size() / receivers_per_mac_task);
+    }
+
+    if (1 < num_tasks)
+    {
+        mac_workers->run(num_tasks, [&](size_t task)
+                {
+                    size_t first = macs.size() * task / num_tasks;
+                    size_t last = macs.size() * (task + 1) / num_tasks;
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        macs[i].valid = compute_mac(macs[i]);
+                    }
+                });
+    }
+    else
+    {
+        for (ReceiverSpecificMac<ReceiverHandle>& receiver_mac : macs)
+        {
+            receiver_mac.valid = compute_mac(receiver_mac);
+        }
+    }
+
+    uint32_t length = 0;
+    for (const ReceiverSpecificMac<ReceiverHandle>& receiver_mac : macs)
+    {
+        if (receiver_mac.valid)
+        {
+            serializer << receiver_mac.key_id;
+            serializer << receiver_mac.mac;
+            ++length;
+        }
+    }
+    return length;
+}
+
 AESGCMGMAC_Transform::AESGCMGMAC_Transform()
 {
 }
@@ -159,7 +327,7 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
     {
         std::vector<std::shared_ptr<DatareaderCryptoHandle>> receiving_datareader_crypto_list;
         if (!serialize_SecureDataTag(serializer, keyMat.transformation_kind, session->session_id,
-                initialization_vector, receiving_datareader_crypto_list, false, tag, nKeys - 1))
+                initialization_vector, receiving_datareader_crypto_list, false, tag, nKeys - 1, nullptr))
         {
             return false;
         }
@@ -294,7 +462,8 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
         const char* length_position = serializer.get_current_position();
 
         if (!serialize_SecureDataTag(serializer, keyMat.transformation_kind, session->session_id,
-                initialization_vector, receiving_datareader_crypto_list, update_specific_keys, tag, 0))
+                initialization_vector, receiving_datareader_crypto_list, update_specific_keys, tag, 0,
+                local_writer->MacWorkers.get()))
         {
             return false;
         }
@@ -436,7 +605,8 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
 
         if (!serialize_SecureDataTag(serializer, local_reader->EntityKeyMaterial.at(0).transformation_kind,
                 session->session_id,
-                initialization_vector, receiving_datawriter_crypto_list, update_specific_keys, tag, 0))
+                initialization_vector, receiving_datawriter_crypto_list, update_specific_keys, tag, 0,
+                local_reader->MacWorkers.get()))
         {
             return false;
         }
@@ -689,7 +859,7 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
     std::array<uint8_t, 32> session_key{};
     compute_sessionkey(session_key,
             sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0),
-            session_id);
+            session_id, sending_participant->ReceivedSessionKeys);
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -777,7 +947,8 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).receiver_specific_key_id,
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).master_receiver_specific_key,
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, session_id, sending_participant->ReceivedSessionKeys,
+                exception))
         {
             return false;
         }
@@ -1054,7 +1225,7 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
     memcpy(&session_id, header.session_id.data(), 4);
     //Sessionkey
     std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    compute_sessionkey(session_key, *keyMat, session_id, sending_writer->ReceivedSessionKeys);
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1113,7 +1284,7 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
                 keyMat->receiver_specific_key_id,
                 keyMat->master_receiver_specific_key,
                 keyMat->master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, session_id, sending_writer->ReceivedSessionKeys, exception))
         {
             return false;
         }
@@ -1234,7 +1405,7 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
     memcpy(&session_id, header.session_id.data(), 4);
     //Sessionkey
     std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    compute_sessionkey(session_key, *keyMat, session_id, sending_reader->ReceivedSessionKeys);
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1293,7 +1464,7 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
                 keyMat->receiver_specific_key_id,
                 keyMat->master_receiver_specific_key,
                 keyMat->master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, session_id, sending_reader->ReceivedSessionKeys, exception))
         {
             return false;
         }
@@ -1390,7 +1561,7 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
 
     //Sessionkey
     std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    compute_sessionkey(session_key, *keyMat, session_id, sending_writer->ReceivedSessionKeys);
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1430,7 +1601,7 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
     // Tag
     try
     {
-        deserialize_SecureDataTag(decoder, tag, {}, {}, {}, {}, {}, 0, exception);
+        deserialize_SecureDataTag(decoder, tag, {}, {}, {}, {}, {}, 0, sending_writer->ReceivedSessionKeys, exception);
     }
     catch (eprosima::fastcdr::exception::Exception&)
     {
@@ -1518,6 +1689,36 @@ void AESGCMGMAC_Transform::compute_sessionkey(
 #endif // if IS_OPENSSL_1_1
 }
 
+void AESGCMGMAC_Transform::compute_sessionkey(
+        std::array<uint8_t, 32>& session_key,
+        const KeyMaterial_AES_GCM_GMAC& key_mat,
+        const uint32_t session_id,
+        const SessionKeyCache& received_keys)
+{
+    bool use_256_bits = (key_mat.transformation_kind == c_transfrom_kind_aes256_gcm ||
+            key_mat.transformation_kind == c_transfrom_kind_aes256_gmac);
+    int key_len = use_256_bits ? 32 : 16;
+
+    compute_sessionkey(session_key, false, key_mat.master_sender_key, key_mat.master_salt, session_id, key_len,
+            received_keys);
+}
+
+void AESGCMGMAC_Transform::compute_sessionkey(
+        std::array<uint8_t, 32>& session_key,
+        bool receiver_specific,
+        const std::array<uint8_t, 32>& master_key,
+        const std::array<uint8_t, 32>& master_salt,
+        const uint32_t session_id,
+        int key_len,
+        const SessionKeyCache& received_keys)
+{
+    if (!received_keys.find(receiver_specific, master_key, master_salt, session_id, key_len, session_key))
+    {
+        compute_sessionkey(session_key, receiver_specific, master_key, master_salt, session_id, key_len);
+        received_keys.store(receiver_specific, master_key, master_salt, session_id, key_len, session_key);
+    }
+}
+
 void AESGCMGMAC_Transform::serialize_SecureDataHeader(
         eprosima::fastcdr::Cdr& serializer,
         const CryptoTransformKind& transformation_kind,
@@ -1546,34 +1747,18 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // AES_BLOCK_SIZE = 16
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
-    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
+    EVP_CIPHER_CTX* e_ctx = ThreadCipherContexts::get(use_256_bits, true);
 
-    if (!use_256_bits)
+    if (nullptr == e_ctx ||
+            !EVP_EncryptInit_ex(e_ctx, nullptr, nullptr, (const unsigned char*)(session_key.data()),
+            initialization_vector.data()))
     {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to encode the payload. EVP_EncryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_CTX_block_size(e_ctx);
 
     if (!do_encryption)
     {
@@ -1582,7 +1767,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 plain_buffer_len)
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Error in fastcdr trying to copy payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
         memcpy(serializer.get_current_position(), plain_buffer, plain_buffer_len);
@@ -1592,7 +1776,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1600,7 +1783,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
     }
@@ -1644,7 +1826,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 (plain_buffer_len + (2 * cipher_block_size) - 1))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Error in fastcdr trying to cipher payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1653,7 +1834,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1661,7 +1841,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1687,7 +1866,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // Get commmon_mac
     EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
-    EVP_CIPHER_CTX_free(e_ctx);
 
     if (submessage)
     {
@@ -1713,7 +1891,8 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
         std::vector<std::shared_ptr<ParticipantCryptoHandle>>& receiving_crypto_list,
         bool update_specific_keys,
         SecureDataTag& tag,
-        size_t sessionIndex)
+        size_t sessionIndex,
+        WorkerPool* mac_workers)
 {
     bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gmac);
@@ -1735,6 +1914,8 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
     serializer << length;
 
     //Check the list of receivers, search for keys and compute session keys as needed
+    static thread_local std::vector<ReceiverSpecificMac<AESGCMGMAC_EntityCryptoHandle>> macs;
+    macs.clear();
     for (auto rec = receiving_crypto_list.begin(); rec != receiving_crypto_list.end(); ++rec)
     {
         AESGCMGMAC_EntityCryptoHandle& remote_entity = AESGCMGMAC_ReaderCryptoHandle::narrow(**rec);
@@ -1759,65 +1940,31 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
             break;
         }
 
-        //Update the key if needed
-        if (update_specific_keys || remote_entity->Sessions[sessionIndex].session_id != session_id)
-        {
-            //Update triggered!
-            remote_entity->Sessions[sessionIndex].session_id = session_id;
-            compute_sessionkey(remote_entity->Sessions[sessionIndex].SessionKey, true,
-                    keyMat.master_receiver_specific_key, keyMat.master_salt, session_id, key_len);
-        }
+        macs.emplace_back();
+        macs.back().receiver = &remote_entity;
+    }
 
-        //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
-        int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        if (transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            continue;
-        }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            continue;
-        }
-        serializer << remote_entity->Remote2EntityKeyMaterial.at(0).receiver_specific_key_id;
-        EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.get_current_position());
-        serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
+    length = serialize_receiver_specific_macs(serializer, macs, mac_workers,
+                    [&](ReceiverSpecificMac<AESGCMGMAC_EntityCryptoHandle>& receiver_mac)
+                    {
+                        AESGCMGMAC_EntityCryptoHandle& remote_entity = *receiver_mac.receiver;
+                        auto& keyMat = remote_entity->Remote2EntityKeyMaterial.at(0);
+                        KeySessionData& session = remote_entity->Sessions[sessionIndex];
 
-        ++length;
-    }
+                        //Update the key if needed
+                        if (update_specific_keys || session.session_id != session_id)
+                        {
+                            //Update triggered!
+                            session.session_id = session_id;
+                            compute_sessionkey(session.SessionKey, true,
+                            keyMat.master_receiver_specific_key, keyMat.master_salt, session_id, key_len);
+                        }
+
+                        //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
+                        receiver_mac.key_id = keyMat.receiver_specific_key_id;
+                        return compute_receiver_specific_mac(use_256_bits, session.SessionKey, initialization_vector,
+                        tag.common_mac, receiver_mac.mac);
+                    });
 
     eprosima::fastcdr::Cdr::state current_state = serializer.get_state();
     serializer.set_state(length_state);
@@ -1841,6 +1988,8 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
     serializer << length;
 
     //Check the list of receivers, search for keys and compute session keys as needed
+    static thread_local std::vector<ReceiverSpecificMac<AESGCMGMAC_ParticipantCryptoHandle>> macs;
+    macs.clear();
     for (auto rec = receiving_crypto_list.begin(); rec != receiving_crypto_list.end(); ++rec)
     {
 
@@ -1866,72 +2015,37 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
             break;
         }
 
-        bool use_256_bits = (keyMat.transformation_kind == c_transfrom_kind_aes256_gcm ||
-                keyMat.transformation_kind == c_transfrom_kind_aes256_gmac);
-        int key_len = use_256_bits ? 32 : 16;
+        macs.emplace_back();
+        macs.back().receiver = &remote_participant;
+    }
 
-        //Update the key if needed
-        if ((update_specific_keys || remote_participant->Session.session_id != local_participant->Session.session_id) &&
-                (*remote_participant != *local_participant))
-        {
-            //Update triggered!
-            remote_participant->Session.session_id = local_participant->Session.session_id;
-            compute_sessionkey(remote_participant->Session.SessionKey, true,
-                    keyMat.master_receiver_specific_key, keyMat.master_salt, remote_participant->Session.session_id,
-                    key_len);
-        }
+    length = serialize_receiver_specific_macs(serializer, macs, local_participant->MacWorkers.get(),
+                    [&](ReceiverSpecificMac<AESGCMGMAC_ParticipantCryptoHandle>& receiver_mac)
+                    {
+                        AESGCMGMAC_ParticipantCryptoHandle& remote_participant = *receiver_mac.receiver;
+                        auto& keyMat = remote_participant->Participant2ParticipantKeyMaterial.at(0);
 
-        //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
-        int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        auto& trans_kind = remote_participant->Participant2ParticipantKeyMaterial.at(0).transformation_kind;
-        if (trans_kind == c_transfrom_kind_aes128_gcm ||
-                trans_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (trans_kind == c_transfrom_kind_aes256_gcm ||
-                trans_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            continue;
-        }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            continue;
-        }
-        serializer << remote_participant->Participant2ParticipantKeyMaterial.at(0).receiver_specific_key_id;
-        EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.get_current_position());
-        serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
+                        bool use_256_bits = (keyMat.transformation_kind == c_transfrom_kind_aes256_gcm ||
+                        keyMat.transformation_kind == c_transfrom_kind_aes256_gmac);
+                        int key_len = use_256_bits ? 32 : 16;
 
-        ++length;
-    }
+                        //Update the key if needed
+                        if ((update_specific_keys ||
+                        remote_participant->Session.session_id != local_participant->Session.session_id) &&
+                        (*remote_participant != *local_participant))
+                        {
+                            //Update triggered!
+                            remote_participant->Session.session_id = local_participant->Session.session_id;
+                            compute_sessionkey(remote_participant->Session.SessionKey, true,
+                            keyMat.master_receiver_specific_key, keyMat.master_salt,
+                            remote_participant->Session.session_id, key_len);
+                        }
+
+                        //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
+                        receiver_mac.key_id = keyMat.receiver_specific_key_id;
+                        return compute_receiver_specific_mac(use_256_bits, remote_participant->Session.SessionKey,
+                        initialization_vector, tag.common_mac, receiver_mac.mac);
+                    });
 
     eprosima::fastcdr::Cdr::state current_state = serializer.get_state();
     serializer.set_state(length_state);
@@ -1970,35 +2084,19 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gmac);
 
-    EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
+    EVP_CIPHER_CTX* d_ctx = ThreadCipherContexts::get(use_256_bits, false);
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
 
-    if (!use_256_bits)
+    if (nullptr == d_ctx ||
+            !EVP_DecryptInit_ex(d_ctx, nullptr, nullptr, (const unsigned char*)session_key.data(),
+            initialization_vector.data()))
     {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_128_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to decode the payload. EVP_DecryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_256_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_CTX_block_size(d_ctx);
 
     uint32_t protected_len = body_length;
     if (do_encryption)
@@ -2010,7 +2108,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
         if (plain_buffer_len < (protected_len + cipher_block_size))
         {
             EPROSIMA_LOG_WARNING(SECURITY_CRYPTO, "Error in fastcdr trying to decode payload");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
     }
@@ -2021,7 +2118,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     {
         EPROSIMA_LOG_WARNING(SECURITY_CRYPTO,
                 "Unable to decode the payload. EVP_DecryptUpdate function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
 
@@ -2031,10 +2127,8 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     {
         EPROSIMA_LOG_WARNING(SECURITY_CRYPTO,
                 "Unable to decode the payload. EVP_DecryptFinal function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
-    EVP_CIPHER_CTX_free(d_ctx);
 
     uint32_t cnt_len = do_encryption ? static_cast<uint32_t>(actual_size + final_size) : body_length;
     if (plain_buffer_len < cnt_len)
@@ -2103,6 +2197,7 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         const std::array<uint8_t, 32>& master_salt,
         const std::array<uint8_t, 12>& initialization_vector,
         const uint32_t session_id,
+        const SessionKeyCache& received_keys,
         SecurityException& exception)
 {
     decoder >> tag.common_mac;
@@ -2138,8 +2233,7 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         }
 
         //Auth message - The point is that we cannot verify the authorship of the message with our receiver_specific_key the message could be crafted
-        EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
-        const EVP_CIPHER* d_cipher = nullptr;
+        EVP_CIPHER_CTX* d_ctx = nullptr;
 
         int actual_size = 0, final_size = 0;
 
@@ -2150,28 +2244,29 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         if (transformation_kind == c_transfrom_kind_aes128_gcm ||
                 transformation_kind == c_transfrom_kind_aes128_gmac)
         {
-            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 16);
-            d_cipher = EVP_aes_128_gcm();
+            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 16,
+                    received_keys);
+            d_ctx = ThreadCipherContexts::get(false, false);
         }
         else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
                 transformation_kind == c_transfrom_kind_aes256_gmac)
         {
-            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 32);
-            d_cipher = EVP_aes_256_gcm();
+            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 32,
+                    received_keys);
+            d_ctx = ThreadCipherContexts::get(true, false);
         }
         else
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Invalid transformation kind)");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        if (!EVP_DecryptInit(d_ctx, d_cipher, (const unsigned char*)specific_session_key.data(),
+        if (nullptr == d_ctx ||
+                !EVP_DecryptInit_ex(d_ctx, nullptr, nullptr, (const unsigned char*)specific_session_key.data(),
                 initialization_vector.data()))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2179,7 +2274,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2187,7 +2281,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_CIPHER_CTX_ctrl function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2195,11 +2288,9 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptFinal_ex function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        EVP_CIPHER_CTX_free(d_ctx);
     }
 
     return true;
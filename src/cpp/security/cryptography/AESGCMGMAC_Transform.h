@@ -118,6 +118,22 @@ public:
             const KeyMaterial_AES_GCM_GMAC& key,
             const uint32_t session_id);
 
+    //Aux functions to obtain the session key of a received message, reusing the keys derived for previous messages
+    void compute_sessionkey(
+            std::array<uint8_t, 32>& session_key,
+            bool receiver_specific,
+            const std::array<uint8_t, 32>& master_key,
+            const std::array<uint8_t, 32>& master_salt,
+            const uint32_t session_id,
+            int key_len,
+            const SessionKeyCache& received_keys);
+
+    void compute_sessionkey(
+            std::array<uint8_t, 32>& session_key,
+            const KeyMaterial_AES_GCM_GMAC& key,
+            const uint32_t session_id,
+            const SessionKeyCache& received_keys);
+
     //Serialization and deserialization of message components
     void serialize_SecureDataHeader(
             eprosima::fastcdr::Cdr& serializer,
@@ -145,7 +161,8 @@ public:
             std::vector<std::shared_ptr<EntityCryptoHandle>>& receiving_crypto_list,
             bool update_specific_keys,
             SecureDataTag& tag,
-            size_t sessionIndex);
+            size_t sessionIndex,
+            WorkerPool* mac_workers);
 
     bool serialize_SecureDataTag(
             eprosima::fastcdr::Cdr& serializer,
@@ -190,6 +207,7 @@ public:
             const std::array<uint8_t, 32>& master_salt,
             const std::array<uint8_t, 12>& initialization_vector,
             uint32_t session_id,
+            const SessionKeyCache& received_keys,
             SecurityException& exception);
 
     uint32_t calculate_extra_size_for_rtps_message(
@@ -19,9 +19,11 @@
 #ifndef _SECURITY_AUTHENTICATION_AESGCMGMAC_TYPES_H_
 #define _SECURITY_AUTHENTICATION_AESGCMGMAC_TYPES_H_
 
+#include <array>
 #include <cassert>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <mutex>
 
 #include <fastdds/rtps/attributes/PropertyPolicy.hpp>
@@ -56,6 +58,9 @@
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
+
+class WorkerPool;
+
 namespace security {
 
 constexpr CryptoTransformKind c_transfrom_kind_none = CRYPTO_TRANSFORMATION_KIND_NONE;
@@ -144,6 +149,85 @@ struct KeySessionData
     uint64_t session_block_counter = 0;
 };
 
+/* Session key cache
+ * -----------------
+ * Deriving a session key from the master key material costs an HMAC-SHA256, and the decoding side would otherwise
+ * derive it again for every received message. Remote CryptoHandles keep the last keys derived for the sessions of
+ * their incoming messages, so the derivation is only done when the remote element starts a new session.
+ * Entries are matched on all the inputs of the derivation, so an update of the key material never returns a stale key.
+ * The cache is thread safe, as the same remote element may be decoded from several reception threads.
+ */
+class SessionKeyCache
+{
+public:
+
+    //! Common and receiver specific keys of the current and the previous session of the remote element
+    static constexpr size_t max_entries = 4;
+
+    bool find(
+            bool receiver_specific,
+            const std::array<uint8_t, 32>& master_key,
+            const std::array<uint8_t, 32>& master_salt,
+            uint32_t session_id,
+            int key_len,
+            std::array<uint8_t, 32>& session_key) const
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        for (const Entry& entry : entries_)
+        {
+            if (entry.valid && entry.session_id == session_id && entry.key_len == key_len &&
+                    entry.receiver_specific == receiver_specific &&
+                    entry.master_key == master_key && entry.master_salt == master_salt)
+            {
+                session_key = entry.session_key;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void store(
+            bool receiver_specific,
+            const std::array<uint8_t, 32>& master_key,
+            const std::array<uint8_t, 32>& master_salt,
+            uint32_t session_id,
+            int key_len,
+            const std::array<uint8_t, 32>& session_key) const
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        Entry& entry = entries_[next_entry_];
+        next_entry_ = (next_entry_ + 1) % max_entries;
+
+        entry.valid = true;
+        entry.receiver_specific = receiver_specific;
+        entry.key_len = key_len;
+        entry.session_id = session_id;
+        entry.master_key = master_key;
+        entry.master_salt = master_salt;
+        entry.session_key = session_key;
+    }
+
+private:
+
+    struct Entry
+    {
+        bool valid = false;
+        bool receiver_specific = false;
+        int key_len = 0;
+        uint32_t session_id = 0;
+        std::array<uint8_t, 32> master_key = c_empty_key_material;
+        std::array<uint8_t, 32> master_salt = c_empty_key_material;
+        std::array<uint8_t, 32> session_key = c_empty_key_material;
+    };
+
+    mutable std::array<Entry, max_entries> entries_;
+    mutable size_t next_entry_ = 0;
+    mutable std::mutex mutex_;
+};
+
 struct EntityKeyHandle
 {
     static const char* const class_id_;
@@ -169,6 +253,10 @@ struct EntityKeyHandle
     //Data used to store the current session keys and to determine when it has to be updated
     KeySessionData Sessions[2];
     uint64_t max_blocks_per_session = 0;
+    //Session keys derived for the messages received from the remote entity, not used in LocalCryptoHandles
+    SessionKeyCache ReceivedSessionKeys;
+    //Workers computing the receiver specific MACs in parallel (inherited from the parent participant), may be null
+    std::shared_ptr<WorkerPool> MacWorkers;
     std::mutex mutex_;
 };
 
@@ -203,6 +291,10 @@ struct ParticipantKeyHandle
     //Data used to store the current session keys and to determine when it has to be updated
     KeySessionData Session;
     uint64_t max_blocks_per_session = {0};
+    //Session keys derived for the messages received from the remote participant, not used in LocalCryptoHandles
+    SessionKeyCache ReceivedSessionKeys;
+    //Workers computing the receiver specific MACs in parallel, only in LocalCryptoHandles and may be null
+    std::shared_ptr<WorkerPool> MacWorkers;
     std::mutex mutex_;
 };
 
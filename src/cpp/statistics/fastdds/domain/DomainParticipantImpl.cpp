@@ -630,6 +630,23 @@ bool DomainParticipantImpl::delete_topic_and_type(
     return true;
 }
 
+efd::ReturnCode_t DomainParticipantImpl::get_filter_evaluation_statistics(
+        const fastdds::rtps::GUID_t& writer_guid,
+        efd::ReaderFilterCollection::EvaluationStatistics& statistics) const
+{
+    std::lock_guard<std::mutex> lock(mtx_pubs_);
+    for (auto& pub : publishers_)
+    {
+        efd::ReturnCode_t ret = pub.second->get_filter_evaluation_statistics(writer_guid, statistics);
+        if (efd::RETCODE_BAD_PARAMETER != ret)
+        {
+            return ret;
+        }
+    }
+
+    return efd::RETCODE_BAD_PARAMETER;
+}
+
 bool DomainParticipantImpl::get_monitoring_status(
         const fastdds::rtps::GUID_t& entity_guid,
         eprosima::fastdds::statistics::MonitorServiceData& status)
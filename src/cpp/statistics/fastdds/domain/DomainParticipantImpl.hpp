@@ -37,6 +37,7 @@
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastdds/domain/DomainParticipantImpl.hpp>
+#include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
 
 #include "DomainParticipantStatisticsListener.hpp"
 #include <statistics/rtps/monitor-service/Interfaces.hpp>
@@ -184,6 +185,20 @@ public:
             fastdds::dds::SubscriptionBuiltinTopicData& data,
             const fastdds::statistics::MonitorServiceStatusData& msg);
 
+    /**
+     * Retrieve the counters of the filter evaluations performed for writer side filtering by a local DataWriter.
+     *
+     * @param [in] writer_guid   GUID of the DataWriter.
+     * @param [out] statistics   Counters of the evaluations performed on behalf of its matched readers.
+     *
+     * @return RETCODE_BAD_PARAMETER if the DataWriter does not belong to this participant, RETCODE_NOT_ENABLED if
+     *         it is not enabled, RETCODE_UNSUPPORTED if writer side filtering is not active on it, and RETCODE_OK
+     *         otherwise.
+     */
+    efd::ReturnCode_t get_filter_evaluation_statistics(
+            const fastdds::rtps::GUID_t& writer_guid,
+            efd::ReaderFilterCollection::EvaluationStatistics& statistics) const;
+
     /**
      * Gets the status observer for that entity
      *
@@ -21,6 +21,7 @@
 #include <unistd.h>
 #endif // if defined(_WIN32)
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -242,6 +243,18 @@ public:
     static std::string get_timestamp(
             const char* format = "%F %T");
 
+    /**
+     * Get a time point as string, formatting it as specified by argument format.
+     *
+     * @param [in] time Time point to be printed.
+     * @param [in] format Format of the date to be printed. Default "%F %T".
+     *
+     * @return The time point in string format
+     */
+    static std::string get_timestamp(
+            const std::chrono::system_clock::time_point& time,
+            const char* format = "%F %T");
+
     /**
      * Fetch and store/update the information relative to all network interfaces present on the system.
      *
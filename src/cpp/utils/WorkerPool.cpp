@@ -0,0 +1,147 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WorkerPool.cpp
+ */
+
+#include <utils/WorkerPool.hpp>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+WorkerPool::~WorkerPool()
+{
+    stop_threads();
+}
+
+void WorkerPool::init_threads(
+        uint32_t num_threads,
+        const fastdds::rtps::ThreadSettings& thread_cfg,
+        const char* name_fmt,
+        uint32_t thread_id)
+{
+    if (0 == num_threads || !threads_.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = true;
+    }
+
+    threads_.reserve(num_threads);
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads_.emplace_back(create_thread([this]()
+                {
+                    worker_loop();
+                }, thread_cfg, name_fmt, thread_id, i));
+    }
+}
+
+void WorkerPool::stop_threads()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    work_cv_.notify_all();
+
+    for (eprosima::thread& thread : threads_)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+    threads_.clear();
+}
+
+void WorkerPool::run(
+        size_t num_tasks,
+        const Task& task)
+{
+    std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+    if (threads_.empty() || num_tasks < 2 || !run_lock.owns_lock())
+    {
+        for (size_t i = 0; i < num_tasks; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_ = &task;
+    num_tasks_ = num_tasks;
+    next_task_ = 0;
+    pending_tasks_ = num_tasks;
+    work_cv_.notify_all();
+
+    // The calling thread takes tasks as well, so the job advances even when all the workers are still waking up
+    execute_tasks(lock);
+    done_cv_.wait(lock, [this]()
+            {
+                return 0 == pending_tasks_;
+            });
+    task_ = nullptr;
+    num_tasks_ = 0;
+}
+
+void WorkerPool::worker_loop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        work_cv_.wait(lock, [this]()
+                {
+                    return !running_ || next_task_ < num_tasks_;
+                });
+
+        if (!running_)
+        {
+            return;
+        }
+
+        execute_tasks(lock);
+    }
+}
+
+void WorkerPool::execute_tasks(
+        std::unique_lock<std::mutex>& lock)
+{
+    while (next_task_ < num_tasks_)
+    {
+        const Task* task = task_;
+        size_t index = next_task_++;
+
+        lock.unlock();
+        (*task)(index);
+        lock.lock();
+
+        if (0 == --pending_tasks_)
+        {
+            done_cv_.notify_all();
+        }
+    }
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
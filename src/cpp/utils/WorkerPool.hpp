@@ -0,0 +1,125 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WorkerPool.hpp
+ */
+
+#ifndef FASTDDS_RTPS_RESOURCES__WORKERPOOL_HPP
+#define FASTDDS_RTPS_RESOURCES__WORKERPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Pool of threads running jobs split into a number of independent tasks.
+ * Writers use it to send to different readers in parallel, and the discovery server database to process the
+ * updates of different topics in parallel.
+ *
+ * The tasks of a job are taken by the workers and by the thread running the job.
+ * Only one job is dispatched to the workers at a time. When the workers are busy with the job of another thread,
+ * the calling thread runs all the tasks by itself, so a thread never waits for the job of another one.
+ */
+class WorkerPool
+{
+public:
+
+    using Task = std::function<void(size_t)>;
+
+    WorkerPool() = default;
+
+    ~WorkerPool();
+
+    WorkerPool(
+            const WorkerPool&) = delete;
+    WorkerPool& operator =(
+            const WorkerPool&) = delete;
+
+    /**
+     * Create the worker threads.
+     *
+     * @param [in]  num_threads  Number of threads to create. Zero leaves the pool disabled.
+     * @param [in]  thread_cfg   Settings to apply to the created threads.
+     * @param [in]  name_fmt     A null-terminated string to be used as the format argument of a `snprintf` like
+     *                          function, taking @c thread_id and the index of the worker as additional arguments.
+     * @param [in]  thread_id    First variadic argument passed to the formatting function.
+     */
+    void init_threads(
+            uint32_t num_threads,
+            const fastdds::rtps::ThreadSettings& thread_cfg,
+            const char* name_fmt,
+            uint32_t thread_id);
+
+    //! Stop and join the worker threads.
+    void stop_threads();
+
+    //! Returns the number of worker threads. Zero means the pool is disabled.
+    size_t size() const
+    {
+        return threads_.size();
+    }
+
+    /**
+     * Run a job, calling @c task once for each index in [0, num_tasks).
+     * Returns when all the tasks have been run.
+     *
+     * @param num_tasks  Number of tasks of the job.
+     * @param task       Functor running the task with a given index. Should not throw.
+     */
+    void run(
+            size_t num_tasks,
+            const Task& task);
+
+private:
+
+    void worker_loop();
+
+    //! Run tasks of the current job until there are none left to take. Called with @c mutex_ locked.
+    void execute_tasks(
+            std::unique_lock<std::mutex>& lock);
+
+    std::vector<eprosima::thread> threads_;
+
+    //! Held by the thread whose job is dispatched to the workers
+    std::mutex run_mutex_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    bool running_ = false;
+
+    //! Current job
+    const Task* task_ = nullptr;
+    size_t num_tasks_ = 0;
+    size_t next_task_ = 0;
+    size_t pending_tasks_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_RESOURCES__WORKERPOOL_HPP
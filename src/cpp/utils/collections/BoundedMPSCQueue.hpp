@@ -0,0 +1,194 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BoundedMPSCQueue.hpp
+ *
+ */
+
+#ifndef FASTDDS_UTILS_COLLECTIONS_BOUNDEDMPSCQUEUE_HPP_
+#define FASTDDS_UTILS_COLLECTIONS_BOUNDEDMPSCQUEUE_HPP_
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace eprosima {
+namespace fastdds {
+
+/**
+ * A lock-free bounded queue for MPSC (multi-producer, single-consumer) comms.
+ *
+ * All the elements are preallocated on construction, and are reused once consumed.
+ * Producers fill an element in place, and the consumer processes it in place, so elements holding dynamic memory
+ * (i.e. strings) keep their capacity between uses.
+ *
+ * Each slot carries a sequence number that tells whether it is free for the producer at a given position, or
+ * ready for the consumer.
+ * Producers only contend on an atomic counter, and never wait for each other nor for the consumer.
+ *
+ * @tparam _Ty  Element type. Should be default constructible.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template<typename _Ty>
+class BoundedMPSCQueue
+{
+
+public:
+
+    using value_type = _Ty;
+    using size_type = std::size_t;
+
+    /**
+     * Construct the queue.
+     *
+     * @param capacity  Maximum number of elements in the queue. Rounded up to the next power of two.
+     */
+    explicit BoundedMPSCQueue(
+            size_type capacity)
+    {
+        size_type rounded = 2;
+        while (rounded < capacity)
+        {
+            rounded <<= 1;
+        }
+
+        mask_ = rounded - 1;
+        slots_.reset(new Slot[rounded]);
+        for (size_type i = 0; i < rounded; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMPSCQueue(
+            const BoundedMPSCQueue&) = delete;
+    BoundedMPSCQueue& operator =(
+            const BoundedMPSCQueue&) = delete;
+
+    /**
+     * Try to push an element to the queue.
+     * Can be called concurrently from any number of threads.
+     *
+     * @param fill  Functor receiving a reference to the element to fill.
+     *
+     * @return false if the queue is full, in which case @c fill has not been called.
+     */
+    template<typename Functor>
+    bool try_push(
+            Functor&& fill)
+    {
+        Slot* slot = nullptr;
+        size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            slot = &slots_[pos & mask_];
+            size_type seq = slot->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (0 == diff)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (0 > diff)
+            {
+                // The slot has not been consumed since the previous lap
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        fill(slot->value);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Try to process the element at the front of the queue, and remove it afterwards.
+     * Should only be called from the consumer thread.
+     *
+     * @param process  Functor receiving a reference to the element to process.
+     *
+     * @return false if the queue is empty, or if the element at the front is still being filled.
+     */
+    template<typename Functor>
+    bool try_pop(
+            Functor&& process)
+    {
+        size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+        {
+            return false;
+        }
+
+        process(slot.value);
+        slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        dequeue_pos_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Reports whether there are no elements ready to be processed.
+    bool empty() const
+    {
+        size_type pos = dequeue_pos_.load(std::memory_order_acquire);
+        return slots_[pos & mask_].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    //! Returns the number of positions taken by producers since construction.
+    size_type pushed() const
+    {
+        return enqueue_pos_.load(std::memory_order_acquire);
+    }
+
+    //! Returns the number of elements processed by the consumer since construction.
+    size_type popped() const
+    {
+        return dequeue_pos_.load(std::memory_order_acquire);
+    }
+
+    //! Returns the maximum number of elements in the queue.
+    size_type capacity() const
+    {
+        return mask_ + 1;
+    }
+
+private:
+
+    struct Slot
+    {
+        std::atomic<size_type> sequence{0};
+        value_type value{};
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_type mask_ = 0;
+
+    // Producer and consumer positions are kept on different cache lines
+    alignas(64) std::atomic<size_type> enqueue_pos_{0};
+    alignas(64) std::atomic<size_type> dequeue_pos_{0};
+};
+
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_UTILS_COLLECTIONS_BOUNDEDMPSCQUEUE_HPP_
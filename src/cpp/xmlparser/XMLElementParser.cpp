@@ -948,6 +948,8 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     <xs:element name="scheduler" type="flowControllerSchedulerPolicy" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="max_bytes_per_period" type="int32" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="period_ms" type="uint64" minOccurs="0" maxOccurs="1"/>
+                    <xs:element name="token_bucket_depth" type="uint32" minOccurs="0" maxOccurs="1"/>
+                    <xs:element name="token_bucket_refill_rate" type="uint64" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="sender_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
             </xs:complexType>
@@ -958,6 +960,7 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     <xs:enumeration value="ROUND_ROBIN" />
                     <xs:enumeration value="HIGH_PRIORITY" />
                     <xs:enumeration value="PRIORITY_WITH_RESERVATION" />
+                    <xs:enumeration value="DEFICIT_ROUND_ROBIN" />
                 </xs:restriction>
             </xs:simpleType>
          */
@@ -1008,7 +1011,8 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                         FIFO, FlowControllerSchedulerPolicy::FIFO,
                         HIGH_PRIORITY, FlowControllerSchedulerPolicy::HIGH_PRIORITY,
                         ROUND_ROBIN, FlowControllerSchedulerPolicy::ROUND_ROBIN,
-                        PRIORITY_WITH_RESERVATION, FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION))
+                        PRIORITY_WITH_RESERVATION, FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION,
+                        DEFICIT_ROUND_ROBIN, FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN))
                 {
                     EPROSIMA_LOG_ERROR(XMLPARSER, "Node '" << SCHEDULER << "' with bad content");
                     return XMLP_ret::XML_ERROR;
@@ -1030,6 +1034,23 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, TOKEN_BUCKET_DEPTH) == 0)
+            {
+                // token_bucket_depth - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux1, &flow_controller_descriptor->token_bucket_depth, ident))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, TOKEN_BUCKET_REFILL_RATE) == 0)
+            {
+                // token_bucket_refill_rate - uint64Type
+                if (XMLP_ret::XML_OK !=
+                        getXMLUint(p_aux1, &flow_controller_descriptor->token_bucket_refill_rate, ident))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, SENDER_THREAD) == 0)
             {
                 // sender_thread - threadSettingsType
@@ -2207,6 +2228,7 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
                 </xs:element>
                 <xs:element name="max_domains" type="uint32" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="data_sharing_listener_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="listener_spin_budget" type="uint32" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -2318,6 +2340,16 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, LISTENER_SPIN_BUDGET) == 0)
+        {
+            // listener_spin_budget - uint32Type
+            unsigned int spin_budget = 0;
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &spin_budget, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            data_sharing.listener_spin_budget(spin_budget);
+        }
         else
         {
             EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid element found in 'data_sharing'. Name: " << name);
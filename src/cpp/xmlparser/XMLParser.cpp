@@ -26,6 +26,7 @@
 
 #include <tinyxml2.h>
 
+#include <fastdds/dds/log/BinaryFileConsumer.hpp>
 #include <fastdds/dds/log/FileConsumer.hpp>
 #include <fastdds/dds/log/StdoutConsumer.hpp>
 #include <fastdds/dds/log/StdoutErrConsumer.hpp>
@@ -268,6 +269,10 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="receiveBufferSize" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="TTL" type="uint8Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="non_blocking_send" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="datagrams_per_batch" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="generic_receive_offload" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="generic_segmentation_offload" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="unicast_receive_threads" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
@@ -284,6 +289,7 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tcp_negotiation_timeout" type="uint32_t" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_queue_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
@@ -356,6 +362,38 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        // Datagrams per batch
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(DATAGRAMS_PER_BATCH)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->datagrams_per_batch, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Generic receive offload
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(GENERIC_RECEIVE_OFFLOAD)))
+        {
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pUDPDesc->generic_receive_offload, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Generic segmentation offload
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(GENERIC_SEGMENTATION_OFFLOAD)))
+        {
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pUDPDesc->generic_segmentation_offload, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        // Unicast receive threads
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(UNICAST_RECEIVE_THREADS)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->unicast_receive_threads, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
     }
     else if (sType == TCPv4)
     {
@@ -454,6 +492,10 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, NETWORK_INTERFACES) == 0 ||
                 strcmp(name, TTL) == 0 ||
                 strcmp(name, NON_BLOCKING_SEND) == 0 ||
+                strcmp(name, DATAGRAMS_PER_BATCH) == 0 ||
+                strcmp(name, GENERIC_RECEIVE_OFFLOAD) == 0 ||
+                strcmp(name, GENERIC_SEGMENTATION_OFFLOAD) == 0 ||
+                strcmp(name, UNICAST_RECEIVE_THREADS) == 0 ||
                 strcmp(name, UDP_OUTPUT_PORT) == 0 ||
                 strcmp(name, TCP_WAN_ADDR) == 0 ||
                 strcmp(name, KEEP_ALIVE_FREQUENCY) == 0 ||
@@ -468,6 +510,7 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, ACCEPT_THREAD) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 ||
                 strcmp(name, TCP_NEGOTIATION_TIMEOUT) == 0 ||
+                strcmp(name, SEND_QUEUE_SIZE) == 0 ||
                 strcmp(name, TLS) == 0 ||
                 strcmp(name, SEGMENT_SIZE) == 0 ||
                 strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
@@ -880,6 +923,7 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="keep_alive_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="accept_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_queue_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -1023,6 +1067,14 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                 }
                 pTCPDesc->tcp_negotiation_timeout = static_cast<uint32_t>(iTimeout);
             }
+            else if (strcmp(name, SEND_QUEUE_SIZE) == 0)
+            {
+                // send_queue_size - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->send_queue_size, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
         }
     }
     else
@@ -2012,15 +2064,24 @@ XMLP_ret XMLParser::parseXMLConsumer(
                 Log::RegisterConsumer(std::unique_ptr<LogConsumer>(log_consumer));
             }
         }
-        else if (std::strcmp(classStr.c_str(), "FileConsumer") == 0)
+        else if (std::strcmp(classStr.c_str(), "FileConsumer") == 0 ||
+                std::strcmp(classStr.c_str(), "BinaryFileConsumer") == 0)
         {
-            std::string outputFile = "output.log";
+            bool is_binary = std::strcmp(classStr.c_str(), "BinaryFileConsumer") == 0;
+            std::string outputFile = is_binary ? "output.blog" : "output.log";
             bool append = false;
 
             tinyxml2::XMLElement* property = consumer.FirstChildElement(PROPERTY);
             if (nullptr == property)
             {
-                Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new FileConsumer));
+                if (is_binary)
+                {
+                    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new BinaryFileConsumer));
+                }
+                else
+                {
+                    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new FileConsumer));
+                }
             }
             else
             {
@@ -2071,7 +2132,14 @@ XMLP_ret XMLParser::parseXMLConsumer(
                     property = property->NextSiblingElement(PROPERTY);
                 }
 
-                Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new FileConsumer(outputFile, append)));
+                if (is_binary)
+                {
+                    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new BinaryFileConsumer(outputFile, append)));
+                }
+                else
+                {
+                    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new FileConsumer(outputFile, append)));
+                }
             }
         }
         else
@@ -47,6 +47,10 @@ const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* DATAGRAMS_PER_BATCH = "datagrams_per_batch";
+const char* GENERIC_RECEIVE_OFFLOAD = "generic_receive_offload";
+const char* GENERIC_SEGMENTATION_OFFLOAD = "generic_segmentation_offload";
+const char* UNICAST_RECEIVE_THREADS = "unicast_receive_threads";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* NETWORK_INTERFACE = "interface";
 const char* NETMASK_FILTER = "netmask_filter";
@@ -68,6 +72,7 @@ const char* CHECK_CRC = "check_crc";
 const char* KEEP_ALIVE_THREAD = "keep_alive_thread";
 const char* ACCEPT_THREAD = "accept_thread";
 const char* TCP_NEGOTIATION_TIMEOUT = "tcp_negotiation_timeout";
+const char* SEND_QUEUE_SIZE = "send_queue_size";
 const char* SEGMENT_SIZE = "segment_size";
 const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
@@ -169,6 +174,7 @@ const char* ENTITY_ID = "entityID";
 const char* MATCHED_SUBSCRIBERS_ALLOCATION = "matchedSubscribersAllocation";
 const char* MATCHED_PUBLISHERS_ALLOCATION = "matchedPublishersAllocation";
 const char* DATA_SHARING_LISTENER_THREAD = "data_sharing_listener_thread";
+const char* LISTENER_SPIN_BUDGET = "listener_spin_budget";
 
 ///
 const char* IGN_NON_MATCHING_LOCS = "ignore_non_matching_locators";
@@ -288,11 +294,14 @@ const char* SCHEDULER = "scheduler";
 const char* SENDER_THREAD = "sender_thread";
 const char* MAX_BYTES_PER_PERIOD = "max_bytes_per_period";
 const char* PERIOD_MILLISECS = "period_ms";
+const char* TOKEN_BUCKET_DEPTH = "token_bucket_depth";
+const char* TOKEN_BUCKET_REFILL_RATE = "token_bucket_refill_rate";
 const char* FLOW_CONTROLLER_NAME = "flow_controller_name";
 const char* FIFO = "FIFO";
 const char* HIGH_PRIORITY = "HIGH_PRIORITY";
 const char* ROUND_ROBIN = "ROUND_ROBIN";
 const char* PRIORITY_WITH_RESERVATION = "PRIORITY_WITH_RESERVATION";
+const char* DEFICIT_ROUND_ROBIN = "DEFICIT_ROUND_ROBIN";
 const char* PORT_BASE = "portBase";
 const char* DOMAIN_ID_GAIN = "domainIDGain";
 const char* PARTICIPANT_ID_GAIN = "participantIDGain";
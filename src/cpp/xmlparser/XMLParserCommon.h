@@ -60,6 +60,10 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* DATAGRAMS_PER_BATCH;
+extern const char* GENERIC_RECEIVE_OFFLOAD;
+extern const char* GENERIC_SEGMENTATION_OFFLOAD;
+extern const char* UNICAST_RECEIVE_THREADS;
 extern const char* WHITE_LIST;
 extern const char* NETWORK_INTERFACE;
 extern const char* NETMASK_FILTER;
@@ -81,6 +85,7 @@ extern const char* CHECK_CRC;
 extern const char* KEEP_ALIVE_THREAD;
 extern const char* ACCEPT_THREAD;
 extern const char* TCP_NEGOTIATION_TIMEOUT;
+extern const char* SEND_QUEUE_SIZE;
 extern const char* SEGMENT_SIZE;
 extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
@@ -185,6 +190,7 @@ extern const char* ENTITY_ID;
 extern const char* MATCHED_SUBSCRIBERS_ALLOCATION;
 extern const char* MATCHED_PUBLISHERS_ALLOCATION;
 extern const char* DATA_SHARING_LISTENER_THREAD;
+extern const char* LISTENER_SPIN_BUDGET;
 
 ///
 extern const char* IGN_NON_MATCHING_LOCS;
@@ -304,8 +310,11 @@ extern const char* FIFO;
 extern const char* HIGH_PRIORITY;
 extern const char* ROUND_ROBIN;
 extern const char* PRIORITY_WITH_RESERVATION;
+extern const char* DEFICIT_ROUND_ROBIN;
 extern const char* FLOW_CONTROLLER_NAME;
 extern const char* PERIOD_MILLISECS;
+extern const char* TOKEN_BUCKET_DEPTH;
+extern const char* TOKEN_BUCKET_REFILL_RATE;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
@@ -428,13 +428,17 @@ GTEST_INSTANTIATE_TEST_MACRO(PubSubFlowControllers,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::FIFO,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::ROUND_ROBIN,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::HIGH_PRIORITY,
-            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION,
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN
             ),
         [](const testing::TestParamInfo<PubSubFlowControllers::ParamType>& info)
         {
             std::string suffix;
             switch (info.param)
             {
+                case eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN:
+                    suffix = "_SCHED_DRR";
+                    break;
                 case eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
                     suffix = "_SCHED_RESERV";
                     break;
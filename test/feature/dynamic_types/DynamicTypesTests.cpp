@@ -12720,6 +12720,392 @@ TEST_F(DynamicTypesTests, DynamicType_union_with_unions)
     EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(union_data), RETCODE_OK);
 }
 
+/*
+ * Check a structure whose member ids are neither consecutive nor in declaration order, so its values cannot be
+ * accessed by position.
+ */
+TEST_F(DynamicTypesTests, DynamicType_structure_non_consecutive_ids)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("NonConsecutiveIdsStruct");
+    DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+    ASSERT_TRUE(builder);
+
+    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+    member_descriptor->type(factory->get_primitive_type(TK_INT32));
+    member_descriptor->name("int32");
+    member_descriptor->id(10);
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    member_descriptor->name("string");
+    member_descriptor->id(2);
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->get_primitive_type(TK_FLOAT64));
+    member_descriptor->name("float64");
+    member_descriptor->id(7);
+    member_descriptor->default_value("1.5");
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    DynamicType::_ref_type struct_type {builder->build()};
+    ASSERT_TRUE(struct_type);
+
+    DynamicData::_ref_type struct_data {DynamicDataFactory::get_instance()->create_data(struct_type)};
+    ASSERT_TRUE(struct_data);
+
+    // Indexes follow the declaration order, not the member ids.
+    EXPECT_EQ(10u, struct_data->get_member_id_at_index(0));
+    EXPECT_EQ(2u, struct_data->get_member_id_at_index(1));
+    EXPECT_EQ(7u, struct_data->get_member_id_at_index(2));
+    EXPECT_EQ(MEMBER_ID_INVALID, struct_data->get_member_id_at_index(3));
+    EXPECT_EQ(10u, struct_data->get_member_id_by_name("int32"));
+    EXPECT_EQ(2u, struct_data->get_member_id_by_name("string"));
+    EXPECT_EQ(7u, struct_data->get_member_id_by_name("float64"));
+    EXPECT_EQ(3u, struct_data->get_item_count());
+
+    double float64_get {0};
+    EXPECT_EQ(struct_data->get_float64_value(float64_get, 7), RETCODE_OK);
+    EXPECT_EQ(1.5, float64_get);
+
+    {
+        eprosima::fastdds::testing::ScopeLogs _("disable");
+        // Positions of the values are not valid ids.
+        EXPECT_EQ(struct_data->set_int32_value(0, 1), RETCODE_BAD_PARAMETER);
+        EXPECT_EQ(struct_data->set_int32_value(1, 1), RETCODE_BAD_PARAMETER);
+        EXPECT_EQ(struct_data->set_int32_value(3, 1), RETCODE_BAD_PARAMETER);
+    }
+
+    const int32_t int32_set {-34};
+    const std::string string_set {"non consecutive"};
+    EXPECT_EQ(struct_data->set_int32_value(10, int32_set), RETCODE_OK);
+    EXPECT_EQ(struct_data->set_string_value(2, string_set), RETCODE_OK);
+    EXPECT_EQ(struct_data->set_float64_value(7, 3.25), RETCODE_OK);
+
+    int32_t int32_get {0};
+    std::string string_get;
+    EXPECT_EQ(struct_data->get_int32_value(int32_get, 10), RETCODE_OK);
+    EXPECT_EQ(int32_set, int32_get);
+    EXPECT_EQ(struct_data->get_string_value(string_get, 2), RETCODE_OK);
+    EXPECT_EQ(string_set, string_get);
+    EXPECT_EQ(struct_data->get_float64_value(float64_get, 7), RETCODE_OK);
+    EXPECT_EQ(3.25, float64_get);
+
+    // Test clone.
+    auto clone = struct_data->clone();
+    ASSERT_TRUE(clone);
+    EXPECT_TRUE(struct_data->equals(clone));
+
+    // Clearing a member only resets that member.
+    EXPECT_EQ(RETCODE_OK, struct_data->clear_value(7));
+    EXPECT_EQ(struct_data->get_float64_value(float64_get, 7), RETCODE_OK);
+    EXPECT_EQ(1.5, float64_get);
+    EXPECT_EQ(struct_data->get_int32_value(int32_get, 10), RETCODE_OK);
+    EXPECT_EQ(int32_set, int32_get);
+    EXPECT_FALSE(struct_data->equals(clone));
+
+    for (auto encoding : encodings)
+    {
+        DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(struct_type)};
+        encoding_decoding_test(struct_type, struct_data, data2, encoding);
+    }
+
+    // A loaned member stays valid after the structure is released.
+    DynamicData::_ref_type loan_data = struct_data->loan_value(2);
+    ASSERT_TRUE(loan_data);
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(struct_data), RETCODE_OK);
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(clone), RETCODE_OK);
+    EXPECT_EQ(loan_data->get_string_value(string_get, MEMBER_ID_INVALID), RETCODE_OK);
+    EXPECT_EQ(string_set, string_get);
+}
+
+/*
+ * Check that erasing the elements of a map keeps the values of the remaining ones, and that new elements can be
+ * added afterwards.
+ */
+TEST_F(DynamicTypesTests, DynamicType_map_erase)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    DynamicType::_ref_type string_type {factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build()};
+    DynamicTypeBuilder::_ref_type builder {factory->create_map_type(
+                                               factory->get_primitive_type(TK_INT32),
+                                               string_type,
+                                               10)};
+    ASSERT_TRUE(builder);
+    DynamicType::_ref_type created_type {builder->build()};
+    ASSERT_TRUE(created_type);
+
+    DynamicData::_ref_type data {DynamicDataFactory::get_instance()->create_data(created_type)};
+    ASSERT_TRUE(data);
+
+    const std::vector<std::string> keys {"10", "20", "30", "40"};
+    for (const auto& key : keys)
+    {
+        EXPECT_EQ(RETCODE_OK, data->set_string_value(data->get_member_id_by_name(key), "value" + key));
+    }
+    EXPECT_EQ(4u, data->get_item_count());
+
+    // Erase an element in the middle and the first one.
+    const MemberId id_20 {data->get_member_id_by_name("20")};
+    const MemberId id_10 {data->get_member_id_by_name("10")};
+    EXPECT_EQ(RETCODE_OK, data->clear_value(id_20));
+    EXPECT_EQ(RETCODE_OK, data->clear_value(id_10));
+    EXPECT_EQ(2u, data->get_item_count());
+    {
+        eprosima::fastdds::testing::ScopeLogs _("disable");
+        EXPECT_EQ(RETCODE_BAD_PARAMETER, data->clear_value(id_20));
+        std::string erased;
+        EXPECT_EQ(RETCODE_BAD_PARAMETER, data->get_string_value(erased, id_20));
+    }
+
+    std::string value;
+    EXPECT_EQ(RETCODE_OK, data->get_string_value(value, data->get_member_id_by_name("30")));
+    EXPECT_EQ("value30", value);
+    EXPECT_EQ(RETCODE_OK, data->get_string_value(value, data->get_member_id_by_name("40")));
+    EXPECT_EQ("value40", value);
+    EXPECT_EQ(2u, data->get_item_count());
+
+    // Erased keys are added again as new elements.
+    const MemberId new_id_20 {data->get_member_id_by_name("20")};
+    EXPECT_NE(MEMBER_ID_INVALID, new_id_20);
+    EXPECT_EQ(3u, data->get_item_count());
+    EXPECT_EQ(RETCODE_OK, data->get_string_value(value, new_id_20));
+    EXPECT_EQ("", value);
+    EXPECT_EQ(RETCODE_OK, data->set_string_value(new_id_20, "again20"));
+    EXPECT_EQ(RETCODE_OK, data->get_string_value(value, data->get_member_id_by_name("40")));
+    EXPECT_EQ("value40", value);
+    EXPECT_EQ(RETCODE_OK, data->get_string_value(value, new_id_20));
+    EXPECT_EQ("again20", value);
+
+    // Test clone.
+    auto clone = data->clone();
+    ASSERT_TRUE(clone);
+    EXPECT_TRUE(data->equals(clone));
+
+    for (auto encoding : encodings)
+    {
+        DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(created_type)};
+        encoding_decoding_test(created_type, data, data2, encoding);
+        EXPECT_EQ(RETCODE_OK, data2->get_string_value(value, data2->get_member_id_by_name("20")));
+        EXPECT_EQ("again20", value);
+    }
+
+    EXPECT_EQ(RETCODE_OK, data->clear_all_values());
+    EXPECT_EQ(0u, data->get_item_count());
+
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(data), RETCODE_OK);
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(clone), RETCODE_OK);
+}
+
+/*
+ * Check a union whose member ids are not consecutive and not in declaration order, switching between its members.
+ */
+TEST_F(DynamicTypesTests, DynamicType_union_non_consecutive_ids)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_UNION);
+    type_descriptor->name("NonConsecutiveIdsUnion");
+    type_descriptor->discriminator_type(factory->get_primitive_type(TK_INT32));
+    DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+    ASSERT_TRUE(builder);
+
+    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+    member_descriptor->type(factory->get_primitive_type(TK_INT64));
+    member_descriptor->name("int64");
+    member_descriptor->id(9);
+    member_descriptor->label({1});
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    member_descriptor->name("string");
+    member_descriptor->id(4);
+    member_descriptor->label({2});
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->get_primitive_type(TK_FLOAT32));
+    member_descriptor->name("float32");
+    member_descriptor->id(20);
+    member_descriptor->is_default_label(true);
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    DynamicType::_ref_type union_type {builder->build()};
+    ASSERT_TRUE(union_type);
+
+    DynamicData::_ref_type union_data {DynamicDataFactory::get_instance()->create_data(union_type)};
+    ASSERT_TRUE(union_data);
+
+    EXPECT_EQ(0u, union_data->get_member_id_at_index(0));
+    EXPECT_EQ(9u, union_data->get_member_id_by_name("int64"));
+    EXPECT_EQ(4u, union_data->get_member_id_by_name("string"));
+    EXPECT_EQ(20u, union_data->get_member_id_by_name("float32"));
+
+    // The default member is selected at creation.
+    int32_t discriminator_value {0};
+    EXPECT_EQ(union_data->get_int32_value(discriminator_value, 0), RETCODE_OK);
+    EXPECT_TRUE(1 != discriminator_value && 2 != discriminator_value);
+    EXPECT_EQ(2u, union_data->get_item_count());
+
+    const int64_t int64_set {-1234567};
+    int64_t int64_get {0};
+    EXPECT_EQ(union_data->set_int64_value(9, int64_set), RETCODE_OK);
+    EXPECT_EQ(union_data->get_int32_value(discriminator_value, 0), RETCODE_OK);
+    EXPECT_EQ(1, discriminator_value);
+    EXPECT_EQ(union_data->get_int64_value(int64_get, 9), RETCODE_OK);
+    EXPECT_EQ(int64_set, int64_get);
+    {
+        eprosima::fastdds::testing::ScopeLogs _("disable");
+        std::string string_get;
+        EXPECT_EQ(union_data->get_string_value(string_get, 4), RETCODE_BAD_PARAMETER);
+        float float32_get {0};
+        EXPECT_EQ(union_data->get_float32_value(float32_get, 20), RETCODE_BAD_PARAMETER);
+    }
+
+    for (auto encoding : encodings)
+    {
+        DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(union_type)};
+        encoding_decoding_test(union_type, union_data, data2, encoding);
+    }
+
+    const std::string string_set {"selected"};
+    std::string string_get;
+    EXPECT_EQ(union_data->set_string_value(4, string_set), RETCODE_OK);
+    EXPECT_EQ(union_data->get_int32_value(discriminator_value, 0), RETCODE_OK);
+    EXPECT_EQ(2, discriminator_value);
+    EXPECT_EQ(union_data->get_string_value(string_get, 4), RETCODE_OK);
+    EXPECT_EQ(string_set, string_get);
+    {
+        eprosima::fastdds::testing::ScopeLogs _("disable");
+        EXPECT_EQ(union_data->get_int64_value(int64_get, 9), RETCODE_BAD_PARAMETER);
+    }
+
+    for (auto encoding : encodings)
+    {
+        DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(union_type)};
+        encoding_decoding_test(union_type, union_data, data2, encoding);
+    }
+
+    EXPECT_EQ(union_data->set_float32_value(20, 2.5f), RETCODE_OK);
+    float float32_get {0};
+    EXPECT_EQ(union_data->get_float32_value(float32_get, 20), RETCODE_OK);
+    EXPECT_EQ(2.5f, float32_get);
+
+    // Test clone.
+    auto clone = union_data->clone();
+    ASSERT_TRUE(clone);
+    EXPECT_TRUE(union_data->equals(clone));
+
+    for (auto encoding : encodings)
+    {
+        DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(union_type)};
+        encoding_decoding_test(union_type, union_data, data2, encoding);
+    }
+
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(union_data), RETCODE_OK);
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(clone), RETCODE_OK);
+}
+
+/*
+ * Check the deserialization of a mutable structure whose member ids are not consecutive, where members are looked up
+ * by the id written in the payload. A payload written by a previous version of the type, lacking the last member,
+ * keeps the default value of that member.
+ */
+TEST_F(DynamicTypesTests, DynamicType_mutable_structure_non_consecutive_ids)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    auto create_type = [&factory](bool with_last_member) -> DynamicType::_ref_type
+            {
+                TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+                type_descriptor->kind(TK_STRUCTURE);
+                type_descriptor->name("MutableNonConsecutiveIds");
+                type_descriptor->extensibility_kind(ExtensibilityKind::MUTABLE);
+                DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+
+                MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+                member_descriptor->type(factory->get_primitive_type(TK_INT32));
+                member_descriptor->name("int32");
+                member_descriptor->id(30);
+                EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+                member_descriptor = traits<MemberDescriptor>::make_shared();
+                member_descriptor->type(factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+                member_descriptor->name("string");
+                member_descriptor->id(5);
+                EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+                if (with_last_member)
+                {
+                    member_descriptor = traits<MemberDescriptor>::make_shared();
+                    member_descriptor->type(factory->get_primitive_type(TK_INT64));
+                    member_descriptor->name("int64");
+                    member_descriptor->id(12);
+                    member_descriptor->default_value("77");
+                    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+                }
+
+                return builder->build();
+            };
+
+    DynamicType::_ref_type struct_type {create_type(true)};
+    ASSERT_TRUE(struct_type);
+
+    DynamicData::_ref_type struct_data {DynamicDataFactory::get_instance()->create_data(struct_type)};
+    ASSERT_TRUE(struct_data);
+    EXPECT_EQ(struct_data->set_int32_value(30, 123), RETCODE_OK);
+    EXPECT_EQ(struct_data->set_string_value(5, "mutable"), RETCODE_OK);
+    EXPECT_EQ(struct_data->set_int64_value(12, -5), RETCODE_OK);
+
+    for (auto encoding : encodings)
+    {
+        DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(struct_type)};
+        encoding_decoding_test(struct_type, struct_data, data2, encoding);
+    }
+
+    DynamicType::_ref_type previous_type {create_type(false)};
+    ASSERT_TRUE(previous_type);
+    DynamicData::_ref_type previous_data {DynamicDataFactory::get_instance()->create_data(previous_type)};
+    ASSERT_TRUE(previous_data);
+    EXPECT_EQ(previous_data->set_int32_value(30, 456), RETCODE_OK);
+    EXPECT_EQ(previous_data->set_string_value(5, "previous"), RETCODE_OK);
+
+    for (auto encoding : encodings)
+    {
+        TypeSupport previous_pubsub_type {new DynamicPubSubType(previous_type)};
+        TypeSupport pubsub_type {new DynamicPubSubType(struct_type)};
+        SerializedPayload_t payload(
+            static_cast<uint32_t>(previous_pubsub_type.calculate_serialized_size(&previous_data, encoding)));
+        ASSERT_TRUE(previous_pubsub_type.serialize(&previous_data, payload, encoding));
+
+        DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(struct_type)};
+        ASSERT_TRUE(pubsub_type.deserialize(payload, &data2));
+
+        int32_t int32_get {0};
+        std::string string_get;
+        int64_t int64_get {0};
+        EXPECT_EQ(data2->get_int32_value(int32_get, 30), RETCODE_OK);
+        EXPECT_EQ(456, int32_get);
+        EXPECT_EQ(data2->get_string_value(string_get, 5), RETCODE_OK);
+        EXPECT_EQ("previous", string_get);
+        EXPECT_EQ(data2->get_int64_value(int64_get, 12), RETCODE_OK);
+        EXPECT_EQ(77, int64_get);
+
+        EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(data2), RETCODE_OK);
+    }
+
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(struct_data), RETCODE_OK);
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(previous_data), RETCODE_OK);
+}
+
 TEST_F(DynamicTypesTests, DynamicType_KeyHash_standard_example_1)
 {
     DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
@@ -731,6 +731,12 @@ public:
         return RETCODE_OK;
     }
 
+    ReturnCode_t get_send_queue_statistics(
+            std::vector<fastdds::rtps::SendQueueStatistics>& /*statistics*/) const
+    {
+        return RETCODE_OK;
+    }
+
     DomainParticipant* get_participant() const
     {
         return participant_;
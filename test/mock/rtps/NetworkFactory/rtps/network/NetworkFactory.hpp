@@ -113,6 +113,11 @@ public:
         return {};
     }
 
+    std::vector<fastdds::rtps::SendQueueStatistics> send_queue_statistics() const
+    {
+        return {};
+    }
+
     NetworkConfigSet_t network_configuration() const
     {
         return NetworkConfigSet_t{};
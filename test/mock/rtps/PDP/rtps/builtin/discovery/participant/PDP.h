@@ -28,6 +28,7 @@
 #include <rtps/builtin/BuiltinProtocols.h>
 #include <rtps/builtin/data/ParticipantProxyData.hpp>
 #include <rtps/builtin/discovery/endpoint/EDP.h>
+#include <rtps/builtin/discovery/endpoint/EndpointTopicIndex.hpp>
 #include <rtps/messages/CDRMessage.hpp>
 #include <utils/ProxyPool.hpp>
 
@@ -122,10 +123,24 @@ public:
         return temp_proxy_writers;
     }
 
+    const EndpointTopicIndex<ReaderProxyData>& readers_topic_index() const
+    {
+        return readers_topic_index_;
+    }
+
+    const EndpointTopicIndex<WriterProxyData>& writers_topic_index() const
+    {
+        return writers_topic_index_;
+    }
+
     // *INDENT-ON*
 
     std::recursive_mutex* mutex_;
 
+    // topic indexes of known endpoints
+    EndpointTopicIndex<ReaderProxyData> readers_topic_index_;
+    EndpointTopicIndex<WriterProxyData> writers_topic_index_;
+
     // temporary proxies pools
     ProxyPool<ReaderProxyData> temp_proxy_readers = {{4, 1}};
     ProxyPool<WriterProxyData> temp_proxy_writers = {{4, 1}};
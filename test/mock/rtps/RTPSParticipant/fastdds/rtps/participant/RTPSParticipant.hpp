@@ -227,6 +227,11 @@ public:
         return {};
     }
 
+    std::vector<fastdds::rtps::SendQueueStatistics> get_send_queue_statistics() const
+    {
+        return {};
+    }
+
     const RTPSParticipantAttributes& get_attributes() const
     {
         return attributes_;
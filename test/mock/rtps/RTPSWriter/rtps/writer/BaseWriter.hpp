@@ -106,6 +106,13 @@ public:
             const LocatorSelectorSender&,
             std::chrono::steady_clock::time_point&));
 
+    MOCK_METHOD5(send_segments_nts, bool(
+            const std::vector<eprosima::fastdds::rtps::NetworkBuffer>&,
+            const uint32_t&,
+            uint32_t,
+            const LocatorSelectorSender&,
+            std::chrono::steady_clock::time_point&));
+
     MOCK_CONST_METHOD0(get_liveliness_kind, const fastdds::dds::LivelinessQosPolicyKind& ());
 
     MOCK_CONST_METHOD0(get_liveliness_lease_duration, const dds::Duration_t& ());
@@ -186,6 +186,8 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
 
     uint32_t tcp_negotiation_timeout;
 
+    uint32_t send_queue_size;
+
     void add_listener_port(
             uint16_t port)
     {
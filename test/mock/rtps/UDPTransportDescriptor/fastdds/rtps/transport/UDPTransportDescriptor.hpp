@@ -65,6 +65,14 @@ typedef struct UDPTransportDescriptor : public SocketTransportDescriptor
     uint16_t m_output_udp_socket;
 
     bool non_blocking_send = false;
+
+    uint32_t datagrams_per_batch = 1;
+
+    bool generic_receive_offload = false;
+
+    bool generic_segmentation_offload = false;
+
+    uint32_t unicast_receive_threads = 1;
 } UDPTransportDescriptor;
 
 } // namespace rtps
@@ -69,6 +69,7 @@ public:
     virtual ~WriterHistory() = default;
 
     using iterator = std::vector<CacheChange_t*>::iterator;
+    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
 
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD2(create_change, CacheChange_t* (
@@ -117,6 +118,8 @@ public:
 
     MOCK_METHOD1(remove_change, bool(const SequenceNumber_t&));
 
+    MOCK_METHOD2(remove_change, iterator(const_iterator, bool));
+
     MOCK_METHOD1(remove_change_and_reuse, CacheChange_t*(const SequenceNumber_t&));
 
     MOCK_METHOD1(remove_change_mock, bool(CacheChange_t*));
@@ -0,0 +1,395 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DiscoveryScale.cpp
+ *
+ * Measures how long it takes to create a DataReader and a DataWriter on a participant that has discovered a growing
+ * fleet of participants, each one with its own endpoints on topics the new endpoints do not match.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/DomainParticipantListener.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    PARTICIPANTS,
+    STEP,
+    ENDPOINTS,
+    SAMPLES,
+    DOMAIN_ID,
+    TIMEOUT
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,  0, "",  "",             Arg::None,
+      "Usage: DiscoveryScale [options]\n\nGeneral options:" },
+    { HELP,         0, "h", "help",         Arg::None,
+      "  -h         --help                   Produce help message." },
+    { PARTICIPANTS, 0, "p", "participants", Arg::Numeric,
+      "  -p <num>,  --participants=<num>     Size of the largest fleet of remote participants (Defaults: 50)." },
+    { STEP,         0, "s", "step",         Arg::Numeric,
+      "  -s <num>,  --step=<num>             Participants added to the fleet between measurements (Defaults: 10)." },
+    { ENDPOINTS,    0, "e", "endpoints",    Arg::Numeric,
+      "  -e <num>,  --endpoints=<num>        Endpoints of each fleet participant, half of them readers "
+      "(Defaults: 20)." },
+    { SAMPLES,      0, "n", "samples",      Arg::Numeric,
+      "  -n <num>,  --samples=<num>          Endpoints created for each measurement (Defaults: 50)." },
+    { DOMAIN_ID,    0, "d", "domain",       Arg::Numeric,
+      "  -d <num>,  --domain=<num>           Domain used by all the participants (Defaults: 0)." },
+    { TIMEOUT,      0, "t", "timeout",      Arg::Numeric,
+      "  -t <num>,  --timeout=<num>          Seconds to wait for the fleet to be discovered (Defaults: 60)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr const char* type_name = "DiscoveryScaleType";
+
+//! Counts the remote endpoints discovered by a participant.
+class DiscoveryCounter : public DomainParticipantListener
+{
+public:
+
+    void on_data_reader_discovery(
+            DomainParticipant* participant,
+            ReaderDiscoveryStatus reason,
+            const SubscriptionBuiltinTopicData& info,
+            bool& /*should_be_ignored*/) override
+    {
+        if (ReaderDiscoveryStatus::DISCOVERED_READER == reason &&
+                info.guid.guidPrefix != participant->guid().guidPrefix)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ++readers_;
+            cv_.notify_all();
+        }
+    }
+
+    void on_data_writer_discovery(
+            DomainParticipant* participant,
+            WriterDiscoveryStatus reason,
+            const PublicationBuiltinTopicData& info,
+            bool& /*should_be_ignored*/) override
+    {
+        if (WriterDiscoveryStatus::DISCOVERED_WRITER == reason &&
+                info.guid.guidPrefix != participant->guid().guidPrefix)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ++writers_;
+            cv_.notify_all();
+        }
+    }
+
+    bool wait_for(
+            uint64_t readers,
+            uint64_t writers,
+            std::chrono::seconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return readers_ >= readers && writers_ >= writers;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint64_t readers_ = 0;
+    uint64_t writers_ = 0;
+};
+
+static TypeSupport create_type_support()
+{
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name(type_name);
+    DynamicTypeBuilder::_ref_type builder = DynamicTypeBuilderFactory::get_instance()->create_type(type_descriptor);
+
+    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+    member_descriptor->name("index");
+    member_descriptor->type(DynamicTypeBuilderFactory::get_instance()->get_primitive_type(TK_UINT32));
+    builder->add_member(member_descriptor);
+
+    return TypeSupport(new DynamicPubSubType(builder->build()));
+}
+
+//! Participant of the fleet, with readers and writers on topics of its own.
+static DomainParticipant* create_fleet_participant(
+        uint32_t domain_id,
+        uint32_t index,
+        uint32_t endpoints)
+{
+    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(domain_id,
+                    PARTICIPANT_QOS_DEFAULT, nullptr, StatusMask::none());
+    if (nullptr == participant)
+    {
+        return nullptr;
+    }
+
+    create_type_support().register_type(participant);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    for (uint32_t e = 0; e < endpoints; ++e)
+    {
+        std::string topic_name = "discovery_scale_" + std::to_string(index) + "_" + std::to_string(e);
+        Topic* topic = participant->create_topic(topic_name, type_name, TOPIC_QOS_DEFAULT);
+        bool created = (nullptr != topic) &&
+                (0 == e % 2 ?
+                nullptr != publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT) :
+                nullptr != subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT));
+        if (!created)
+        {
+            participant->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant);
+            return nullptr;
+        }
+    }
+
+    return participant;
+}
+
+struct LatencyStats
+{
+    double mean_us = 0.0;
+    double max_us = 0.0;
+};
+
+template<typename Functor>
+static LatencyStats measure(
+        uint32_t samples,
+        Functor create_and_delete)
+{
+    LatencyStats stats;
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        double elapsed_us = create_and_delete();
+        stats.mean_us += elapsed_us;
+        stats.max_us = std::max(stats.max_us, elapsed_us);
+    }
+    stats.mean_us /= samples;
+    return stats;
+}
+
+static void delete_participant(
+        DomainParticipant* participant)
+{
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    uint32_t max_participants = 50;
+    uint32_t step = 10;
+    uint32_t endpoints = 20;
+    uint32_t samples = 50;
+    uint32_t domain_id = 0;
+    uint32_t timeout_s = 60;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case PARTICIPANTS:
+                max_participants = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case STEP:
+                step = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case ENDPOINTS:
+                endpoints = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case SAMPLES:
+                samples = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case DOMAIN_ID:
+                domain_id = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case TIMEOUT:
+                timeout_s = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case UNKNOWN_OPT:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 1;
+                break;
+        }
+    }
+
+    if (0 == step || 0 == samples)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    // Participant where the measured endpoints are created
+    DiscoveryCounter counter;
+    DomainParticipant* probe = DomainParticipantFactory::get_instance()->create_participant(domain_id,
+                    PARTICIPANT_QOS_DEFAULT, &counter, StatusMask::none());
+    if (nullptr == probe)
+    {
+        printf("error creating the probe participant\n");
+        return 1;
+    }
+    create_type_support().register_type(probe);
+    Publisher* publisher = probe->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = probe->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    Topic* topic = probe->create_topic("discovery_scale_probe", type_name, TOPIC_QOS_DEFAULT);
+    if (nullptr == publisher || nullptr == subscriber || nullptr == topic)
+    {
+        printf("error creating the probe entities\n");
+        delete_participant(probe);
+        return 1;
+    }
+
+    std::vector<DomainParticipant*> fleet;
+    int ret = 0;
+    uint32_t fleet_size = 0;
+    while (0 == ret)
+    {
+        // Wait for the whole fleet to be known before measuring
+        uint64_t fleet_readers = static_cast<uint64_t>(fleet_size) * (endpoints / 2);
+        uint64_t fleet_writers = static_cast<uint64_t>(fleet_size) * (endpoints - endpoints / 2);
+        if (!counter.wait_for(fleet_readers, fleet_writers, std::chrono::seconds(timeout_s)))
+        {
+            printf("timed out discovering %u participants\n", fleet_size);
+            ret = 1;
+            break;
+        }
+
+        LatencyStats reader_stats = measure(samples, [&]()
+                        {
+                            Clock::time_point start = Clock::now();
+                            DataReader* reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+                            double elapsed = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+                            subscriber->delete_datareader(reader);
+                            return elapsed;
+                        });
+        LatencyStats writer_stats = measure(samples, [&]()
+                        {
+                            Clock::time_point start = Clock::now();
+                            DataWriter* writer = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+                            double elapsed = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+                            publisher->delete_datawriter(writer);
+                            return elapsed;
+                        });
+
+        printf("participants: %5u  endpoints: %7llu  reader creation [us] mean: %10.1f max: %10.1f  "
+                "writer creation [us] mean: %10.1f max: %10.1f\n",
+                fleet_size, static_cast<unsigned long long>(fleet_readers + fleet_writers),
+                reader_stats.mean_us, reader_stats.max_us, writer_stats.mean_us, writer_stats.max_us);
+
+        if (fleet_size >= max_participants)
+        {
+            break;
+        }
+
+        // Grow the fleet
+        uint32_t target_size = std::min(fleet_size + step, max_participants);
+        for (; fleet_size < target_size; ++fleet_size)
+        {
+            DomainParticipant* participant = create_fleet_participant(domain_id, fleet_size, endpoints);
+            if (nullptr == participant)
+            {
+                printf("error creating fleet participant %u\n", fleet_size);
+                ret = 1;
+                break;
+            }
+            fleet.push_back(participant);
+        }
+    }
+
+    for (DomainParticipant* participant : fleet)
+    {
+        delete_participant(participant);
+    }
+    delete_participant(probe);
+
+    return ret;
+}
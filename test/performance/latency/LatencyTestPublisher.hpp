@@ -93,6 +93,8 @@ public:
             const std::string& xml_config_file,
             bool dynamic_data,
             Arg::EnablerValue data_sharing,
+            uint32_t data_sharing_spin_budget,
+            uint64_t data_sharing_affinity,
             bool data_loans,
             Arg::EnablerValue shared_memory,
             int forced_domain,
@@ -198,6 +200,8 @@ private:
     bool reliable_ = false;
     bool dynamic_types_ = false;
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
+    uint32_t data_sharing_spin_budget_ = 0;
+    uint64_t data_sharing_affinity_ = 0;
     bool data_loans_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
     int forced_domain_ = -1;
@@ -70,6 +70,8 @@ bool LatencyTestSubscriber::init(
         const std::string& xml_config_file,
         bool dynamic_data,
         Arg::EnablerValue data_sharing,
+        uint32_t data_sharing_spin_budget,
+        uint64_t data_sharing_affinity,
         bool data_loans,
         Arg::EnablerValue shared_memory,
         int forced_domain,
@@ -81,6 +83,8 @@ bool LatencyTestSubscriber::init(
     samples_ = samples;
     dynamic_types_ = dynamic_data;
     data_sharing_ = data_sharing;
+    data_sharing_spin_budget_ = data_sharing_spin_budget;
+    data_sharing_affinity_ = data_sharing_affinity;
     data_loans_ = data_loans;
     shared_memory_ = shared_memory;
     forced_domain_ = forced_domain;
@@ -227,6 +231,8 @@ bool LatencyTestSubscriber::init(
         {
             DataSharingQosPolicy dsp;
             dsp.on("");
+            dsp.listener_spin_budget(data_sharing_spin_budget_);
+            dsp.data_sharing_listener_thread().affinity = data_sharing_affinity_;
             dw_qos_.data_sharing(dsp);
             dr_qos_.data_sharing(dsp);
         }
@@ -61,6 +61,12 @@ if __name__ == '__main__':
         help='Explicitly enable/disable data sharing. (Defaults: Fast DDS default settings)',
         required=False
     )
+    parser.add_argument(
+        '--data_sharing_spin',
+        type=int,
+        help='Data sharing listener spin time in microseconds before blocking (Defaults: 0, always block)',
+        required=False
+    )
     parser.add_argument(
         '-l',
         '--data_loans',
@@ -138,6 +144,9 @@ if __name__ == '__main__':
     elif args.data_loans:
         filename_options += '_data_loans'
 
+    if args.data_sharing_spin:
+        filename_options += '_spin'
+
     # add flags to the command line
     data_options = []
 
@@ -147,6 +156,9 @@ if __name__ == '__main__':
         else:
             data_options += ['--data_sharing=off']
 
+    if args.data_sharing_spin:
+        data_options += ['--data_sharing_spin={}'.format(args.data_sharing_spin)]
+
     if args.data_loans:
         data_options += ['--data_loans']
 
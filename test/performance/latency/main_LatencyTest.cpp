@@ -62,6 +62,8 @@ enum  optionIndex
     FORCED_DOMAIN,
     FILE_R,
     DATA_SHARING,
+    DATA_SHARING_SPIN,
+    DATA_SHARING_AFFINITY,
     DATA_LOAN,
     SHARED_MEMORY
 };
@@ -95,6 +97,10 @@ const option::Descriptor usage[] = {
       "               --dynamic_types       Use dynamic types." },
     { DATA_SHARING,  0, "d", "data_sharing",    Arg::Enabler,
       "               --data_sharing=[on|off]             Explicitly enable/disable data sharing feature." },
+    { DATA_SHARING_SPIN, 0, "", "data_sharing_spin", Arg::Numeric,
+      "               --data_sharing_spin=<us>            Data sharing listener spin time (0: always block)." },
+    { DATA_SHARING_AFFINITY, 0, "", "data_sharing_affinity", Arg::Numeric,
+      "               --data_sharing_affinity=<mask>      CPU affinity mask of the data sharing listener threads." },
     { DATA_LOAN,        0, "l", "data_loans",            Arg::None,
       "               --data_loans          Use loan sample API." },
     { SHARED_MEMORY,    0, "", "shared_memory", Arg::Enabler,
@@ -227,6 +233,8 @@ int main(
     int forced_domain = -1;
     std::string demands_file = "";
     Arg::EnablerValue data_sharing = Arg::EnablerValue::NO_SET;
+    uint32_t data_sharing_spin_budget = 0;
+    uint64_t data_sharing_affinity = 0;
     bool data_loans = false;
     Arg::EnablerValue shared_memory = Arg::EnablerValue::NO_SET;
 
@@ -392,6 +400,11 @@ int main(
                     data_sharing = Arg::EnablerValue::OFF;
                 }
                 break;
+            case DATA_SHARING_SPIN:
+                data_sharing_spin_budget = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case DATA_SHARING_AFFINITY:
+                data_sharing_affinity = strtoull(opt.arg, nullptr, 10);
                 break;
             case DATA_LOAN:
                 data_loans = true;
@@ -500,7 +513,8 @@ int main(
         LatencyTestPublisher latency_publisher;
         if (latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv, export_prefix,
                 raw_data_file, pub_part_property_policy, pub_property_policy, xml_config_file,
-                dynamic_types, data_sharing, data_loans, shared_memory, forced_domain, data_sizes))
+                dynamic_types, data_sharing, data_sharing_spin_budget, data_sharing_affinity, data_loans, shared_memory,
+                forced_domain, data_sizes))
         {
             latency_publisher.run();
             latency_publisher.destroy_user_entities();
@@ -516,7 +530,8 @@ int main(
         LatencyTestSubscriber latency_subscriber;
         if (latency_subscriber.init(echo, samples, reliable, seed, hostname, sub_part_property_policy,
                 sub_property_policy,
-                xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, forced_domain, data_sizes))
+                xml_config_file, dynamic_types, data_sharing, data_sharing_spin_budget, data_sharing_affinity,
+                data_loans, shared_memory, forced_domain, data_sizes))
         {
             latency_subscriber.run();
             latency_subscriber.destroy_user_entities();
@@ -536,8 +551,8 @@ int main(
         LatencyTestPublisher latency_publisher;
         bool pub_init = latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv,
                         export_prefix, raw_data_file, pub_part_property_policy, pub_property_policy,
-                        xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, forced_domain,
-                        data_sizes);
+                        xml_config_file, dynamic_types, data_sharing, data_sharing_spin_budget, data_sharing_affinity,
+                        data_loans, shared_memory, forced_domain, data_sizes);
 
         // Initialize subscribers
         std::vector<std::shared_ptr<LatencyTestSubscriber>> latency_subscribers;
@@ -548,7 +563,8 @@ int main(
             latency_subscribers.push_back(std::make_shared<LatencyTestSubscriber>());
             sub_init &= latency_subscribers.back()->init(echo, samples, reliable, seed, hostname,
                             sub_part_property_policy,
-                            sub_property_policy, xml_config_file, dynamic_types, data_sharing, data_loans,
+                            sub_property_policy, xml_config_file, dynamic_types, data_sharing,
+                            data_sharing_spin_budget, data_sharing_affinity, data_loans,
                             shared_memory,
                             forced_domain, data_sizes);
         }
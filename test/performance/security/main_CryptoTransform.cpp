@@ -0,0 +1,474 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_CryptoTransform.cpp
+ *
+ * Measures the throughput of the builtin AES-GCM-GMAC cryptographic transform, encoding and decoding RTPS messages
+ * and serialized payloads between two local participants.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <openssl/rand.h>
+
+#include <fastdds/rtps/attributes/PropertyPolicy.hpp>
+#include <fastdds/rtps/common/CDRMessage_t.hpp>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+
+#include <rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
+#include <rtps/security/common/SharedSecretHandle.h>
+#include <security/cryptography/AESGCMGMAC.h>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastdds::rtps;
+using namespace eprosima::fastdds::rtps::security;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    MODE,
+    SIZE,
+    RECEIVERS,
+    SECONDS,
+    KEY_SIZE,
+    MAC_THREADS
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0, "",  "",          Arg::None,
+      "Usage: CryptoTransform [options]\n\nGeneral options:" },
+    { HELP,        0, "h", "help",      Arg::None,
+      "  -h         --help                   Produce help message." },
+    { MODE,        0, "m", "mode",      Arg::Required,
+      "  -m <arg>,  --mode=<arg>             Transformation to measure (\"rtps\"/\"payload\"/\"both\")." },
+    { SIZE,        0, "s", "size",      Arg::Numeric,
+      "  -s <num>,  --size=<num>             Size in bytes of the plain messages (Defaults: 1024)." },
+    { RECEIVERS,   0, "r", "receivers", Arg::Numeric,
+      "  -r <num>,  --receivers=<num>        Number of receivers of the RTPS messages (Defaults: 1)." },
+    { SECONDS,     0, "t", "seconds",   Arg::Numeric,
+      "  -t <num>,  --seconds=<num>          Duration of each run in seconds (Defaults: 5)." },
+    { KEY_SIZE,    0, "k", "keysize",   Arg::Numeric,
+      "  -k <num>,  --keysize=<num>          Size in bits of the keys (\"128\"/\"256\") (Defaults: 256)." },
+    { MAC_THREADS, 0, "",  "mac-threads", Arg::Numeric,
+      "             --mac-threads=<num>      Threads computing the receiver specific MACs (Defaults: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+using Clock = std::chrono::steady_clock;
+
+//! Creates the shared secret that the authentication plugin would obtain on the handshake.
+class BenchmarkAuthentication
+{
+public:
+
+    using BenchmarkSecretHandle = HandleImpl<SharedSecret, BenchmarkAuthentication>;
+
+    static std::shared_ptr<SecretHandle> create_shared_secret()
+    {
+        std::shared_ptr<BenchmarkSecretHandle> handle(new BenchmarkSecretHandle(), [](BenchmarkSecretHandle* p)
+                {
+                    delete p;
+                });
+
+        for (const char* name : {"Challenge1", "Challenge2", "SharedSecret"})
+        {
+            std::vector<uint8_t> value(32);
+            RAND_bytes(value.data(), 32);
+            (*handle)->data_.emplace_back(std::string(name), value);
+        }
+
+        return handle;
+    }
+
+};
+
+//! Accumulated results of a run.
+struct RunResults
+{
+    uint64_t messages = 0;
+    Clock::duration encode_time = Clock::duration::zero();
+    Clock::duration decode_time = Clock::duration::zero();
+
+    void print(
+            const char* mode,
+            uint32_t size,
+            uint32_t receivers) const
+    {
+        double encode_seconds = std::chrono::duration<double>(encode_time).count();
+        double decode_seconds = std::chrono::duration<double>(decode_time).count();
+        double count = static_cast<double>(messages);
+        double megabytes = count * static_cast<double>(size) / (1024.0 * 1024.0);
+
+        printf("%-8s size: %6u  receivers: %3u  encode msg/s: %10.0f  encode MB/s: %8.1f  "
+                "decode msg/s: %10.0f  decode MB/s: %8.1f\n",
+                mode, size, receivers,
+                encode_seconds > 0 ? count / encode_seconds : 0.0,
+                encode_seconds > 0 ? megabytes / encode_seconds : 0.0,
+                decode_seconds > 0 ? count / decode_seconds : 0.0,
+                decode_seconds > 0 ? megabytes / decode_seconds : 0.0);
+    }
+
+};
+
+static bool run_rtps(
+        AESGCMGMAC& plugin,
+        const PropertySeq& properties,
+        uint32_t size,
+        uint32_t num_receivers,
+        uint32_t seconds)
+{
+    SecurityException exception;
+    NilHandle identity;
+    NilHandle permissions;
+    std::shared_ptr<SecretHandle> shared_secret = BenchmarkAuthentication::create_shared_secret();
+
+    ParticipantSecurityAttributes part_sec_attr;
+    part_sec_attr.is_rtps_protected = true;
+    part_sec_attr.plugin_participant_attributes = PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ENCRYPTED |
+            PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ORIGIN_AUTHENTICATED;
+
+    std::shared_ptr<ParticipantCryptoHandle> participant_A = plugin.keyfactory()->register_local_participant(
+        identity, permissions, properties, part_sec_attr, exception);
+    std::shared_ptr<ParticipantCryptoHandle> participant_B = plugin.keyfactory()->register_local_participant(
+        identity, permissions, properties, part_sec_attr, exception);
+    if (!participant_A || !participant_B)
+    {
+        printf("Error registering local participants: %s\n", exception.what());
+        return false;
+    }
+
+    // Participant B as seen by A, and participant A as seen by B
+    std::shared_ptr<ParticipantCryptoHandle> participant_A_remote =
+            plugin.keyfactory()->register_matched_remote_participant(*participant_A, identity, permissions,
+                    *shared_secret, exception);
+    std::shared_ptr<ParticipantCryptoHandle> participant_B_remote =
+            plugin.keyfactory()->register_matched_remote_participant(*participant_B, identity, permissions,
+                    *shared_secret, exception);
+
+    ParticipantCryptoTokenSeq participant_A_tokens;
+    ParticipantCryptoTokenSeq participant_B_tokens;
+    plugin.keyexchange()->create_local_participant_crypto_tokens(participant_A_tokens, *participant_A,
+            *participant_A_remote, exception);
+    plugin.keyexchange()->create_local_participant_crypto_tokens(participant_B_tokens, *participant_B,
+            *participant_B_remote, exception);
+    plugin.keyexchange()->set_remote_participant_crypto_tokens(*participant_A, *participant_A_remote,
+            participant_B_tokens, exception);
+    plugin.keyexchange()->set_remote_participant_crypto_tokens(*participant_B, *participant_B_remote,
+            participant_A_tokens, exception);
+
+    // The intended receiver is the first one, the rest only add receiver specific MACs
+    std::vector<std::shared_ptr<ParticipantCryptoHandle>> receivers;
+    receivers.push_back(participant_A_remote);
+    for (uint32_t i = 1; i < num_receivers; ++i)
+    {
+        receivers.push_back(plugin.keyfactory()->register_matched_remote_participant(*participant_A, identity,
+                permissions, *shared_secret, exception));
+    }
+
+    uint32_t capacity = size + 256 + 32 * num_receivers;
+    CDRMessage_t plain(capacity);
+    CDRMessage_t encoded(capacity);
+    CDRMessage_t decoded(capacity);
+    RAND_bytes(plain.buffer, static_cast<int>(size));
+    plain.length = size;
+
+    RunResults results;
+    bool ret = true;
+    Clock::time_point end = Clock::now() + std::chrono::seconds(seconds);
+    for (Clock::time_point now = Clock::now(); ret && now < end; )
+    {
+        plain.pos = 0;
+        encoded.pos = 0;
+        encoded.length = 0;
+        decoded.pos = 0;
+        decoded.length = 0;
+
+        ret = plugin.transform()->encode_rtps_message(encoded, plain, *participant_A, receivers, exception);
+        Clock::time_point encoded_time = Clock::now();
+        results.encode_time += encoded_time - now;
+
+        encoded.pos = 0;
+        ret = ret && plugin.transform()->decode_rtps_message(decoded, encoded, *participant_B, *participant_B_remote,
+                exception);
+        now = Clock::now();
+        results.decode_time += now - encoded_time;
+        ++results.messages;
+    }
+
+    if (!ret || decoded.length != plain.length || 0 != memcmp(decoded.buffer, plain.buffer, plain.length))
+    {
+        printf("Error transforming RTPS messages: %s\n", exception.what());
+        ret = false;
+    }
+    else
+    {
+        results.print("rtps", size, num_receivers);
+    }
+
+    receivers.clear();
+    plugin.keyfactory()->unregister_participant(participant_A_remote, exception);
+    plugin.keyfactory()->unregister_participant(participant_B_remote, exception);
+    plugin.keyfactory()->unregister_participant(participant_A, exception);
+    plugin.keyfactory()->unregister_participant(participant_B, exception);
+    return ret;
+}
+
+static bool run_payload(
+        AESGCMGMAC& plugin,
+        const PropertySeq& properties,
+        uint32_t size,
+        uint32_t seconds)
+{
+    SecurityException exception;
+    NilHandle identity;
+    NilHandle permissions;
+    std::shared_ptr<SecretHandle> shared_secret = BenchmarkAuthentication::create_shared_secret();
+
+    ParticipantSecurityAttributes part_sec_attr;
+    EndpointSecurityAttributes sec_attrs;
+    sec_attrs.is_payload_protected = true;
+    sec_attrs.plugin_endpoint_attributes = PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_ENCRYPTED;
+
+    // Participant A owns the reader, participant B owns the writer
+    std::shared_ptr<ParticipantCryptoHandle> participant_A = plugin.keyfactory()->register_local_participant(
+        identity, permissions, properties, part_sec_attr, exception);
+    std::shared_ptr<ParticipantCryptoHandle> participant_B = plugin.keyfactory()->register_local_participant(
+        identity, permissions, properties, part_sec_attr, exception);
+    if (!participant_A || !participant_B)
+    {
+        printf("Error registering local participants: %s\n", exception.what());
+        return false;
+    }
+
+    DatareaderCryptoHandle* reader =
+            plugin.keyfactory()->register_local_datareader(*participant_A, properties, sec_attrs, exception);
+    DatawriterCryptoHandle* writer =
+            plugin.keyfactory()->register_local_datawriter(*participant_B, properties, sec_attrs, exception);
+
+    std::shared_ptr<ParticipantCryptoHandle> participant_A_remote =
+            plugin.keyfactory()->register_matched_remote_participant(*participant_A, identity, permissions,
+                    *shared_secret, exception);
+    std::shared_ptr<ParticipantCryptoHandle> participant_B_remote =
+            plugin.keyfactory()->register_matched_remote_participant(*participant_B, identity, permissions,
+                    *shared_secret, exception);
+
+    DatareaderCryptoHandle* remote_reader = plugin.keyfactory()->register_matched_remote_datareader(*writer,
+                    *participant_B_remote, *shared_secret, false, exception);
+    DatawriterCryptoHandle* remote_writer = plugin.keyfactory()->register_matched_remote_datawriter(*reader,
+                    *participant_A_remote, *shared_secret, exception);
+
+    DatawriterCryptoTokenSeq writer_tokens;
+    DatareaderCryptoTokenSeq reader_tokens;
+    plugin.keyexchange()->create_local_datawriter_crypto_tokens(writer_tokens, *writer, *remote_reader, exception);
+    plugin.keyexchange()->create_local_datareader_crypto_tokens(reader_tokens, *reader, *remote_writer, exception);
+    plugin.keyexchange()->set_remote_datareader_crypto_tokens(*writer, *remote_reader, reader_tokens, exception);
+    plugin.keyexchange()->set_remote_datawriter_crypto_tokens(*reader, *remote_writer, writer_tokens, exception);
+
+    SerializedPayload_t plain(size);
+    SerializedPayload_t encoded(size + 128);
+    SerializedPayload_t decoded(size + 128);
+    RAND_bytes(plain.data, static_cast<int>(size));
+    plain.length = size;
+    std::vector<uint8_t> inline_qos;
+
+    RunResults results;
+    bool ret = true;
+    Clock::time_point end = Clock::now() + std::chrono::seconds(seconds);
+    for (Clock::time_point now = Clock::now(); ret && now < end; )
+    {
+        plain.pos = 0;
+        encoded.pos = 0;
+        encoded.length = 0;
+        decoded.pos = 0;
+        decoded.length = 0;
+        inline_qos.clear();
+
+        ret = plugin.transform()->encode_serialized_payload(encoded, inline_qos, plain, *writer, exception);
+        Clock::time_point encoded_time = Clock::now();
+        results.encode_time += encoded_time - now;
+
+        encoded.pos = 0;
+        ret = ret && plugin.transform()->decode_serialized_payload(decoded, encoded, inline_qos, *reader,
+                *remote_writer, exception);
+        now = Clock::now();
+        results.decode_time += now - encoded_time;
+        ++results.messages;
+    }
+
+    if (!ret || decoded.length != plain.length || 0 != memcmp(decoded.data, plain.data, plain.length))
+    {
+        printf("Error transforming serialized payloads: %s\n", exception.what());
+        ret = false;
+    }
+    else
+    {
+        results.print("payload", size, 1);
+    }
+
+    plugin.keyfactory()->unregister_datawriter(writer, exception);
+    plugin.keyfactory()->unregister_datawriter(remote_writer, exception);
+    plugin.keyfactory()->unregister_datareader(reader, exception);
+    plugin.keyfactory()->unregister_datareader(remote_reader, exception);
+    plugin.keyfactory()->unregister_participant(participant_A_remote, exception);
+    plugin.keyfactory()->unregister_participant(participant_B_remote, exception);
+    plugin.keyfactory()->unregister_participant(participant_A, exception);
+    plugin.keyfactory()->unregister_participant(participant_B, exception);
+    return ret;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    bool run_rtps_messages = true;
+    bool run_payloads = true;
+    uint32_t size = 1024;
+    uint32_t num_receivers = 1;
+    uint32_t seconds = 5;
+    uint32_t key_size = 256;
+    uint32_t mac_threads = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case MODE:
+                if (strcmp(opt.arg, "rtps") == 0)
+                {
+                    run_rtps_messages = true;
+                    run_payloads = false;
+                }
+                else if (strcmp(opt.arg, "payload") == 0)
+                {
+                    run_rtps_messages = false;
+                    run_payloads = true;
+                }
+                else if (strcmp(opt.arg, "both") == 0)
+                {
+                    run_rtps_messages = true;
+                    run_payloads = true;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 1;
+                }
+                break;
+            case SIZE:
+                size = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case RECEIVERS:
+                num_receivers = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case SECONDS:
+                seconds = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case KEY_SIZE:
+                key_size = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case MAC_THREADS:
+                mac_threads = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case UNKNOWN_OPT:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 1;
+                break;
+        }
+    }
+
+    if (0 == size || 0 == num_receivers || (128 != key_size && 256 != key_size))
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    PropertySeq properties;
+    if (128 == key_size)
+    {
+        Property key_size_property;
+        key_size_property.name("dds.sec.crypto.keysize");
+        key_size_property.value("128");
+        properties.push_back(key_size_property);
+    }
+    if (0 < mac_threads)
+    {
+        Property mac_threads_property;
+        mac_threads_property.name("dds.sec.crypto.mac_threads");
+        mac_threads_property.value(std::to_string(mac_threads));
+        properties.push_back(mac_threads_property);
+    }
+
+    AESGCMGMAC plugin;
+    bool ret = true;
+
+    if (run_rtps_messages)
+    {
+        ret = run_rtps(plugin, properties, size, num_receivers, seconds) && ret;
+    }
+    if (run_payloads)
+    {
+        ret = run_payload(plugin, properties, size, seconds) && ret;
+    }
+
+    return ret ? 0 : 1;
+}
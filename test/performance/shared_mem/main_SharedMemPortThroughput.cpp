@@ -0,0 +1,324 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_SharedMemPortThroughput.cpp
+ *
+ * Measures the throughput of buffer descriptors going through a shared-memory port between two processes,
+ * pushing them one by one and popping them one by one or in batches.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <rtps/transport/shared_mem/SharedMemGlobal.hpp>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastdds::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    ROLE,
+    PORT,
+    SAMPLES,
+    BATCH,
+    DESCRIPTORS
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0, "",  "",            Arg::None,
+      "Usage: SharedMemPortThroughput --role=<producer|consumer> [options]\n\nGeneral options:" },
+    { HELP,        0, "h", "help",        Arg::None,
+      "  -h         --help                   Produce help message." },
+    { ROLE,        0, "r", "role",        Arg::Required,
+      "  -r <arg>,  --role=<arg>             Side of the port run by this process (\"producer\"/\"consumer\")." },
+    { PORT,        0, "p", "port",        Arg::Numeric,
+      "  -p <num>,  --port=<num>             Identifier of the shared-memory port (Defaults: 7400)." },
+    { SAMPLES,     0, "s", "samples",     Arg::Numeric,
+      "  -s <num>,  --samples=<num>          Number of buffer descriptors to transfer (Defaults: 1000000)." },
+    { BATCH,       0, "b", "batch",       Arg::Numeric,
+      "  -b <num>,  --batch=<num>            Descriptors popped per call, 1 disables batching "
+      "(Defaults: 32)." },
+    { DESCRIPTORS, 0, "d", "descriptors", Arg::Numeric,
+      "  -d <num>,  --descriptors=<num>      Capacity of the port (Defaults: 512)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr const char* domain_name = "fastdds_perf";
+static constexpr uint32_t healthy_check_timeout_ms = 1000;
+
+static void print_results(
+        const char* role,
+        uint32_t batch,
+        uint64_t samples,
+        double elapsed,
+        uint64_t stalls)
+{
+    printf("%-8s batch: %4u  samples: %10llu  descriptors/s: %12.0f  stalls: %10llu\n",
+            role, batch, static_cast<unsigned long long>(samples),
+            elapsed > 0.0 ? static_cast<double>(samples) / elapsed : 0.0,
+            static_cast<unsigned long long>(stalls));
+}
+
+static int run_producer(
+        SharedMemGlobal& global,
+        uint32_t port_id,
+        uint32_t num_descriptors,
+        uint64_t samples)
+{
+    std::shared_ptr<SharedMemGlobal::Port> port =
+            global.open_port(port_id, num_descriptors, healthy_check_timeout_ms,
+                    SharedMemGlobal::Port::OpenMode::Write);
+
+    // Wait for the consumer process to register its listener
+    Clock::time_point deadline = Clock::now() + std::chrono::seconds(10);
+    while (!port->port_has_listeners())
+    {
+        if (Clock::now() > deadline)
+        {
+            printf("producer timed out waiting for the consumer\n");
+            return 1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    SharedMemSegment::Id segment_id;
+    segment_id.generate();
+
+    uint64_t sent = 0;
+    uint64_t retries = 0;
+    bool listeners_active = true;
+    Clock::time_point start = Clock::now();
+    while (sent < samples && listeners_active)
+    {
+        SharedMemGlobal::BufferDescriptor descriptor(segment_id, 0, static_cast<uint32_t>(sent));
+
+        // On overflow retry the descriptor, so the consumer receives all of them in order
+        if (port->try_push(descriptor, &listeners_active))
+        {
+            ++sent;
+        }
+        else
+        {
+            ++retries;
+            std::this_thread::yield();
+        }
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (!listeners_active)
+    {
+        printf("producer lost the consumer after %llu samples\n", static_cast<unsigned long long>(sent));
+        return 1;
+    }
+
+    print_results("producer", 1, sent, elapsed, retries);
+    return 0;
+}
+
+static int run_consumer(
+        SharedMemGlobal& global,
+        uint32_t port_id,
+        uint32_t num_descriptors,
+        uint64_t samples,
+        uint32_t batch)
+{
+    std::shared_ptr<SharedMemGlobal::Port> port =
+            global.open_port(port_id, num_descriptors, healthy_check_timeout_ms,
+                    SharedMemGlobal::Port::OpenMode::ReadExclusive);
+
+    uint32_t listener_index = 0;
+    std::unique_ptr<SharedMemGlobal::Listener> listener = port->create_listener(&listener_index);
+    std::atomic<bool> is_listener_closed(false);
+
+    std::vector<SharedMemGlobal::BufferDescriptor> descriptors(batch);
+    std::unique_ptr<bool[]> was_cell_freed(new bool[batch]);
+
+    int ret = 0;
+    uint64_t received = 0;
+    uint64_t waits = 0;
+    Clock::time_point start;
+    while (received < samples && 0 == ret)
+    {
+        uint32_t count = 0;
+        if (1 == batch)
+        {
+            SharedMemGlobal::PortCell* head = listener->head();
+            if (nullptr != head)
+            {
+                descriptors[0] = head->data();
+                port->pop(*listener, was_cell_freed[0]);
+                count = 1;
+            }
+        }
+        else
+        {
+            count = port->pop(*listener, descriptors.data(), was_cell_freed.get(), batch);
+        }
+
+        if (0 == count)
+        {
+            port->wait_pop(*listener, is_listener_closed, listener_index);
+            ++waits;
+            continue;
+        }
+
+        if (0 == received)
+        {
+            start = Clock::now();
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (descriptors[i].validity_id != static_cast<uint32_t>(received + i))
+            {
+                printf("consumer expected sample %llu but received %u\n",
+                        static_cast<unsigned long long>(received + i), descriptors[i].validity_id);
+                ret = 1;
+                break;
+            }
+        }
+        received += count;
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    port->unregister_listener(&listener, listener_index);
+
+    if (0 == ret)
+    {
+        print_results("consumer", batch, received, elapsed, waits);
+    }
+    return ret;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    int role = -1;
+    uint32_t port_id = 7400;
+    uint64_t samples = 1000000;
+    uint32_t batch = 32;
+    uint32_t num_descriptors = 512;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case ROLE:
+                if (strcmp(opt.arg, "producer") == 0)
+                {
+                    role = 0;
+                }
+                else if (strcmp(opt.arg, "consumer") == 0)
+                {
+                    role = 1;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 1;
+                }
+                break;
+            case PORT:
+                port_id = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case SAMPLES:
+                samples = strtoull(opt.arg, nullptr, 10);
+                break;
+            case BATCH:
+                batch = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case DESCRIPTORS:
+                num_descriptors = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case UNKNOWN_OPT:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 1;
+                break;
+        }
+    }
+
+    if (role < 0 || 0 == samples || 0 == batch || 0 == num_descriptors)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    try
+    {
+        SharedMemGlobal global(domain_name);
+        return 0 == role ?
+               run_producer(global, port_id, num_descriptors, samples) :
+               run_consumer(global, port_id, num_descriptors, samples, batch);
+    }
+    catch (const std::exception& e)
+    {
+        printf("%s\n", e.what());
+    }
+
+    return 1;
+}
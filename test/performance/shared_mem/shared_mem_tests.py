@@ -0,0 +1,100 @@
+# Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import os
+import subprocess
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter
+    )
+    parser.add_argument(
+        '-n',
+        '--number_of_samples',
+        help='The number of buffer descriptors transferred through the port',
+        required=False,
+        default='1000000'
+    )
+    parser.add_argument(
+        '-b',
+        '--batch',
+        help='Descriptors popped per call, 1 disables batching',
+        required=False,
+        default='32'
+    )
+    parser.add_argument(
+        '-d',
+        '--descriptors',
+        help='Capacity of the port',
+        required=False,
+        default='512'
+    )
+
+    # Parse arguments
+    args = parser.parse_args()
+
+    for name in ['number_of_samples', 'batch', 'descriptors']:
+        value = getattr(args, name)
+        if not str.isdigit(value) or int(value) <= 0:
+            print('"{}" must be a positive integer, NOT {}'.format(name, value))
+            exit(1)  # Exit with error
+
+    # Environment variables
+    executable = os.environ.get('SHARED_MEM_PORT_THROUGHPUT_BIN')
+
+    # Check that executable exists
+    if executable:
+        if not os.path.isfile(executable):
+            print('SHARED_MEM_PORT_THROUGHPUT_BIN does NOT specify a file')
+            exit(1)  # Exit with error
+    else:
+        print('SHARED_MEM_PORT_THROUGHPUT_BIN is NOT set')
+        exit(1)  # Exit with error
+
+    # Port, so concurrent runs do not share it
+    port = str(7400 + os.getpid() % 10000)
+
+    common_options = [
+        '--port', port,
+        '--samples', args.number_of_samples,
+        '--batch', args.batch,
+        '--descriptors', args.descriptors,
+    ]
+    consumer_command = [executable, '--role=consumer'] + common_options
+    producer_command = [executable, '--role=producer'] + common_options
+
+    print('Consumer command: {}'.format(
+        ' '.join(element for element in consumer_command)),
+        flush=True
+    )
+    print('Producer command: {}'.format(
+        ' '.join(element for element in producer_command)),
+        flush=True
+    )
+
+    # Spawn processes
+    consumer = subprocess.Popen(consumer_command)
+    producer = subprocess.Popen(producer_command)
+    # Wait until finish
+    producer.communicate()
+    if producer.returncode != 0:
+        consumer.kill()
+    consumer.communicate()
+
+    if consumer.returncode != 0:
+        exit(consumer.returncode)
+    elif producer.returncode != 0:
+        exit(producer.returncode)
+    exit(0)
@@ -0,0 +1,610 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_MixedPayloadThroughput.cpp
+ *
+ * Measures the latency of writers sending small samples while a writer sending large samples keeps the same
+ * flow controller busy, in order to compare how each scheduler isolates the small samples from the large ones.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/core/ReturnCode.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.hpp>
+
+#include "../optionarg.hpp"
+#include "ThroughputTypes.hpp"
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    SCHEDULER,
+    SMALL_WRITERS,
+    SMALL_SIZE,
+    LARGE_SIZE,
+    SAMPLES,
+    WRITE_PERIOD,
+    BANDWIDTH,
+    FLOW_PERIOD,
+    SMALL_WEIGHT,
+    LARGE_WEIGHT,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,   0, "",  "",              Arg::None,
+      "Usage: MixedPayloadThroughputTest [options]\n\nGeneral options:" },
+    { HELP,          0, "h", "help",          Arg::None,
+      "  -h         --help                   Produce help message." },
+    { SCHEDULER,     0, "s", "scheduler",     Arg::Required,
+      "  -s <arg>,  --scheduler=<arg>        Scheduler of the flow controller (\"FIFO\"/\"ROUND_ROBIN\"/"
+      "\"HIGH_PRIORITY\"/\"PRIORITY_WITH_RESERVATION\"/\"DEFICIT_ROUND_ROBIN\") (Defaults: DEFICIT_ROUND_ROBIN)." },
+    { SMALL_WRITERS, 0, "w", "small_writers", Arg::Numeric,
+      "  -w <num>,  --small_writers=<num>    Number of writers sending small samples (Defaults: 4)." },
+    { SMALL_SIZE,    0, "",  "small_size",    Arg::Numeric,
+      "             --small_size=<num>       Size in bytes of the small samples (Defaults: 100)." },
+    { LARGE_SIZE,    0, "",  "large_size",    Arg::Numeric,
+      "             --large_size=<num>       Size in bytes of the large samples (Defaults: 4194304)." },
+    { SAMPLES,       0, "n", "samples",       Arg::Numeric,
+      "  -n <num>,  --samples=<num>          Number of samples sent by each small writer (Defaults: 100)." },
+    { WRITE_PERIOD,  0, "p", "period_us",     Arg::Numeric,
+      "  -p <num>,  --period_us=<num>        Microseconds between two small samples of a writer (Defaults: 10000)." },
+    { BANDWIDTH,     0, "b", "bandwidth",     Arg::Numeric,
+      "  -b <num>,  --bandwidth=<num>        Bytes the flow controller sends per period, 0 means no limit "
+      "(Defaults: 1000000)." },
+    { FLOW_PERIOD,   0, "",  "flow_period",   Arg::Numeric,
+      "             --flow_period=<num>      Period of the flow controller in milliseconds (Defaults: 10)." },
+    { SMALL_WEIGHT,  0, "",  "small_weight",  Arg::Numeric,
+      "             --small_weight=<num>     Value of fastdds.sfc.weight for the small writers (Defaults: 1)." },
+    { LARGE_WEIGHT,  0, "",  "large_weight",  Arg::Numeric,
+      "             --large_weight=<num>     Value of fastdds.sfc.weight for the large writer (Defaults: 1)." },
+    { DOMAIN_ID,     0, "d", "domain",        Arg::Numeric,
+      "  -d <num>,  --domain=<num>           DDS domain ID (Defaults: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr const char* flow_controller_name = "mixed_payload_flow_controller";
+static constexpr std::chrono::seconds match_timeout{10};
+static constexpr std::chrono::seconds reception_timeout{60};
+
+static int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+//! Stores the latencies of the samples of a small writer, taking the send time stored by the writer thread.
+class SmallSampleListener : public DataReaderListener
+{
+public:
+
+    SmallSampleListener(
+            uint32_t samples,
+            std::mutex& mutex,
+            std::condition_variable& cv)
+        : sent_ns(new std::atomic<int64_t>[samples])
+        , samples_(samples)
+        , mutex_(mutex)
+        , cv_(cv)
+    {
+        for (uint32_t i = 0; i < samples_; ++i)
+        {
+            sent_ns[i].store(0);
+        }
+        latencies_us.reserve(samples_);
+    }
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        SampleInfo info;
+        while (RETCODE_OK == reader->take_next_sample(data_, &info))
+        {
+            int64_t received_ns = now_ns();
+            ThroughputType* sample = static_cast<ThroughputType*>(data_);
+            if (info.valid_data && sample->seqnum < samples_)
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                latencies_us.push_back(static_cast<double>(received_ns - sent_ns[sample->seqnum].load()) / 1000.0);
+                cv_.notify_all();
+            }
+        }
+    }
+
+    //! Send time of each sample, indexed by sequence number.
+    std::unique_ptr<std::atomic<int64_t>[]> sent_ns;
+
+    //! Latencies of the received samples. Protected by the mutex given on construction.
+    std::vector<double> latencies_us;
+
+    //! Buffer where samples are taken.
+    void* data_ = nullptr;
+
+private:
+
+    uint32_t samples_;
+
+    std::mutex& mutex_;
+
+    std::condition_variable& cv_;
+};
+
+//! Counts the samples received from the large writer.
+class LargeSampleListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        SampleInfo info;
+        while (RETCODE_OK == reader->take_next_sample(data_, &info))
+        {
+            if (info.valid_data)
+            {
+                ++received;
+            }
+        }
+    }
+
+    std::atomic<uint64_t> received{0};
+
+    //! Buffer where samples are taken.
+    void* data_ = nullptr;
+};
+
+static bool parse_scheduler(
+        const char* name,
+        FlowControllerSchedulerPolicy& scheduler)
+{
+    static const std::pair<const char*, FlowControllerSchedulerPolicy> schedulers[] = {
+        { "FIFO", FlowControllerSchedulerPolicy::FIFO },
+        { "ROUND_ROBIN", FlowControllerSchedulerPolicy::ROUND_ROBIN },
+        { "HIGH_PRIORITY", FlowControllerSchedulerPolicy::HIGH_PRIORITY },
+        { "PRIORITY_WITH_RESERVATION", FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION },
+        { "DEFICIT_ROUND_ROBIN", FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN }
+    };
+
+    for (const auto& entry : schedulers)
+    {
+        if (0 == strcmp(name, entry.first))
+        {
+            scheduler = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+static DomainParticipant* create_participant(
+        uint32_t domain,
+        const std::string& name,
+        const std::shared_ptr<FlowControllerDescriptor>& flow_controller)
+{
+    DomainParticipantQos pqos;
+    pqos.name(name);
+
+    // Samples should go through the flow controller and the network, so only UDP is used.
+    pqos.transport().use_builtin_transports = false;
+    pqos.transport().user_transports.push_back(std::make_shared<UDPv4TransportDescriptor>());
+
+    if (flow_controller)
+    {
+        pqos.flow_controllers().push_back(flow_controller);
+    }
+
+    return DomainParticipantFactory::get_instance()->create_participant(domain, pqos);
+}
+
+static DataWriterQos writer_qos(
+        uint32_t depth,
+        uint32_t weight)
+{
+    DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+    wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    wqos.reliability().max_blocking_time = eprosima::fastdds::dds::Duration_t(1, 0);
+    wqos.history().kind = KEEP_ALL_HISTORY_QOS;
+    wqos.resource_limits().max_samples = static_cast<int32_t>(depth);
+    wqos.resource_limits().max_samples_per_instance = static_cast<int32_t>(depth);
+    wqos.resource_limits().allocated_samples = static_cast<int32_t>(depth);
+    wqos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
+    wqos.publish_mode().flow_controller_name = flow_controller_name;
+    wqos.data_sharing().off();
+    wqos.properties().properties().emplace_back("fastdds.sfc.weight", std::to_string(weight));
+    return wqos;
+}
+
+static DataReaderQos reader_qos(
+        uint32_t depth)
+{
+    DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+    rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    rqos.history().kind = KEEP_ALL_HISTORY_QOS;
+    rqos.resource_limits().max_samples = static_cast<int32_t>(depth);
+    rqos.resource_limits().max_samples_per_instance = static_cast<int32_t>(depth);
+    rqos.resource_limits().allocated_samples = static_cast<int32_t>(depth);
+    rqos.data_sharing().off();
+    return rqos;
+}
+
+static bool wait_matched(
+        const std::vector<DataWriter*>& writers)
+{
+    Clock::time_point deadline = Clock::now() + match_timeout;
+    for (DataWriter* writer : writers)
+    {
+        PublicationMatchedStatus status;
+        while (RETCODE_OK == writer->get_publication_matched_status(status) && 0 == status.current_count)
+        {
+            if (Clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    return true;
+}
+
+static void print_latencies(
+        const char* name,
+        uint32_t index,
+        uint32_t sent,
+        std::vector<double> latencies)
+{
+    if (latencies.empty())
+    {
+        printf("%5s %3u %10u %10u %12s %12s %12s %12s\n", name, index, sent, 0u, "-", "-", "-", "-");
+        return;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    double mean = 0.0;
+    for (double latency : latencies)
+    {
+        mean += latency;
+    }
+    mean /= static_cast<double>(latencies.size());
+    size_t p50 = (latencies.size() - 1) / 2;
+    size_t p99 = (latencies.size() - 1) * 99 / 100;
+
+    printf("%5s %3u %10u %10zu %12.1f %12.1f %12.1f %12.1f\n", name, index, sent, latencies.size(),
+            mean, latencies[p50], latencies[p99], latencies.back());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    FlowControllerSchedulerPolicy scheduler = FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN;
+    const char* scheduler_name = "DEFICIT_ROUND_ROBIN";
+    uint32_t small_writers = 4;
+    uint32_t small_size = 100;
+    uint32_t large_size = 4194304;
+    uint32_t samples = 100;
+    uint32_t period_us = 10000;
+    uint32_t bandwidth = 1000000;
+    uint32_t flow_period_ms = 10;
+    uint32_t small_weight = 1;
+    uint32_t large_weight = 1;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case SCHEDULER:
+                if (!parse_scheduler(opt.arg, scheduler))
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 1;
+                }
+                scheduler_name = opt.arg;
+                break;
+            case SMALL_WRITERS:
+                small_writers = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case SMALL_SIZE:
+                small_size = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case LARGE_SIZE:
+                large_size = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case SAMPLES:
+                samples = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case WRITE_PERIOD:
+                period_us = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case BANDWIDTH:
+                bandwidth = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case FLOW_PERIOD:
+                flow_period_ms = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case SMALL_WEIGHT:
+                small_weight = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case LARGE_WEIGHT:
+                large_weight = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case DOMAIN_ID:
+                domain = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case UNKNOWN_OPT:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 1;
+                break;
+        }
+    }
+
+    if (0 == small_writers || 0 == small_size || 0 == large_size || 0 == samples || 0 == flow_period_ms ||
+            bandwidth > static_cast<uint32_t>((std::numeric_limits<int32_t>::max)()))
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    // Intraprocess delivery would bypass the flow controller.
+    eprosima::fastdds::LibrarySettings library_settings;
+    library_settings.intraprocess_delivery = eprosima::fastdds::IntraprocessDeliveryType::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(library_settings);
+
+    auto flow_controller = std::make_shared<FlowControllerDescriptor>();
+    flow_controller->name = flow_controller_name;
+    flow_controller->scheduler = scheduler;
+    flow_controller->max_bytes_per_period = static_cast<int32_t>(bandwidth);
+    flow_controller->period_ms = flow_period_ms;
+
+    DomainParticipant* pub_participant = create_participant(domain, "mixed_payload_pub", flow_controller);
+    DomainParticipant* sub_participant = create_participant(domain, "mixed_payload_sub", nullptr);
+    if (nullptr == pub_participant || nullptr == sub_participant)
+    {
+        printf("Error creating the participants\n");
+        return 1;
+    }
+
+    // Both sizes share the data type, so each one is registered with its own name.
+    TypeSupport small_type(new ThroughputDataType(small_size));
+    TypeSupport large_type(new ThroughputDataType(large_size));
+    const std::string small_type_name = "MixedPayloadSmallType";
+    const std::string large_type_name = "MixedPayloadLargeType";
+    small_type.register_type(pub_participant, small_type_name);
+    small_type.register_type(sub_participant, small_type_name);
+    large_type.register_type(pub_participant, large_type_name);
+    large_type.register_type(sub_participant, large_type_name);
+
+    Publisher* publisher = pub_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = sub_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    std::mutex latencies_mutex;
+    std::condition_variable latencies_cv;
+
+    std::vector<DataWriter*> writers;
+    std::vector<DataReader*> readers;
+    std::vector<std::unique_ptr<SmallSampleListener>> small_listeners;
+    LargeSampleListener large_listener;
+
+    Topic* large_pub_topic = pub_participant->create_topic("MixedPayloadLarge", large_type_name, TOPIC_QOS_DEFAULT);
+    Topic* large_sub_topic = sub_participant->create_topic("MixedPayloadLarge", large_type_name, TOPIC_QOS_DEFAULT);
+    DataWriter* large_writer = publisher->create_datawriter(large_pub_topic, writer_qos(2, large_weight));
+    large_listener.data_ = large_type.create_data();
+    readers.push_back(subscriber->create_datareader(large_sub_topic, reader_qos(2), &large_listener));
+    writers.push_back(large_writer);
+
+    for (uint32_t i = 0; i < small_writers; ++i)
+    {
+        std::string topic_name = "MixedPayloadSmall_" + std::to_string(i);
+        Topic* pub_topic = pub_participant->create_topic(topic_name, small_type_name, TOPIC_QOS_DEFAULT);
+        Topic* sub_topic = sub_participant->create_topic(topic_name, small_type_name, TOPIC_QOS_DEFAULT);
+        small_listeners.emplace_back(new SmallSampleListener(samples, latencies_mutex, latencies_cv));
+        small_listeners.back()->data_ = small_type.create_data();
+        writers.push_back(publisher->create_datawriter(pub_topic, writer_qos(samples, small_weight)));
+        readers.push_back(subscriber->create_datareader(sub_topic, reader_qos(samples), small_listeners.back().get()));
+    }
+
+    if (std::any_of(writers.begin(), writers.end(), [](DataWriter* writer)
+            {
+                return nullptr == writer;
+            }) ||
+            std::any_of(readers.begin(), readers.end(), [](DataReader* reader)
+            {
+                return nullptr == reader;
+            }))
+    {
+        printf("Error creating the endpoints\n");
+        return 1;
+    }
+
+    if (!wait_matched(writers))
+    {
+        printf("Timed out waiting for the endpoints to match\n");
+        return 1;
+    }
+
+    // The large writer keeps the flow controller busy for the whole test.
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> large_sent{0};
+    std::thread large_thread([&]()
+            {
+                ThroughputType* sample = static_cast<ThroughputType*>(large_type.create_data());
+                memset(sample->data, 0, large_size);
+                while (!stop.load())
+                {
+                    sample->seqnum = static_cast<uint32_t>(large_sent.load());
+                    if (RETCODE_OK == large_writer->write(sample))
+                    {
+                        ++large_sent;
+                    }
+                }
+                large_type.delete_data(sample);
+            });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> small_threads;
+    for (uint32_t i = 0; i < small_writers; ++i)
+    {
+        small_threads.emplace_back([&, i]()
+                {
+                    DataWriter* writer = writers[i + 1];
+                    SmallSampleListener& listener = *small_listeners[i];
+                    ThroughputType* sample = static_cast<ThroughputType*>(small_type.create_data());
+                    memset(sample->data, 0, small_size);
+                    for (uint32_t seq = 0; seq < samples; ++seq)
+                    {
+                        sample->seqnum = seq;
+                        listener.sent_ns[seq].store(now_ns());
+                        writer->write(sample);
+                        std::this_thread::sleep_until(start + std::chrono::microseconds(
+                            static_cast<uint64_t>(period_us) * (seq + 1)));
+                    }
+                    small_type.delete_data(sample);
+                });
+    }
+
+    for (std::thread& thread : small_threads)
+    {
+        thread.join();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(latencies_mutex);
+        latencies_cv.wait_for(lock, reception_timeout, [&]()
+                {
+                    return std::all_of(small_listeners.begin(), small_listeners.end(),
+                    [samples](const std::unique_ptr<SmallSampleListener>& listener)
+                    {
+                        return listener->latencies_us.size() == samples;
+                    });
+                });
+    }
+
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    uint64_t large_received = large_listener.received.load();
+    stop.store(true);
+    large_thread.join();
+
+    printf("Scheduler: %s  Bandwidth: %u bytes / %u ms  Small samples: %u bytes every %u us  Large samples: %u bytes\n",
+            scheduler_name, bandwidth, flow_period_ms, small_size, period_us, large_size);
+    printf("%5s %3s %10s %10s %12s %12s %12s %12s\n", "Kind", "Id", "Sent", "Received",
+            "Mean(us)", "50%(us)", "99%(us)", "Max(us)");
+
+    bool all_received = true;
+    {
+        std::lock_guard<std::mutex> guard(latencies_mutex);
+        for (uint32_t i = 0; i < small_writers; ++i)
+        {
+            all_received &= small_listeners[i]->latencies_us.size() == samples;
+            print_latencies("small", i, samples, small_listeners[i]->latencies_us);
+        }
+    }
+    printf("%5s %3u %10llu %10llu  MBits/sec: %.3f\n", "large", 0u,
+            static_cast<unsigned long long>(large_sent.load()), static_cast<unsigned long long>(large_received),
+            elapsed > 0.0 ? static_cast<double>(large_received) * large_size * 8 / elapsed / 1000000.0 : 0.0);
+    fflush(stdout);
+
+    for (size_t i = 0; i < readers.size(); ++i)
+    {
+        readers[i]->set_listener(nullptr);
+    }
+    large_type.delete_data(large_listener.data_);
+    for (auto& listener : small_listeners)
+    {
+        small_type.delete_data(listener->data_);
+    }
+
+    pub_participant->delete_contained_entities();
+    sub_participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(pub_participant);
+    DomainParticipantFactory::get_instance()->delete_participant(sub_participant);
+
+    if (!all_received)
+    {
+        printf("Not all the small samples were received\n");
+        return 1;
+    }
+
+    return 0;
+}
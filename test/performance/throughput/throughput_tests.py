@@ -13,10 +13,48 @@
 # limitations under the License.
 
 import argparse
+import csv
 import os
 import subprocess
 
 
+def xml_filename_options(xml_file):
+    """Return the part of the measurements file name taken from an XML configuration file name."""
+    filename_options = xml_file.split('/')[-1].split('\\')[-1]
+    filename_options = filename_options.split('.')[-2].split('_')[1:]
+    return '_'.join(filename_options)
+
+
+def read_measurements(csv_file):
+    """Return the subscription throughput [Mb/s] of each (payload, demand, recovery time) of a measurements file."""
+    with open(csv_file) as data_file:
+        reader = csv.reader(data_file)
+        next(reader, None)  # Skip the header
+        return {tuple(row[0:3]): float(row[11]) for row in reader if len(row) >= 12}
+
+
+def compare_measurements(baseline_csv, measurements_csv):
+    """Print the difference between the subscription throughput of this run and the one of a baseline run."""
+    if not os.path.isfile(baseline_csv):
+        print('Baseline measurements "{}" NOT found, run its test first'.format(baseline_csv))
+        return
+    if not os.path.isfile(measurements_csv):
+        print('Measurements "{}" NOT found'.format(measurements_csv))
+        return
+
+    baseline = read_measurements(baseline_csv)
+    measurements = read_measurements(measurements_csv)
+
+    print('Comparison with {}'.format(baseline_csv))
+    print('[ Bytes,Demand,Recovery Time][Baseline MBits/sec,  MBits/sec,  Diff (%)]')
+    for key, mbits in measurements.items():
+        if key in baseline:
+            base = baseline[key]
+            diff = (mbits - base) * 100.0 / base if base > 0 else 0.0
+            print('{:>7},{:>6},{:>14},{:>19.3f},{:>11.3f},{:>10.2f}'.format(
+                key[0], key[1], key[2], base, mbits, diff))
+
+
 if __name__ == '__main__':
     parser = argparse.ArgumentParser(
         formatter_class=argparse.ArgumentDefaultsHelpFormatter
@@ -89,6 +127,12 @@ if __name__ == '__main__':
         help='Explicitly enable/disable shared memory transport. (Defaults: Fast DDS default settings)',
         required=False
         )
+    parser.add_argument(
+        '-b',
+        '--baseline_xml_file',
+        help='A Fast DDS XML configuration file, whose measurements from a previous run are compared with these ones',
+        required=False
+    )
 
     # Parse arguments
     args = parser.parse_args()
@@ -122,18 +166,28 @@ if __name__ == '__main__':
         else:
             xml_options = ['--xml', xml_file]
             # Get reliability from XML
-            filename_options = xml_file.split('/')[-1].split('\\')[-1]
-            filename_options = filename_options.split('.')[-2].split('_')[1:]
-            filename_options = '_'.join(filename_options)
+            filename_options = xml_filename_options(xml_file)
 
     # Data sharing and loans options
     # modify output file names
+    filename_suffix = ''
     if args.data_sharing and 'on' == args.data_sharing and args.data_loans:
-        filename_options += '_data_loans_and_sharing'
+        filename_suffix = '_data_loans_and_sharing'
     elif args.data_sharing and 'on' == args.data_sharing:
-        filename_options += '_data_sharing'
+        filename_suffix = '_data_sharing'
     elif args.data_loans:
-        filename_options += '_data_loans'
+        filename_suffix = '_data_loans'
+
+    # Measurements file names
+    measurements_pattern = './measurements_{}_{{}}{}{}.csv'.format(
+        'interprocess' if interprocess else 'intraprocess',
+        filename_suffix,
+        '_security' if security else '')
+    measurements_csv = measurements_pattern.format(filename_options)
+
+    baseline_csv = None
+    if args.baseline_xml_file:
+        baseline_csv = measurements_pattern.format(xml_filename_options(args.baseline_xml_file))
 
     # Demands files options
     demands_options = []
@@ -232,21 +286,12 @@ if __name__ == '__main__':
             'subscriber',
         ]
 
+        pub_command.append(measurements_csv)
+
         # Manage security
         if security is True:
-            pub_command.append(
-                './measurements_interprocess_{}_security.csv'.format(
-                    filename_options
-                )
-            )
             pub_command += security_options
             sub_command += security_options
-        else:
-            pub_command.append(
-                './measurements_interprocess_{}.csv'.format(
-                    filename_options
-                )
-            )
 
         pub_command += demands_options
         pub_command += recoveries_options
@@ -290,20 +335,11 @@ if __name__ == '__main__':
             '--export_csv',
         ]
 
+        command.append(measurements_csv)
+
         # Manage security
         if security is True:
-            command.append(
-                './measurements_intraprocess_{}_security.csv'.format(
-                    filename_options,
-                )
-            )
             command += security_options
-        else:
-            command.append(
-                './measurements_intraprocess_{}.csv'.format(
-                    filename_options,
-                )
-            )
 
         command += demands_options
         command += recoveries_options
@@ -321,5 +357,11 @@ if __name__ == '__main__':
         both = subprocess.Popen(command)
         # Wait until finish
         both.communicate()
-        exit(both.returncode)
+
+        if both.returncode != 0:
+            exit(both.returncode)
+
+    if baseline_csv:
+        compare_measurements(baseline_csv, measurements_csv)
+
     exit(0)
@@ -0,0 +1,317 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TimedEventChurn.cpp
+ *
+ * Measures the cost of restarting and cancelling timed events on a ResourceEvent holding a large number of active
+ * events, with the sorted collection and with the timing wheel.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <rtps/resources/ResourceEvent.h>
+#include <rtps/resources/TimedEvent.h>
+
+#include "../optionarg.hpp"
+
+using namespace eprosima::fastdds::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    MODE,
+    EVENTS,
+    SECONDS,
+    THREADS,
+    SEED
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0, "",  "",        Arg::None,
+      "Usage: TimedEventChurn [options]\n\nGeneral options:" },
+    { HELP,        0, "h", "help",    Arg::None,
+      "  -h         --help                   Produce help message." },
+    { MODE,        0, "m", "mode",    Arg::Required,
+      "  -m <arg>,  --mode=<arg>             Collection of active timers (\"sorted\"/\"wheel\"/\"both\")." },
+    { EVENTS,      0, "e", "events",  Arg::Numeric,
+      "  -e <num>,  --events=<num>           Number of timed events (Defaults: 50000)." },
+    { SECONDS,     0, "t", "seconds", Arg::Numeric,
+      "  -t <num>,  --seconds=<num>          Duration of each run in seconds (Defaults: 5)." },
+    { THREADS,     0, "n", "threads", Arg::Numeric,
+      "  -n <num>,  --threads=<num>          Number of threads restarting and cancelling events (Defaults: 1)." },
+    { SEED,        0, "",  "seed",    Arg::Numeric,
+      "             --seed=<num>             Seed of the random generators (Defaults: 80)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+using Clock = std::chrono::steady_clock;
+
+//! A timed event together with the data used to measure how late it is triggered.
+struct ChurnEvent
+{
+    ChurnEvent(
+            ResourceEvent& service,
+            double milliseconds,
+            std::atomic<uint64_t>& triggered,
+            std::atomic<uint64_t>& total_delay_us,
+            std::atomic<uint64_t>& max_delay_us)
+        : interval(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(
+                milliseconds)))
+        , event(service, [this, &triggered, &total_delay_us, &max_delay_us]()
+                {
+                    int64_t delay = std::chrono::duration_cast<std::chrono::microseconds>(
+                        Clock::now().time_since_epoch()).count() - expected_us.load(std::memory_order_relaxed);
+                    uint64_t delay_us = delay > 0 ? static_cast<uint64_t>(delay) : 0u;
+
+                    triggered.fetch_add(1, std::memory_order_relaxed);
+                    total_delay_us.fetch_add(delay_us, std::memory_order_relaxed);
+                    uint64_t max = max_delay_us.load(std::memory_order_relaxed);
+                    while (delay_us > max &&
+                    !max_delay_us.compare_exchange_weak(max, delay_us, std::memory_order_relaxed))
+                    {
+                    }
+                    return false;
+                }, milliseconds)
+    {
+    }
+
+    void restart()
+    {
+        expected_us.store(std::chrono::duration_cast<std::chrono::microseconds>(
+                    (Clock::now() + interval).time_since_epoch()).count(), std::memory_order_relaxed);
+        event.restart_timer();
+    }
+
+    Clock::duration interval;
+    std::atomic<int64_t> expected_us{0};
+    //! Declared as the last member, as required by TimedEvent
+    TimedEvent event;
+};
+
+static void run_churn(
+        bool use_timer_wheel,
+        uint32_t num_events,
+        uint32_t seconds,
+        uint32_t num_threads,
+        uint32_t seed)
+{
+    std::atomic<uint64_t> triggered{0};
+    std::atomic<uint64_t> total_delay_us{0};
+    std::atomic<uint64_t> max_delay_us{0};
+
+    ResourceEvent service;
+    service.init_thread({}, "dds.ev.%u", 0, use_timer_wheel);
+
+    // Intervals between 10 ms and 10 s, so most of the events are active at any time
+    std::vector<std::unique_ptr<ChurnEvent>> events;
+    events.reserve(num_events);
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> interval(10.0, 10000.0);
+        for (uint32_t i = 0; i < num_events; ++i)
+        {
+            events.emplace_back(new ChurnEvent(service, interval(gen), triggered, total_delay_us, max_delay_us));
+        }
+    }
+    for (std::unique_ptr<ChurnEvent>& event : events)
+    {
+        event->restart();
+    }
+
+    // Each thread churns on its own range of events: three restarts for each cancellation
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> operations(num_threads, 0u);
+    std::vector<std::thread> threads;
+    Clock::time_point start = Clock::now();
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&, t]()
+                {
+                    std::mt19937 gen(seed + t + 1);
+                    size_t first = events.size() * t / num_threads;
+                    size_t last = events.size() * (t + 1) / num_threads;
+                    std::uniform_int_distribution<size_t> index(first, last - 1);
+                    std::uniform_int_distribution<uint32_t> action(0, 3);
+                    uint64_t count = 0;
+
+                    while (!stop.load(std::memory_order_relaxed))
+                    {
+                        ChurnEvent& event = *events[index(gen)];
+                        if (0 == action(gen))
+                        {
+                            event.event.cancel_timer();
+                        }
+                        else
+                        {
+                            event.restart();
+                        }
+                        ++count;
+                    }
+
+                    operations[t] = count;
+                });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    stop.store(true);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // Destroy the events before the service
+    events.clear();
+
+    uint64_t total_operations = 0;
+    for (uint64_t count : operations)
+    {
+        total_operations += count;
+    }
+    uint64_t num_triggered = triggered.load();
+
+    printf("%-8s events: %u  threads: %u  operations/s: %12.0f  triggered: %10llu  "
+            "mean delay (us): %10.1f  max delay (us): %10llu\n",
+            use_timer_wheel ? "wheel" : "sorted", num_events, num_threads,
+            static_cast<double>(total_operations) / elapsed,
+            static_cast<unsigned long long>(num_triggered),
+            num_triggered > 0 ? static_cast<double>(total_delay_us.load()) / static_cast<double>(num_triggered) : 0.0,
+            static_cast<unsigned long long>(max_delay_us.load()));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    bool run_sorted = true;
+    bool run_wheel = true;
+    uint32_t num_events = 50000;
+    uint32_t seconds = 5;
+    uint32_t num_threads = 1;
+    uint32_t seed = 80;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case MODE:
+                if (strcmp(opt.arg, "sorted") == 0)
+                {
+                    run_sorted = true;
+                    run_wheel = false;
+                }
+                else if (strcmp(opt.arg, "wheel") == 0)
+                {
+                    run_sorted = false;
+                    run_wheel = true;
+                }
+                else if (strcmp(opt.arg, "both") == 0)
+                {
+                    run_sorted = true;
+                    run_wheel = true;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 1;
+                }
+                break;
+            case EVENTS:
+                num_events = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case SECONDS:
+                seconds = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case THREADS:
+                num_threads = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case SEED:
+                seed = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case UNKNOWN_OPT:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 1;
+                break;
+        }
+    }
+
+    if (0 == num_events || 0 == num_threads || num_threads > num_events)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    if (run_sorted)
+    {
+        run_churn(false, num_events, seconds, num_threads, seed);
+    }
+    if (run_wheel)
+    {
+        run_churn(true, num_events, seconds, num_threads, seed);
+    }
+
+    return 0;
+}
@@ -0,0 +1,238 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
+
+#include <fastdds/publisher/filtering/DataWriterFilteredChange.hpp>
+#include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
+
+#include "../topic/DDSSQLFilter/data_types/ContentFilterTestType.hpp"
+#include "../topic/DDSSQLFilter/data_types/ContentFilterTestTypePubSubTypes.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DomainParticipantTest : public DomainParticipant
+{
+public:
+
+    DomainParticipantImpl* get_impl() const
+    {
+        return impl_;
+    }
+
+};
+
+/**
+ * Check how the readers of a ReaderFilterCollection are grouped, using a real participant so the built-in DDS-SQL
+ * filter factory is used.
+ */
+class ReaderFilterCollectionTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+        ASSERT_NE(nullptr, participant_);
+
+        type_ = TypeSupport(new ContentFilterTestTypePubSubType());
+        ASSERT_EQ(RETCODE_OK, type_.register_type(participant_));
+
+        topic_ = participant_->create_topic("filtered_topic", type_.get_type_name(), TOPIC_QOS_DEFAULT);
+        ASSERT_NE(nullptr, topic_);
+    }
+
+    void TearDown() override
+    {
+        if (nullptr != participant_)
+        {
+            participant_->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant_);
+        }
+    }
+
+    static fastdds::rtps::GUID_t reader_guid(
+            uint8_t id)
+    {
+        fastdds::rtps::GUID_t guid;
+        guid.guidPrefix.value[0] = 1;
+        guid.entityId.value[3] = id;
+        return guid;
+    }
+
+    //! Registers a reader filtering with a DDS-SQL expression, on a content filtered topic of its own.
+    void set_filter(
+            ReaderFilterCollection& collection,
+            const fastdds::rtps::GUID_t& guid,
+            const std::string& expression,
+            const std::string& parameter)
+    {
+        rtps::ContentFilterProperty filter_info(rtps::ContentFilterProperty::AllocationConfiguration{});
+        filter_info.content_filtered_topic_name = "cft_" + std::to_string(guid.entityId.value[3]);
+        filter_info.related_topic_name = "filtered_topic";
+        filter_info.filter_class_name = FASTDDS_SQLFILTER_NAME;
+        filter_info.filter_expression = expression;
+        filter_info.expression_parameters.push_back(parameter.c_str());
+
+        DomainParticipantImpl* participant_impl = static_cast<DomainParticipantTest*>(participant_)->get_impl();
+        collection.process_reader_filter_info(guid, filter_info, participant_impl, topic_);
+    }
+
+    //! Filters a change, returning the readers for which it has been filtered out.
+    std::vector<fastdds::rtps::GUID_t> filter(
+            const ReaderFilterCollection& collection,
+            int16_t value)
+    {
+        ContentFilterTestType data;
+        data.int16_field(value);
+
+        DataWriterFilteredChange change(ResourceLimitedContainerConfig{});
+        change.writerGUID.guidPrefix.value[0] = 2;
+        change.sequenceNumber = ++sequence_number_;
+        // Appendable types encoded with XCDRv2 need the payload to be deserialized
+        change.serializedPayload.reserve(type_.calculate_serialized_size(&data, XCDR2_DATA_REPRESENTATION));
+        EXPECT_TRUE(type_.serialize(&data, change.serializedPayload, XCDR2_DATA_REPRESENTATION));
+
+        collection.update_filter_info(change, fastdds::rtps::SampleIdentity::unknown());
+
+        std::vector<fastdds::rtps::GUID_t> filtered_out(change.filtered_out_readers.begin(),
+                change.filtered_out_readers.end());
+        std::sort(filtered_out.begin(), filtered_out.end());
+        return filtered_out;
+    }
+
+    DomainParticipant* participant_ = nullptr;
+    TypeSupport type_;
+    Topic* topic_ = nullptr;
+    fastdds::rtps::SequenceNumber_t sequence_number_;
+};
+
+/*
+ * Check that the readers with the same expression and parameters share the evaluation of their filter, and that
+ * all the DDS-SQL filters on the type share the deserialized payload.
+ */
+TEST_F(ReaderFilterCollectionTests, add_readers_share_results)
+{
+    ReaderFilterCollection collection(ResourceLimitedContainerConfig{});
+    set_filter(collection, reader_guid(1), "int16_field > %0", "0");
+    set_filter(collection, reader_guid(2), "int16_field > %0", "0");
+    set_filter(collection, reader_guid(3), "int16_field > %0", "0");
+    set_filter(collection, reader_guid(4), "int16_field < %0", "0");
+    ASSERT_FALSE(collection.empty());
+
+    std::vector<fastdds::rtps::GUID_t> expected{ reader_guid(4) };
+    EXPECT_EQ(expected, filter(collection, 5));
+
+    const ReaderFilterCollection::EvaluationStatistics& statistics = collection.evaluation_statistics();
+    EXPECT_EQ(4u, statistics.reader_evaluations);
+    EXPECT_EQ(2u, statistics.filter_evaluations);
+    EXPECT_EQ(2u, statistics.shared_evaluations);
+    // Each filter builds its own DynamicType, but they are equal, so the payload is only deserialized once
+    EXPECT_EQ(1u, statistics.payload_decodings);
+
+    expected = { reader_guid(1), reader_guid(2), reader_guid(3) };
+    EXPECT_EQ(expected, filter(collection, -5));
+    EXPECT_EQ(8u, statistics.reader_evaluations);
+    EXPECT_EQ(4u, statistics.filter_evaluations);
+    EXPECT_EQ(2u, statistics.payload_decodings);
+}
+
+/*
+ * Check that a reader changing its filter moves to the group of its new expression.
+ */
+TEST_F(ReaderFilterCollectionTests, update_reader_changes_group)
+{
+    ReaderFilterCollection collection(ResourceLimitedContainerConfig{});
+    set_filter(collection, reader_guid(1), "int16_field > %0", "0");
+    set_filter(collection, reader_guid(2), "int16_field > %0", "0");
+    set_filter(collection, reader_guid(3), "int16_field < %0", "0");
+
+    std::vector<fastdds::rtps::GUID_t> expected{ reader_guid(3) };
+    EXPECT_EQ(expected, filter(collection, 5));
+
+    // Same expression as reader 3
+    set_filter(collection, reader_guid(2), "int16_field < %0", "0");
+    expected = { reader_guid(2), reader_guid(3) };
+    EXPECT_EQ(expected, filter(collection, 5));
+
+    // A different parameter makes a different group
+    set_filter(collection, reader_guid(3), "int16_field < %0", "10");
+    expected = { reader_guid(2) };
+    EXPECT_EQ(expected, filter(collection, 5));
+
+    const ReaderFilterCollection::EvaluationStatistics& statistics = collection.evaluation_statistics();
+    EXPECT_EQ(9u, statistics.reader_evaluations);
+    EXPECT_EQ(2u + 2u + 3u, statistics.filter_evaluations);
+    EXPECT_EQ(2u, statistics.shared_evaluations);
+    EXPECT_EQ(3u, statistics.payload_decodings);
+}
+
+/*
+ * Check that removing readers keeps the results of the remaining ones, even when the first reader of a group is
+ * removed.
+ */
+TEST_F(ReaderFilterCollectionTests, remove_reader_keeps_groups)
+{
+    ReaderFilterCollection collection(ResourceLimitedContainerConfig{});
+    set_filter(collection, reader_guid(1), "int16_field > %0", "0");
+    set_filter(collection, reader_guid(2), "int16_field < %0", "0");
+    set_filter(collection, reader_guid(3), "int16_field > %0", "0");
+    set_filter(collection, reader_guid(4), "int16_field < %0", "0");
+
+    collection.remove_reader(reader_guid(1));
+
+    std::vector<fastdds::rtps::GUID_t> expected{ reader_guid(2), reader_guid(4) };
+    EXPECT_EQ(expected, filter(collection, 5));
+    const ReaderFilterCollection::EvaluationStatistics& statistics = collection.evaluation_statistics();
+    EXPECT_EQ(3u, statistics.reader_evaluations);
+    EXPECT_EQ(2u, statistics.filter_evaluations);
+    EXPECT_EQ(1u, statistics.shared_evaluations);
+
+    collection.remove_reader(reader_guid(2));
+    expected = { reader_guid(3) };
+    EXPECT_EQ(expected, filter(collection, -5));
+    EXPECT_EQ(5u, statistics.reader_evaluations);
+    EXPECT_EQ(4u, statistics.filter_evaluations);
+    EXPECT_EQ(1u, statistics.shared_evaluations);
+
+    collection.remove_reader(reader_guid(3));
+    collection.remove_reader(reader_guid(4));
+    EXPECT_TRUE(collection.empty());
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,4 +1,7 @@
 #include <fastdds/subscriber/history/DataReaderInstance.hpp>
+#include <fastdds/subscriber/history/DataReaderInstanceCollection.hpp>
+
+#include <set>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -374,6 +377,113 @@ TEST(DataReaderInstance, same_ownership_strenght)
     ASSERT_EQ(0u, counters.instances_no_writers);
 }
 
+/*!
+ * Tests DataReaderInstanceCollection keeps all instances accessible by their handle while they are added and removed,
+ * including the growth of the table and the reuse of pooled instances.
+ */
+TEST(DataReaderInstanceCollection, add_find_erase)
+{
+    using eprosima::fastdds::dds::detail::DataReaderInstance;
+    using eprosima::fastdds::dds::detail::DataReaderInstanceCollection;
+    using eprosima::fastdds::rtps::InstanceHandle_t;
+
+    DataReaderInstanceCollection instances;
+    instances.init({}, {}, static_cast<size_t>(std::numeric_limits<int32_t>::max()));
+
+    auto make_handle = [](uint32_t n)
+            {
+                return InstanceHandle_t(eprosima::fastdds::rtps::GUID_t({}, n));
+            };
+
+    // Grow the table several times
+    const uint32_t num_instances = 1000;
+    for (uint32_t i = 1; i <= num_instances; ++i)
+    {
+        ASSERT_EQ(nullptr, instances.find(make_handle(i)));
+        DataReaderInstance* instance = instances.emplace(make_handle(i));
+        ASSERT_NE(nullptr, instance);
+        instance->disposed_generation_count = static_cast<int32_t>(i);
+    }
+    ASSERT_EQ(num_instances, instances.size());
+
+    // Remove the odd ones
+    for (uint32_t i = 1; i <= num_instances; i += 2)
+    {
+        ASSERT_TRUE(instances.erase(make_handle(i)));
+        ASSERT_FALSE(instances.erase(make_handle(i)));
+    }
+    ASSERT_EQ(num_instances / 2, instances.size());
+
+    for (uint32_t i = 1; i <= num_instances; ++i)
+    {
+        DataReaderInstance* instance = instances.find(make_handle(i));
+        if (i % 2)
+        {
+            ASSERT_EQ(nullptr, instance);
+        }
+        else
+        {
+            ASSERT_NE(nullptr, instance);
+            ASSERT_EQ(static_cast<int32_t>(i), instance->disposed_generation_count);
+        }
+    }
+
+    // Iteration visits each instance once
+    std::set<InstanceHandle_t> visited;
+    for (const DataReaderInstanceCollection::value_type& item : instances)
+    {
+        ASSERT_EQ(item.second, instances.find(item.first));
+        ASSERT_TRUE(visited.insert(item.first).second);
+    }
+    ASSERT_EQ(instances.size(), visited.size());
+
+    // Reused instances are returned on their initial state
+    DataReaderInstance* instance = instances.emplace(make_handle(1));
+    ASSERT_EQ(0, instance->disposed_generation_count);
+    ASSERT_EQ(eprosima::fastdds::dds::NEW_VIEW_STATE, instance->view_state);
+    ASSERT_EQ(eprosima::fastdds::dds::ALIVE_INSTANCE_STATE, instance->instance_state);
+    ASSERT_FALSE(instance->has_available_data);
+
+    // The unknown handle is a valid key
+    const InstanceHandle_t unknown_handle;
+    ASSERT_EQ(nullptr, instances.find(unknown_handle));
+    ASSERT_FALSE(instances.erase(unknown_handle));
+    instance = instances.emplace(unknown_handle);
+    ASSERT_EQ(instance, instances.find(unknown_handle));
+    ASSERT_TRUE(instances.erase(unknown_handle));
+    ASSERT_EQ(nullptr, instances.find(unknown_handle));
+}
+
+/*!
+ * Tests DataReaderInstanceCollection preallocates all instances when the maximum number of instances is finite.
+ */
+TEST(DataReaderInstanceCollection, preallocation)
+{
+    using eprosima::fastdds::dds::detail::DataReaderInstance;
+    using eprosima::fastdds::dds::detail::DataReaderInstanceCollection;
+    using eprosima::fastdds::rtps::InstanceHandle_t;
+
+    const uint32_t max_instances = 64;
+    DataReaderInstanceCollection instances;
+    instances.init({}, {}, max_instances);
+
+    std::set<DataReaderInstance*> pointers;
+    for (uint32_t i = 1; i <= max_instances; ++i)
+    {
+        pointers.insert(instances.emplace(InstanceHandle_t(eprosima::fastdds::rtps::GUID_t({}, i))));
+    }
+
+    // Instances removed and added again are taken from the same pool
+    for (uint32_t i = 1; i <= max_instances; ++i)
+    {
+        ASSERT_TRUE(instances.erase(InstanceHandle_t(eprosima::fastdds::rtps::GUID_t({}, i))));
+        DataReaderInstance* instance =
+                instances.emplace(InstanceHandle_t(eprosima::fastdds::rtps::GUID_t({}, i + 100)));
+        ASSERT_EQ(1u, pointers.count(instance));
+    }
+    ASSERT_EQ(max_instances, instances.size());
+}
+
 int main(
         int argc,
         char** argv)
@@ -28,6 +28,13 @@
 
 #include "fastdds/dds/core/StackAllocatedSequence.hpp"
 #include "fastdds/dds/log/Log.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/DynamicData.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp"
+#include "fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp"
 
 #include "data_types/ContentFilterTestType.hpp"
 #include "data_types/ContentFilterTestTypePubSubTypes.hpp"
@@ -591,8 +598,12 @@ public:
 
     static const std::vector<std::unique_ptr<IContentFilter::SerializedPayload>>& values()
     {
-        static DDSSQLFilterValueGlobalData the_instance;
-        return the_instance.values_;
+        return instance().values_;
+    }
+
+    static const std::vector<std::unique_ptr<IContentFilter::SerializedPayload>>& xcdr2_values()
+    {
+        return instance().xcdr2_values_;
     }
 
     static const std::array<std::array<std::array<bool, 5>, 5>, 6>& results()
@@ -663,6 +674,13 @@ public:
 private:
 
     std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> values_;
+    std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> xcdr2_values_;
+
+    static DDSSQLFilterValueGlobalData& instance()
+    {
+        static DDSSQLFilterValueGlobalData the_instance;
+        return the_instance;
+    }
 
     DDSSQLFilterValueGlobalData()
     {
@@ -692,19 +710,22 @@ private:
 
         for (const ContentFilterTestType& d : data)
         {
-            add_value(d);
+            add_value(values_, d, fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+            add_value(xcdr2_values_, d, fastdds::dds::XCDR2_DATA_REPRESENTATION);
         }
     }
 
     void add_value(
-            const ContentFilterTestType& data)
+            std::vector<std::unique_ptr<IContentFilter::SerializedPayload>>& values,
+            const ContentFilterTestType& data,
+            fastdds::dds::DataRepresentationId_t data_representation)
     {
         static ContentFilterTestTypePubSubType type_support;
         auto data_ptr = const_cast<ContentFilterTestType*>(&data);
-        auto data_size = type_support.calculate_serialized_size(data_ptr, fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        auto data_size = type_support.calculate_serialized_size(data_ptr, data_representation);
         auto payload = new IContentFilter::SerializedPayload(data_size);
-        values_.emplace_back(payload);
-        type_support.serialize(data_ptr, *payload, fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        values.emplace_back(payload);
+        type_support.serialize(data_ptr, *payload, data_representation);
     }
 
     void add_char_values(
@@ -1091,6 +1112,9 @@ TEST_P(DDSSQLFilterValueTests, test_filtered_value)
 
     perform_basic_check(filter_instance, results, values);
 
+    // Payloads of appendable types encoded with XCDRv2 are fully deserialized
+    perform_basic_check(filter_instance, results, DDSSQLFilterValueGlobalData::xcdr2_values());
+
     ret = uut.delete_content_filter("DDSSQL", filter_instance);
     EXPECT_EQ(RETCODE_OK, ret);
 
@@ -1205,6 +1229,55 @@ TEST_F(DDSSQLFilterValueTests, test_compound_or)
     }
 }
 
+TEST_F(DDSSQLFilterValueTests, shared_decoded_payload)
+{
+    IContentFilter* and_filter = nullptr;
+    auto ret = create_content_filter(uut, "float_field BETWEEN %0 AND %1 AND int16_field < 0",
+                    { "-3.14159", "3.14159" }, &type_support, and_filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+    ASSERT_NE(nullptr, and_filter);
+
+    IContentFilter* or_filter = nullptr;
+    ret = create_content_filter(uut, "float_field NOT BETWEEN %0 AND %1 OR int16_field > 0",
+                    { "-3.14159", "3.14159" }, &type_support, or_filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+    ASSERT_NE(nullptr, or_filter);
+
+    auto and_expression = static_cast<DDSSQLFilter::DDSFilterExpression*>(and_filter);
+    auto or_expression = static_cast<DDSSQLFilter::DDSFilterExpression*>(or_filter);
+
+    // Payloads of appendable types encoded with XCDRv2 are fully deserialized
+    const auto& values = DDSSQLFilterValueGlobalData::xcdr2_values();
+    std::array<bool, 5> and_results{false, true, false, false, false};
+    std::array<bool, 5> or_results{ true, false, false, true, true };
+    ASSERT_EQ(and_results.size(), values.size());
+
+    DDSSQLFilter::DDSFilterExpression::DecodedPayload decoded;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        decoded.reset();
+        EXPECT_EQ(and_results[i], and_expression->evaluate(*values[i], decoded)) << "with i = " << i;
+        EXPECT_TRUE(decoded.is_decoded);
+        EXPECT_TRUE(decoded.is_valid);
+        EXPECT_EQ(or_results[i], or_expression->evaluate(*values[i], decoded)) << "with i = " << i;
+
+        // The payload is not deserialized again until the view is reset
+        size_t other = (i + 1) % values.size();
+        EXPECT_EQ(or_results[i], or_expression->evaluate(*values[other], decoded)) << "with i = " << i;
+    }
+
+    // Plain XCDRv1 payloads do not need the decoded view
+    decoded.reset();
+    const auto& plain_values = DDSSQLFilterValueGlobalData::values();
+    EXPECT_EQ(and_results[1], and_expression->evaluate(*plain_values[1], decoded));
+    EXPECT_FALSE(decoded.is_decoded);
+
+    ret = uut.delete_content_filter("DDSSQL", and_filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+    ret = uut.delete_content_filter("DDSSQL", or_filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+}
+
 TEST_F(DDSSQLFilterValueTests, test_update_params)
 {
     static const std::string expression = "string_field MATCH %0 OR string_field LIKE %1";
@@ -1293,6 +1366,206 @@ TEST_F(DDSSQLFilterValueTests, key_only_payload)
     EXPECT_EQ(RETCODE_OK, ret);
 }
 
+/**
+ * Build a structure where the payload plan needs to skip a string and a sequence to reach the last member.
+ */
+static DynamicType::_ref_type create_payload_plan_type(
+        const std::string& type_name,
+        ExtensibilityKind extensibility)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name(type_name);
+    type_descriptor->extensibility_kind(extensibility);
+    DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+
+    const std::vector<std::pair<std::string, DynamicType::_ref_type>> members =
+    {
+        {"int16_field", factory->get_primitive_type(TK_INT16)},
+        {"string_field", factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build()},
+        {"sequence_field", factory->create_sequence_type(factory->get_primitive_type(TK_INT32),
+                static_cast<uint32_t>(LENGTH_UNLIMITED))->build()},
+        {"float_field", factory->get_primitive_type(TK_FLOAT32)}
+    };
+    MemberId id = 0;
+    for (const auto& member : members)
+    {
+        MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+        member_descriptor->id(id++);
+        member_descriptor->name(member.first);
+        member_descriptor->type(member.second);
+        EXPECT_EQ(RETCODE_OK, builder->add_member(member_descriptor));
+    }
+
+    return builder->build();
+}
+
+/**
+ * Serialize the samples used by the payload plan tests with both XCDRv1 and XCDRv2.
+ */
+static void add_payload_plan_values(
+        DynamicPubSubType& type_support,
+        std::vector<std::unique_ptr<IContentFilter::SerializedPayload>>& xcdr1_values,
+        std::vector<std::unique_ptr<IContentFilter::SerializedPayload>>& xcdr2_values)
+{
+    struct Sample
+    {
+        int16_t int16_value;
+        std::string string_value;
+        std::vector<int32_t> sequence_value;
+        float float_value;
+    };
+
+    static const std::array<Sample, 5> samples =
+    {{
+        {2, "abc", {1, 2}, 1.0f},
+        {1, "xyz", {1, 20}, 1.0f},
+        {3, "xyz", {30, 5, 7}, 2.5f},
+        {4, "abd", {1, 2}, 0.25f},
+        {-5, "", {0, 9}, 0.75f}
+    }};
+
+    DynamicType::_ref_type type = type_support.get_dynamic_type();
+    for (const Sample& sample : samples)
+    {
+        DynamicData::_ref_type data {DynamicDataFactory::get_instance()->create_data(type)};
+        EXPECT_EQ(RETCODE_OK, data->set_int16_value(data->get_member_id_by_name("int16_field"), sample.int16_value));
+        EXPECT_EQ(RETCODE_OK, data->set_string_value(data->get_member_id_by_name("string_field"),
+                sample.string_value));
+        EXPECT_EQ(RETCODE_OK, data->set_int32_values(data->get_member_id_by_name("sequence_field"),
+                sample.sequence_value));
+        EXPECT_EQ(RETCODE_OK, data->set_float32_value(data->get_member_id_by_name("float_field"),
+                sample.float_value));
+
+        for (auto data_representation : {XCDR_DATA_REPRESENTATION, XCDR2_DATA_REPRESENTATION})
+        {
+            auto data_size = type_support.calculate_serialized_size(&data, data_representation);
+            auto payload = new IContentFilter::SerializedPayload(data_size);
+            EXPECT_TRUE(type_support.serialize(&data, *payload, data_representation));
+            (XCDR_DATA_REPRESENTATION == data_representation ? xcdr1_values : xcdr2_values).emplace_back(payload);
+        }
+    }
+}
+
+/**
+ * Check the results of a filter on the payload plan samples, and whether they needed to be deserialized.
+ */
+static void check_payload_plan_values(
+        DDSFilterFactory& factory,
+        const std::string& type_name,
+        DynamicPubSubType& type_support,
+        bool expect_plan)
+{
+    static const std::string expression =
+            "float_field > %0 AND (string_field LIKE 'ab%' OR sequence_field[1] < 10) AND int16_field <> 2";
+    static const std::array<bool, 5> results{ false, false, true, false, true };
+
+    StackAllocatedSequence<const char*, 1> params;
+    params.length(1);
+    params[0] = "0.5";
+
+    IContentFilter* filter = nullptr;
+    auto ret = factory.create_content_filter("DDSSQL", type_name.c_str(), &type_support, expression.c_str(),
+                    params, filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+    ASSERT_NE(nullptr, filter);
+    auto filter_expression = static_cast<DDSSQLFilter::DDSFilterExpression*>(filter);
+
+    std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> xcdr1_values;
+    std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> xcdr2_values;
+    add_payload_plan_values(type_support, xcdr1_values, xcdr2_values);
+
+    for (const auto* values : {&xcdr1_values, &xcdr2_values})
+    {
+        ASSERT_EQ(results.size(), values->size());
+        for (size_t i = 0; i < values->size(); ++i)
+        {
+            DDSSQLFilter::DDSFilterExpression::DecodedPayload decoded;
+            EXPECT_EQ(results[i], filter_expression->evaluate(*(*values)[i], decoded)) << "with i = " << i;
+            EXPECT_EQ(!expect_plan, decoded.is_decoded) << "with i = " << i;
+
+            IContentFilter::FilterSampleInfo info;
+            IContentFilter::GUID_t guid;
+            EXPECT_EQ(results[i], filter->evaluate(*(*values)[i], info, guid)) << "with i = " << i;
+        }
+    }
+
+    ret = factory.delete_content_filter("DDSSQL", filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+}
+
+/*
+ * Check that the payloads of a final type are evaluated with the payload plan, for both XCDRv1 and XCDRv2, giving
+ * the same results as the deserialization of the same samples on a mutable type with the same members.
+ */
+TEST_F(DDSSQLFilterValueTests, payload_plan_matches_dynamic_data)
+{
+    DynamicPubSubType final_type_support(create_payload_plan_type("PayloadPlanFinalType", ExtensibilityKind::FINAL));
+    final_type_support.register_type_object_representation();
+    check_payload_plan_values(uut, "PayloadPlanFinalType", final_type_support, true);
+
+    DynamicPubSubType mutable_type_support(create_payload_plan_type("PayloadPlanMutableType",
+            ExtensibilityKind::MUTABLE));
+    mutable_type_support.register_type_object_representation();
+    check_payload_plan_values(uut, "PayloadPlanMutableType", mutable_type_support, false);
+}
+
+/*
+ * Check that the payload plan is not used for the payloads of types it cannot be compiled for.
+ */
+TEST_F(DDSSQLFilterValueTests, payload_plan_rejected)
+{
+    // Appendable types are only supported on XCDRv1
+    IContentFilter* filter = nullptr;
+    auto ret = create_content_filter(uut, "int16_field < 0", {}, &type_support, filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+    ASSERT_NE(nullptr, filter);
+    auto filter_expression = static_cast<DDSSQLFilter::DDSFilterExpression*>(filter);
+
+    DDSSQLFilter::DDSFilterExpression::DecodedPayload decoded;
+    filter_expression->evaluate(*DDSSQLFilterValueGlobalData::values()[0], decoded);
+    EXPECT_FALSE(decoded.is_decoded);
+    filter_expression->evaluate(*DDSSQLFilterValueGlobalData::xcdr2_values()[0], decoded);
+    EXPECT_TRUE(decoded.is_decoded);
+
+    ret = uut.delete_content_filter("DDSSQL", filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+
+    // Mutable types are not supported on any encoding
+    DynamicPubSubType mutable_type_support(create_payload_plan_type("PayloadPlanRejectedType",
+            ExtensibilityKind::MUTABLE));
+    mutable_type_support.register_type_object_representation();
+
+    std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> xcdr1_values;
+    std::vector<std::unique_ptr<IContentFilter::SerializedPayload>> xcdr2_values;
+    add_payload_plan_values(mutable_type_support, xcdr1_values, xcdr2_values);
+
+    StackAllocatedSequence<const char*, 1> params;
+    ret = uut.create_content_filter("DDSSQL", "PayloadPlanRejectedType", &mutable_type_support, "float_field > 0.1",
+                    params, filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+    ASSERT_NE(nullptr, filter);
+    filter_expression = static_cast<DDSSQLFilter::DDSFilterExpression*>(filter);
+
+    for (const auto& value : xcdr1_values)
+    {
+        decoded.reset();
+        EXPECT_TRUE(filter_expression->evaluate(*value, decoded));
+        EXPECT_TRUE(decoded.is_decoded);
+    }
+    for (const auto& value : xcdr2_values)
+    {
+        decoded.reset();
+        EXPECT_TRUE(filter_expression->evaluate(*value, decoded));
+        EXPECT_TRUE(decoded.is_decoded);
+    }
+
+    ret = uut.delete_content_filter("DDSSQL", filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+}
+
 static void add_test_filtered_value_inputs(
         const std::string& test_prefix,
         const std::string& field_name,
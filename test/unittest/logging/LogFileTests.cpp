@@ -14,12 +14,14 @@
 //
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/log/BinaryFileConsumer.hpp>
 #include <fastdds/dds/log/FileConsumer.hpp>
 #include <gtest/gtest.h>
 #include <memory>
 #include <thread>
 #include <chrono>
 #include <sstream>
+#include <fstream>
 
 using namespace eprosima::fastdds::dds;
 using namespace std;
@@ -116,6 +118,57 @@ TEST(LogFileTests, file_consumer_append)
     }
 }
 
+TEST(LogFileTests, binary_file_consumer)
+{
+    // First remove previous executions file
+    std::remove("binary_consumer.blog");
+
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new BinaryFileConsumer("binary_consumer.blog")));
+    Log::SetVerbosity(Log::Info);
+    Log::SetStructuredMode(true);
+
+    vector<unique_ptr<thread>> threads;
+    for (int i = 0; i != 5; i++)
+    {
+        threads.emplace_back(new thread([i]
+                {
+                    EPROSIMA_LOG_WARNING(Multithread, "I'm thread " << i << " of " << 5u << " (" << 0.5 << ")");
+                }));
+    }
+
+    for (auto& thread: threads)
+    {
+        thread->join();
+    }
+
+    // Entries logged out of structured mode are stored as text
+    Log::SetStructuredMode(false);
+    EPROSIMA_LOG_ERROR(TextCategory, "Text message");
+
+    Log::Flush();
+    Log::ClearConsumers(); // Force close file
+
+    std::ifstream ifs("binary_consumer.blog", std::ios::in | std::ios::binary);
+    std::stringstream content;
+    ASSERT_TRUE(BinaryFileConsumer::decode(ifs, content));
+
+    for (int i = 0; i != 5; ++i)
+    {
+        std::string str("[Multithread Warning] I'm thread " + std::to_string(i) + " of 5 (0.5)");
+        std::size_t found = content.str().find(str);
+        ASSERT_TRUE(found != std::string::npos);
+    }
+    ASSERT_TRUE(content.str().find("[TextCategory Error] Text message") != std::string::npos);
+}
+
+TEST(LogFileTests, binary_file_consumer_invalid_input)
+{
+    std::stringstream input("This is not a binary log file");
+    std::stringstream output;
+    ASSERT_FALSE(BinaryFileConsumer::decode(input, output));
+}
+
 int main(
         int argc,
         char** argv)
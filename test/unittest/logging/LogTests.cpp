@@ -24,6 +24,10 @@
 #include <thread>
 #include <chrono>
 #include <sstream>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <vector>
 
 using namespace eprosima::fastdds::dds;
 using namespace std;
@@ -695,6 +699,226 @@ TEST_F(LogTests, thread_config)
     EXPECT_EQ(entries.size(), n_logs);
 }
 
+/*
+ * Check that messages logged on structured mode are formatted as they would have been on the calling thread.
+ */
+TEST_F(LogTests, structured_mode)
+{
+    Log::SetStructuredMode(true);
+    ASSERT_TRUE(Log::GetStructuredMode());
+
+    const std::string text("text");
+    EPROSIMA_LOG_WARNING(Structured, "Value " << 42 << ' ' << -7 << " " << 3.25 << " " << text << " " << true);
+    EPROSIMA_LOG_WARNING(Structured, "Hex " << std::hex << 255 << " " << std::setw(4) << std::setfill('0') << 7);
+
+    auto consumedEntries = HELPER_WaitForEntries(2);
+    ASSERT_EQ(2u, consumedEntries.size());
+
+    std::stringstream expected;
+    expected << "Value " << 42 << ' ' << -7 << " " << 3.25 << " " << text << " " << true;
+    EXPECT_EQ(expected.str(), consumedEntries[0].message);
+    EXPECT_FALSE(consumedEntries[0].arguments.empty());
+    EXPECT_FALSE(consumedEntries[0].timestamp.empty());
+
+    expected.str("");
+    expected << "Hex " << std::hex << 255 << " " << std::setw(4) << std::setfill('0') << 7;
+    EXPECT_EQ(expected.str(), consumedEntries[1].message);
+
+    Log::Reset();
+    EXPECT_FALSE(Log::GetStructuredMode());
+}
+
+/**
+ * Consumer that only reads the binary fields of the entries, counting the times it is flushed.
+ */
+class BinaryLogConsumerMock : public LogConsumer
+{
+public:
+
+    BinaryLogConsumerMock(
+            std::vector<Log::Entry>& entries_reference,
+            std::mutex& mutex_reference,
+            std::atomic<unsigned int>& flushes_reference)
+        : entries_(entries_reference)
+        , mutex_(mutex_reference)
+        , flushes_(flushes_reference)
+    {
+    }
+
+    void Consume(
+            const Log::Entry& entry) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        entries_.push_back(entry);
+    }
+
+    bool RequiresText() const override
+    {
+        return false;
+    }
+
+    void Flush() override
+    {
+        flushes_++;
+    }
+
+protected:
+
+    std::vector<Log::Entry>& entries_;
+    std::mutex& mutex_;
+    std::atomic<unsigned int>& flushes_;
+};
+
+/*
+ * Check that the text of the entries is only formatted when a consumer requires it, and that consumers are flushed
+ * before Log::Flush returns.
+ */
+TEST_F(LogTests, structured_mode_lazy_formatting)
+{
+    std::vector<Log::Entry> entries;
+    std::mutex entries_mutex;
+    std::atomic<unsigned int> flushes(0);
+
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new BinaryLogConsumerMock(entries, entries_mutex, flushes)));
+    Log::SetStructuredMode(true);
+
+    EPROSIMA_LOG_WARNING(Structured, "Value " << 42);
+    Log::Flush();
+
+    {
+        std::lock_guard<std::mutex> guard(entries_mutex);
+        ASSERT_EQ(1u, entries.size());
+        EXPECT_TRUE(entries[0].message.empty());
+        EXPECT_TRUE(entries[0].timestamp.empty());
+        EXPECT_FALSE(entries[0].arguments.empty());
+        EXPECT_NE(0, entries[0].timestamp_ns);
+    }
+    EXPECT_GE(flushes.load(), 1u);
+
+    // Entries are formatted for a consumer requiring text, even when registered after one that does not
+    mockConsumer = new MockConsumer();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(mockConsumer));
+
+    EPROSIMA_LOG_WARNING(Structured, "Value " << 43);
+    auto consumedEntries = HELPER_WaitForEntries(1);
+    ASSERT_EQ(1u, consumedEntries.size());
+    EXPECT_EQ("Value 43", consumedEntries[0].message);
+    EXPECT_FALSE(consumedEntries[0].timestamp.empty());
+}
+
+/**
+ * Consumer that holds the logging thread on the first entry until released, so the log queue can be filled.
+ */
+class GatedLogConsumer : public LogConsumer
+{
+public:
+
+    GatedLogConsumer(
+            std::atomic<unsigned int>& consumed_reference,
+            std::atomic<unsigned int>& dropped_reports_reference,
+            std::atomic<bool>& gate_reference)
+        : logs_consumed_(consumed_reference)
+        , dropped_reports_(dropped_reports_reference)
+        , gate_(gate_reference)
+    {
+    }
+
+    void Consume(
+            const Log::Entry& entry) override
+    {
+        while (!gate_)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (0 == strcmp(entry.context.category, "LOG"))
+        {
+            dropped_reports_++;
+        }
+        else
+        {
+            logs_consumed_++;
+        }
+    }
+
+protected:
+
+    std::atomic<unsigned int>& logs_consumed_;
+    std::atomic<unsigned int>& dropped_reports_;
+    std::atomic<bool>& gate_;
+};
+
+/*
+ * Check that entries logged while the queue is full are discarded and accounted with the DropNewest overflow policy,
+ * and that Log::Reset clears the counter.
+ */
+TEST_F(LogTests, overflow_policy_drop_newest)
+{
+    std::atomic<unsigned int> consumed(0);
+    std::atomic<unsigned int> dropped_reports(0);
+    std::atomic<bool> gate(false);
+
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new GatedLogConsumer(consumed, dropped_reports, gate)));
+    Log::SetOverflowPolicy(Log::DropNewest);
+
+    const uint64_t initial_dropped = Log::GetDroppedEntries();
+    const unsigned int num_entries = 10000;
+    for (unsigned int i = 0; i < num_entries; ++i)
+    {
+        EPROSIMA_LOG_INFO(TEST_OVERFLOW, "Info message " << i);
+    }
+
+    gate = true;
+    Log::Flush();
+
+    const uint64_t dropped = Log::GetDroppedEntries() - initial_dropped;
+    EXPECT_GT(dropped, 0u);
+    EXPECT_EQ(num_entries, consumed + dropped);
+    EXPECT_GE(dropped_reports.load(), 1u);
+
+    Log::Reset();
+    EXPECT_EQ(0u, Log::GetDroppedEntries());
+}
+
+/*
+ * Check that no entries are lost with the default overflow policy, which blocks the callers.
+ */
+TEST_F(LogTests, overflow_policy_block)
+{
+    std::atomic<unsigned int> consumed(0);
+    std::atomic<unsigned int> dropped_reports(0);
+    std::atomic<bool> gate(false);
+
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new GatedLogConsumer(consumed, dropped_reports, gate)));
+    ASSERT_EQ(Log::Block, Log::GetOverflowPolicy());
+
+    const uint64_t initial_dropped = Log::GetDroppedEntries();
+    const unsigned int num_entries = 10000;
+    std::thread producer([&]()
+            {
+                for (unsigned int i = 0; i < num_entries; ++i)
+                {
+                    EPROSIMA_LOG_INFO(TEST_OVERFLOW, "Info message " << i);
+                }
+            });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    gate = true;
+    producer.join();
+    Log::Flush();
+
+    EXPECT_EQ(initial_dropped, Log::GetDroppedEntries());
+    EXPECT_EQ(num_entries, consumed.load());
+    EXPECT_EQ(0u, dropped_reports.load());
+
+    Log::SetOverflowPolicy(Log::DropNewest);
+    Log::Reset();
+    EXPECT_EQ(Log::Block, Log::GetOverflowPolicy());
+}
+
 /**
  * Regression test 22624: when setting thread affinity fails, eprosima log error throws another error,
  * and calls eprosima log error. This causes a looping recursive call for eprosima log error.
@@ -0,0 +1,379 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/common/CacheChange.hpp>
+#include <fastdds/rtps/common/EntityId_t.hpp>
+#include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryParticipantChangeData.hpp>
+#include <rtps/builtin/discovery/database/ShardedMap.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+static GuidPrefix_t make_prefix(
+        uint32_t id)
+{
+    GuidPrefix_t prefix;
+    prefix.value[0] = 0x01;
+    prefix.value[1] = 0x0f;
+    prefix.value[8] = static_cast<octet>(id >> 24);
+    prefix.value[9] = static_cast<octet>(id >> 16);
+    prefix.value[10] = static_cast<octet>(id >> 8);
+    prefix.value[11] = static_cast<octet>(id);
+    return prefix;
+}
+
+TEST(ShardedMapTests, insert_find_erase)
+{
+    ShardedMap<GuidPrefix_t, uint32_t, GuidPrefixHash> map;
+    EXPECT_TRUE(map.empty());
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        auto ret = map.insert({make_prefix(i), i});
+        EXPECT_TRUE(ret.second);
+        EXPECT_EQ(i, ret.first->second);
+    }
+    EXPECT_FALSE(map.insert({make_prefix(7), 0u}).second);
+    EXPECT_EQ(100u, map.size());
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        auto it = map.find(make_prefix(i));
+        ASSERT_NE(map.end(), it);
+        EXPECT_EQ(i, it->second);
+        EXPECT_EQ(1u, map.shard(decltype(map)::shard_of(make_prefix(i))).count(make_prefix(i)));
+    }
+    EXPECT_EQ(map.end(), map.find(make_prefix(100)));
+
+    // Erase the even keys while iterating
+    for (auto it = map.begin(); it != map.end();)
+    {
+        it = (0 == it->second % 2) ? map.erase(it) : std::next(it);
+    }
+    EXPECT_EQ(50u, map.size());
+    for (const auto& element : map)
+    {
+        EXPECT_EQ(1u, element.second % 2);
+    }
+
+    map[make_prefix(200)] = 200;
+    EXPECT_EQ(200u, map.find(make_prefix(200))->second);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.end(), map.begin());
+}
+
+TEST(ShardedMapTests, keys_spread_over_shards)
+{
+    using Map = ShardedMap<GuidPrefix_t, uint32_t, GuidPrefixHash>;
+    std::set<size_t> shards;
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        shards.insert(Map::shard_of(make_prefix(i)));
+    }
+    EXPECT_EQ(Map::num_shards, shards.size());
+
+    // The endpoints of a participant live on the shard of the participant
+    GUID_t guid(make_prefix(3), EntityId_t(0x00000103));
+    EXPECT_EQ(Map::shard_of(make_prefix(3)),
+            (ShardedMap<GUID_t, uint32_t, GuidPrefixOfGuidHash>::shard_of(guid)));
+}
+
+TEST(ShardedMapTests, iteration_order_only_depends_on_keys)
+{
+    ShardedMap<std::string, uint32_t> forward;
+    ShardedMap<std::string, uint32_t> backward;
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        forward.insert({"topic_" + std::to_string(i), i});
+        backward.insert({"topic_" + std::to_string(63 - i), 63 - i});
+    }
+    // Remove and insert again some keys, so the history of both maps differ
+    for (uint32_t i = 0; i < 64; i += 3)
+    {
+        forward.erase(forward.find("topic_" + std::to_string(i)));
+        forward["topic_" + std::to_string(i)] = i;
+    }
+
+    std::vector<std::string> forward_keys;
+    for (const auto& element : forward)
+    {
+        forward_keys.push_back(element.first);
+    }
+    std::vector<std::string> backward_keys;
+    for (const auto& element : backward)
+    {
+        backward_keys.push_back(element.first);
+    }
+    EXPECT_EQ(64u, forward_keys.size());
+    EXPECT_EQ(forward_keys, backward_keys);
+}
+
+/**
+ * Feeds a database with the DATA(p) of a number of local clients and the DATA(w) and DATA(r) of their endpoints,
+ * owning every change it creates.
+ */
+class DiscoveryDataBaseTests : public ::testing::Test
+{
+protected:
+
+    static constexpr uint32_t num_participants = 24;
+    static constexpr uint32_t endpoints_per_participant = 8;
+    static constexpr uint32_t num_topics = 20;
+
+    void TearDown() override
+    {
+        for (auto& db : dbs_)
+        {
+            db->stop_processing_threads();
+            db->disable();
+            db->clear();
+        }
+        dbs_.clear();
+        changes_.clear();
+    }
+
+    DiscoveryDataBase& create_database(
+            uint32_t num_threads)
+    {
+        dbs_.emplace_back(new DiscoveryDataBase(server_prefix_));
+        DiscoveryDataBase& db = *dbs_.back();
+        if (0 < num_threads)
+        {
+            db.init_processing_threads(num_threads, ThreadSettings{}, 0);
+        }
+        return db;
+    }
+
+    CacheChange_t* create_change(
+            const GUID_t& guid,
+            const EntityId_t& writer_id)
+    {
+        changes_.emplace_back(new CacheChange_t());
+        CacheChange_t* change = changes_.back().get();
+        change->kind = ALIVE;
+        change->writerGUID = GUID_t(guid.guidPrefix, writer_id);
+        change->instanceHandle = InstanceHandle_t(guid);
+        change->sequenceNumber = SequenceNumber_t(0, 1);
+        SampleIdentity identity;
+        identity.writer_guid(change->writerGUID);
+        identity.sequence_number(change->sequenceNumber);
+        change->write_params.sample_identity(identity);
+        change->write_params.related_sample_identity(identity);
+        return change;
+    }
+
+    static RemoteLocatorList metatraffic_locators(
+            uint32_t id)
+    {
+        RemoteLocatorList locators(1, 1);
+        Locator_t locator(LOCATOR_KIND_UDPv4, 7410 + id);
+        locators.add_unicast_locator(locator);
+        return locators;
+    }
+
+    void add_participants(
+            DiscoveryDataBase& db,
+            bool reverse)
+    {
+        db.update(create_change(GUID_t(server_prefix_, c_EntityId_RTPSParticipant), c_EntityId_SPDPWriter),
+                DiscoveryParticipantChangeData(metatraffic_locators(0), false, true));
+        for (uint32_t i = 0; i < num_participants; ++i)
+        {
+            uint32_t id = reverse ? num_participants - i : i + 1;
+            db.update(create_change(GUID_t(make_prefix(id), c_EntityId_RTPSParticipant), c_EntityId_SPDPWriter),
+                    DiscoveryParticipantChangeData(metatraffic_locators(id), true, true));
+        }
+        db.swap_data_queues();
+        db.process_pdp_data_queue();
+    }
+
+    void add_endpoints(
+            DiscoveryDataBase& db)
+    {
+        for (uint32_t i = 0; i < num_participants; ++i)
+        {
+            for (uint32_t e = 0; e < endpoints_per_participant; ++e)
+            {
+                std::string topic = "topic_" + std::to_string((i + e) % num_topics);
+                // Alternate writers (kind 0x03) and readers (kind 0x04)
+                bool is_writer = (0 == e % 2);
+                EntityId_t entity_id(((e + 1) << 8) | (is_writer ? 0x03 : 0x04));
+                db.update(create_change(GUID_t(make_prefix(i + 1), entity_id),
+                        is_writer ? c_EntityId_SEDPPubWriter : c_EntityId_SEDPSubWriter), topic);
+            }
+        }
+        db.swap_data_queues();
+    }
+
+    static std::set<GUID_t> guids_of(
+            const std::vector<CacheChange_t*>& changes)
+    {
+        std::set<GUID_t> ret;
+        for (CacheChange_t* change : changes)
+        {
+            ret.insert(iHandle2GUID(change->instanceHandle));
+        }
+        return ret;
+    }
+
+    static std::vector<GUID_t> ordered_guids_of(
+            const std::vector<CacheChange_t*>& changes)
+    {
+        std::vector<GUID_t> ret;
+        for (CacheChange_t* change : changes)
+        {
+            ret.push_back(iHandle2GUID(change->instanceHandle));
+        }
+        return ret;
+    }
+
+    static std::string dump(
+            const DiscoveryDataBase& db)
+    {
+        nlohmann::json j;
+        db.to_json(j);
+        return j.dump();
+    }
+
+    GuidPrefix_t server_prefix_ = make_prefix(0);
+
+    std::vector<std::unique_ptr<DiscoveryDataBase>> dbs_;
+
+    std::vector<std::unique_ptr<CacheChange_t>> changes_;
+};
+
+TEST_F(DiscoveryDataBaseTests, parallel_edp_processing_matches_sequential)
+{
+    DiscoveryDataBase& sequential = create_database(0);
+    DiscoveryDataBase& parallel = create_database(4);
+
+    for (DiscoveryDataBase* db : {&sequential, &parallel})
+    {
+        add_participants(*db, false);
+        add_endpoints(*db);
+        db->process_edp_data_queue();
+    }
+
+    EXPECT_EQ(guids_of(sequential.edp_publications_to_send()), guids_of(parallel.edp_publications_to_send()));
+    EXPECT_EQ(guids_of(sequential.edp_subscriptions_to_send()), guids_of(parallel.edp_subscriptions_to_send()));
+    EXPECT_EQ(guids_of(sequential.changes_to_release()), guids_of(parallel.changes_to_release()));
+    EXPECT_EQ(dump(sequential), dump(parallel));
+
+    // The clients have not acknowledged the DATA(p) of each other, so they are sent before any DATA(w|r)
+    EXPECT_EQ(sequential.process_dirty_topics(), parallel.process_dirty_topics());
+    EXPECT_EQ(num_participants, guids_of(sequential.pdp_to_send()).size());
+    EXPECT_EQ(ordered_guids_of(sequential.pdp_to_send()), ordered_guids_of(parallel.pdp_to_send()));
+    EXPECT_EQ(dump(sequential), dump(parallel));
+}
+
+TEST_F(DiscoveryDataBaseTests, iteration_does_not_depend_on_arrival_order)
+{
+    DiscoveryDataBase& forward = create_database(0);
+    DiscoveryDataBase& backward = create_database(0);
+    add_participants(forward, false);
+    add_participants(backward, true);
+
+    std::vector<GuidPrefix_t> forward_participants = forward.direct_clients_and_servers();
+    EXPECT_EQ(num_participants, forward_participants.size());
+    EXPECT_EQ(forward_participants, backward.direct_clients_and_servers());
+}
+
+TEST_F(DiscoveryDataBaseTests, queries_while_processing_in_parallel)
+{
+    DiscoveryDataBase& sequential = create_database(0);
+    DiscoveryDataBase& parallel = create_database(4);
+    add_participants(sequential, false);
+    add_participants(parallel, false);
+
+    std::vector<CacheChange_t*> writer_changes;
+    for (uint32_t i = 0; i < num_participants; ++i)
+    {
+        writer_changes.push_back(create_change(GUID_t(make_prefix(i + 1), EntityId_t(0x00000103)),
+                c_EntityId_SEDPPubWriter));
+    }
+
+    // Query the database from another thread, as the writers and the listeners do
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> queries{0};
+    std::thread querier([&]()
+            {
+                while (!stop)
+                {
+                    for (uint32_t i = 0; i < num_participants; ++i)
+                    {
+                        GUID_t reader_guid(make_prefix((i + 1) % num_participants + 1), c_EntityId_SEDPPubReader);
+                        parallel.pdp_is_relevant(*writer_changes[i], reader_guid);
+                        parallel.edp_publications_is_relevant(*writer_changes[i], reader_guid);
+                        parallel.edp_subscriptions_is_relevant(*writer_changes[i], reader_guid);
+                        EXPECT_TRUE(parallel.is_participant_local(make_prefix(i + 1)));
+                        EXPECT_EQ(1u, parallel.participant_metatraffic_locators(make_prefix(i + 1)).size());
+                    }
+                    EXPECT_EQ(num_participants, parallel.direct_clients_and_servers().size());
+                    ++queries;
+                }
+            });
+
+    // Several rounds, so the later ones find the endpoints already known
+    for (uint32_t round = 0; round < 10; ++round)
+    {
+        for (DiscoveryDataBase* db : {&sequential, &parallel})
+        {
+            add_endpoints(*db);
+            db->process_edp_data_queue();
+            db->process_dirty_topics();
+        }
+    }
+
+    while (0 == queries)
+    {
+        std::this_thread::yield();
+    }
+    stop = true;
+    querier.join();
+
+    EXPECT_EQ(ordered_guids_of(sequential.pdp_to_send()), ordered_guids_of(parallel.pdp_to_send()));
+    EXPECT_EQ(guids_of(sequential.changes_to_release()), guids_of(parallel.changes_to_release()));
+    EXPECT_EQ(dump(sequential), dump(parallel));
+}
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
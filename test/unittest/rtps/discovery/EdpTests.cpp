@@ -267,6 +267,59 @@ TEST_F(EdpTests, CheckPartitionCompatibility)
     check_expectations(true);
 }
 
+TEST_F(EdpTests, CheckPartitionWildcardCompatibility)
+{
+    // Wildcards on the reader side
+    wdata->partition.push_back("Sensors/Front");
+    rdata->partition.push_back("Sensors/*");
+    check_expectations(true);
+    rdata->partition.clear();
+    rdata->partition.push_back("Sensors/Fron?");
+    check_expectations(true);
+    rdata->partition.clear();
+    rdata->partition.push_back("Sensors/*/Front");
+    check_expectations(false);
+
+    // Wildcards on both sides match if one of them matches the other one as a string
+    wdata->partition.clear();
+    wdata->partition.push_back("Sensors/*");
+    rdata->partition.clear();
+    rdata->partition.push_back("Sens*");
+    check_expectations(true);
+    rdata->partition.clear();
+    rdata->partition.push_back("*/Rear");
+    check_expectations(false);
+
+    // Bracket expressions
+    wdata->partition.clear();
+    wdata->partition.push_back("Sensor[0-9]");
+    rdata->partition.clear();
+    rdata->partition.push_back("Sensor7");
+    check_expectations(true);
+    rdata->partition.clear();
+    rdata->partition.push_back("SensorA");
+    check_expectations(false);
+
+    // A wildcard does not match an empty list
+    wdata->partition.clear();
+    rdata->partition.clear();
+    rdata->partition.push_back("*");
+    check_expectations(false);
+
+    // Results do not depend on previous checks of the same partition sets
+    wdata->partition.clear();
+    wdata->partition.push_back("A");
+    wdata->partition.push_back("B*");
+    rdata->partition.clear();
+    rdata->partition.push_back("C");
+    check_expectations(false);
+    rdata->partition.push_back("Bravo");
+    check_expectations(true);
+    rdata->partition.clear();
+    rdata->partition.push_back("C");
+    check_expectations(false);
+}
+
 TEST_F(EdpTests, CheckDurabilityCompatibility)
 {
     std::vector<QosTestingCase<fastdds::dds::DurabilityQosPolicyKind>> testing_cases{
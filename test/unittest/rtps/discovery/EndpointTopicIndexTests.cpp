@@ -0,0 +1,194 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fastcdr/cdr/fixed_size_string.hpp>
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/endpoint/EndpointTopicIndex.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Proxy with the fields used by EndpointTopicIndex, named as in ReaderProxyData and WriterProxyData.
+ */
+struct TestProxyData
+{
+    TestProxyData(
+            const std::string& topic,
+            const std::string& type)
+        : topic_name(topic)
+        , type_name(type)
+    {
+    }
+
+    fastcdr::string_255 topic_name;
+    fastcdr::string_255 type_name;
+};
+
+class EndpointTopicIndexTests : public ::testing::Test
+{
+protected:
+
+    //! Proxies visited by for_each_candidate, sorted by address.
+    std::vector<TestProxyData*> candidates(
+            const std::string& topic_name,
+            const std::string& type_name,
+            bool any_type) const
+    {
+        std::vector<TestProxyData*> result;
+        index_.for_each_candidate(topic_name, type_name, any_type, [&result](TestProxyData* proxy)
+                {
+                    result.push_back(proxy);
+                });
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    static std::vector<TestProxyData*> sorted(
+            std::vector<TestProxyData*> proxies)
+    {
+        std::sort(proxies.begin(), proxies.end());
+        return proxies;
+    }
+
+    EndpointTopicIndex<TestProxyData> index_;
+};
+
+/*
+ * Check that only the proxies with the same type are candidates when the endpoint has no type information, and that
+ * all the proxies on the topic are when it has.
+ */
+TEST_F(EndpointTopicIndexTests, for_each_candidate_with_and_without_type_info)
+{
+    TestProxyData a("topic", "type_a");
+    TestProxyData b("topic", "type_a");
+    TestProxyData c("topic", "type_b");
+    TestProxyData d("other_topic", "type_a");
+    index_.update(&a);
+    index_.update(&b);
+    index_.update(&c);
+    index_.update(&d);
+    EXPECT_EQ(4u, index_.size());
+
+    EXPECT_EQ(sorted({&a, &b}), candidates("topic", "type_a", false));
+    EXPECT_EQ(sorted({&c}), candidates("topic", "type_b", false));
+    EXPECT_TRUE(candidates("topic", "type_c", false).empty());
+
+    EXPECT_EQ(sorted({&a, &b, &c}), candidates("topic", "type_a", true));
+    EXPECT_EQ(sorted({&a, &b, &c}), candidates("topic", "type_c", true));
+    EXPECT_EQ(sorted({&d}), candidates("other_topic", "type_b", true));
+
+    EXPECT_TRUE(candidates("unknown_topic", "type_a", false).empty());
+    EXPECT_TRUE(candidates("unknown_topic", "type_a", true).empty());
+}
+
+/*
+ * Check that updating a proxy whose topic or type changed moves it to its new bucket, and that updating it again
+ * without changes does not index it twice.
+ */
+TEST_F(EndpointTopicIndexTests, update_moves_proxy)
+{
+    TestProxyData a("topic", "type_a");
+    TestProxyData b("topic", "type_a");
+    index_.update(&a);
+    index_.update(&b);
+
+    // Same topic and type
+    index_.update(&a);
+    EXPECT_EQ(2u, index_.size());
+    EXPECT_EQ(sorted({&a, &b}), candidates("topic", "type_a", false));
+
+    // Type change
+    a.type_name = "type_b";
+    index_.update(&a);
+    EXPECT_EQ(2u, index_.size());
+    EXPECT_EQ(sorted({&b}), candidates("topic", "type_a", false));
+    EXPECT_EQ(sorted({&a}), candidates("topic", "type_b", false));
+    EXPECT_EQ(sorted({&a, &b}), candidates("topic", "type_a", true));
+
+    // Topic change
+    a.topic_name = "other_topic";
+    index_.update(&a);
+    EXPECT_EQ(2u, index_.size());
+    EXPECT_TRUE(candidates("topic", "type_b", false).empty());
+    EXPECT_EQ(sorted({&b}), candidates("topic", "type_a", true));
+    EXPECT_EQ(sorted({&a}), candidates("other_topic", "type_b", false));
+
+    // Both change, back to the bucket of the other proxy
+    a.topic_name = "topic";
+    a.type_name = "type_a";
+    index_.update(&a);
+    EXPECT_EQ(2u, index_.size());
+    EXPECT_TRUE(candidates("other_topic", "type_b", true).empty());
+    EXPECT_EQ(sorted({&a, &b}), candidates("topic", "type_a", false));
+}
+
+/*
+ * Check that removing proxies, even after their contents changed, only removes them, and that removing a proxy not in
+ * the index has no effect.
+ */
+TEST_F(EndpointTopicIndexTests, remove)
+{
+    TestProxyData a("topic", "type_a");
+    TestProxyData b("topic", "type_a");
+    TestProxyData c("topic", "type_b");
+    TestProxyData not_indexed("topic", "type_a");
+    index_.update(&a);
+    index_.update(&b);
+    index_.update(&c);
+
+    index_.remove(&not_indexed);
+    EXPECT_EQ(3u, index_.size());
+
+    // Removal uses the location where the proxy was indexed, not its current contents
+    a.topic_name = "other_topic";
+    index_.remove(&a);
+    EXPECT_EQ(2u, index_.size());
+    EXPECT_EQ(sorted({&b}), candidates("topic", "type_a", false));
+    EXPECT_EQ(sorted({&b, &c}), candidates("topic", "type_a", true));
+
+    index_.remove(&a);
+    EXPECT_EQ(2u, index_.size());
+
+    index_.remove(&c);
+    index_.remove(&b);
+    EXPECT_EQ(0u, index_.size());
+    EXPECT_TRUE(candidates("topic", "type_a", true).empty());
+
+    // The proxies can be indexed again
+    index_.update(&a);
+    EXPECT_EQ(sorted({&a}), candidates("other_topic", "type_a", false));
+
+    index_.clear();
+    EXPECT_EQ(0u, index_.size());
+    EXPECT_TRUE(candidates("other_topic", "type_a", true).empty());
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -115,6 +115,16 @@ TEST(FlowControllerFactory, register_flow_controllers)
                     FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
     ASSERT_TRUE(nullptr != async_reserv_flow);
 
+    const char* async_drr = "AsyncFlowControllerDeficitRoundRobin";
+    flow_controller_descr.name = async_drr;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_drr, writer_attributes);
+    FlowControllerImpl<FlowControllerAsyncPublishMode,
+            FlowControllerDeficitRoundRobinSchedule>* async_drr_flow = dynamic_cast<FlowControllerImpl<FlowControllerAsyncPublishMode,
+                    FlowControllerDeficitRoundRobinSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_drr_flow);
+
     flow_controller_descr.max_bytes_per_period = 1;
     flow_controller_descr.period_ms = 1;
 
@@ -158,6 +168,79 @@ TEST(FlowControllerFactory, register_flow_controllers)
             FlowControllerPriorityWithReservationSchedule>* async_limited_reserv_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                     FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
     ASSERT_TRUE(nullptr != async_limited_reserv_flow);
+
+    const char* async_limited_drr = "AsyncLimitedFlowControllerDeficitRoundRobin";
+    flow_controller_descr.name = async_limited_drr;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_limited_drr, writer_attributes);
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+            FlowControllerDeficitRoundRobinSchedule>* async_limited_drr_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                    FlowControllerDeficitRoundRobinSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_limited_drr_flow);
+
+    // Token bucket requires both the depth and the refill rate.
+    flow_controller_descr.token_bucket_depth = 1;
+
+    const char* token_bucket_wrong = "TokenBucketFlowControllerWrong";
+    flow_controller_descr.name = token_bucket_wrong;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::FIFO;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_wrong, writer_attributes);
+    ASSERT_TRUE(nullptr == flow_controller);
+
+    flow_controller_descr.token_bucket_refill_rate = 1;
+
+    // TokenBucketFlowController with Fifo scheduler
+    const char* token_bucket_fifo = "TokenBucketFlowControllerFifo";
+    flow_controller_descr.name = token_bucket_fifo;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::FIFO;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_fifo, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerFifoSchedule>* token_bucket_fifo_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerFifoSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_fifo_flow);
+
+    const char* token_bucket_robin = "TokenBucketFlowControllerRobin";
+    flow_controller_descr.name = token_bucket_robin;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::ROUND_ROBIN;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_robin, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerRoundRobinSchedule>* token_bucket_robin_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerRoundRobinSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_robin_flow);
+
+    const char* token_bucket_high = "TokenBucketFlowControllerHigh";
+    flow_controller_descr.name = token_bucket_high;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::HIGH_PRIORITY;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_high, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerHighPrioritySchedule>* token_bucket_high_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerHighPrioritySchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_high_flow);
+
+    const char* token_bucket_reserv = "TokenBucketFlowControllerReservation";
+    flow_controller_descr.name = token_bucket_reserv;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_reserv, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerPriorityWithReservationSchedule>* token_bucket_reserv_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_reserv_flow);
+
+    const char* token_bucket_drr = "TokenBucketFlowControllerDeficitRoundRobin";
+    flow_controller_descr.name = token_bucket_drr;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(token_bucket_drr, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerDeficitRoundRobinSchedule>* token_bucket_drr_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerDeficitRoundRobinSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != token_bucket_drr_flow);
 }
 
 int main(
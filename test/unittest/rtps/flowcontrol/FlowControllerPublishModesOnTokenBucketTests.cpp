@@ -0,0 +1,138 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlowControllerPublishModesTests.hpp"
+
+#include <thread>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using namespace testing;
+
+struct FlowControllerTokenBucketPublishModeMock : FlowControllerTokenBucketPublishMode
+{
+    FlowControllerTokenBucketPublishModeMock(
+            RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerTokenBucketPublishMode(participant, descriptor)
+    {
+        group_mock = &group;
+    }
+
+    static RTPSMessageGroup* get_group()
+    {
+        return group_mock;
+    }
+
+    static RTPSMessageGroup* group_mock;
+};
+RTPSMessageGroup* FlowControllerTokenBucketPublishModeMock::group_mock = nullptr;
+
+TYPED_TEST(FlowControllerPublishModes, token_bucket_publish_mode)
+{
+    // A whole bucket is refilled every 10ms.
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.token_bucket_depth = 10200;
+    flow_controller_descr.token_bucket_refill_rate = 1020000;
+    FlowControllerImpl<FlowControllerTokenBucketPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+    EXPECT_EQ(10200u, async.get_max_payload());
+
+    // Instantiate writers.
+    BaseWriter writer1;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        CacheChange_t* change,
+        RTPSMessageGroup&,
+        LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->last_thread_delivering_sample = std::this_thread::get_id();
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+
+    EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(),
+            get_current_bytes_processed()).WillRepeatedly(ReturnPointee(&this->current_bytes_processed));
+    EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                this->current_bytes_processed = 0;
+            });
+
+    CacheChange_t change_writer1;
+    INIT_CACHE_CHANGE(change_writer1, writer1, 1);
+
+    // Testing add_new_sample. Writer will be able to deliver it.
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer1, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(1);
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    // Testing add_old_sample. The first delivery exceeds the available tokens.
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer1, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(Return(DeliveryRetCode::EXCEEDED_LIMIT)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_old_sample(&writer1, &change_writer1));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(1);
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    // Send 10 samples using add_new_sample. Only one of them fits on the bucket, so the rest are paced.
+    std::vector<CacheChange_t> changes(10);
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        INIT_CACHE_CHANGE(changes[i], writer1, i + 1);
+        EXPECT_CALL(writer1,
+                deliver_sample_nts(&changes[i], _, Ref(writer1.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    writer1.getMutex().lock();
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(10);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    // At least 89800 bytes had to be refilled at 1020000 bytes per second.
+    EXPECT_LE(std::chrono::milliseconds(80), elapsed);
+
+    async.unregister_writer(&writer1);
+}
@@ -2556,6 +2556,133 @@ TEST_F(FlowControllerSchedulers, PriorityWithReservation)
     async.unregister_writer(&writer10);
 }
 
+TEST_F(FlowControllerSchedulers, DeficitRoundRobin)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 102000;
+    flow_controller_descr.period_ms = 10;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock,
+            FlowControllerDeficitRoundRobinSchedule> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+
+    // Instantiate writers. Quantums are 1500 bytes for writer1 and writer3, and 3000 bytes for writer2.
+    Property weight_property;
+    weight_property.name("fastdds.sfc.weight");
+    BaseWriter writer1;
+    BaseWriter writer2;
+    weight_property.value("2");
+    writer2.m_att.endpoint.properties.properties().push_back(weight_property);
+    BaseWriter writer3;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        CacheChange_t* change,
+        RTPSMessageGroup&,
+        LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+    async.register_writer(&writer3);
+
+    CacheChange_t change_writer1_1;
+    CacheChange_t change_writer1_2;
+    CacheChange_t change_writer1_3;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    INIT_CACHE_CHANGE(change_writer1_3, writer1, 3);
+    change_writer1_1.serializedPayload.length = 3000;
+    change_writer1_2.serializedPayload.length = 3000;
+    change_writer1_3.serializedPayload.length = 3000;
+    CacheChange_t change_writer2_1;
+    CacheChange_t change_writer2_2;
+    CacheChange_t change_writer2_3;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    INIT_CACHE_CHANGE(change_writer2_3, writer2, 3);
+    change_writer2_1.serializedPayload.length = 3000;
+    change_writer2_2.serializedPayload.length = 3000;
+    change_writer2_3.serializedPayload.length = 3000;
+    CacheChange_t change_writer3_1;
+    CacheChange_t change_writer3_2;
+    CacheChange_t change_writer3_3;
+    INIT_CACHE_CHANGE(change_writer3_1, writer3, 1);
+    INIT_CACHE_CHANGE(change_writer3_2, writer3, 2);
+    INIT_CACHE_CHANGE(change_writer3_3, writer3, 3);
+    change_writer3_1.serializedPayload.length = 1000;
+    change_writer3_2.serializedPayload.length = 1000;
+    change_writer3_3.serializedPayload.length = 1000;
+
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            get_current_bytes_processed()).WillRepeatedly(
+        ReturnPointee(&this->current_bytes_processed));
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                this->current_bytes_processed = 0;
+            });
+    EXPECT_CALL(writer1, deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).Times(3).
+            WillRepeatedly(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer2, deliver_sample_nts(_, _, Ref(writer2.async_locator_selector_), _)).Times(3).
+            WillRepeatedly(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer3, deliver_sample_nts(_, _, Ref(writer3.async_locator_selector_), _)).Times(3).
+            WillRepeatedly(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer2.getMutex().unlock();
+    writer3.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer3.getMutex().unlock();
+
+    // The sender thread is started once all the samples are queued, so the order only depends on the scheduler.
+    async.init();
+    this->wait_changes_was_delivered(9);
+
+    // Each writer sends while its deficit covers the size of its next change. A writer with a bigger weight sends
+    // more bytes per round, and small changes are not delayed behind the big ones.
+    std::vector<CacheChange_t*> expected_order {
+        &change_writer2_1, &change_writer3_1, &change_writer1_1,
+        &change_writer2_2, &change_writer3_2, &change_writer3_3,
+        &change_writer2_3, &change_writer1_2, &change_writer1_3
+    };
+    EXPECT_EQ(expected_order, this->changes_delivered);
+    this->changes_delivered.clear();
+    this->current_bytes_processed = 0;
+
+    // Unregister writers.
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+    async.unregister_writer(&writer3);
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
@@ -17,7 +17,9 @@
 #include <rtps/history/TopicPayloadPool.hpp>
 #include <fastdds/rtps/common/CacheChange.hpp>
 
+#include <thread>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastdds::rtps;
 using namespace ::testing;
@@ -483,6 +485,65 @@ TEST(TopicPayloalPoolTests, dynamic_reusable_memory_zero_size)
     do_dynamic_topic_payload_pool_zero_size_test(config);
 }
 
+//! Payloads kept on the thread caches are shared by all threads and the pool limits are kept
+TEST(TopicPayloalPoolTests, thread_caches_concurrent_get_release)
+{
+    constexpr uint32_t num_payloads = 64u;
+    constexpr size_t num_threads = 8u;
+    constexpr size_t num_iterations = 1000u;
+
+    PoolConfig config{ PREALLOCATED_MEMORY_MODE, 128, num_payloads, num_payloads};
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&pool]()
+                {
+                    std::vector<SerializedPayload_t> payloads(num_payloads / num_threads);
+                    for (size_t i = 0; i < num_iterations; ++i)
+                    {
+                        for (SerializedPayload_t& payload : payloads)
+                        {
+                            ASSERT_TRUE(pool->get_payload(128, payload));
+                        }
+                        for (SerializedPayload_t& payload : payloads)
+                        {
+                            ASSERT_TRUE(pool->release_payload(payload));
+                        }
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Payloads cached by a thread are taken by the others before the pool is exhausted
+    SerializedPayload_t payloads[num_payloads];
+    for (SerializedPayload_t& payload : payloads)
+    {
+        ASSERT_TRUE(pool->get_payload(128, payload));
+    }
+    SerializedPayload_t extra_payload;
+    EXPECT_FALSE(pool->get_payload(128, extra_payload));
+    EXPECT_EQ(pool->payload_pool_available_size(), 0u);
+    for (SerializedPayload_t& payload : payloads)
+    {
+        ASSERT_TRUE(pool->release_payload(payload));
+    }
+
+    EXPECT_EQ(pool->payload_pool_allocated_size(), num_payloads);
+    EXPECT_EQ(pool->payload_pool_available_size(), num_payloads);
+
+    TopicPayloadPool::CacheStatistics statistics = static_cast<TopicPayloadPool*>(pool.get())->cache_statistics();
+    EXPECT_GT(statistics.hits, statistics.misses);
+
+    EXPECT_TRUE(pool->release_history(config, false));
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 0u);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <climits>
 #include <sstream>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -481,6 +483,180 @@ TEST_F(PersistenceTest, Reader)
     ASSERT_EQ(seq_map_loaded, seq_map);
 }
 
+/*!
+ * @fn TEST_F(PersistenceTest, WriteBehind)
+ * @brief This test checks that the write-behind mode commits the queued operations when the batch is full, before
+ * loading from storage and when the service is destroyed.
+ */
+TEST_F(PersistenceTest, WriteBehind)
+{
+    using testing::_;
+
+    const std::string persist_guid("TEST_WRITER");
+    const std::string reader_persist_guid("TEST_READER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.write_behind", "true");
+    // Only a full batch, a load or the destruction of the service should write to the database
+    policy.properties().emplace_back("dds.persistence.sqlite3.flush_interval_ms", "3600000");
+    policy.properties().emplace_back("dds.persistence.sqlite3.max_batch_size", "4");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto count_stored_changes = [this]()
+            {
+                int count = -1;
+                sqlite3* db = nullptr;
+                sqlite3_stmt* stmt = nullptr;
+                if (SQLITE_OK == sqlite3_open_v2(dbfile.c_str(), &db, SQLITE_OPEN_READONLY, 0) &&
+                        SQLITE_OK == sqlite3_prepare_v2(db, "SELECT COUNT(*) FROM writers_histories;", -1, &stmt,
+                        NULL) &&
+                        SQLITE_ROW == sqlite3_step(stmt))
+                {
+                    count = sqlite3_column_int(stmt, 0);
+                }
+                sqlite3_finalize(stmt);
+                sqlite3_close(db);
+                return count;
+            };
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    auto create_change = [&pool](uint32_t, ChangeKind_t, InstanceHandle_t)
+            {
+                CacheChange_t* ch = nullptr;
+                return pool->reserve_cache(ch) ? ch : nullptr;
+            };
+    EXPECT_CALL(history, create_change(_, _, _))
+            .Times(testing::AnyNumber())
+            .WillRepeatedly(testing::Invoke(create_change));
+
+    // Operations are queued until the batch is full
+    for (uint32_t seq = 1; seq <= 3; ++seq)
+    {
+        change.sequenceNumber.low = seq;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+    EXPECT_EQ(count_stored_changes(), 0);
+
+    // Fourth operation fills the batch, which is committed by the background thread
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (count_stored_changes() != 2 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(count_stored_changes(), 2);
+
+    // Loading writes the operations still queued
+    change.sequenceNumber.low = 4;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 3u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 4u));
+    uint32_t i = 1;
+    for (auto it : history.m_changes)
+    {
+        ++i;
+        ASSERT_EQ(it->sequenceNumber, SequenceNumber_t(0, i));
+    }
+
+    // Reader updates are queued as well
+    IPersistenceService::map_allocator_t map_pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(map_pool);
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid, SequenceNumber_t(0, 10u)));
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid, SequenceNumber_t(0, 20u)));
+    ASSERT_TRUE(service->load_reader_from_storage(reader_persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded.size(), 1u);
+    ASSERT_EQ(seq_map_loaded[guid], SequenceNumber_t(0, 20u));
+
+    // Destroying the service writes the operations still queued
+    change.sequenceNumber.low = 2;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    delete service;
+    service = nullptr;
+    EXPECT_EQ(count_stored_changes(), 2);
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, WriteBehindBackpressure)
+ * @brief This test checks that the write-behind queue does not grow over its maximum size, making the callers wait
+ * until the queued operations are written.
+ */
+TEST_F(PersistenceTest, WriteBehindBackpressure)
+{
+    using testing::_;
+
+    const std::string persist_guid("TEST_WRITER");
+    const uint32_t num_changes = 20;
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.write_behind", "true");
+    // Neither the flush interval nor the batch size should trigger a write
+    policy.properties().emplace_back("dds.persistence.sqlite3.flush_interval_ms", "3600000");
+    policy.properties().emplace_back("dds.persistence.sqlite3.max_batch_size", "1000");
+    // Room for a single change
+    policy.properties().emplace_back("dds.persistence.sqlite3.max_pending_bytes", "1");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, num_changes, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    auto create_change = [&pool](uint32_t, ChangeKind_t, InstanceHandle_t)
+            {
+                CacheChange_t* ch = nullptr;
+                return pool->reserve_cache(ch) ? ch : nullptr;
+            };
+    EXPECT_CALL(history, create_change(_, _, _))
+            .Times(testing::AnyNumber())
+            .WillRepeatedly(testing::Invoke(create_change));
+
+    // Every change waits for the previous one to be written
+    for (uint32_t seq = 1; seq <= num_changes; ++seq)
+    {
+        change.sequenceNumber.low = seq;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, max_seq));
+    ASSERT_EQ(history.m_changes.size(), num_changes);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, num_changes));
+}
+
 int main(
         int argc,
         char** argv)
@@ -37,6 +37,8 @@
 #include <fastdds/rtps/writer/RTPSWriter.hpp>
 
 #include <rtps/builtin/data/WriterProxyData.hpp>
+#include <rtps/participant/RTPSParticipantImpl.hpp>
+#include <rtps/RTPSDomainImpl.hpp>
 
 #ifdef FASTDDS_STATISTICS
 
@@ -112,6 +114,78 @@ TEST(StatefulReaderTests, RTPSCorrectGAPProcessing)
     RTPSDomain::removeRTPSReader(reader);
 }
 
+/* Check the readers report which participants they may accept messages from, which is used to dispatch messages not
+ * directed to a specific reader.
+ */
+TEST(StatefulReaderTests, MayAcceptMessagesFromMatchedParticipants)
+{
+    RTPSParticipantAttributes part_attrs;
+    RTPSParticipant* part = RTPSDomain::createParticipant(0, false, part_attrs, nullptr);
+
+    HistoryAttributes hatt{};
+    ReaderHistory reader_history(hatt);
+    WriterHistory writer_history(hatt);
+
+    ReaderAttributes reader_att{};
+    reader_att.endpoint.endpointKind = READER;
+    reader_att.endpoint.reliabilityKind = RELIABLE;
+    reader_att.endpoint.durabilityKind = TRANSIENT_LOCAL;
+
+    RTPSReader* reader = RTPSDomain::createRTPSReader(part, reader_att, &reader_history, nullptr);
+    StatefulReader* uut = dynamic_cast<StatefulReader*>(reader);
+    ASSERT_NE(uut, nullptr);
+
+    WriterAttributes writer_att{};
+    writer_att.endpoint.endpointKind = WRITER;
+    writer_att.endpoint.reliabilityKind = RELIABLE;
+    writer_att.endpoint.durabilityKind = TRANSIENT_LOCAL;
+
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(part, writer_att, &writer_history, nullptr);
+    ASSERT_NE(writer, nullptr);
+
+    GuidPrefix_t writer_prefix = writer->getGuid().guidPrefix;
+    GuidPrefix_t other_prefix = writer_prefix;
+    other_prefix.value[11] ^= 0xFF;
+
+    // Nothing matched yet
+    EXPECT_FALSE(uut->may_accept_messages_from(writer_prefix));
+    EXPECT_FALSE(uut->may_accept_messages_from(other_prefix));
+
+    // The matching generation is kept by each participant
+    RTPSParticipant* other_part = RTPSDomain::createParticipant(0, false, part_attrs, nullptr);
+    ASSERT_NE(other_part, nullptr);
+    RTPSParticipantImpl* part_impl = RTPSDomainImpl::find_local_participant(part->getGuid());
+    RTPSParticipantImpl* other_part_impl = RTPSDomainImpl::find_local_participant(other_part->getGuid());
+    ASSERT_NE(part_impl, nullptr);
+    ASSERT_NE(other_part_impl, nullptr);
+    uint64_t other_generation = other_part_impl->reader_matching_generation();
+
+    // Matching the writer changes the generation and makes its participant interesting
+    uint64_t generation = part_impl->reader_matching_generation();
+    TopicDescription topic_desc;
+    topic_desc.type_name = "string";
+    topic_desc.topic_name = "topic";
+    part->register_reader(reader, topic_desc, fastdds::dds::ReaderQos());
+    part->register_writer(writer, topic_desc, fastdds::dds::WriterQos());
+    ASSERT_TRUE(uut->matched_writer_is_matched(writer->getGuid()));
+    EXPECT_NE(generation, part_impl->reader_matching_generation());
+    EXPECT_TRUE(uut->may_accept_messages_from(writer_prefix));
+    EXPECT_FALSE(uut->may_accept_messages_from(other_prefix));
+
+    // Unmatching the writer changes the generation again
+    generation = part_impl->reader_matching_generation();
+    EXPECT_TRUE(uut->matched_writer_remove(writer->getGuid()));
+    EXPECT_NE(generation, part_impl->reader_matching_generation());
+    EXPECT_FALSE(uut->may_accept_messages_from(writer_prefix));
+
+    // Readers of other participants do not invalidate the cache of this one
+    EXPECT_EQ(other_generation, other_part_impl->reader_matching_generation());
+
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSReader(reader);
+    RTPSDomain::removeRTPSParticipant(other_part);
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
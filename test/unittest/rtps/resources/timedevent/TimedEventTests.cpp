@@ -12,12 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <memory>
 #include <random>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <rtps/resources/ResourceEvent.h>
+#include <rtps/resources/TimerWheel.hpp>
 
 #include "mock/MockEvent.h"
 
@@ -29,14 +32,18 @@ public:
     {
         service_ = new eprosima::fastdds::rtps::ResourceEvent();
         service_->init_thread();
+        wheel_service_ = new eprosima::fastdds::rtps::ResourceEvent();
+        wheel_service_->init_thread({}, "event %u", 1, true);
     }
 
     void TearDown()
     {
+        delete wheel_service_;
         delete service_;
     }
 
     eprosima::fastdds::rtps::ResourceEvent* service_;
+    eprosima::fastdds::rtps::ResourceEvent* wheel_service_;
 };
 
 TimedEventEnvironment* const env =
@@ -506,6 +513,219 @@ TEST(TimedEvent, Event_UnregisterEventWithinCallbackOfAnotherEvent)
 
 }
 
+/*!
+ * @fn TEST(TimerWheel, ExpirationOrder)
+ * @brief This test checks the timing wheel expires nodes in order, never before their expiration time,
+ * including those scheduled on the higher levels of the wheel and out of its range.
+ */
+TEST(TimerWheel, ExpirationOrder)
+{
+    using eprosima::fastdds::rtps::TimerWheel;
+    using clock = TimerWheel::clock;
+
+    struct Node : public TimerWheel::Node
+    {
+        clock::time_point expiration;
+    };
+
+    const clock::duration resolution = std::chrono::microseconds(100);
+    const clock::time_point origin = clock::now();
+    TimerWheel wheel(resolution, origin);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(clock::time_point::max(), wheel.next_expiration());
+
+    // Delays covering every level of the wheel, and beyond
+    const std::vector<clock::duration> delays = {
+        std::chrono::microseconds(250),
+        std::chrono::milliseconds(20),
+        std::chrono::milliseconds(7),
+        std::chrono::seconds(3),
+        std::chrono::seconds(30),
+        std::chrono::hours(1),
+        std::chrono::hours(24 * 30)
+    };
+    std::vector<Node> nodes(delays.size());
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        nodes[i].expiration = origin + delays[i];
+        wheel.schedule(&nodes[i], nodes[i].expiration);
+        EXPECT_TRUE(nodes[i].is_scheduled());
+    }
+    EXPECT_EQ(nodes.size(), wheel.size());
+
+    // The node of the cancelled 20 ms delay should never expire
+    wheel.cancel(&nodes[1]);
+    EXPECT_FALSE(nodes[1].is_scheduled());
+    EXPECT_EQ(nodes.size() - 1, wheel.size());
+
+    clock::time_point now = origin;
+    clock::time_point last_expiration = origin;
+    size_t expired = 0;
+    while (!wheel.empty())
+    {
+        clock::time_point next = wheel.next_expiration();
+        ASSERT_GT(next, now);
+        now = next;
+        wheel.advance(now);
+
+        while (TimerWheel::Node* node = wheel.pop_expired())
+        {
+            const Node* expired_node = static_cast<const Node*>(node);
+            EXPECT_NE(&nodes[1], expired_node);
+            EXPECT_FALSE(expired_node->is_scheduled());
+            EXPECT_LE(expired_node->expiration, now);
+            EXPECT_LE(now, expired_node->expiration + resolution);
+            EXPECT_LE(last_expiration, expired_node->expiration);
+            last_expiration = expired_node->expiration;
+            ++expired;
+        }
+    }
+
+    EXPECT_EQ(nodes.size() - 1, expired);
+}
+
+/*!
+ * @fn TEST(TimedEventWheel, Event_SuccessEvents)
+ * @brief This test checks the correct behavior of launching events on a service using a timing wheel.
+ */
+TEST(TimedEventWheel, Event_SuccessEvents)
+{
+    MockEvent event(*env->wheel_service_, 100, false);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        event.event().restart_timer();
+        event.wait();
+    }
+
+    int successed = event.successed_.load(std::memory_order_relaxed);
+
+    ASSERT_EQ(successed, 10);
+}
+
+/*!
+ * @fn TEST(TimedEventWheel, Event_CancelEvents)
+ * @brief This test checks the correct behavior of cancelling events on a service using a timing wheel.
+ */
+TEST(TimedEventWheel, Event_CancelEvents)
+{
+    MockEvent event(*env->wheel_service_, 100, false);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        event.event().restart_timer();
+        event.event().cancel_timer();
+        ASSERT_FALSE(event.wait(120));
+    }
+
+    int successed = event.successed_.load(std::memory_order_relaxed);
+
+    ASSERT_EQ(successed, 0);
+}
+
+/*!
+ * @fn TEST(TimedEventWheel, Event_AutoRestart)
+ * @brief This test checks an event is able to restart itself on a service using a timing wheel.
+ */
+TEST(TimedEventWheel, Event_AutoRestart)
+{
+    MockEvent event(*env->wheel_service_, 10, true);
+
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        event.event().restart_timer();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    int successed = event.successed_.load(std::memory_order_relaxed);
+
+    ASSERT_GE(successed, 100);
+}
+
+/*!
+ * @fn TEST(TimedEventWheel, Event_ManyEvents)
+ * @brief This test checks events with different periods are all triggered on a service using a timing wheel,
+ * while some of them are restarted or cancelled.
+ */
+TEST(TimedEventWheel, Event_ManyEvents)
+{
+    std::vector<std::unique_ptr<MockEvent>> events;
+    for (unsigned int i = 0; i < 50; ++i)
+    {
+        events.emplace_back(new MockEvent(*env->wheel_service_, 1 + (i % 10) * 5, false));
+        events.back()->event().restart_timer();
+    }
+
+    for (unsigned int i = 0; i < events.size(); i += 5)
+    {
+        events[i]->event().cancel_timer();
+    }
+
+    for (unsigned int i = 0; i < events.size(); ++i)
+    {
+        if (0 == i % 5)
+        {
+            ASSERT_FALSE(events[i]->wait(100));
+        }
+        else
+        {
+            ASSERT_TRUE(events[i]->wait(1000));
+        }
+    }
+}
+
+/*!
+ * @brief Checks an event can be deleted from its own callback, while asking to be restarted, and the service keeps
+ * triggering other events afterwards.
+ */
+static void delete_event_within_its_own_callback(
+        eprosima::fastdds::rtps::ResourceEvent& service)
+{
+    using TimedEvent = eprosima::fastdds::rtps::TimedEvent;
+
+    std::atomic_bool deleted(false);
+    TimedEvent* event = nullptr;
+    event = new TimedEvent(service, [&]()
+                    {
+                        delete event;
+                        deleted = true;
+                        return true;
+                    }, 10);
+    event->restart_timer();
+
+    for (int i = 0; i < 100 && !deleted; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(deleted);
+
+    MockEvent other_event(service, 10, false);
+    for (int i = 0; i < 5; ++i)
+    {
+        other_event.event().restart_timer();
+        ASSERT_TRUE(other_event.wait(1000));
+    }
+}
+
+/*!
+ * @fn TEST(TimedEvent, Event_DeleteEventWithinItsOwnCallback)
+ * @brief This test checks an event can be deleted from its own callback.
+ */
+TEST(TimedEvent, Event_DeleteEventWithinItsOwnCallback)
+{
+    delete_event_within_its_own_callback(*env->service_);
+}
+
+/*!
+ * @fn TEST(TimedEventWheel, Event_DeleteEventWithinItsOwnCallback)
+ * @brief This test checks an event can be deleted from its own callback on a service using a timing wheel, where
+ * the event has already been removed from the wheel when its callback runs.
+ */
+TEST(TimedEventWheel, Event_DeleteEventWithinItsOwnCallback)
+{
+    delete_event_within_its_own_callback(*env->wheel_service_);
+}
+
 int main(
         int argc,
         char** argv)
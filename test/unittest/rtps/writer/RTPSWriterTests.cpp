@@ -12,14 +12,25 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <asio.hpp>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <fastdds/rtps/builtin/data/SubscriptionBuiltinTopicData.hpp>
 #include <fastdds/rtps/RTPSDomain.hpp>
 #include <fastdds/rtps/participant/RTPSParticipant.hpp>
 #include <fastdds/rtps/writer/RTPSWriter.hpp>
 #include <fastdds/rtps/history/IPayloadPool.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
+#include <fastdds/utils/IPLocator.hpp>
 
 
 namespace eprosima {
@@ -169,6 +180,207 @@ TEST(RTPSWriterTests, WriterWithCustomPayloadPool_DoesNotInitializePool_WhenDyna
     pool_initialization_test(DYNAMIC_REUSABLE_MEMORY_MODE);
 }
 
+/**
+ * Submessages received from a StatefulWriter by a remote reader.
+ */
+struct ReceivedSubmessages
+{
+    //! Sequence numbers of the DATA submessages, in reception order
+    std::vector<int64_t> data;
+    //! Last sequence number and count of the HEARTBEAT submessages, in reception order
+    std::vector<std::pair<int64_t, uint32_t>> heartbeats;
+};
+
+/**
+ * Parse the DATA and HEARTBEAT submessages of a RTPS message, classifying them by their reader entity.
+ */
+static void parse_rtps_message(
+        const octet* buffer,
+        size_t length,
+        std::map<uint32_t, ReceivedSubmessages>& received)
+{
+    constexpr size_t header_size = 20;
+    constexpr size_t submessage_header_size = 4;
+
+    auto read_u32 = [](const octet* data, bool little_endian)
+            {
+                uint32_t value = 0;
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    value |= static_cast<uint32_t>(data[little_endian ? i : 3 - i]) << (8 * i);
+                }
+                return value;
+            };
+    auto read_sequence = [&read_u32](const octet* data, bool little_endian)
+            {
+                return (static_cast<int64_t>(static_cast<int32_t>(read_u32(data, little_endian))) << 32) +
+                       read_u32(data + 4, little_endian);
+            };
+    auto read_entity = [](const octet* data)
+            {
+                return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+                       (static_cast<uint32_t>(data[2]) << 8) | data[3];
+            };
+
+    size_t pos = header_size;
+    while (pos + submessage_header_size <= length)
+    {
+        octet id = buffer[pos];
+        bool little_endian = 0 != (buffer[pos + 1] & 0x01);
+        uint16_t submessage_length = little_endian ?
+                static_cast<uint16_t>(buffer[pos + 2] | (buffer[pos + 3] << 8)) :
+                static_cast<uint16_t>((buffer[pos + 2] << 8) | buffer[pos + 3]);
+        const octet* body = &buffer[pos + submessage_header_size];
+        size_t body_length = 0 == submessage_length ? length - pos - submessage_header_size : submessage_length;
+
+        if (0x15 == id && 20 <= body_length)
+        {
+            received[read_entity(body + 4)].data.push_back(read_sequence(body + 12, little_endian));
+        }
+        else if (0x07 == id && 28 <= body_length)
+        {
+            received[read_entity(body)].heartbeats.emplace_back(read_sequence(body + 16, little_endian),
+                    read_u32(body + 24, little_endian));
+        }
+
+        pos += submessage_header_size + body_length;
+    }
+}
+
+/*
+ * Check that a StatefulWriter sending a separate message to each reader on the writer send pool keeps the order of
+ * the changes and heartbeats sent to each reader, both when sending changes and periodic heartbeats.
+ */
+TEST(RTPSWriterTests, StatefulWriterSendsToReadersInParallel)
+{
+    constexpr size_t num_sockets = 4;
+    constexpr size_t readers_per_socket = 2;
+    constexpr int64_t num_changes = 10;
+
+    // Readers are never acknowledging, so the writer keeps sending periodic heartbeats to all of them
+    asio::io_context io_context;
+    std::vector<std::unique_ptr<asio::ip::udp::socket>> sockets;
+    for (size_t i = 0; i < num_sockets; ++i)
+    {
+        sockets.emplace_back(new asio::ip::udp::socket(io_context,
+                asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), 0)));
+        sockets.back()->non_blocking(true);
+    }
+
+    RTPSParticipantAttributes p_attr;
+    p_attr.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::NONE;
+    p_attr.builtin.use_WriterLivelinessProtocol = false;
+    p_attr.writer_send_threads_number = 2;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, p_attr);
+    ASSERT_NE(participant, nullptr);
+
+    HistoryAttributes h_attr;
+    h_attr.payloadMaxSize = TestDataType::data_size;
+    WriterHistory* history = new WriterHistory(h_attr);
+
+    WriterAttributes w_attr;
+    w_attr.endpoint.reliabilityKind = RELIABLE;
+    w_attr.separate_sending = true;
+    w_attr.times.heartbeat_period = dds::Duration_t(0, 100000000);
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, w_attr, history);
+    ASSERT_NE(writer, nullptr);
+
+    GuidPrefix_t prefix = participant->getGuid().guidPrefix;
+    prefix.value[8] = 1;
+    for (size_t i = 0; i < num_sockets * readers_per_socket; ++i)
+    {
+        SubscriptionBuiltinTopicData rdata;
+        rdata.guid.guidPrefix = prefix;
+        rdata.guid.entityId.value[2] = static_cast<octet>(i + 1);
+        rdata.guid.entityId.value[3] = 0x04;
+        rdata.reliability.kind = dds::RELIABLE_RELIABILITY_QOS;
+
+        Locator_t locator;
+        IPLocator::setIPv4(locator, 127, 0, 0, 1);
+        locator.port = sockets[i % num_sockets]->local_endpoint().port();
+        rdata.remote_locators.add_unicast_locator(locator);
+        ASSERT_TRUE(writer->matched_reader_add(rdata));
+    }
+
+    for (int64_t i = 0; i < num_changes; ++i)
+    {
+        CacheChange_t* ch = history->create_change(TestDataType::data_size, ALIVE);
+        ASSERT_NE(ch, nullptr);
+        memset(ch->serializedPayload.data, 0, TestDataType::data_size);
+        ch->serializedPayload.length = TestDataType::data_size;
+        ASSERT_TRUE(history->add_change(ch));
+    }
+
+    // Wait for all the changes and a periodic heartbeat after them to be received by all the readers
+    std::map<uint32_t, ReceivedSubmessages> received;
+    auto all_received = [&]()
+            {
+                if (num_sockets * readers_per_socket != received.size())
+                {
+                    return false;
+                }
+                for (const auto& reader : received)
+                {
+                    // Periodic heartbeats announce the last change, as readers never acknowledge it
+                    auto announcing_last = std::count_if(reader.second.heartbeats.begin(),
+                                    reader.second.heartbeats.end(),
+                                    [&](const std::pair<int64_t, uint32_t>& heartbeat)
+                                    {
+                                        return num_changes == heartbeat.first;
+                                    });
+                    if (num_changes != static_cast<int64_t>(reader.second.data.size()) || 2 > announcing_last)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+    std::vector<octet> buffer(65536);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!all_received() && std::chrono::steady_clock::now() < deadline)
+    {
+        bool any_received = false;
+        for (auto& socket : sockets)
+        {
+            asio::ip::udp::endpoint sender;
+            asio::error_code ec;
+            size_t length = socket->receive_from(asio::buffer(buffer), sender, 0, ec);
+            if (!ec)
+            {
+                parse_rtps_message(buffer.data(), length, received);
+                any_received = true;
+            }
+        }
+
+        if (!any_received)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSParticipant(participant);
+    delete(history);
+
+    ASSERT_TRUE(all_received());
+    for (const auto& reader : received)
+    {
+        for (int64_t i = 0; i < num_changes; ++i)
+        {
+            EXPECT_EQ(i + 1, reader.second.data[static_cast<size_t>(i)]);
+        }
+
+        const auto& heartbeats = reader.second.heartbeats;
+        for (size_t i = 1; i < heartbeats.size(); ++i)
+        {
+            EXPECT_LT(heartbeats[i - 1].second, heartbeats[i].second);
+            EXPECT_LE(heartbeats[i - 1].first, heartbeats[i].first);
+        }
+        EXPECT_EQ(num_changes, heartbeats.back().first);
+    }
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
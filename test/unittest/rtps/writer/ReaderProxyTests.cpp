@@ -17,6 +17,7 @@
 
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <rtps/messages/RTPSGapBuilder.hpp>
+#include <rtps/writer/ChangeForReaderRing.hpp>
 #include <rtps/writer/ReaderProxy.hpp>
 #include <rtps/writer/StatefulWriter.hpp>
 
@@ -382,6 +383,232 @@ TEST(ReaderProxyTests, has_been_delivered_test)
     expect_result({0, 3}, false, false);
 }
 
+// Test a deep history, with holes due to irrelevant and removed changes, so the collection of changes grows
+TEST(ReaderProxyTests, deep_history_test)
+{
+    StatefulWriter writer_mock;
+    WriterTimes w_times;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(w_times, alloc, &writer_mock);
+
+    constexpr uint32_t NUM_CHANGES = 10000;
+    std::vector<CacheChange_t> changes(NUM_CHANGES);
+    for (uint32_t i = 0; i < NUM_CHANGES; ++i)
+    {
+        changes[i].sequenceNumber = {0, i + 1};
+        // Every seventh change is irrelevant
+        rproxy.add_change(ChangeForReader_t(&changes[i]), 0 != (i + 1) % 7, false);
+    }
+
+    // Remove every fifth change from the middle of the collection
+    for (uint32_t seq = 5; seq <= NUM_CHANGES; seq += 5)
+    {
+        rproxy.change_has_been_removed({0, seq});
+    }
+
+    for (uint32_t seq = 1; seq <= NUM_CHANGES; ++seq)
+    {
+        bool is_hole = (0 == seq % 7) || (0 == seq % 5);
+        ASSERT_EQ(is_hole, rproxy.change_is_acked({0, seq}));
+    }
+
+    // Acknowledge the first half
+    rproxy.acked_changes_set({0, NUM_CHANGES / 2 + 1});
+    EXPECT_EQ(SequenceNumber_t(0, NUM_CHANGES / 2), rproxy.changes_low_mark());
+    for (uint32_t seq = 1; seq <= NUM_CHANGES; ++seq)
+    {
+        bool is_hole = (0 == seq % 7) || (0 == seq % 5);
+        ASSERT_EQ(is_hole || seq <= NUM_CHANGES / 2, rproxy.change_is_acked({0, seq}));
+    }
+
+    // Acknowledge everything
+    rproxy.acked_changes_set({0, NUM_CHANGES + 1});
+    EXPECT_FALSE(rproxy.has_changes());
+    for (uint32_t seq = 1; seq <= NUM_CHANGES; ++seq)
+    {
+        ASSERT_TRUE(rproxy.change_is_acked({0, seq}));
+    }
+}
+
+// Test an unacknowledged oldest change followed by large gaps on the sequence numbers, as happens with keyed
+// KEEP_LAST histories or content filtered changes
+TEST(ReaderProxyTests, unacked_oldest_with_gaps_test)
+{
+    StatefulWriter writer_mock;
+    WriterTimes w_times;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(w_times, alloc, &writer_mock);
+
+    constexpr uint32_t NUM_CHANGES = 100;
+    constexpr uint32_t GAP = 1000000;
+    std::vector<CacheChange_t> changes(NUM_CHANGES);
+    for (uint32_t i = 0; i < NUM_CHANGES; ++i)
+    {
+        changes[i].sequenceNumber = {0, 1 + i * GAP};
+        rproxy.add_change(ChangeForReader_t(&changes[i]), true, false);
+    }
+
+    EXPECT_FALSE(rproxy.change_is_acked({0, 1}));
+    EXPECT_TRUE(rproxy.change_is_acked({0, 2}));
+    EXPECT_FALSE(rproxy.change_is_acked({0, 1 + GAP}));
+    EXPECT_TRUE(rproxy.change_is_acked({0, GAP}));
+    EXPECT_FALSE(rproxy.change_is_acked({0, 1 + (NUM_CHANGES - 1) * GAP}));
+
+    // Acknowledging up to the second change leaves the rest untouched
+    rproxy.acked_changes_set({0, 2 + GAP});
+    EXPECT_TRUE(rproxy.change_is_acked({0, 1}));
+    EXPECT_TRUE(rproxy.change_is_acked({0, 1 + GAP}));
+    EXPECT_FALSE(rproxy.change_is_acked({0, 1 + 2 * GAP}));
+
+    // Removing a change on the middle keeps the others
+    rproxy.change_has_been_removed({0, 1 + 50 * GAP});
+    EXPECT_TRUE(rproxy.change_is_acked({0, 1 + 50 * GAP}));
+    EXPECT_FALSE(rproxy.change_is_acked({0, 1 + 49 * GAP}));
+    EXPECT_FALSE(rproxy.change_is_acked({0, 1 + 51 * GAP}));
+
+    rproxy.acked_changes_set({0, 2 + (NUM_CHANGES - 1) * GAP});
+    EXPECT_FALSE(rproxy.has_changes());
+}
+
+// The capacity of the collection of changes depends on the number of changes, not on the sequence numbers
+TEST(ReaderProxyTests, change_ring_capacity_test)
+{
+    ChangeForReaderRing ring(ResourceLimitedContainerConfig(16u, 64u));
+    size_t initial_capacity = ring.capacity();
+
+    constexpr uint64_t GAP = 1000000000;
+    std::vector<CacheChange_t> changes(32);
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        uint64_t seq = 1 + i * GAP;
+        changes[i].sequenceNumber = {static_cast<int32_t>(seq >> 32), static_cast<uint32_t>(seq)};
+    }
+
+    // Oldest change stays unacknowledged while the rest arrive with large gaps
+    for (size_t i = 0; i < changes.size(); i += 2)
+    {
+        ASSERT_NE(nullptr, ring.push_back(ChangeForReader_t(&changes[i])));
+    }
+    EXPECT_EQ(initial_capacity, ring.capacity());
+
+    // Fill the gaps in the middle
+    for (size_t i = 1; i < changes.size(); i += 2)
+    {
+        ASSERT_NE(nullptr, ring.insert(ChangeForReader_t(&changes[i])));
+    }
+    EXPECT_EQ(changes.size(), ring.size());
+    EXPECT_LE(ring.capacity(), 2 * changes.size());
+
+    for (const CacheChange_t& change : changes)
+    {
+        const ChangeForReader_t* found = ring.find(change.sequenceNumber);
+        ASSERT_NE(nullptr, found);
+        EXPECT_EQ(change.sequenceNumber, found->getSequenceNumber());
+        EXPECT_EQ(nullptr, ring.find(change.sequenceNumber + 1));
+    }
+    EXPECT_EQ(changes[3].sequenceNumber, ring.lower_bound(changes[2].sequenceNumber + 1)->getSequenceNumber());
+    EXPECT_EQ(changes[2].sequenceNumber, ring.previous(changes[3].sequenceNumber)->getSequenceNumber());
+
+    // Remove from the middle, then from the front
+    EXPECT_TRUE(ring.erase(changes[10].sequenceNumber));
+    EXPECT_FALSE(ring.erase(changes[10].sequenceNumber));
+    EXPECT_EQ(nullptr, ring.find(changes[10].sequenceNumber));
+    EXPECT_NE(nullptr, ring.find(changes[11].sequenceNumber));
+    ring.erase_before(changes[20].sequenceNumber);
+    EXPECT_EQ(changes[20].sequenceNumber, ring.front().getSequenceNumber());
+    EXPECT_EQ(changes.back().sequenceNumber, ring.back().getSequenceNumber());
+    EXPECT_EQ(12u, ring.size());
+
+    // The maximum number of changes is honored
+    ChangeForReaderRing limited(ResourceLimitedContainerConfig::fixed_size_configuration(2u));
+    EXPECT_NE(nullptr, limited.push_back(ChangeForReader_t(&changes[0])));
+    EXPECT_NE(nullptr, limited.push_back(ChangeForReader_t(&changes[1])));
+    EXPECT_EQ(nullptr, limited.push_back(ChangeForReader_t(&changes[2])));
+}
+
+// The capacity of the collection of changes never grows past the maximum number of changes
+TEST(ReaderProxyTests, change_ring_maximum_capacity_test)
+{
+    std::vector<CacheChange_t> changes(60);
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        changes[i].sequenceNumber = {0, static_cast<uint32_t>(i + 1)};
+    }
+
+    ChangeForReaderRing small(ResourceLimitedContainerConfig(0u, 5u));
+    EXPECT_EQ(5u, small.capacity());
+
+    ChangeForReaderRing ring(ResourceLimitedContainerConfig(16u, 40u));
+    EXPECT_EQ(16u, ring.capacity());
+    for (size_t i = 0; i < 40; ++i)
+    {
+        ASSERT_NE(nullptr, ring.push_back(ChangeForReader_t(&changes[i])));
+        EXPECT_LE(ring.capacity(), 40u);
+    }
+    EXPECT_EQ(40u, ring.capacity());
+    EXPECT_EQ(nullptr, ring.push_back(ChangeForReader_t(&changes[40])));
+
+    // Wrap around the end of the ring
+    ring.erase_before(changes[30].sequenceNumber);
+    for (size_t i = 40; i < 60; ++i)
+    {
+        ASSERT_NE(nullptr, ring.push_back(ChangeForReader_t(&changes[i])));
+    }
+    EXPECT_EQ(40u, ring.capacity());
+    EXPECT_EQ(30u, ring.size());
+    EXPECT_EQ(changes[30].sequenceNumber, ring.front().getSequenceNumber());
+    EXPECT_EQ(changes[59].sequenceNumber, ring.back().getSequenceNumber());
+    for (size_t i = 30; i < 60; ++i)
+    {
+        const ChangeForReader_t* found = ring.find(changes[i].sequenceNumber);
+        ASSERT_NE(nullptr, found);
+        EXPECT_EQ(changes[i].sequenceNumber, found->getSequenceNumber());
+    }
+
+    // Insert and erase across the end of the ring
+    EXPECT_TRUE(ring.erase(changes[45].sequenceNumber));
+    EXPECT_TRUE(ring.erase(changes[31].sequenceNumber));
+    ASSERT_NE(nullptr, ring.insert(ChangeForReader_t(&changes[31])));
+    ASSERT_NE(nullptr, ring.insert(ChangeForReader_t(&changes[45])));
+    size_t expected = 30;
+    ring.for_each([&](const ChangeForReader_t& change)
+            {
+                EXPECT_EQ(changes[expected++].sequenceNumber, change.getSequenceNumber());
+            });
+    EXPECT_EQ(60u, expected);
+}
+
+// The run of consecutive changes fulfilling a predicate ends at the first gap or change not fulfilling it
+TEST(ReaderProxyTests, change_ring_end_of_run_test)
+{
+    std::vector<CacheChange_t> changes(10);
+    ChangeForReaderRing ring(ResourceLimitedContainerConfig(16u, 16u));
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        changes[i].sequenceNumber = {0, static_cast<uint32_t>(i + 1)};
+        if (6 != i)
+        {
+            ChangeForReader_t change(&changes[i]);
+            change.setStatus(8 == i ? UNACKNOWLEDGED : ACKNOWLEDGED);
+            ASSERT_NE(nullptr, ring.push_back(change));
+        }
+    }
+
+    auto is_acked = [](const ChangeForReader_t& change)
+            {
+                return ACKNOWLEDGED == change.getStatus();
+            };
+
+    // Sequence number 7 is missing, and 9 is not acknowledged
+    EXPECT_EQ(SequenceNumber_t(0, 7), ring.end_of_run(SequenceNumber_t(0, 1), is_acked));
+    EXPECT_EQ(SequenceNumber_t(0, 7), ring.end_of_run(SequenceNumber_t(0, 4), is_acked));
+    EXPECT_EQ(SequenceNumber_t(0, 7), ring.end_of_run(SequenceNumber_t(0, 7), is_acked));
+    EXPECT_EQ(SequenceNumber_t(0, 9), ring.end_of_run(SequenceNumber_t(0, 8), is_acked));
+    EXPECT_EQ(SequenceNumber_t(0, 9), ring.end_of_run(SequenceNumber_t(0, 9), is_acked));
+    EXPECT_EQ(SequenceNumber_t(0, 11), ring.end_of_run(SequenceNumber_t(0, 10), is_acked));
+    EXPECT_EQ(SequenceNumber_t(0, 20), ring.end_of_run(SequenceNumber_t(0, 20), is_acked));
+}
+
 // Test expectations regarding acknack count.
 // Serves as a regression test for redmine issue #20729.
 TEST(ReaderProxyTests, acknack_count)
@@ -642,6 +642,159 @@ TEST_F(CryptographyPluginTest, transform_RTPSMessage)
     access_plugin.return_permissions_handle(&perm_handle, exception);
 }
 
+TEST_F(CryptographyPluginTest, transform_RTPSMessage_parallel_receiver_specific_macs)
+{
+    using namespace eprosima::fastdds::rtps::security;
+
+    SecurityException exception;
+
+    PKIIdentityHandle& i_handle =
+            PKIIdentityHandle::narrow(*auth_plugin.get_identity_handle(exception));
+
+    AccessPermissionsHandle& perm_handle =
+            AccessPermissionsHandle::narrow(*access_plugin.get_permissions_handle(exception));
+
+    eprosima::fastdds::rtps::PropertySeq prop_handle;
+    ParticipantSecurityAttributes part_sec_attr;
+
+    std::shared_ptr<SecretHandle> secret =
+            auth_plugin.get_shared_secret(SharedSecretHandle::nil_handle, exception);
+
+    std::shared_ptr<SharedSecretHandle> shared_secret = std::dynamic_pointer_cast<SharedSecretHandle>(secret);
+
+    part_sec_attr.is_rtps_protected = true;
+    part_sec_attr.plugin_participant_attributes = PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ENCRYPTED |
+            PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ORIGIN_AUTHENTICATED;
+
+    //Fill shared secret with dummy values
+    std::vector<uint8_t> dummy_data, challenge_1, challenge_2;
+    SharedSecret::BinaryData binary_data;
+    challenge_1.resize(32);
+    challenge_2.resize(32);
+
+    RAND_bytes(challenge_1.data(), 32);
+    binary_data.name("Challenge1");
+    binary_data.value(challenge_1);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    RAND_bytes(challenge_2.data(), 32);
+    binary_data.name("Challenge2");
+    binary_data.value(challenge_2);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    dummy_data.resize(32);
+    RAND_bytes(dummy_data.data(), 32);
+    binary_data.name("SharedSecret");
+    binary_data.value(dummy_data);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    //ParticipantA computes its receiver specific MACs on a pool of workers
+    eprosima::fastdds::rtps::PropertySeq prop_handle_A;
+    eprosima::fastdds::rtps::Property mac_threads;
+    mac_threads.name("dds.sec.crypto.mac_threads");
+    mac_threads.value("3");
+    prop_handle_A.push_back(mac_threads);
+
+    std::shared_ptr<ParticipantCryptoHandle> ParticipantA =
+            CryptoPlugin->keyfactory()->register_local_participant(i_handle, perm_handle, prop_handle_A,
+                    part_sec_attr, exception);
+    std::shared_ptr<ParticipantCryptoHandle> ParticipantB =
+            CryptoPlugin->keyfactory()->register_local_participant(i_handle, perm_handle, prop_handle, part_sec_attr,
+                    exception);
+
+    ASSERT_TRUE(ParticipantA && ParticipantB);
+
+    //Register a remote for both Participants
+    std::shared_ptr<ParticipantCryptoHandle> ParticipantA_remote =
+            CryptoPlugin->keyfactory()->register_matched_remote_participant(*ParticipantA, i_handle, perm_handle,
+                    *shared_secret, exception);
+    std::shared_ptr<ParticipantCryptoHandle> ParticipantB_remote =
+            CryptoPlugin->keyfactory()->register_matched_remote_participant(*ParticipantB, i_handle, perm_handle,
+                    *shared_secret, exception);
+
+    //Create CryptoTokens for both Participants
+    ParticipantCryptoTokenSeq ParticipantA_CryptoTokens, ParticipantB_CryptoTokens;
+
+    CryptoPlugin->keyexchange()->create_local_participant_crypto_tokens(ParticipantA_CryptoTokens, *ParticipantA,
+            *ParticipantA_remote, exception);
+    CryptoPlugin->keyexchange()->create_local_participant_crypto_tokens(ParticipantB_CryptoTokens, *ParticipantB,
+            *ParticipantB_remote, exception);
+
+    //Set ParticipantA token into ParticipantB and viceversa
+    CryptoPlugin->keyexchange()->set_remote_participant_crypto_tokens(*ParticipantA, *ParticipantA_remote,
+            ParticipantB_CryptoTokens, exception);
+    CryptoPlugin->keyexchange()->set_remote_participant_crypto_tokens(*ParticipantB, *ParticipantB_remote,
+            ParticipantA_CryptoTokens, exception);
+
+    //Enough receivers for the MACs to be split among the workers, with the intended one in the middle
+    std::vector<std::shared_ptr<ParticipantCryptoHandle>> unintended_remotes;
+    std::vector<std::shared_ptr<ParticipantCryptoHandle>> receivers;
+    for (int i = 0; i < 40; i++)
+    {
+        if (i == 20)
+        {
+            receivers.push_back(ParticipantA_remote);
+        }
+        unintended_remotes.push_back(CryptoPlugin->keyfactory()->register_matched_remote_participant(*ParticipantA,
+                i_handle, perm_handle, *shared_secret, exception));
+        receivers.push_back(unintended_remotes.back());
+    }
+
+    eprosima::fastdds::rtps::CDRMessage_t plain_rtps_message(RTPSMESSAGE_DEFAULT_SIZE);
+    eprosima::fastdds::rtps::CDRMessage_t encoded_rtps_message(RTPSMESSAGE_DEFAULT_SIZE);
+    eprosima::fastdds::rtps::CDRMessage_t decoded_rtps_message(RTPSMESSAGE_DEFAULT_SIZE);
+
+    char message[] = "RPTSMessage"; //Length 11
+    memcpy(plain_rtps_message.buffer, message, 11);
+    plain_rtps_message.length = 11;
+
+    //Run past the end of the first session, so the receiver specific keys are updated by the workers
+    uint32_t encoded_length = 0;
+    for (int i = 0; i < 50; i++)
+    {
+        ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_rtps_message(encoded_rtps_message, plain_rtps_message,
+                *ParticipantA, receivers, exception));
+        if (i == 0)
+        {
+            encoded_length = encoded_rtps_message.length;
+        }
+        //All the receivers get their MAC on every message
+        ASSERT_EQ(encoded_length, encoded_rtps_message.length);
+        encoded_rtps_message.pos = 0;
+        ASSERT_TRUE(CryptoPlugin->cryptotransform()->decode_rtps_message(decoded_rtps_message, encoded_rtps_message,
+                *ParticipantB, *ParticipantB_remote, exception));
+        ASSERT_TRUE(plain_rtps_message.length == decoded_rtps_message.length);
+        ASSERT_TRUE(memcmp(plain_rtps_message.buffer, decoded_rtps_message.buffer, decoded_rtps_message.length) == 0);
+        plain_rtps_message.pos = 0;
+        encoded_rtps_message.pos = 0;
+        encoded_rtps_message.length = 0;
+        decoded_rtps_message.pos = 0;
+        decoded_rtps_message.length = 0;
+    }
+
+    //Send message to unintended participants only
+    receivers.erase(receivers.begin() + 20);
+    ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_rtps_message(encoded_rtps_message, plain_rtps_message,
+            *ParticipantA, receivers, exception));
+    encoded_rtps_message.pos = 0;
+    ASSERT_FALSE(CryptoPlugin->cryptotransform()->decode_rtps_message(decoded_rtps_message, encoded_rtps_message,
+            *ParticipantB, *ParticipantB_remote, exception));
+
+    receivers.clear();
+    for (auto& unintended_remote : unintended_remotes)
+    {
+        CryptoPlugin->keyfactory()->unregister_participant(unintended_remote, exception);
+    }
+    CryptoPlugin->keyfactory()->unregister_participant(ParticipantA, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(ParticipantB, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(ParticipantA_remote, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(ParticipantB_remote, exception);
+
+    auth_plugin.return_identity_handle(&i_handle, exception);
+    auth_plugin.return_sharedsecret_handle(secret, exception);
+    access_plugin.return_permissions_handle(&perm_handle, exception);
+}
+
 TEST_F(CryptographyPluginTest, factory_CreateLocalWriterHandle)
 {
     using namespace eprosima::fastdds::rtps::security;
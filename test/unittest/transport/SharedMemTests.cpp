@@ -359,6 +359,68 @@ TEST_F(SHMRingBuffer, listeners_register_unregister)
     listener2->pop();
 }
 
+TEST_F(SHMRingBuffer, batch_pop)
+{
+    std::vector<MyData> data(buffer_size_ + 2);
+    for (uint32_t i = 0; i < data.size(); i++)
+    {
+        data[i] = {0, i};
+    }
+
+    auto listener1 = ring_buffer_->register_listener();
+    auto listener2 = ring_buffer_->register_listener();
+
+    for (uint32_t i = 0; i < buffer_size_; i++)
+    {
+        ASSERT_TRUE(ring_buffer_->push(data[i]));
+    }
+    ASSERT_TRUE(ring_buffer_->is_buffer_full());
+
+    std::vector<MyData> popped(buffer_size_ + 2);
+    std::unique_ptr<bool[]> was_cell_freed(new bool[buffer_size_ + 2]);
+
+    // Cells are not freed until all the listeners have popped them
+    ASSERT_EQ(listener1->pop(popped.data(), was_cell_freed.get(), buffer_size_ + 2), buffer_size_);
+    for (uint32_t i = 0; i < buffer_size_; i++)
+    {
+        EXPECT_EQ(popped[i].counter, i);
+        EXPECT_FALSE(was_cell_freed[i]);
+    }
+    ASSERT_EQ(listener1->head(), nullptr);
+    ASSERT_TRUE(ring_buffer_->is_buffer_full());
+
+    // A partial pop frees only the popped cells
+    ASSERT_EQ(listener2->pop(popped.data(), was_cell_freed.get(), 2), 2u);
+    EXPECT_EQ(popped[0].counter, 0u);
+    EXPECT_EQ(popped[1].counter, 1u);
+    EXPECT_TRUE(was_cell_freed[0]);
+    EXPECT_TRUE(was_cell_freed[1]);
+
+    ASSERT_TRUE(ring_buffer_->push(data[buffer_size_]));
+    ASSERT_TRUE(ring_buffer_->push(data[buffer_size_ + 1]));
+    ASSERT_TRUE(ring_buffer_->is_buffer_full());
+
+    // The pushed cells are available after the ones not popped yet
+    ASSERT_EQ(listener2->pop(popped.data(), was_cell_freed.get(), buffer_size_ + 2), buffer_size_);
+    for (uint32_t i = 0; i < buffer_size_; i++)
+    {
+        EXPECT_EQ(popped[i].counter, i + 2);
+    }
+    for (uint32_t i = 0; i < buffer_size_ - 2; i++)
+    {
+        EXPECT_TRUE(was_cell_freed[i]);
+    }
+
+    ASSERT_EQ(listener1->pop(popped.data(), was_cell_freed.get(), buffer_size_ + 2), 2u);
+    EXPECT_EQ(popped[0].counter, buffer_size_);
+    EXPECT_EQ(popped[1].counter, buffer_size_ + 1);
+    EXPECT_TRUE(was_cell_freed[0]);
+    EXPECT_TRUE(was_cell_freed[1]);
+
+    ASSERT_TRUE(ring_buffer_->is_buffer_empty());
+    ASSERT_EQ(listener1->pop(popped.data(), was_cell_freed.get(), buffer_size_ + 2), 0u);
+}
+
 TEST_F(SHMCondition, wait_notify)
 {
     SharedMemSegment::condition_variable cv;
@@ -1326,6 +1388,109 @@ TEST_F(SHMTransportTests, empty_cv_mutex_deadlocked_try_push)
     thread_locker.join();
 }
 
+TEST_F(SHMTransportTests, port_batch_pop)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    SharedMemGlobal* shared_mem_global = shared_mem_manager->global_segment();
+
+    constexpr uint32_t num_descriptors = 16;
+
+    shared_mem_global->remove_port(0);
+    auto port = shared_mem_global->open_port(0, num_descriptors, 1000);
+    uint32_t listener_index;
+    auto listener = port->create_listener(&listener_index);
+
+    SharedMemSegment::Id random_id;
+    random_id.generate();
+
+    // Wait in another thread, so it has to be notified
+    std::atomic_bool is_listener_closed(false);
+    std::thread thread_wait([&]
+            {
+                port->wait_pop(*listener, is_listener_closed, listener_index);
+            });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    bool listeners_active = false;
+    for (uint32_t i = 0; i < num_descriptors; i++)
+    {
+        ASSERT_TRUE(port->try_push(SharedMemGlobal::BufferDescriptor(random_id, 0, i), &listeners_active));
+        ASSERT_TRUE(listeners_active);
+    }
+    thread_wait.join();
+
+    std::vector<SharedMemGlobal::BufferDescriptor> popped(num_descriptors);
+    std::unique_ptr<bool[]> was_cell_freed(new bool[num_descriptors]);
+    ASSERT_EQ(port->pop(*listener, popped.data(), was_cell_freed.get(), num_descriptors), num_descriptors);
+    for (uint32_t i = 0; i < num_descriptors; i++)
+    {
+        EXPECT_EQ(popped[i].validity_id, i);
+        EXPECT_TRUE(popped[i].source_segment_id == random_id);
+        EXPECT_TRUE(was_cell_freed[i]);
+    }
+    ASSERT_EQ(listener->head(), nullptr);
+
+    port->unregister_listener(&listener, listener_index);
+}
+
+TEST_F(SHMTransportTests, listener_pops_available_buffers_at_once)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    shared_mem_manager->global_segment()->remove_port(0);
+
+    constexpr uint32_t num_descriptors = 4;
+
+    auto listener = shared_mem_manager->open_port(0, num_descriptors, 1000,
+                    SharedMemGlobal::Port::OpenMode::ReadExclusive)->create_listener();
+    auto port_sender = shared_mem_manager->open_port(0, num_descriptors, 1000, SharedMemGlobal::Port::OpenMode::Write);
+    auto segment = shared_mem_manager->create_segment(1024, num_descriptors * 2 + 1);
+
+    auto push_buffer = [&](uint8_t value)
+            {
+                auto buf = segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+                ASSERT_TRUE(buf != nullptr);
+                *static_cast<uint8_t*>(buf->data()) = value;
+                bool is_port_ok = false;
+                ASSERT_TRUE(port_sender->try_push(buf, is_port_ok));
+                ASSERT_TRUE(is_port_ok);
+            };
+
+    for (uint8_t i = 0; i < num_descriptors; i++)
+    {
+        push_buffer(i);
+    }
+
+    // The port is full
+    {
+        auto buf = segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+        ASSERT_TRUE(buf != nullptr);
+        bool is_port_ok = false;
+        ASSERT_FALSE(port_sender->try_push(buf, is_port_ok));
+        ASSERT_TRUE(is_port_ok);
+    }
+
+    auto buf = listener->pop();
+    ASSERT_TRUE(buf != nullptr);
+    EXPECT_EQ(*static_cast<uint8_t*>(buf->data()), 0u);
+    buf.reset();
+    listener->stop_processing_buffer();
+
+    // All the descriptors were popped from the port by the first pop
+    for (uint8_t i = num_descriptors; i < num_descriptors * 2; i++)
+    {
+        push_buffer(i);
+    }
+
+    for (uint8_t i = 1; i < num_descriptors * 2; i++)
+    {
+        buf = listener->pop();
+        ASSERT_TRUE(buf != nullptr);
+        EXPECT_EQ(*static_cast<uint8_t*>(buf->data()), i);
+        buf.reset();
+        listener->stop_processing_buffer();
+    }
+}
+
 TEST_F(SHMTransportTests, dead_listener_sender_port_recover)
 {
     auto shared_mem_manager = SharedMemManager::create(domain_name);
@@ -810,6 +810,101 @@ TEST_F(TCPv4Tests, send_and_receive_between_secure_ports_client_verifies)
     }
 }
 
+// This test verifies that messages sent through a TLS connection with a send queue are received, and that the
+// statistics of the queue are reported by the transport.
+TEST_F(TCPv4Tests, send_and_receive_between_secure_ports_with_send_queue)
+{
+    using TLSOptions = TCPTransportDescriptor::TLSConfig::TLSOptions;
+    using TLSVerifyMode = TCPTransportDescriptor::TLSConfig::TLSVerifyMode;
+
+    TCPv4TransportDescriptor recvDescriptor;
+    recvDescriptor.add_listener_port(g_default_port);
+    recvDescriptor.apply_security = true;
+    recvDescriptor.tls_config.password = "fastddspwd";
+    recvDescriptor.tls_config.cert_chain_file = "fastdds.crt";
+    recvDescriptor.tls_config.private_key_file = "fastdds.key";
+    recvDescriptor.tls_config.tmp_dh_file = "dh_params.pem";
+    recvDescriptor.tls_config.verify_mode = TLSVerifyMode::VERIFY_PEER;
+    recvDescriptor.tls_config.add_option(TLSOptions::DEFAULT_WORKAROUNDS);
+    recvDescriptor.tls_config.add_option(TLSOptions::SINGLE_DH_USE);
+    recvDescriptor.tls_config.add_option(TLSOptions::NO_SSLV2);
+    recvDescriptor.tls_config.add_option(TLSOptions::NO_COMPRESSION);
+    TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    receiveTransportUnderTest.init();
+
+    TCPv4TransportDescriptor sendDescriptor;
+    sendDescriptor.apply_security = true;
+    sendDescriptor.send_queue_size = 4;
+    sendDescriptor.tls_config.verify_file = "ca.crt";
+    sendDescriptor.tls_config.verify_mode = TLSVerifyMode::VERIFY_PEER;
+    sendDescriptor.tls_config.add_option(TLSOptions::DEFAULT_WORKAROUNDS);
+    sendDescriptor.tls_config.add_option(TLSOptions::SINGLE_DH_USE);
+    sendDescriptor.tls_config.add_option(TLSOptions::NO_SSLV2);
+    sendDescriptor.tls_config.add_option(TLSOptions::NO_COMPRESSION);
+    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendTransportUnderTest.init();
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(inputLocator);
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_TCPv4;
+    IPLocator::setIPv4(outputLocator, 127, 0, 0, 1);
+    outputLocator.port = g_default_port;
+    IPLocator::setLogicalPort(outputLocator, 7410);
+
+    {
+        MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+        MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+        ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+        SendResourceList send_resource_list;
+        ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(send_resource_list, outputLocator));
+        ASSERT_FALSE(send_resource_list.empty());
+        octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+        std::vector<NetworkBuffer> buffer_list;
+        buffer_list.emplace_back(message, 5);
+
+        Semaphore sem;
+        std::function<void()> recCallback = [&]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                    sem.post();
+                };
+
+        msg_recv->setCallback(recCallback);
+
+        bool sent = false;
+        while (!sent)
+        {
+            Locators input_begin(locator_list.begin());
+            Locators input_end(locator_list.end());
+
+            sent = send_resource_list.at(0)->send(buffer_list, 5, &input_begin, &input_end,
+                            (std::chrono::steady_clock::now() + std::chrono::microseconds(100)));
+            if (!sent)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+        sem.wait();
+
+        // The binding messages and the data went through the queue of the only connection
+        std::vector<SendQueueStatistics> stats = sendTransportUnderTest.send_queue_statistics();
+        ASSERT_EQ(stats.size(), 1u);
+        EXPECT_GE(stats[0].enqueued_messages, 2u);
+        EXPECT_EQ(stats[0].dropped_messages, 0u);
+        EXPECT_GE(stats[0].coalesced_writes, 1u);
+        EXPECT_LE(stats[0].max_depth, sendDescriptor.send_queue_size);
+    }
+}
+
 TEST_F(TCPv4Tests, send_and_receive_between_secure_ports_server_verifies)
 {
     eprosima::fastdds::dds::Log::SetVerbosity(eprosima::fastdds::dds::Log::Kind::Info);
@@ -2140,6 +2235,100 @@ TEST_F(TCPv4Tests, non_blocking_send)
 }
 #endif // ifndef _WIN32
 
+// This test verifies that, with a send queue, messages are written in order and coalesced when the peer is slow,
+// and that they are dropped when the queue is full and non_blocking_send is enabled.
+TEST_F(TCPv4Tests, send_queue)
+{
+    uint16_t port = g_default_port;
+    uint32_t queue_size = 4;
+    TCPv4TransportDescriptor senderDescriptor;
+    senderDescriptor.add_listener_port(port);
+    senderDescriptor.send_queue_size = queue_size;
+    MockTCPv4Transport senderTransportUnderTest(senderDescriptor);
+    senderTransportUnderTest.init();
+
+    // Connect a raw socket, so reads on the receiving side are controlled by the test
+    Locator_t serverLoc;
+    serverLoc.kind = LOCATOR_KIND_TCPv4;
+    IPLocator::setIPv4(serverLoc, 127, 0, 0, 1);
+    serverLoc.port = port;
+    IPLocator::setLogicalPort(serverLoc, 7410);
+
+    asio::io_context io_context;
+    asio::ip::tcp::resolver resolver(io_context);
+    auto endpoints = resolver.resolve(
+        IPLocator::ip_to_string(serverLoc),
+        std::to_string(IPLocator::getPhysicalPort(serverLoc)));
+    asio::ip::tcp::socket socket = asio::ip::tcp::socket (io_context);
+    asio::connect(socket, endpoints);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto sender_unbound_channel_resources = senderTransportUnderTest.get_unbound_channel_resources();
+    ASSERT_TRUE(sender_unbound_channel_resources.size() == 1u);
+    auto sender_channel_resource =
+            std::static_pointer_cast<TCPChannelResourceBasic>(
+        sender_unbound_channel_resources[0]);
+
+    // Backpressure: every message is accepted, and they all arrive in order
+    const uint32_t num_messages = 100;
+    asio::error_code ec;
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        octet header[4] = { 'H', 'D', 'R', static_cast<octet>(i) };
+        uint32_t payload = i;
+        std::vector<NetworkBuffer> buffer_list;
+        buffer_list.emplace_back(&payload, static_cast<uint32_t>(sizeof(payload)));
+        size_t bytes_sent = sender_channel_resource->send(header, sizeof(header), buffer_list,
+                        static_cast<uint32_t>(sizeof(payload)), ec);
+        ASSERT_EQ(bytes_sent, sizeof(header) + sizeof(payload));
+    }
+
+    std::vector<octet> received(num_messages * 8u, 0);
+    size_t bytes_read = asio::read(socket, asio::buffer(received), asio::transfer_exactly(received.size()), ec);
+    ASSERT_EQ(bytes_read, received.size());
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        const octet* msg = &received[i * 8u];
+        EXPECT_EQ(msg[3], static_cast<octet>(i));
+        uint32_t payload = 0;
+        memcpy(&payload, &msg[4], sizeof(payload));
+        EXPECT_EQ(payload, i);
+    }
+
+    SendQueueStatistics stats = sender_channel_resource->send_queue_statistics();
+    EXPECT_EQ(stats.enqueued_messages, num_messages);
+    EXPECT_EQ(stats.dropped_messages, 0u);
+    EXPECT_LE(stats.max_depth, queue_size);
+    EXPECT_GE(stats.coalesced_writes, 1u);
+    EXPECT_LE(stats.coalesced_writes, num_messages);
+
+    // Drop: the peer stops reading, so the queue eventually fills up and messages are discarded
+    senderTransportUnderTest.configuration()->non_blocking_send = true;
+    std::vector<octet> message(64u * 1024u, 0);
+    std::vector<NetworkBuffer> buffer_list;
+    buffer_list.emplace_back(message.data(), static_cast<uint32_t>(message.size()));
+    for (uint32_t i = 0; i < 1000 && 0 == sender_channel_resource->send_queue_statistics().dropped_messages; ++i)
+    {
+        size_t bytes_sent = sender_channel_resource->send(nullptr, 0, buffer_list,
+                        static_cast<uint32_t>(message.size()), ec);
+        EXPECT_TRUE(bytes_sent == message.size() || bytes_sent == 0u);
+    }
+    stats = sender_channel_resource->send_queue_statistics();
+    EXPECT_GT(stats.dropped_messages, 0u);
+    EXPECT_LE(stats.max_depth, queue_size);
+
+    // The statistics of the connection are also reported by the transport
+    std::vector<SendQueueStatistics> transport_stats = senderTransportUnderTest.send_queue_statistics();
+    ASSERT_EQ(transport_stats.size(), 1u);
+    EXPECT_EQ(transport_stats[0].enqueued_messages, stats.enqueued_messages);
+    EXPECT_EQ(transport_stats[0].dropped_messages, stats.dropped_messages);
+
+    socket.shutdown(asio::ip::tcp::socket::shutdown_both);
+    socket.cancel();
+    socket.close();
+}
+
 // This test verifies that a server can reconnect to a client after the client has once failed in a
 // openLogicalPort request
 TEST_F(TCPv4Tests, reconnect_after_open_port_failure)
@@ -12,9 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <asio.hpp>
 #include <gtest/gtest.h>
@@ -813,6 +817,319 @@ TEST_F(UDPv4Tests, simple_throughput)
             , std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / (num_samples_per_batch * 1000.0));
 }
 
+TEST_F(UDPv4Tests, send_and_receive_batched_datagrams)
+{
+    const uint32_t num_messages = 10;
+
+    auto batch_descriptor = descriptor;
+    batch_descriptor.datagrams_per_batch = 4;
+
+    UDPv4Transport sub_transport(batch_descriptor);
+    ASSERT_TRUE(sub_transport.init());
+
+    Locator_t first_locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, first_locator);
+    Locator_t second_locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port + 1, second_locator);
+
+    MockReceiverResource first_receiver(sub_transport, first_locator);
+    MockReceiverResource second_receiver(sub_transport, second_locator);
+    ASSERT_TRUE(first_receiver.is_valid());
+    ASSERT_TRUE(second_receiver.is_valid());
+    MockMessageReceiver* first_msg_recv =
+            dynamic_cast<MockMessageReceiver*>(first_receiver.CreateMessageReceiver());
+    MockMessageReceiver* second_msg_recv =
+            dynamic_cast<MockMessageReceiver*>(second_receiver.CreateMessageReceiver());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    std::vector<NetworkBuffer> buffer_list;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        buffer_list.emplace_back(&message[i], 1);
+    }
+
+    Semaphore sem;
+    std::atomic<uint32_t> first_received(0);
+    std::atomic<uint32_t> second_received(0);
+    first_msg_recv->setCallback([&]()
+            {
+                EXPECT_EQ(memcmp(message, first_msg_recv->data, 5), 0);
+                first_received.fetch_add(1);
+                sem.post();
+            });
+    second_msg_recv->setCallback([&]()
+            {
+                EXPECT_EQ(memcmp(message, second_msg_recv->data, 5), 0);
+                second_received.fetch_add(1);
+                sem.post();
+            });
+
+    UDPv4Transport pub_transport(batch_descriptor);
+    ASSERT_TRUE(pub_transport.init());
+
+    eprosima::fastdds::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(pub_transport.OpenOutputChannel(send_resource_list, first_locator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    // Each send reaches both destinations with a single call
+    LocatorList_t locator_list;
+    locator_list.push_back(first_locator);
+    locator_list.push_back(second_locator);
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(buffer_list, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    for (uint32_t i = 0; i < 2 * num_messages; ++i)
+    {
+        sem.wait();
+    }
+    EXPECT_EQ(num_messages, first_received.load());
+    EXPECT_EQ(num_messages, second_received.load());
+}
+
+TEST_F(UDPv4Tests, send_and_receive_with_receive_offload)
+{
+    const uint32_t num_messages = 10;
+
+    auto offload_descriptor = descriptor;
+    offload_descriptor.generic_receive_offload = true;
+
+    UDPv4Transport sub_transport(offload_descriptor);
+    ASSERT_TRUE(sub_transport.init());
+
+    Locator_t sub_locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, sub_locator);
+
+    MockReceiverResource receiver(sub_transport, sub_locator);
+    ASSERT_TRUE(receiver.is_valid());
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    std::vector<NetworkBuffer> buffer_list;
+    buffer_list.emplace_back(message, 5);
+
+    Semaphore sem;
+    msg_recv->setCallback([&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            });
+
+    UDPv4Transport pub_transport(descriptor);
+    ASSERT_TRUE(pub_transport.init());
+
+    eprosima::fastdds::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(pub_transport.OpenOutputChannel(send_resource_list, sub_locator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    LocatorList_t locator_list;
+    locator_list.push_back(sub_locator);
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(buffer_list, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    // Every datagram is delivered on its own, even if the kernel coalesced them
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        sem.wait();
+    }
+}
+
+#if defined(__linux__)
+TEST_F(UDPv4Tests, send_and_receive_with_segmentation_offload)
+{
+    const uint32_t num_segments = 5;
+    const uint32_t segment_size = 8;
+
+    Locator_t sub_locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, sub_locator);
+
+    UDPv4Transport sub_transport(descriptor);
+    ASSERT_TRUE(sub_transport.init());
+
+    MockReceiverResource receiver(sub_transport, sub_locator);
+    ASSERT_TRUE(receiver.is_valid());
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    // Every datagram but the last one is formed by two buffers, and the last one is smaller
+    octet body[6] = { 'S', 'e', 'g', 'm', 'e', 'n' };
+    octet tails[num_segments - 1][2];
+    octet last[5] = { 'H', 'e', 'l', 'l', 'o' };
+    std::vector<NetworkBuffer> buffer_list;
+    for (uint32_t i = 0; i < num_segments - 1; ++i)
+    {
+        tails[i][0] = 't';
+        tails[i][1] = static_cast<octet>('0' + i);
+        buffer_list.emplace_back(body, 6);
+        buffer_list.emplace_back(tails[i], 2);
+    }
+    buffer_list.emplace_back(last, 5);
+    const uint32_t total_bytes = (num_segments - 1) * segment_size + 5;
+
+    std::mutex received_mtx;
+    std::vector<std::string> received;
+    Semaphore sem;
+    msg_recv->setCallback([&]()
+            {
+                std::string datagram(reinterpret_cast<const char*>(msg_recv->data), 5);
+                if (datagram != "Hello")
+                {
+                    datagram.assign(reinterpret_cast<const char*>(msg_recv->data), segment_size);
+                }
+                std::lock_guard<std::mutex> lock(received_mtx);
+                received.push_back(datagram);
+                sem.post();
+            });
+
+    auto offload_descriptor = descriptor;
+    offload_descriptor.generic_segmentation_offload = true;
+    UDPv4Transport pub_transport(offload_descriptor);
+    ASSERT_TRUE(pub_transport.init());
+
+    eprosima::fastdds::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(pub_transport.OpenOutputChannel(send_resource_list, sub_locator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(send_resource_list.at(0)->supports_segments());
+
+    LocatorList_t locator_list;
+    locator_list.push_back(sub_locator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send_segments(buffer_list, total_bytes, segment_size, &locators_begin,
+            &locators_end, (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+
+    // The train is received as the original datagrams, whether the kernel segmented it or not
+    for (uint32_t i = 0; i < num_segments; ++i)
+    {
+        sem.wait();
+    }
+    std::vector<std::string> expected{ "Segment0", "Segment1", "Segment2", "Segment3", "Hello" };
+    std::sort(received.begin(), received.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, received);
+}
+
+#endif // if defined(__linux__)
+
+TEST_F(UDPv4Tests, send_and_receive_with_unicast_receive_threads)
+{
+    const uint32_t num_senders = 8;
+    const uint32_t num_messages = 10;
+
+    auto threads_descriptor = descriptor;
+    threads_descriptor.unicast_receive_threads = 4;
+
+    UDPv4Transport sub_transport(threads_descriptor);
+    ASSERT_TRUE(sub_transport.init());
+
+    Locator_t sub_locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, sub_locator);
+    Locator_t multicast_locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "239.255.1.4", g_default_port, multicast_locator);
+
+#if defined(__linux__)
+    EXPECT_EQ(4u, sub_transport.max_concurrent_receptions(sub_locator));
+#else
+    EXPECT_EQ(1u, sub_transport.max_concurrent_receptions(sub_locator));
+#endif // if defined(__linux__)
+    EXPECT_EQ(1u, sub_transport.max_concurrent_receptions(multicast_locator));
+
+    MockReceiverResource receiver(sub_transport, sub_locator);
+    ASSERT_TRUE(receiver.is_valid());
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    // Another transport sharing its unicast ports cannot open a port already in use
+    UDPv4Transport other_transport(threads_descriptor);
+    ASSERT_TRUE(other_transport.init());
+    MockReceiverResource other_receiver(other_transport, sub_locator);
+    EXPECT_FALSE(other_receiver.is_valid());
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    std::vector<NetworkBuffer> buffer_list;
+    buffer_list.emplace_back(message, 5);
+
+    Semaphore sem;
+    msg_recv->setCallback([&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            });
+
+    // Each sender has its own source port, so the datagrams are spread among the sockets sharing the port
+    std::vector<std::unique_ptr<UDPv4Transport>> pub_transports;
+    std::vector<eprosima::fastdds::rtps::SendResourceList> send_resource_lists(num_senders);
+    for (uint32_t i = 0; i < num_senders; ++i)
+    {
+        pub_transports.emplace_back(new UDPv4Transport(descriptor));
+        ASSERT_TRUE(pub_transports.back()->init());
+        ASSERT_TRUE(pub_transports.back()->OpenOutputChannel(send_resource_lists[i], sub_locator));
+        ASSERT_FALSE(send_resource_lists[i].empty());
+    }
+
+    LocatorList_t locator_list;
+    locator_list.push_back(sub_locator);
+    for (uint32_t n = 0; n < num_messages; ++n)
+    {
+        for (uint32_t i = 0; i < num_senders; ++i)
+        {
+            Locators locators_begin(locator_list.begin());
+            Locators locators_end(locator_list.end());
+            EXPECT_TRUE(send_resource_lists[i].at(0)->send(buffer_list, 5, &locators_begin, &locators_end,
+                    (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+        }
+    }
+
+    for (uint32_t i = 0; i < num_senders * num_messages; ++i)
+    {
+        sem.wait();
+    }
+}
+
+TEST_F(UDPv4Tests, unicast_receive_threads_port_contention)
+{
+    const uint32_t num_iterations = 50;
+
+    auto threads_descriptor = descriptor;
+    threads_descriptor.unicast_receive_threads = 4;
+
+    Locator_t locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, locator);
+
+    // Two transports opening the same port at the same time must never both get it
+    for (uint32_t n = 0; n < num_iterations; ++n)
+    {
+        UDPv4Transport first_transport(threads_descriptor);
+        ASSERT_TRUE(first_transport.init());
+        UDPv4Transport second_transport(threads_descriptor);
+        ASSERT_TRUE(second_transport.init());
+
+        std::unique_ptr<MockReceiverResource> first_receiver;
+        std::unique_ptr<MockReceiverResource> second_receiver;
+        std::thread first_thread([&]()
+                {
+                    first_receiver.reset(new MockReceiverResource(first_transport, locator));
+                });
+        std::thread second_thread([&]()
+                {
+                    second_receiver.reset(new MockReceiverResource(second_transport, locator));
+                });
+        first_thread.join();
+        second_thread.join();
+
+        EXPECT_FALSE(first_receiver->is_valid() && second_receiver->is_valid());
+        EXPECT_EQ(first_receiver->is_valid(), first_transport.IsInputChannelOpen(locator));
+        EXPECT_EQ(second_receiver->is_valid(), second_transport.IsInputChannelOpen(locator));
+    }
+}
+
 // Regression test for redmine issue #19587
 TEST_F(UDPv4Tests, double_binding_fails)
 {
@@ -68,6 +68,7 @@ void MockReceiverResource::OnDataReceived(
         const Locator_t&,
         const Locator_t& remote)
 {
+    std::lock_guard<std::mutex> lock(mtx_);
     if (msg_receiver != nullptr)
     {
         CDRMessage_t msg(0);
@@ -78,6 +79,17 @@ void MockReceiverResource::OnDataReceived(
     }
 }
 
+void MockReceiverResource::OnDataBatchReceived(
+        const ReceivedDatagram* datagrams,
+        const uint32_t count,
+        const Locator_t& local)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        OnDataReceived(datagrams[i].data, datagrams[i].size, local, datagrams[i].remote_locator);
+    }
+}
+
 void MockMessageReceiver::setCallback(
         std::function<void()> cb)
 {
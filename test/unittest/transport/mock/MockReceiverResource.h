@@ -16,6 +16,7 @@
 #define MOCK_RECEIVER_STUFF_H
 
 #include <functional>
+#include <mutex>
 
 #include <rtps/messages/MessageReceiver.h>
 #include <rtps/network/ReceiverResource.h>
@@ -40,12 +41,21 @@ public:
             const uint32_t,
             const Locator_t&,
             const Locator_t&) override;
+    virtual void OnDataBatchReceived(
+            const ReceivedDatagram*,
+            const uint32_t,
+            const Locator_t&) override;
     MockReceiverResource(
             eprosima::fastdds::rtps::TransportInterface& transport,
             const Locator_t& locator);
     ~MockReceiverResource();
     MessageReceiver* CreateMessageReceiver() override;
     MockMessageReceiver* msg_receiver;
+
+private:
+
+    //! Serializes the messages delivered by several reception threads
+    std::mutex mtx_;
 };
 
 class MockMessageReceiver : public MessageReceiver
@@ -65,6 +65,12 @@ size_t MockTCPChannelResource::send(
     return 0;
 }
 
+void MockTCPChannelResource::write_queued(
+        const std::vector<asio::const_buffer>&,
+        asio::error_code&)
+{
+}
+
 asio::ip::tcp::endpoint MockTCPChannelResource::remote_endpoint() const
 {
     asio::ip::tcp::endpoint ep;
@@ -83,6 +83,12 @@ public:
 
     void shutdown(
             asio::socket_base::shutdown_type what) override;
+
+protected:
+
+    void write_queued(
+            const std::vector<asio::const_buffer>& buffers,
+            asio::error_code& ec) override;
 };
 
 } // namespace rtps
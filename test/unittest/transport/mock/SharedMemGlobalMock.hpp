@@ -97,7 +97,7 @@ public:
     static void set_port_not_ok(
             SharedMemGlobal::Port& port)
     {
-        port.node_->is_port_ok = false;
+        port.node_->set_flag(SharedMemGlobal::PortNode::PORT_OK_FLAG, false);
     }
 
     static void forze_listener_leak(
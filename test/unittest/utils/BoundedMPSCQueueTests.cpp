@@ -0,0 +1,162 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <utils/collections/BoundedMPSCQueue.hpp>
+
+using namespace eprosima::fastdds;
+
+TEST(BoundedMPSCQueueTests, capacity_is_rounded)
+{
+    BoundedMPSCQueue<int> uut(30);
+    EXPECT_EQ(32u, uut.capacity());
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(0u, uut.pushed());
+    EXPECT_EQ(0u, uut.popped());
+}
+
+TEST(BoundedMPSCQueueTests, fill_and_drain)
+{
+    BoundedMPSCQueue<int> uut(8);
+
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            EXPECT_TRUE(uut.try_push([i](int& value)
+                    {
+                        value = i;
+                    }));
+        }
+
+        // Queue is full, so the functor should not be called
+        bool called = false;
+        EXPECT_FALSE(uut.try_push([&called](int&)
+                {
+                    called = true;
+                }));
+        EXPECT_FALSE(called);
+
+        for (int i = 0; i < 8; ++i)
+        {
+            int read = -1;
+            EXPECT_TRUE(uut.try_pop([&read](int& value)
+                    {
+                        read = value;
+                    }));
+            EXPECT_EQ(i, read);
+        }
+
+        EXPECT_TRUE(uut.empty());
+        EXPECT_FALSE(uut.try_pop([](int&)
+                {
+                }));
+    }
+
+    EXPECT_EQ(24u, uut.pushed());
+    EXPECT_EQ(24u, uut.popped());
+}
+
+TEST(BoundedMPSCQueueTests, elements_are_reused)
+{
+    BoundedMPSCQueue<std::string> uut(2);
+    const std::string long_text(256, 'x');
+
+    ASSERT_TRUE(uut.try_push([&](std::string& value)
+            {
+                value.assign(long_text);
+            }));
+    ASSERT_TRUE(uut.try_pop([](std::string&)
+            {
+            }));
+    ASSERT_TRUE(uut.try_push([](std::string&)
+            {
+            }));
+    ASSERT_TRUE(uut.try_push([&](std::string& value)
+            {
+                // Same slot as the first push
+                EXPECT_EQ(long_text, value);
+                value.assign("short");
+                EXPECT_GE(value.capacity(), long_text.size());
+            }));
+}
+
+TEST(BoundedMPSCQueueTests, multiple_producers)
+{
+    constexpr size_t num_producers = 4;
+    constexpr size_t items_per_producer = 10000;
+
+    BoundedMPSCQueue<std::pair<size_t, size_t>> uut(64);
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < num_producers; ++p)
+    {
+        producers.emplace_back([&uut, p]()
+                {
+                    for (size_t i = 0; i < items_per_producer; ++i)
+                    {
+                        while (!uut.try_push([p, i](std::pair<size_t, size_t>& value)
+                        {
+                            value = {p, i};
+                        }))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+    }
+
+    // Items from the same producer should be received in order
+    std::vector<size_t> next_expected(num_producers, 0);
+    size_t received = 0;
+    while (received < num_producers * items_per_producer)
+    {
+        if (uut.try_pop([&](std::pair<size_t, size_t>& value)
+                {
+                    EXPECT_EQ(next_expected[value.first], value.second);
+                    next_expected[value.first] = value.second + 1;
+                }))
+        {
+            ++received;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE(uut.empty());
+    for (size_t p = 0; p < num_producers; ++p)
+    {
+        EXPECT_EQ(items_per_producer, next_expected[p]);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
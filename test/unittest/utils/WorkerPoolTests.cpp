@@ -0,0 +1,132 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <utils/WorkerPool.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+/*!
+ * @fn TEST(WorkerPool, disabled_pool_runs_inline)
+ * @brief This test checks that a pool without threads runs all the tasks of a job on the calling thread.
+ */
+TEST(WorkerPool, disabled_pool_runs_inline)
+{
+    WorkerPool pool;
+    pool.init_threads(0, ThreadSettings{}, "test.%u.%u", 0);
+    ASSERT_EQ(0u, pool.size());
+
+    std::thread::id caller = std::this_thread::get_id();
+    std::vector<size_t> run_tasks;
+    pool.run(5, [&](size_t task)
+            {
+                EXPECT_EQ(caller, std::this_thread::get_id());
+                run_tasks.push_back(task);
+            });
+
+    ASSERT_EQ(5u, run_tasks.size());
+    for (size_t i = 0; i < run_tasks.size(); ++i)
+    {
+        EXPECT_EQ(i, run_tasks[i]);
+    }
+}
+
+/*!
+ * @fn TEST(WorkerPool, run_all_tasks_once)
+ * @brief This test checks that every task of a job is run exactly once, and that run returns after all of them.
+ */
+TEST(WorkerPool, run_all_tasks_once)
+{
+    WorkerPool pool;
+    pool.init_threads(3, ThreadSettings{}, "test.%u.%u", 0);
+    ASSERT_EQ(3u, pool.size());
+
+    for (size_t num_tasks = 0; num_tasks < 10; ++num_tasks)
+    {
+        for (size_t repetition = 0; repetition < 100; ++repetition)
+        {
+            std::vector<std::atomic<uint32_t>> counters(num_tasks);
+            for (std::atomic<uint32_t>& counter : counters)
+            {
+                counter = 0;
+            }
+
+            pool.run(num_tasks, [&](size_t task)
+                    {
+                        ++counters[task];
+                    });
+
+            for (std::atomic<uint32_t>& counter : counters)
+            {
+                EXPECT_EQ(1u, counter.load());
+            }
+        }
+    }
+
+    pool.stop_threads();
+    EXPECT_EQ(0u, pool.size());
+}
+
+/*!
+ * @fn TEST(WorkerPool, concurrent_jobs)
+ * @brief This test checks that jobs run concurrently from several threads are all completed.
+ */
+TEST(WorkerPool, concurrent_jobs)
+{
+    WorkerPool pool;
+    pool.init_threads(2, ThreadSettings{}, "test.%u.%u", 0);
+
+    const size_t num_callers = 4;
+    const size_t num_jobs = 500;
+    const size_t num_tasks = 4;
+    std::atomic<size_t> total(0);
+
+    std::vector<std::thread> callers;
+    for (size_t i = 0; i < num_callers; ++i)
+    {
+        callers.emplace_back([&]()
+                {
+                    for (size_t job = 0; job < num_jobs; ++job)
+                    {
+                        std::atomic<size_t> job_tasks(0);
+                        pool.run(num_tasks, [&](size_t)
+                        {
+                            ++job_tasks;
+                            ++total;
+                        });
+                        EXPECT_EQ(num_tasks, job_tasks.load());
+                    }
+                });
+    }
+
+    for (std::thread& caller : callers)
+    {
+        caller.join();
+    }
+
+    EXPECT_EQ(num_callers * num_jobs * num_tasks, total.load());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
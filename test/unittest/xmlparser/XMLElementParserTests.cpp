@@ -2203,7 +2203,8 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
         {"FIFO", FlowControllerSchedulerPolicy::FIFO},
         {"ROUND_ROBIN", FlowControllerSchedulerPolicy::ROUND_ROBIN},
         {"HIGH_PRIORITY", FlowControllerSchedulerPolicy::HIGH_PRIORITY},
-        {"PRIORITY_WITH_RESERVATION", FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION}
+        {"PRIORITY_WITH_RESERVATION", FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION},
+        {"DEFICIT_ROUND_ROBIN", FlowControllerSchedulerPolicy::DEFICIT_ROUND_ROBIN}
     };
 
     /* Define the test cases */
@@ -2222,6 +2223,8 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
             "15", "12", "12", "12", "" }, XMLP_ret::XML_OK},
         {{"test_flow_controller", "PRIORITY_WITH_RESERVATION", "2500", "100", \
             "15", "12", "12", "12", "" }, XMLP_ret::XML_OK},
+        {{"test_flow_controller", "DEFICIT_ROUND_ROBIN", "2500", "100", \
+            "15", "12", "12", "12", "" }, XMLP_ret::XML_OK},
         {{"test_flow_controller", "INVALID", "120", "50", \
             "12", "12", "12", "12", "" }, XMLP_ret::XML_ERROR},   // Invalid scheduler
         {{"test_flow_controller", "HIGH_PRIORITY", "120", "-10", \
@@ -2360,6 +2363,72 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList_NegativeClauses)
             ident));
 }
 
+/*
+ * This test checks parsing of the token bucket elements of <flow_controller_descriptor>
+ * 1. Check both values are parsed
+ * 2. Check invalid values and duplicated tags
+ */
+TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList_TokenBucket)
+{
+    uint8_t ident = 1;
+
+    /* Define the test cases */
+    std::vector<std::pair<std::vector<std::string>, XMLP_ret>> test_cases =
+    {
+        /*
+         * token_bucket_depth, token_bucket_refill_rate, extra_xml_tag
+         */
+        {{"1500", "125000000", ""}, XMLP_ret::XML_OK},
+        {{"0", "0", ""}, XMLP_ret::XML_OK},
+        {{"a", "125000000", ""}, XMLP_ret::XML_ERROR},   // not numerical token_bucket_depth
+        {{"1500", "-1", ""}, XMLP_ret::XML_ERROR},   // negative token_bucket_refill_rate
+        {{"1500", "125000000", "<token_bucket_depth>96</token_bucket_depth>"},
+            XMLP_ret::XML_ERROR},   // duplicated token_bucket_depth tag
+        {{"1500", "125000000", "<token_bucket_refill_rate>96</token_bucket_refill_rate>"},
+            XMLP_ret::XML_ERROR},   // duplicated token_bucket_refill_rate tag
+    };
+
+    /* Run the tests */
+    for (auto test_case : test_cases)
+    {
+        std::vector<std::string>& params = test_case.first;
+        XMLP_ret& expectation = test_case.second;
+
+        XMLParserTest::FlowControllerDescriptorList flow_controller_descriptor_list;
+        tinyxml2::XMLDocument xml_doc;
+        tinyxml2::XMLElement* titleElement;
+
+        // Create XML snippet
+        std::string xml =
+                "<flow_controller_descriptor_list>"
+                "   <flow_controller_descriptor>"
+                "       <name>test_flow_controller</name>"
+                "       <token_bucket_depth>" + params[0] + "</token_bucket_depth>"
+                "       <token_bucket_refill_rate>" + params[1] + "</token_bucket_refill_rate>"
+                + params[2] +
+                "   </flow_controller_descriptor>"
+                "</flow_controller_descriptor_list>";
+
+        // Parse the XML snippet
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml.c_str())) << xml;
+
+        // Extract FlowControllersDescriptors
+        titleElement = xml_doc.RootElement();
+        ASSERT_EQ(expectation,
+                XMLParserTest::getXMLFlowControllerDescriptorList_wrapper(titleElement, flow_controller_descriptor_list,
+                ident));
+
+        // Validate in the OK cases
+        if (expectation == XMLP_ret::XML_OK)
+        {
+            ASSERT_EQ(flow_controller_descriptor_list.at(0)->token_bucket_depth,
+                    static_cast<uint32_t>(std::stoul(params[0])));
+            ASSERT_EQ(flow_controller_descriptor_list.at(0)->token_bucket_refill_rate,
+                    static_cast<uint64_t>(std::stoull(params[1])));
+        }
+    }
+}
+
 /*
  * This test checks the negative cases in the xml child element of <TopicAttributes>
  * 1. Check an invalid tag of:
@@ -3809,6 +3878,7 @@ TEST_F(XMLParserTests, getXMLEnum_positive)
  * 7. Correct parsing of a valid <data_sharing> set to AUTO with shared memory directory.
  * 8. Correct parsing of a valid <data_sharing> set to ON with shared memory directory.
  * 9. Correct parsing of a valid <data_sharing> set to OFF with shared memory directory.
+ * 10. Correct parsing of a valid <data_sharing> with a listener spin budget.
  */
 TEST_F(XMLParserTests, getXMLDataSharingQos)
 {
@@ -3952,6 +4022,22 @@ TEST_F(XMLParserTests, getXMLDataSharingQos)
         EXPECT_EQ(datasharing_policy.max_domains(), 0u);
         EXPECT_EQ(datasharing_policy.domain_ids().size(), 0u);
     }
+
+    {
+        const char* xml =
+                "\
+                <data_sharing>\
+                    <kind>ON</kind>\
+                    <listener_spin_budget>50</listener_spin_budget>\
+                </data_sharing>\
+                ";
+
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::propertiesPolicy_wrapper(titleElement, datasharing_policy, ident));
+        EXPECT_EQ(datasharing_policy.kind(), DataSharingKind::ON);
+        EXPECT_EQ(datasharing_policy.listener_spin_budget(), 50u);
+    }
 }
 
 /*
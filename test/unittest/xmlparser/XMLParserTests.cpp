@@ -909,6 +909,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <receiveBufferSize>8192</receiveBufferSize>\
                     <TTL>250</TTL>\
                     <non_blocking_send>false</non_blocking_send>\
+                    <datagrams_per_batch>16</datagrams_per_batch>\
+                    <generic_receive_offload>true</generic_receive_offload>\
+                    <generic_segmentation_offload>true</generic_segmentation_offload>\
+                    <unicast_receive_threads>4</unicast_receive_threads>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                     <interfaceWhiteList>\
@@ -968,7 +972,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     </reception_threads>\
                 </transport_descriptor>\
                 ";
-        constexpr size_t xml_len {3500};
+        constexpr size_t xml_len {4000};
         char xml[xml_len];
 
         // UDPv4
@@ -983,6 +987,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv4Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv4Desc->TTL, 250u);
         EXPECT_EQ(pUDPv4Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv4Desc->datagrams_per_batch, 16u);
+        EXPECT_EQ(pUDPv4Desc->generic_receive_offload, true);
+        EXPECT_EQ(pUDPv4Desc->generic_segmentation_offload, true);
+        EXPECT_EQ(pUDPv4Desc->unicast_receive_threads, 4u);
         EXPECT_EQ(pUDPv4Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv4Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -1012,6 +1020,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv6Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv6Desc->TTL, 250u);
         EXPECT_EQ(pUDPv6Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv6Desc->datagrams_per_batch, 16u);
+        EXPECT_EQ(pUDPv6Desc->generic_receive_offload, true);
+        EXPECT_EQ(pUDPv6Desc->generic_segmentation_offload, true);
+        EXPECT_EQ(pUDPv6Desc->unicast_receive_threads, 4u);
         EXPECT_EQ(pUDPv6Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv6Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv6Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -1073,6 +1085,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <enable_tcp_nodelay>false</enable_tcp_nodelay>\
                     <non_blocking_send>true</non_blocking_send>\
                     <tcp_negotiation_timeout>100</tcp_negotiation_timeout>\
+                    <send_queue_size>64</send_queue_size>\
                     <tls><!-- TLS Section --></tls>\
                     <keep_alive_thread>\
                         <scheduling_policy>12</scheduling_policy>\
@@ -1146,6 +1159,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv4Desc->non_blocking_send, true);
         EXPECT_EQ(pTCPv4Desc->accept_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->tcp_negotiation_timeout, 100u);
+        EXPECT_EQ(pTCPv4Desc->send_queue_size, 64u);
         EXPECT_EQ(pTCPv4Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->get_thread_config_for_port(12346), modified_thread_settings);
@@ -1182,6 +1196,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv6Desc->non_blocking_send, true);
         EXPECT_EQ(pTCPv6Desc->accept_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->tcp_negotiation_timeout, 100u);
+        EXPECT_EQ(pTCPv6Desc->send_queue_size, 64u);
         EXPECT_EQ(pTCPv6Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->get_thread_config_for_port(12346), modified_thread_settings);
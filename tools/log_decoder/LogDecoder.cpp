@@ -0,0 +1,106 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogDecoder.cpp
+ *
+ * Turns the files written by BinaryFileConsumer back into text.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <fastdds/dds/log/BinaryFileConsumer.hpp>
+
+static void print_usage(
+        const char* program)
+{
+    std::cout << "Usage: " << program << " [-t|--thread-ids] <input.blog> [<output.log>]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Decodes a binary log file written by BinaryFileConsumer." << std::endl;
+    std::cout << "The text is written to <output.log>, or to the standard output if not given." << std::endl;
+    std::cout << std::endl;
+    std::cout << "  -t  --thread-ids  Print the identifier of the thread that logged each entry." << std::endl;
+    std::cout << "  -h  --help        Produce help message." << std::endl;
+}
+
+int main(
+        int argc,
+        char* argv[])
+{
+    bool print_thread_ids = false;
+    std::string input_file;
+    std::string output_file;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == std::strcmp(argv[i], "-h") || 0 == std::strcmp(argv[i], "--help"))
+        {
+            print_usage(argv[0]);
+            return 0;
+        }
+        else if (0 == std::strcmp(argv[i], "-t") || 0 == std::strcmp(argv[i], "--thread-ids"))
+        {
+            print_thread_ids = true;
+        }
+        else if (input_file.empty())
+        {
+            input_file = argv[i];
+        }
+        else if (output_file.empty())
+        {
+            output_file = argv[i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (input_file.empty())
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    std::ifstream input(input_file, std::ios::in | std::ios::binary);
+    if (!input.is_open())
+    {
+        std::cerr << "Cannot open input file '" << input_file << "'" << std::endl;
+        return 1;
+    }
+
+    std::ofstream output;
+    if (!output_file.empty())
+    {
+        output.open(output_file, std::ios::out);
+        if (!output.is_open())
+        {
+            std::cerr << "Cannot open output file '" << output_file << "'" << std::endl;
+            return 1;
+        }
+    }
+
+    if (!eprosima::fastdds::dds::BinaryFileConsumer::decode(
+                input, output_file.empty() ? std::cout : output, print_thread_ids))
+    {
+        std::cerr << "Input file '" << input_file << "' is not a valid binary log, or it is truncated" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}